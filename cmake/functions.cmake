@@ -304,7 +304,9 @@ function(generate_build_flags)
     endif()
     set(BUILD_MCAPI ${WOLFSSL_MCAPI} PARENT_SCOPE)
     set(BUILD_ASYNCCRYPT ${WOLFSSL_ASYNCCRYPT} PARENT_SCOPE)
-    set(BUILD_WOLFEVENT ${WOLFSSL_ASYNCCRYPT} PARENT_SCOPE)
+    if(WOLFSSL_ASYNCCRYPT OR WOLFSSL_CRYPT_POOL)
+        set(BUILD_WOLFEVENT "yes" PARENT_SCOPE)
+    endif()
     if(WOLFSSL_CRYPTOCB OR WOLFSSL_USER_SETTINGS)
         set(BUILD_CRYPTOCB "yes" PARENT_SCOPE)
     endif()
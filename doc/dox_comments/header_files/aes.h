@@ -465,6 +465,61 @@ int  wc_AesGcmDecrypt(Aes* aes, byte* out,
                                    const byte* authTag, word32 authTagSz,
                                    const byte* authIn, word32 authInSz);
 
+/*!
+    \ingroup AES
+    \brief This function encrypts a run of records with the same key, as
+    wc_AesGcmEncrypt does for each record. Each wc_AesGcmRecord holds the
+    arguments for one record: out, in, sz, iv, ivSz, authTag, authTagSz,
+    authIn and authInSz, as passed to wc_AesGcmEncrypt. When the CPU has VAES
+    and VPCLMULQDQ, consecutive records with the same length, the same
+    authIn length and 12 byte IVs are encrypted in pairs. Other records are
+    encrypted one at a time. The results are the same as calling
+    wc_AesGcmEncrypt on each record in turn. Records are encrypted in order
+    and encryption stops at the first record that fails.
+
+    \return 0 On successfully encrypting all records
+    \return BAD_FUNC_ARG If aes is NULL, recs is NULL and cnt is not zero, or
+    the arguments of a record are invalid
+
+    \param aes pointer to the AES object used to encrypt data
+    \param recs array of records to encrypt
+    \param cnt number of records in recs
+
+    _Example_
+    \code
+    Aes enc;
+    // initialize Aes structure by calling wc_AesInit() and wc_AesGcmSetKey
+
+    byte plain[2][1024];
+    byte cipher[2][1024];
+    byte iv[2][GCM_NONCE_MID_SZ]; // a different 12 byte IV for each record
+    byte authTag[2][WC_AES_BLOCK_SIZE];
+    byte authIn[2][13]; // Authentication Vector of each record
+    wc_AesGcmRecord recs[2];
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        recs[i].out = cipher[i];
+        recs[i].in = plain[i];
+        recs[i].sz = sizeof(plain[i]);
+        recs[i].iv = iv[i];
+        recs[i].ivSz = sizeof(iv[i]);
+        recs[i].authTag = authTag[i];
+        recs[i].authTagSz = sizeof(authTag[i]);
+        recs[i].authIn = authIn[i];
+        recs[i].authInSz = sizeof(authIn[i]);
+    }
+    if (wc_AesGcmEncryptRecords(&enc, recs, 2) != 0) {
+        // failed to encrypt records
+    }
+    \endcode
+
+    \sa wc_AesGcmSetKey
+    \sa wc_AesGcmEncrypt
+*/
+int wc_AesGcmEncryptRecords(Aes* aes, const wc_AesGcmRecord* recs,
+                            word32 cnt);
+
 /*!
     \ingroup AES
     \brief This function initializes and sets the key for a GMAC object
@@ -97,6 +97,85 @@ int  wc_FreeNetRandom(void);
 */
 int  wc_InitRng(WC_RNG*);
 
+/*!
+    \ingroup Random
+
+    \brief Instantiates rng with a seed generated by an already initialized
+    parent rng. The entropy source is not read and the health test is not run
+    again, making this much cheaper than wc_InitRng_ex. The child reseeds
+    from the entropy source as normal. Calls using the same parent must be
+    serialized by the caller. Free the child with wc_FreeRng.
+
+    \return 0 on success.
+    \return BAD_FUNC_ARG rng or parent is NULL.
+    \return MEMORY_E XMALLOC failed.
+    \return RNG_FAILURE_E parent failed to generate the seed.
+
+    \param rng random number generator to be initialized
+    \param parent initialized random number generator to seed from
+    \param heap heap hint for dynamic memory allocation
+    \param devId device identifier, INVALID_DEVID for software
+
+    _Example_
+    \code
+    WC_RNG parent;
+    WC_RNG child;
+    int ret;
+
+    ret = wc_InitRng(&parent);
+    if (ret == 0) {
+        ret = wc_InitRngChild_ex(&child, &parent, NULL, INVALID_DEVID);
+    }
+    \endcode
+
+    \sa wc_InitRng
+    \sa wc_RNG_GenerateBlock
+    \sa wc_FreeRng
+*/
+int  wc_InitRngChild_ex(WC_RNG* rng, WC_RNG* parent, void* heap, int devId);
+
+/*!
+    \ingroup Random
+
+    \brief Instantiates rng as a CTR_DRBG (SP 800-90A) using AES-256 with a
+    derivation function instead of the SHA-256 Hash_DRBG. Output is the
+    AES-CTR key stream, so AES-NI/VAES is used when available. Requests of
+    up to half of WC_RNG_CTR_DRBG_BUF_SZ bytes (default 256) are served from
+    a buffer of pre-generated output, paying the key and counter update once
+    per buffer. Children created with wc_InitRngChild_ex also use CTR_DRBG.
+    Free with wc_FreeRng. Available when built with WC_RNG_CTR_DRBG
+    (--enable-ctrdrbg), which also makes TLS connections use CTR_DRBG.
+
+    \return 0 on success.
+    \return BAD_FUNC_ARG rng is NULL.
+    \return MEMORY_E XMALLOC failed.
+    \return DRBG_CONT_FIPS_E the known answer test failed.
+    \return RNG_FAILURE_E seeding or instantiation failed.
+
+    \param rng random number generator to be initialized
+    \param heap heap hint for dynamic memory allocation
+    \param devId device identifier, INVALID_DEVID for software
+
+    _Example_
+    \code
+    WC_RNG rng;
+    byte   nonce[32];
+    int    ret;
+
+    ret = wc_InitRngCtrDrbg_ex(&rng, NULL, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_RNG_GenerateBlock(&rng, nonce, sizeof(nonce));
+        wc_FreeRng(&rng);
+    }
+    \endcode
+
+    \sa wc_InitRng_ex
+    \sa wc_InitRngChild_ex
+    \sa wc_RNG_GenerateBlock
+    \sa wc_FreeRng
+*/
+int  wc_InitRngCtrDrbg_ex(WC_RNG* rng, void* heap, int devId);
+
 /*!
     \ingroup Random
 
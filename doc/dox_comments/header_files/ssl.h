@@ -2274,6 +2274,370 @@ int  wolfSSL_read(WOLFSSL* ssl, void* data, int sz);
 */
 int  wolfSSL_peek(WOLFSSL* ssl, void* data, int sz);
 
+/*!
+    \ingroup IO
+
+    \brief This function reads application data like wolfSSL_read() but
+    does not copy it. On success, data is set to the decrypted data of the
+    current record, in place in the SSL session's (ssl) internal receive
+    buffer. The data is not consumed: call wolfSSL_read_release() with the
+    number of bytes used. Until then, further calls to wolfSSL_read_zc(),
+    wolfSSL_read() or wolfSSL_peek() return the same data. The pointer is
+    only valid until the data is released or the next read call.
+
+    \return >0 the number of bytes available at data upon success.
+    \return 0 when the peer closed the connection. Call wolfSSL_get_error()
+    for the specific error code.
+    \return SSL_FATAL_ERROR upon failure or, when using non-blocking sockets,
+    when SSL_ERROR_WANT_READ or SSL_ERROR_WANT_WRITE was received. Use
+    wolfSSL_get_error() to get a specific error code.
+    \return BAD_FUNC_ARG when ssl or data is NULL.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param data set to the decrypted data in the receive buffer.
+
+    _Example_
+    \code
+    WOLFSSL* ssl = 0;
+    const unsigned char* data;
+    int len;
+    ...
+
+    len = wolfSSL_read_zc(ssl, &data);
+    if (len > 0) {
+        // forward “len” bytes at “data”
+        wolfSSL_read_release(ssl, len);
+    }
+    \endcode
+
+    \sa wolfSSL_read_release
+    \sa wolfSSL_read
+*/
+int  wolfSSL_read_zc(WOLFSSL* ssl, const unsigned char** data);
+
+/*!
+    \ingroup IO
+
+    \brief This function consumes data returned by wolfSSL_read_zc(). Fewer
+    bytes than were returned may be released; the rest is returned by the
+    next read call.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ssl is NULL, sz is negative or sz is more than
+    the data available.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param sz number of bytes consumed.
+
+    _Example_
+    \code
+    WOLFSSL* ssl = 0;
+    const unsigned char* data;
+    int len;
+    ...
+
+    len = wolfSSL_read_zc(ssl, &data);
+    if (len > 0) {
+        // forward “len” bytes at “data”
+        wolfSSL_read_release(ssl, len);
+    }
+    \endcode
+
+    \sa wolfSSL_read_zc
+*/
+int  wolfSSL_read_release(WOLFSSL* ssl, int sz);
+
+/*!
+    \ingroup Setup
+
+    \brief This function hands record protection of connections created from
+    the context over to Linux kernel TLS (kTLS) once their handshake is done.
+    See wolfSSL_UseKTLS(). Requires wolfSSL to be built with --enable-ktls.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ctx is NULL or dirs has unknown bits set.
+
+    \param ctx pointer to the SSL context, created with wolfSSL_CTX_new().
+    \param dirs WOLFSSL_KTLS_TX and/or WOLFSSL_KTLS_RX. 0 for none.
+
+    _Example_
+    \code
+    WOLFSSL_CTX* ctx = 0;
+    ...
+    wolfSSL_CTX_UseKTLS(ctx, WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX);
+    \endcode
+
+    \sa wolfSSL_UseKTLS
+    \sa wolfSSL_GetKTLS
+*/
+int wolfSSL_CTX_UseKTLS(WOLFSSL_CTX* ctx, int dirs);
+
+/*!
+    \ingroup Setup
+
+    \brief This function hands record protection of the connection over to
+    Linux kernel TLS (kTLS) once the handshake is done. The traffic keys, IVs
+    and sequence numbers are installed into the socket on the next read or
+    write that finds no record part way through being sent or processed.
+    From then on wolfSSL_write() and wolfSSL_read() send and receive
+    plaintext, and wolfSSL_sendfile() can be used. TLS 1.3 KeyUpdate
+    messages and alerts are still handled by wolfSSL.
+
+    Only TLS 1.2 and TLS 1.3 with AES-GCM or ChaCha20-Poly1305 over the
+    socket set with wolfSSL_set_fd() and the default I/O callbacks are
+    offloaded. TLS 1.3 connections are only offloaded when the kernel can take
+    the keys of a KeyUpdate. This is checked once per process by setting keys
+    twice on a loopback connection. Otherwise, or when the kernel does not
+    support kTLS, the connection stays in software.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ssl is NULL or dirs has unknown bits set.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param dirs WOLFSSL_KTLS_TX and/or WOLFSSL_KTLS_RX. 0 for none.
+
+    _Example_
+    \code
+    WOLFSSL* ssl = 0;
+    ...
+    wolfSSL_UseKTLS(ssl, WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX);
+    if (wolfSSL_accept(ssl) == SSL_SUCCESS) {
+        wolfSSL_write(ssl, hdr, hdrSz);
+        if (wolfSSL_GetKTLS(ssl) & WOLFSSL_KTLS_TX)
+            wolfSSL_sendfile(ssl, fd, 0, fileSz);
+    }
+    \endcode
+
+    \sa wolfSSL_CTX_UseKTLS
+    \sa wolfSSL_GetKTLS
+    \sa wolfSSL_sendfile
+*/
+int wolfSSL_UseKTLS(WOLFSSL* ssl, int dirs);
+
+/*!
+    \ingroup IO
+
+    \brief This function returns the directions in which the kernel
+    protects the records of the connection.
+
+    \return WOLFSSL_KTLS_TX and/or WOLFSSL_KTLS_RX, or 0 for none.
+    \return BAD_FUNC_ARG when ssl is NULL.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+
+    \sa wolfSSL_UseKTLS
+*/
+int wolfSSL_GetKTLS(WOLFSSL* ssl);
+
+/*!
+    \ingroup IO
+
+    \brief This function sends part of a file as application data with
+    sendfile(), without copying it through user space. Requires kTLS send
+    offload to be active - see wolfSSL_UseKTLS().
+
+    \return The number of bytes sent upon success. May be less than count.
+    \return 0 when the connection was closed by the peer.
+    \return SSL_FATAL_ERROR upon failure. Call wolfSSL_get_error() for the
+    reason, e.g. SSL_ERROR_WANT_WRITE on a non-blocking socket.
+    \return BAD_FUNC_ARG when ssl is NULL, fd is negative or offset is
+    negative.
+    \return BAD_STATE_E when kTLS send offload is not active.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param fd descriptor of the file to send.
+    \param offset offset into the file of the data to send.
+    \param count number of bytes to send.
+
+    \sa wolfSSL_UseKTLS
+    \sa wolfSSL_write
+*/
+int wolfSSL_sendfile(WOLFSSL* ssl, int fd, off_t offset, size_t count);
+
+/*!
+    \ingroup IO
+
+    \brief This function turns on read ahead for connections created from
+    the context. See wolfSSL_SetReadAheadSz().
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ctx is NULL or sz is more than
+    WOLFSSL_READ_AHEAD_MAX_SZ.
+
+    \param ctx pointer to the SSL context, created with wolfSSL_CTX_new().
+    \param sz size of the input buffer to fill in bytes. 0 turns read ahead
+    off.
+
+    \sa wolfSSL_SetReadAheadSz
+*/
+int wolfSSL_CTX_SetReadAheadSz(WOLFSSL_CTX* ctx, unsigned int sz);
+
+/*!
+    \ingroup IO
+
+    \brief This function turns on read ahead for the connection. Instead of
+    reading each record header and body separately, every read from the
+    socket asks for as many bytes as fit in an input buffer of sz bytes, so
+    that one call can bring in many records. wolfSSL_read() then decrypts
+    records already read into the caller's buffer until it is full, without
+    reading from the socket again. Read ahead is not used with DTLS.
+    wolfSSL_set_read_ahead() turns read ahead on with a buffer of
+    WOLFSSL_READ_AHEAD_SZ bytes (64 KiB by default).
+
+    Each connection that is reading holds an input buffer of sz bytes
+    instead of one record. The buffer is kept while it holds part of a
+    record and is freed once everything in it has been processed, so the
+    next read allocates it again. wolfSSL_CTX_UseIOPool() keeps freed
+    buffers for reuse.
+
+    Bytes the peer sends after close_notify may be read into the input buffer
+    and so can't be read from the socket afterwards.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ssl is NULL or sz is more than
+    WOLFSSL_READ_AHEAD_MAX_SZ.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param sz size of the input buffer to fill in bytes. 0 turns read ahead
+    off.
+
+    _Example_
+    \code
+    WOLFSSL* ssl;
+    byte buf[65536];
+    ...
+    wolfSSL_SetReadAheadSz(ssl, 65536);
+    ...
+    len = wolfSSL_read(ssl, buf, sizeof(buf));
+    \endcode
+
+    \sa wolfSSL_CTX_SetReadAheadSz
+    \sa wolfSSL_set_read_ahead
+    \sa wolfSSL_read
+*/
+int wolfSSL_SetReadAheadSz(WOLFSSL* ssl, unsigned int sz);
+
+/*!
+    \ingroup IO
+
+    \brief This function turns on dynamic record sizing for connections
+    created from the context. See wolfSSL_SetDynamicRecordSize().
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ctx is NULL, smallSz is more than 16384 or
+    rampSz is too big.
+
+    \param ctx pointer to the SSL context, created with wolfSSL_CTX_new().
+    \param smallSz size of the small records in bytes. 0 turns dynamic record
+    sizing off.
+    \param rampSz number of bytes to send in small records.
+    \param idleSec seconds without writes after which records start small
+    again. 0 for never.
+
+    \sa wolfSSL_SetDynamicRecordSize
+*/
+int wolfSSL_CTX_SetDynamicRecordSize(WOLFSSL_CTX* ctx, unsigned short smallSz,
+    unsigned int rampSz, unsigned int idleSec);
+
+/*!
+    \ingroup IO
+
+    \brief This function turns on dynamic record sizing for the connection.
+    Application data is sent in records of at most smallSz bytes until rampSz
+    bytes have been sent. After that, records are filled up to the maximum
+    fragment size. A small record fits in one TCP segment, so the peer can
+    decrypt it as soon as that segment arrives. This reduces the time to the
+    first byte on new connections, where the TCP congestion window is still
+    small. Sizing starts small again after the connection has had no writes
+    for idleSec seconds, and after each handshake. The maximum fragment size
+    and record size limit negotiated with the peer are still upper bounds.
+    Not used with DTLS.
+
+    Building with WOLFSSL_DYN_REC turns dynamic record sizing on for every
+    new context with the defaults WOLFSSL_DYN_REC_SMALL_SZ,
+    WOLFSSL_DYN_REC_RAMP_SZ and WOLFSSL_DYN_REC_IDLE_SEC. These are 1369
+    bytes, 64 KiB and 1 second unless defined otherwise.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ssl is NULL, smallSz is more than 16384 or
+    rampSz is too big.
+
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param smallSz size of the small records in bytes. 0 turns dynamic record
+    sizing off.
+    \param rampSz number of bytes to send in small records.
+    \param idleSec seconds without writes after which records start small
+    again. 0 for never.
+
+    _Example_
+    \code
+    WOLFSSL* ssl;
+    ...
+    wolfSSL_SetDynamicRecordSize(ssl, 1369, 65536, 1);
+    \endcode
+
+    \sa wolfSSL_CTX_SetDynamicRecordSize
+    \sa wolfSSL_write
+*/
+int wolfSSL_SetDynamicRecordSize(WOLFSSL* ssl, unsigned short smallSz,
+    unsigned int rampSz, unsigned int idleSec);
+
+/*!
+    \ingroup IO
+
+    \brief This function makes the context keep a pool of I/O buffers for
+    its connections. Connections borrow input and output buffers from the
+    pool only while records are being sent or received, and give them back
+    when their input and output are drained. An idle connection holds no I/O
+    buffers. The buffers come in a few fixed sizes, and up to maxFree free
+    buffers of each size are kept. Call this before creating connections
+    with the context. Not available with WOLFSSL_STATIC_MEMORY, or when
+    WOLFSSL_NO_IO_POOL is defined.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ctx is NULL.
+    \return BAD_MUTEX_E when the lock can't be created or taken.
+    \return NOT_COMPILED_IN when pooling is not compiled in.
+
+    \param ctx pointer to the SSL context, created with wolfSSL_CTX_new().
+    \param maxFree most free buffers of each size to keep. 0 turns the pool
+    off and frees the buffers in it.
+
+    _Example_
+    \code
+    WOLFSSL_CTX* ctx;
+    WOLFSSL_IO_POOL_STATS stats;
+    ...
+    wolfSSL_CTX_UseIOPool(ctx, 1024);
+    ...
+    wolfSSL_CTX_GetIOPoolStats(ctx, &stats);
+    printf("I/O buffers: %lu in use, %lu free\n", stats.inUse, stats.free);
+    \endcode
+
+    \sa wolfSSL_CTX_GetIOPoolStats
+*/
+int wolfSSL_CTX_UseIOPool(WOLFSSL_CTX* ctx, unsigned int maxFree);
+
+/*!
+    \ingroup IO
+
+    \brief This function gets the statistics of the context's pool of I/O
+    buffers: the number of buffers borrowed, how many of them came from the
+    pool, and the number and bytes of buffers held by connections and kept
+    free in the pool.
+
+    \return SSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ctx or stats is NULL.
+    \return BAD_MUTEX_E when the lock can't be taken.
+    \return NOT_COMPILED_IN when pooling is not compiled in.
+
+    \param ctx pointer to the SSL context, created with wolfSSL_CTX_new().
+    \param stats statistics filled in.
+
+    \sa wolfSSL_CTX_UseIOPool
+*/
+int wolfSSL_CTX_GetIOPoolStats(WOLFSSL_CTX* ctx, WOLFSSL_IO_POOL_STATS* stats);
+
 /*!
     \ingroup IO
 
@@ -5360,6 +5724,10 @@ int  wolfSSL_CTX_get_read_ahead(WOLFSSL_CTX* ctx);
     \ingroup Setup
 
     \brief This function sets the read ahead flag in the WOLFSSL_CTX structure.
+    A non-zero flag turns on read ahead with an input buffer of
+    WOLFSSL_READ_AHEAD_SZ bytes (64 KiB by default) for each connection
+    created from the context. See wolfSSL_SetReadAheadSz() for the memory
+    this uses and wolfSSL_CTX_SetReadAheadSz() to choose another size.
 
     \return SSL_SUCCESS If ctx read ahead flag set.
     \return SSL_FAILURE If ctx is NULL then SSL_FAILURE is returned.
@@ -5380,6 +5748,7 @@ int  wolfSSL_CTX_get_read_ahead(WOLFSSL_CTX* ctx);
     \sa wolfSSL_CTX_new
     \sa wolfSSL_CTX_free
     \sa wolfSSL_CTX_get_read_ahead
+    \sa wolfSSL_CTX_SetReadAheadSz
 */
 int  wolfSSL_CTX_set_read_ahead(WOLFSSL_CTX* ctx, int v);
 
@@ -12213,6 +12582,76 @@ int wolfSSL_CTX_set_TicketEncCtx(WOLFSSL_CTX* ctx, void*);
 */
 void* wolfSSL_CTX_get_TicketEncCtx(WOLFSSL_CTX* ctx);
 
+/*!
+    \ingroup Setup
+
+    \brief This function adds a named session ticket key to the ring of keys
+    used by the default ticket callback. New tickets are encrypted with this
+    key. Keys already in the ring still decrypt tickets until they expire or
+    their slot is reused. Servers given the same name and key can resume each
+    other's tickets. The key is not rotated every WOLFSSL_TICKET_KEY_ROTATE
+    seconds. It is used until another key is added or made with
+    wolfSSL_CTX_rotate_ticket_key(), or until it expires
+    (WOLFSSL_TICKET_KEY_LIFETIME seconds after being added) within the
+    ticket lifetime. A new key is then generated locally, so add the next
+    shared key before then. Requires WOLFSSL_TICKET_KEY_RING. For server side
+    use.
+
+    \return WOLFSSL_SUCCESS on success.
+    \return BAD_FUNC_ARG when ctx, name or key is NULL or keySz is not
+    WOLFSSL_TICKET_KEY_SZ.
+    \return SIDE_ERROR when ctx is not for a server.
+
+    \param ctx pointer to the WOLFSSL_CTX object, created
+    with wolfSSL_CTX_new().
+    \param name name of the key of WOLFSSL_TICKET_NAME_SZ bytes.
+    \param key the key data.
+    \param keySz length of the key data in bytes.
+
+    _Example_
+    \code
+    unsigned char name[WOLFSSL_TICKET_NAME_SZ];
+    unsigned char key[WOLFSSL_TICKET_KEY_SZ];
+    // name and key shared by all servers
+    ret = wolfSSL_CTX_add_ticket_key(ctx, name, key, sizeof(key));
+    if (ret != WOLFSSL_SUCCESS) {
+        // failed to add key
+    }
+    \endcode
+
+    \sa wolfSSL_CTX_rotate_ticket_key
+    \sa wolfSSL_CTX_set_TicketEncCb
+*/
+int wolfSSL_CTX_add_ticket_key(WOLFSSL_CTX* ctx, const unsigned char* name,
+                               const unsigned char* key, unsigned int keySz);
+
+/*!
+    \ingroup Setup
+
+    \brief This function generates a new session ticket key in the ring of
+    keys used by the default ticket callback. New tickets are encrypted with
+    the new key. Keys are otherwise rotated every WOLFSSL_TICKET_KEY_ROTATE
+    seconds. Requires WOLFSSL_TICKET_KEY_RING. For server side use.
+
+    \return WOLFSSL_SUCCESS on success.
+    \return BAD_FUNC_ARG when ctx is NULL.
+    \return SIDE_ERROR when ctx is not for a server.
+
+    \param ctx pointer to the WOLFSSL_CTX object, created
+    with wolfSSL_CTX_new().
+
+    _Example_
+    \code
+    ret = wolfSSL_CTX_rotate_ticket_key(ctx);
+    if (ret != WOLFSSL_SUCCESS) {
+        // failed to rotate key
+    }
+    \endcode
+
+    \sa wolfSSL_CTX_add_ticket_key
+*/
+int wolfSSL_CTX_rotate_ticket_key(WOLFSSL_CTX* ctx);
+
 /*!
     \brief This function sets the handshake done callback. The hsDoneCb and
     hsDoneCtx members of the WOLFSSL structure are set in this function.
@@ -14185,6 +14624,92 @@ int  wolfSSL_CTX_set_max_early_data(WOLFSSL_CTX* ctx,
 */
 int  wolfSSL_set_max_early_data(WOLFSSL* ssl, unsigned int sz);
 
+/*!
+    \ingroup Setup
+
+    \brief This function sets up a store, on a TLS v1.3 server context, of the
+    ClientHellos that early data was accepted with. Early data in a ClientHello
+    that is seen again within the window is rejected and the handshake
+    continues without it. ClientHellos are identified by the binder of the
+    first pre-shared key. Memory for the store is allocated by this call and
+    does not grow. When more than maxEntries ClientHellos are seen in a window,
+    some early data that is not replayed may be rejected.
+    Only available when wolfSSL is built with WOLFSSL_EARLY_DATA_ANTI_REPLAY
+    (--enable-earlydata-antireplay). Do not call while connections created
+    from the context are handshaking.
+
+    \param [in,out] ctx a pointer to a WOLFSSL_CTX structure, created
+    with wolfSSL_CTX_new().
+    \param [in] window the number of seconds to remember a ClientHello for.
+    0 uses the default of WOLFSSL_ANTI_REPLAY_WINDOW which covers the ticket
+    age check. Must be at least MAX_TICKET_AGE_DIFF + 2 seconds.
+    \param [in] maxEntries the number of ClientHellos to remember in a window.
+    0 removes the store.
+
+    \return BAD_FUNC_ARG if ctx is NULL, not using TLS v1.3, window is too
+    short or maxEntries is too large.
+    \return SIDE_ERROR if ctx is not for a server.
+    \return MEMORY_E if allocating the store fails.
+    \return WOLFSSL_SUCCESS if successful.
+
+    _Example_
+    \code
+    int ret;
+    WOLFSSL_CTX* ctx;
+    ...
+    ret = wolfSSL_CTX_set_early_data_antireplay(ctx, 0, 100000);
+    if (ret != WOLFSSL_SUCCESS) {
+        // failed to set up anti-replay store
+    }
+    \endcode
+
+    \sa wolfSSL_CTX_set_early_data_antireplay_cb
+    \sa wolfSSL_CTX_set_max_early_data
+    \sa wolfSSL_read_early_data
+*/
+int  wolfSSL_CTX_set_early_data_antireplay(WOLFSSL_CTX* ctx,
+    unsigned int window, unsigned int maxEntries);
+
+/*!
+    \ingroup Setup
+
+    \brief This function sets a callback, on a TLS v1.3 server context, to
+    check for replayed early data against a store shared between servers or
+    processes. The callback is called with the binder of the ClientHello when
+    the context's own store, if any, has not seen it. The callback returns 0
+    when the binder was not seen within window seconds, and records it, 1 when
+    it was seen and a negative value on error. Early data is rejected unless 0
+    is returned.
+    Only available when wolfSSL is built with WOLFSSL_EARLY_DATA_ANTI_REPLAY.
+
+    \param [in,out] ctx a pointer to a WOLFSSL_CTX structure, created
+    with wolfSSL_CTX_new().
+    \param [in] cb the callback to check the ClientHello with. NULL removes
+    the callback.
+    \param [in] cbCtx the context passed to the callback.
+
+    \return BAD_FUNC_ARG if ctx is NULL or not using TLS v1.3.
+    \return SIDE_ERROR if ctx is not for a server.
+    \return WOLFSSL_SUCCESS if successful.
+
+    _Example_
+    \code
+    static int SharedReplayCheck(WOLFSSL* ssl, const unsigned char* key,
+        unsigned int keySz, unsigned int window, void* ctx)
+    {
+        // atomically add key with expiry of window seconds to shared store
+        // return 1 if already present
+    }
+    ...
+    ret = wolfSSL_CTX_set_early_data_antireplay_cb(ctx, SharedReplayCheck,
+        store);
+    \endcode
+
+    \sa wolfSSL_CTX_set_early_data_antireplay
+*/
+int  wolfSSL_CTX_set_early_data_antireplay_cb(WOLFSSL_CTX* ctx,
+    CallbackAntiReplay cb, void* cbCtx);
+
 /*!
     \ingroup IO
 
@@ -15597,3 +16122,157 @@ WOLFSSL_CIPHERSUITE_INFO wolfSSL_get_ciphersuite_info(byte first,
 */
 int wolfSSL_get_sigalg_info(byte first, byte second,
         int* hashAlgo, int* sigAlgo);
+
+/*!
+    \ingroup TLS
+
+    \brief This function creates a pool of worker threads that run handshake
+    steps, including their RSA, ECC, ML-KEM and ML-DSA private key
+    operations, off the thread of an event loop. Available when wolfSSL is
+    built with WOLFSSL_CRYPT_POOL (--enable-cryptpool).
+
+    \return pointer to the new pool upon success.
+    \return NULL when threads is not between 1 and
+    WOLFSSL_CRYPT_POOL_MAX_THREADS, on memory allocation failure or when a
+    thread can't be created.
+
+    \param heap heap hint for allocations. May be NULL.
+    \param threads number of worker threads to start.
+
+    _Example_
+    \code
+    WOLFSSL_CRYPTPOOL* pool = wolfSSL_CryptPool_new(NULL, 4);
+    if (pool == NULL) {
+        // failed to create pool
+    }
+    \endcode
+
+    \sa wolfSSL_CryptPool_free
+    \sa wolfSSL_CryptPool_Submit
+    \sa wolfSSL_CryptPool_Poll
+*/
+WOLFSSL_CRYPTPOOL* wolfSSL_CryptPool_new(void* heap, int threads);
+
+/*!
+    \ingroup TLS
+
+    \brief This function stops the worker threads of a pool and frees it.
+    Handshake steps already submitted are run before the threads stop. The
+    SSL/TLS objects submitted must not be freed until this returns.
+
+    \return none No returns.
+
+    \param pool pool created with wolfSSL_CryptPool_new(). May be NULL.
+
+    _Example_
+    \code
+    wolfSSL_CryptPool_free(pool);
+    \endcode
+
+    \sa wolfSSL_CryptPool_new
+*/
+void wolfSSL_CryptPool_free(WOLFSSL_CRYPTPOOL* pool);
+
+/*!
+    \ingroup TLS
+
+    \brief This function sets a function that a worker thread calls each time
+    it finishes a submitted handshake step. An event loop can use it to wake
+    up, for example by writing to an eventfd or pipe, and then call
+    wolfSSL_CryptPool_Poll(). Set it before submitting.
+
+    \return 0 upon success.
+    \return BAD_FUNC_ARG when pool is NULL.
+
+    \param pool pool created with wolfSSL_CryptPool_new().
+    \param signal function to call on a worker thread. NULL for none.
+    \param ctx argument passed to signal.
+
+    _Example_
+    \code
+    static void PoolDone(void* ctx)
+    {
+        uint64_t one = 1;
+        (void)write(*(int*)ctx, &one, sizeof(one));
+    }
+    ...
+    wolfSSL_CryptPool_SetSignal(pool, PoolDone, &eventFd);
+    \endcode
+
+    \sa wolfSSL_CryptPool_Poll
+*/
+int wolfSSL_CryptPool_SetSignal(WOLFSSL_CRYPTPOOL* pool,
+    WOLFSSL_CRYPT_POOL_SIGNAL signal, void* ctx);
+
+/*!
+    \ingroup TLS
+
+    \brief This function queues the next step of a handshake to run on a
+    worker thread. The worker calls wolfSSL_negotiate() on the object, so the
+    I/O callbacks are called on the worker thread too. Use non-blocking I/O
+    and submit again when the socket is ready if the step wants to read or
+    write. The object must not be used until its event has been returned by
+    wolfSSL_CryptPool_Poll().
+
+    \return 0 upon success.
+    \return BAD_FUNC_ARG when pool or ssl is NULL.
+    \return BAD_STATE_E when ssl is already submitted and not yet polled, or
+    when the pool is being freed.
+    \return BAD_MUTEX_E when locking fails.
+
+    \param pool pool created with wolfSSL_CryptPool_new().
+    \param ssl pointer to the SSL/TLS object to run a handshake step of.
+
+    _Example_
+    \code
+    // socket of ssl is readable
+    if (wolfSSL_CryptPool_Submit(pool, ssl) != 0) {
+        // failed to submit
+    }
+    \endcode
+
+    \sa wolfSSL_CryptPool_Poll
+    \sa wolfSSL_negotiate
+*/
+int wolfSSL_CryptPool_Submit(WOLFSSL_CRYPTPOOL* pool, WOLFSSL* ssl);
+
+/*!
+    \ingroup TLS
+
+    \brief This function gets the events of submitted handshake steps that
+    are done and removes them from the pool. The context of each event is the
+    WOLFSSL object submitted and its ret field is the return of
+    wolfSSL_negotiate(). Pass both to wolfSSL_get_error() to find out whether
+    the handshake is complete, wants I/O or failed.
+
+    \return 0 upon success.
+    \return BAD_FUNC_ARG when a pointer is NULL or maxEvents is less than 1.
+
+    \param pool pool created with wolfSSL_CryptPool_new().
+    \param events array to hold the events that are done.
+    \param maxEvents number of entries in events.
+    \param eventCount number of events put in events.
+
+    _Example_
+    \code
+    WOLF_EVENT* events[16];
+    int i, count = 0;
+
+    wolfSSL_CryptPool_Poll(pool, events, 16, &count);
+    for (i = 0; i < count; i++) {
+        WOLFSSL* ssl = (WOLFSSL*)events[i]->context;
+        int err = wolfSSL_get_error(ssl, events[i]->ret);
+        if (events[i]->ret == WOLFSSL_SUCCESS) {
+            // handshake complete
+        }
+        else if (err == WOLFSSL_ERROR_WANT_READ) {
+            // submit again when socket is readable
+        }
+    }
+    \endcode
+
+    \sa wolfSSL_CryptPool_Submit
+    \sa wolfSSL_CryptPool_SetSignal
+*/
+int wolfSSL_CryptPool_Poll(WOLFSSL_CRYPTPOOL* pool, WOLF_EVENT** events,
+    int maxEvents, int* eventCount);
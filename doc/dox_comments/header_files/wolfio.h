@@ -618,3 +618,209 @@ void wolfSSL_SSLDisableRead(WOLFSSL *ssl);
     \sa wolfSSL_SSLEnableRead
  */
 void wolfSSL_SSLEnableRead(WOLFSSL *ssl);
+
+/*!
+    \ingroup IO
+
+    \brief This function creates a Linux io_uring to batch the socket I/O of
+    many SSL/TLS connections. Each connection attached gets a receive and a
+    send buffer of bufSz bytes. The buffers are registered with the kernel
+    where allowed so that receives need no per-operation page mapping.
+    Requires Linux 5.11 or later and wolfSSL built with --enable-iouring.
+
+    \return pointer to the new io_uring on success.
+    \return NULL on bad arguments, out of memory or when the kernel does not
+    provide a usable io_uring.
+
+    \param heap heap hint for allocations. May be NULL.
+    \param maxConns most connections attached at once.
+    \param bufSz size of each receive and send buffer. 0 for the default of
+    16384 bytes.
+
+    _Example_
+    \code
+    WOLFSSL_URING* ring = wolfSSL_IoUring_new(NULL, 50000, 0);
+    if (ring == NULL) {
+        // fall back to poll() or epoll() with socket I/O
+    }
+    \endcode
+
+    \sa wolfSSL_IoUring_free
+    \sa wolfSSL_IoUring_Attach
+    \sa wolfSSL_IoUring_Wait
+*/
+WOLFSSL_URING* wolfSSL_IoUring_new(void* heap, unsigned int maxConns,
+    unsigned int bufSz);
+
+/*!
+    \ingroup IO
+
+    \brief This function frees an io_uring. Operations in flight are cancelled
+    by the kernel. SSL/TLS objects still attached get back the I/O callbacks
+    and contexts they had before being attached.
+
+    \return none No returns.
+
+    \param ring io_uring created with wolfSSL_IoUring_new(). May be NULL.
+
+    _Example_
+    \code
+    WOLFSSL_URING* ring;
+    ...
+    wolfSSL_IoUring_free(ring);
+    \endcode
+
+    \sa wolfSSL_IoUring_new
+*/
+void wolfSSL_IoUring_free(WOLFSSL_URING* ring);
+
+/*!
+    \ingroup IO
+
+    \brief This function sets the socket of an SSL/TLS object and does its I/O
+    through the io_uring. A read with no data received queues a receive and
+    fails with WOLFSSL_ERROR_WANT_READ. A write copies the data into the send
+    buffer and queues a send. It fails with WOLFSSL_ERROR_WANT_WRITE only when
+    the send buffer is full. Call the operation again once
+    wolfSSL_IoUring_Wait() returns the object. DTLS is not supported.
+    wolfSSL_free() detaches the object, dropping data not yet sent.
+
+    \return WOLFSSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ring or ssl is NULL, sd is negative, ssl is a
+    DTLS object or ssl is already attached.
+    \return MEMORY_E when maxConns objects are already attached.
+
+    \param ring io_uring created with wolfSSL_IoUring_new().
+    \param ssl pointer to the SSL session, created with wolfSSL_new().
+    \param sd connected stream socket.
+
+    _Example_
+    \code
+    WOLFSSL_URING* ring;
+    WOLFSSL* ssl = wolfSSL_new(ctx);
+    int sd = accept(listenSd, NULL, NULL);
+    if (wolfSSL_IoUring_Attach(ring, ssl, sd) != WOLFSSL_SUCCESS) {
+        // no room for the connection
+    }
+    // Queues the read of the ClientHello.
+    wolfSSL_accept(ssl);
+    \endcode
+
+    \sa wolfSSL_IoUring_Detach
+    \sa wolfSSL_IoUring_Wait
+*/
+int wolfSSL_IoUring_Attach(WOLFSSL_URING* ring, WOLFSSL* ssl, SOCKET_T sd);
+
+/*!
+    \ingroup IO
+
+    \brief This function stops doing the I/O of an SSL/TLS object through the
+    io_uring. A receive in flight is cancelled. Data not yet taken by the
+    kernel is dropped, so wait for wolfSSL_IoUring_Pending() to return 0
+    first. The object gets back the I/O callbacks and contexts it had before
+    being attached.
+
+    \return WOLFSSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ssl is not attached to ring.
+
+    \param ring io_uring created with wolfSSL_IoUring_new().
+    \param ssl pointer to the SSL session attached to ring.
+
+    _Example_
+    \code
+    wolfSSL_shutdown(ssl);
+    ...
+    if (wolfSSL_IoUring_Pending(ring, ssl) == 0) {
+        wolfSSL_IoUring_Detach(ring, ssl);
+        wolfSSL_free(ssl);
+        close(sd);
+    }
+    \endcode
+
+    \sa wolfSSL_IoUring_Attach
+    \sa wolfSSL_IoUring_Pending
+*/
+int wolfSSL_IoUring_Detach(WOLFSSL_URING* ring, WOLFSSL* ssl);
+
+/*!
+    \ingroup IO
+
+    \brief This function gets the number of bytes written by an SSL/TLS object
+    that the kernel has not yet taken. wolfSSL_write() succeeds once the data
+    is in the send buffer of the connection.
+
+    \return number of bytes waiting to be sent.
+    \return BAD_FUNC_ARG when ssl is not attached to ring.
+
+    \param ring io_uring created with wolfSSL_IoUring_new().
+    \param ssl pointer to the SSL session attached to ring.
+
+    _Example_
+    \code
+    while (wolfSSL_IoUring_Pending(ring, ssl) > 0) {
+        wolfSSL_IoUring_Wait(ring, ready, READY_MAX, 100);
+    }
+    \endcode
+
+    \sa wolfSSL_IoUring_Detach
+*/
+int wolfSSL_IoUring_Pending(WOLFSSL_URING* ring, WOLFSSL* ssl);
+
+/*!
+    \ingroup IO
+
+    \brief This function passes all operations queued by the attached SSL/TLS
+    objects to the kernel in one system call. wolfSSL_IoUring_Wait() also
+    submits, so this is only needed to start I/O early.
+
+    \return WOLFSSL_SUCCESS upon success.
+    \return BAD_FUNC_ARG when ring is NULL.
+    \return WOLFSSL_FATAL_ERROR when the kernel fails the call.
+
+    \param ring io_uring created with wolfSSL_IoUring_new().
+
+    _Example_
+    \code
+    wolfSSL_IoUring_Submit(ring);
+    // do other work while the kernel does the I/O
+    \endcode
+
+    \sa wolfSSL_IoUring_Wait
+*/
+int wolfSSL_IoUring_Submit(WOLFSSL_URING* ring);
+
+/*!
+    \ingroup IO
+
+    \brief This function submits all queued operations, waits for completions
+    and returns the SSL/TLS objects whose I/O completed. Call
+    wolfSSL_accept(), wolfSSL_connect(), wolfSSL_read() or wolfSSL_write()
+    again on each. Objects that did not fit in ready are returned by the next
+    call, which then does not wait.
+
+    \return number of objects placed in ready.
+    \return BAD_FUNC_ARG when ring or ready is NULL or maxReady is not
+    positive.
+    \return WOLFSSL_FATAL_ERROR when the kernel fails the call.
+
+    \param ring io_uring created with wolfSSL_IoUring_new().
+    \param ready array to fill with the SSL/TLS objects.
+    \param maxReady number of entries in ready.
+    \param timeoutMs most milliseconds to wait when no object is ready. 0
+    does not wait and negative waits until an operation completes.
+
+    _Example_
+    \code
+    WOLFSSL* ready[64];
+    int i;
+    int n = wolfSSL_IoUring_Wait(ring, ready, 64, 10);
+    for (i = 0; i < n; i++) {
+        // continue the handshake or read and write of ready[i]
+    }
+    \endcode
+
+    \sa wolfSSL_IoUring_Attach
+    \sa wolfSSL_IoUring_Submit
+*/
+int wolfSSL_IoUring_Wait(WOLFSSL_URING* ring, WOLFSSL** ready, int maxReady,
+    int timeoutMs);
@@ -341,6 +341,7 @@ typedef struct {
     double rxTime;
     double txTime;
     int connCount;
+    int resumeCount;
     int rxTotal;
     int txTotal;
 } stats_t;
@@ -361,6 +362,7 @@ typedef struct {
     int runTimeSec;
     int showPeerInfo;
     int showVerbose;
+    int doResume;   /* Number of sessions to resume in turn */
 #ifndef NO_WOLFSSL_SERVER
     int listenFd;
 #endif
@@ -937,6 +939,8 @@ static int bench_tls_client(info_t* info)
     int ret, readBufSz;
     WOLFSSL_CTX* cli_ctx = NULL;
     WOLFSSL* cli_ssl = NULL;
+    WOLFSSL_SESSION** sessions = NULL;
+    int sessCnt = 0, sessIdx = 0;
     int haveShownPeerInfo = 0;
     int tls13 = XSTRNCMP(info->cipher, "TLS13", 5) == 0;
     int total_sz;
@@ -1045,6 +1049,17 @@ static int bench_tls_client(info_t* info)
         ret = MEMORY_E; goto exit;
     }
 
+    /* Allocate sessions to resume */
+    if (info->doResume > 0) {
+        sessions = (WOLFSSL_SESSION**)XMALLOC(
+            sizeof(WOLFSSL_SESSION*) * (size_t)info->doResume, NULL,
+            DYNAMIC_TYPE_TMP_BUFFER);
+        if (sessions == NULL) {
+            fprintf(stderr, "failed to allocate session memory\n");
+            ret = MEMORY_E; goto exit;
+        }
+    }
+
     /* BENCHMARK CONNECTIONS LOOP */
     while (!info->client.shutdown) {
         int writeSz = info->packetSize;
@@ -1095,6 +1110,17 @@ static int bench_tls_client(info_t* info)
         wolfSSL_SetIOReadCtx(cli_ssl, info);
         wolfSSL_SetIOWriteCtx(cli_ssl, info);
 
+        /* Once all are taken, resume each session in turn so that the server
+         * decrypts a batch of distinct tickets. */
+        if (sessCnt > 0 && sessCnt == info->doResume) {
+            ret = wolfSSL_set_session(cli_ssl, sessions[sessIdx]);
+            if (ret != WOLFSSL_SUCCESS) {
+                fprintf(stderr, "error setting session to resume\n");
+                goto exit;
+            }
+            sessIdx = (sessIdx + 1) % sessCnt;
+        }
+
 #if !defined(SINGLE_THREADED) && defined(WOLFSSL_DTLS)
         /* synchronize with server */
         if (info->doDTLS && !info->clientOrserverOnly) {
@@ -1127,6 +1153,9 @@ static int bench_tls_client(info_t* info)
         }
         info->client_stats.connTime += start;
         info->client_stats.connCount++;
+        if (wolfSSL_session_reused(cli_ssl)) {
+            info->client_stats.resumeCount++;
+        }
 
         if ((info->showPeerInfo) && (!haveShownPeerInfo)) {
             haveShownPeerInfo = 1;
@@ -1210,6 +1239,15 @@ static int bench_tls_client(info_t* info)
 
         CloseAndCleanupSocket(&info->client.sockFd);
 
+        /* Later connections resume the first ones' sessions. Taken once the
+         * connection is done so that a TLS 1.3 ticket has been received. */
+        if (sessCnt < info->doResume) {
+            sessions[sessCnt] = wolfSSL_get1_session(cli_ssl);
+            if (sessions[sessCnt] != NULL) {
+                sessCnt++;
+            }
+        }
+
         wolfSSL_free(cli_ssl);
         cli_ssl = NULL;
     }
@@ -1226,6 +1264,12 @@ exit:
     if (cli_ssl != NULL) {
         wolfSSL_free(cli_ssl);
     }
+    if (sessions != NULL) {
+        for (sessIdx = 0; sessIdx < sessCnt; sessIdx++) {
+            wolfSSL_SESSION_free(sessions[sessIdx]);
+        }
+        XFREE(sessions, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    }
     if (cli_ctx != NULL) {
         wolfSSL_CTX_free(cli_ctx);
     }
@@ -1472,6 +1516,14 @@ static int bench_tls_server(info_t* info)
         goto exit;
     }
 
+#if defined(HAVE_SESSION_TICKET) && !defined(WOLFSSL_NO_TLS12)
+    /* TLS 1.2 resumes from the session cache rather than with tickets.
+     * TLS 1.3 only resumes with tickets. */
+    if (info->doResume > 0) {
+        wolfSSL_CTX_NoTicketTLSv12(srv_ctx);
+    }
+#endif
+
 #ifndef NO_DH
     ret = wolfSSL_CTX_SetMinDhKey_Sz(srv_ctx, MIN_DHKEY_BITS);
     if (ret != WOLFSSL_SUCCESS) {
@@ -1579,6 +1631,9 @@ static int bench_tls_server(info_t* info)
 
         info->server_stats.connTime += start;
         info->server_stats.connCount++;
+        if (wolfSSL_session_reused(srv_ssl)) {
+            info->server_stats.resumeCount++;
+        }
 
         /* echo loop */
         ret = 0;
@@ -1725,6 +1780,7 @@ static void print_stats(stats_t* wcStat, const char* desc, const char* cipher, c
                 "wolfSSL %s Benchmark on %s with group %s:\n"
                 "\tTotal       : %9d bytes\n"
                 "\tNum Conns   : %9d\n"
+                "\tNum Resumed : %9d\n"
                 "\tRx Total    : %9.3f ms\n"
                 "\tTx Total    : %9.3f ms\n"
                 "\tRx          : %9.3f MB/s\n"
@@ -1736,6 +1792,7 @@ static void print_stats(stats_t* wcStat, const char* desc, const char* cipher, c
                 group,
                 wcStat->txTotal + wcStat->rxTotal,
                 wcStat->connCount,
+                wcStat->resumeCount,
                 wcStat->rxTime * 1000,
                 wcStat->txTime * 1000,
                 wcStat->rxTotal / wcStat->rxTime / 1024 / 1024,
@@ -1782,6 +1839,9 @@ static void Usage(void)
     fprintf(stderr, "            In the case of DTLS, [1-8kB] (default %d)\n", TEST_DTLS_PACKET_SIZE);
 #endif
     fprintf(stderr, "-S <num>    The total size <num> in bytes (default %d)\n", TEST_MAX_SIZE);
+    fprintf(stderr, "-r          Resume the first session in later connections\n");
+    fprintf(stderr, "-k <num>    Resume the first <num> sessions in turn in later connections\n");
+    fprintf(stderr, "            TLS 1.2 resumes from the session cache, TLS 1.3 with tickets\n");
     fprintf(stderr, "-v          Show verbose output\n");
 #ifdef DEBUG_WOLFSSL
     fprintf(stderr, "-d          Enable debug messages\n");
@@ -1887,6 +1947,7 @@ int bench_tls(void* args)
     const char* argHost = BENCH_DEFAULT_HOST;
     word32 argPort = BENCH_DEFAULT_PORT;
     int argShowPeerInfo = 0;
+    int argResume = 0;
 #ifndef SINGLE_THREADED
     int doShutdown;
 #endif
@@ -1932,7 +1993,7 @@ int bench_tls(void* args)
 #endif /* HAVE_FIPS && HAVE_FIPS_VERSION == 5 */
 
     /* Parse command line arguments */
-    while ((ch = mygetopt(argc, argv, "?" "udeil:p:t:vT:sch:P:mS:g")) != -1) {
+    while ((ch = mygetopt(argc, argv, "?" "udeil:p:t:vT:sch:P:mS:grk:")) != -1) {
         switch (ch) {
             case '?' :
                 Usage();
@@ -1997,6 +2058,18 @@ int bench_tls(void* args)
                 argTestMaxSize = atoi(myoptarg);
                 break;
 
+            case 'r' :
+                argResume = 1;
+                break;
+
+            case 'k' :
+                argResume = atoi(myoptarg);
+                if (argResume <= 0) {
+                    Usage();
+                    ret = MY_EX_USAGE; goto exit;
+                }
+                break;
+
             case 't' :
                 argRuntimeSec = atoi(myoptarg);
                 break;
@@ -2160,6 +2233,7 @@ int bench_tls(void* args)
                 info->maxSize = argTestMaxSize;
                 info->showPeerInfo = argShowPeerInfo;
                 info->showVerbose = argShowVerbose;
+                info->doResume = argResume;
         #ifndef NO_WOLFSSL_SERVER
                 info->listenFd = listenFd;
         #endif
@@ -2260,6 +2334,9 @@ int bench_tls(void* args)
                 cli_comb.connCount += info->client_stats.connCount;
                 srv_comb.connCount += info->server_stats.connCount;
 
+                cli_comb.resumeCount += info->client_stats.resumeCount;
+                srv_comb.resumeCount += info->server_stats.resumeCount;
+
                 cli_comb.connTime += info->client_stats.connTime;
                 srv_comb.connTime += info->server_stats.connTime;
 
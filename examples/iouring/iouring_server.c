@@ -0,0 +1,322 @@
+/* iouring_server.c
+ *
+ * Copyright (C) 2006-2025 wolfSSL Inc.
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+/* TLS echo server serving many connections from one thread with the I/O of
+ * all connections batched through one io_uring */
+
+#ifdef HAVE_CONFIG_H
+    #include <config.h>
+#endif
+
+/* std */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+/* socket */
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+
+/* wolfSSL */
+#ifndef WOLFSSL_USER_SETTINGS
+    #include <wolfssl/options.h>
+#endif
+#include <wolfssl/ssl.h>
+#include <wolfssl/wolfio.h>
+
+#if defined(WOLFSSL_IO_URING) && !defined(NO_WOLFSSL_SERVER) && \
+    !defined(NO_TLS) && !defined(NO_FILESYSTEM)
+
+/* Test certificates and keys for RSA and ECC */
+#ifndef NO_RSA
+    #define CERT_FILE "./certs/server-cert.pem"
+    #define KEY_FILE  "./certs/server-key.pem"
+#elif defined(HAVE_ECC)
+    #define CERT_FILE "./certs/server-ecc.pem"
+    #define KEY_FILE  "./certs/ecc-key.pem"
+#else
+    #error No authentication algorithm (ECC/RSA)
+#endif
+
+#define DEFAULT_PORT      11111
+#define DEFAULT_MAX_CONNS 1024
+/* Milliseconds to wait for I/O before checking for new connections */
+#define WAIT_MS           10
+/* Most connections handled per wait */
+#define READY_MAX         256
+/* File descriptors above the connection count, for stdio, listener, ring */
+#define EXTRA_FDS         64
+
+typedef struct EchoConn {
+    WOLFSSL* ssl;
+    int      fd;
+    int      closing;
+    int      len;                /* bytes read and not yet echoed */
+    char     buf[16384];
+} EchoConn;
+
+static volatile int mShutdown = 0;
+
+static void sig_handler(const int sig)
+{
+    (void)sig;
+    mShutdown = 1;
+}
+
+/* Free a connection once all it wrote has gone to the kernel. */
+static void EchoFinish(WOLFSSL_URING* ring, EchoConn* c, int* active)
+{
+    if (wolfSSL_IoUring_Pending(ring, c->ssl) > 0)
+        return;
+
+    wolfSSL_IoUring_Detach(ring, c->ssl);
+    wolfSSL_free(c->ssl);
+    close(c->fd);
+    c->ssl = NULL;
+    c->fd = -1;
+    c->closing = 0;
+    c->len = 0;
+    (*active)--;
+}
+
+/* Queue a close_notify and free the connection once it has been sent. */
+static void EchoClose(WOLFSSL_URING* ring, EchoConn* c, int* active)
+{
+    c->closing = 1;
+    if (wolfSSL_is_init_finished(c->ssl))
+        (void)wolfSSL_shutdown(c->ssl);
+    EchoFinish(ring, c, active);
+}
+
+/* Make as much progress as the completed I/O allows. */
+static void EchoServe(WOLFSSL_URING* ring, EchoConn* c, int* active)
+{
+    int ret;
+    int err;
+
+    if (c->closing) {
+        EchoFinish(ring, c, active);
+        return;
+    }
+
+    if (!wolfSSL_is_init_finished(c->ssl)) {
+        ret = wolfSSL_accept(c->ssl);
+        if (ret != WOLFSSL_SUCCESS) {
+            err = wolfSSL_get_error(c->ssl, ret);
+            if (err != WOLFSSL_ERROR_WANT_READ &&
+                    err != WOLFSSL_ERROR_WANT_WRITE) {
+                EchoClose(ring, c, active);
+            }
+            return;
+        }
+    }
+
+    for (;;) {
+        if (c->len > 0) {
+            ret = wolfSSL_write(c->ssl, c->buf, c->len);
+            if (ret <= 0) {
+                err = wolfSSL_get_error(c->ssl, ret);
+                if (err != WOLFSSL_ERROR_WANT_WRITE)
+                    EchoClose(ring, c, active);
+                return;
+            }
+            c->len = 0;
+        }
+        ret = wolfSSL_read(c->ssl, c->buf, (int)sizeof(c->buf));
+        if (ret <= 0) {
+            err = wolfSSL_get_error(c->ssl, ret);
+            if (err != WOLFSSL_ERROR_WANT_READ)
+                EchoClose(ring, c, active);
+            return;
+        }
+        c->len = ret;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+    int listenFd = -1;
+    int on = 1;
+    int port = DEFAULT_PORT;
+    int maxConns = DEFAULT_MAX_CONNS;
+    int maxFds;
+    int active = 0;
+    long served = 0;
+    int i;
+    struct sockaddr_in servAddr;
+    WOLFSSL_CTX* ctx = NULL;
+    WOLFSSL_URING* ring = NULL;
+    EchoConn* conns = NULL;
+    WOLFSSL* ready[READY_MAX];
+
+    if (argc > 1)
+        port = atoi(argv[1]);
+    if (argc > 2)
+        maxConns = atoi(argv[2]);
+    if (port <= 0 || port > 65535 || maxConns <= 0) {
+        fprintf(stderr, "usage: %s [port] [max connections]\n", argv[0]);
+        return 1;
+    }
+    maxFds = maxConns + EXTRA_FDS;
+
+    signal(SIGINT, sig_handler);
+    signal(SIGTERM, sig_handler);
+
+    conns = (EchoConn*)calloc((size_t)maxFds, sizeof(EchoConn));
+    if (conns == NULL) {
+        fprintf(stderr, "ERROR: out of memory\n");
+        return 1;
+    }
+
+    memset(&servAddr, 0, sizeof(servAddr));
+    servAddr.sin_family      = AF_INET;
+    servAddr.sin_port        = htons((unsigned short)port);
+    servAddr.sin_addr.s_addr = INADDR_ANY;
+
+    if ((listenFd = socket(AF_INET, SOCK_STREAM, 0)) == -1 ||
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, (char*)&on,
+            (socklen_t)sizeof(on)) != 0 ||
+        bind(listenFd, (struct sockaddr*)&servAddr, sizeof(servAddr)) != 0 ||
+        listen(listenFd, 1024) != 0 ||
+        fcntl(listenFd, F_SETFL, O_NONBLOCK) != 0) {
+        fprintf(stderr, "ERROR: failed to listen on port %d (errno: %d)\n",
+            port, errno);
+        ret = -1; goto exit;
+    }
+
+#ifdef DEBUG_WOLFSSL
+    wolfSSL_Debugging_ON();
+#endif
+    if ((ret = wolfSSL_Init()) != WOLFSSL_SUCCESS) {
+        fprintf(stderr, "ERROR: Failed to initialize the library\n");
+        goto exit;
+    }
+
+    if ((ctx = wolfSSL_CTX_new(wolfSSLv23_server_method())) == NULL) {
+        fprintf(stderr, "ERROR: failed to create WOLFSSL_CTX\n");
+        ret = -1; goto exit;
+    }
+    if ((ret = wolfSSL_CTX_use_certificate_file(ctx, CERT_FILE,
+                                    WOLFSSL_FILETYPE_PEM)) != WOLFSSL_SUCCESS) {
+        fprintf(stderr, "ERROR: failed to load %s, please check the file.\n",
+                CERT_FILE);
+        goto exit;
+    }
+    if ((ret = wolfSSL_CTX_use_PrivateKey_file(ctx, KEY_FILE,
+                                    WOLFSSL_FILETYPE_PEM)) != WOLFSSL_SUCCESS) {
+        fprintf(stderr, "ERROR: failed to load %s, please check the file.\n",
+                KEY_FILE);
+        goto exit;
+    }
+
+    /* One ring serves the reads and writes of every connection. */
+    if ((ring = wolfSSL_IoUring_new(NULL, (unsigned int)maxConns, 0)) ==
+            NULL) {
+        fprintf(stderr, "ERROR: failed to create io_uring\n");
+        ret = -1; goto exit;
+    }
+
+    printf("Listening on port %d for up to %d connections\n", port, maxConns);
+
+    while (!mShutdown) {
+        int fd;
+        int n;
+
+        /* Take all new connections. */
+        while (active < maxConns &&
+                (fd = accept(listenFd, NULL, NULL)) >= 0) {
+            EchoConn* c;
+
+            if (fd >= maxFds) {
+                close(fd);
+                continue;
+            }
+            c = &conns[fd];
+            c->fd = fd;
+            c->len = 0;
+            c->closing = 0;
+            if ((c->ssl = wolfSSL_new(ctx)) == NULL) {
+                close(fd);
+                continue;
+            }
+            if (wolfSSL_IoUring_Attach(ring, c->ssl, fd) != WOLFSSL_SUCCESS) {
+                wolfSSL_free(c->ssl);
+                c->ssl = NULL;
+                close(fd);
+                continue;
+            }
+            active++;
+            served++;
+            /* Queues the read of the ClientHello. */
+            EchoServe(ring, c, &active);
+        }
+
+        /* Submit everything queued, then handle what completed. */
+        n = wolfSSL_IoUring_Wait(ring, ready, READY_MAX, WAIT_MS);
+        if (n < 0) {
+            fprintf(stderr, "ERROR: io_uring wait failed: %d\n", n);
+            ret = n; break;
+        }
+        for (i = 0; i < n; i++)
+            EchoServe(ring, &conns[wolfSSL_get_fd(ready[i])], &active);
+    }
+
+    printf("Shutdown after %ld connections\n", served);
+    ret = 0;
+
+exit:
+    if (conns != NULL) {
+        for (i = 0; i < maxFds; i++) {
+            if (conns[i].ssl != NULL) {
+                wolfSSL_IoUring_Detach(ring, conns[i].ssl);
+                wolfSSL_free(conns[i].ssl);
+                close(conns[i].fd);
+            }
+        }
+    }
+    wolfSSL_IoUring_free(ring);
+    if (listenFd != -1)
+        close(listenFd);
+    if (ctx)
+        wolfSSL_CTX_free(ctx);
+    wolfSSL_Cleanup();
+    free(conns);
+
+    return ret;
+}
+
+#else
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    printf("Requires wolfSSL built with --enable-iouring\n");
+    return 0;
+}
+
+#endif /* WOLFSSL_IO_URING && !NO_WOLFSSL_SERVER && !NO_TLS */
@@ -287,6 +287,24 @@ static int Dtls13GetRnMask(WOLFSSL* ssl, const byte* ciphertext, byte* mask,
     }
 #endif /* HAVE_CHACHA */
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    if (ssl->specs.bulk_cipher_algorithm == wolfssl_ascon_aead) {
+        byte tag[ASCON_AEAD128_TAG_SZ];
+        int ret;
+
+        if (c->ascon == NULL)
+            return BAD_STATE_E;
+
+        /* Mask is the Ascon-AEAD128 keystream with the first 16 bytes of
+         * ciphertext as the nonce - no associated data, tag discarded. */
+        XMEMSET(mask, 0, DTLS13_RN_MASK_SIZE);
+        ret = wc_AsconAEAD128_Encrypt(c->ascon, ciphertext, NULL, 0, mask,
+            DTLS13_RN_MASK_SIZE, mask, tag);
+        ForceZero(tag, sizeof(tag));
+        return ret;
+    }
+#endif /* BUILD_TLS_ASCON_AEAD128_SHA256 */
+
     return NOT_COMPILED_IN;
 }
 
@@ -2123,6 +2141,28 @@ static int Dtls13InitChaChaCipher(RecordNumberCiphers* c, byte* key,
 }
 #endif /* HAVE_CHACHA */
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+static int Dtls13InitAsconCipher(RecordNumberCiphers* c, const byte* key,
+    word16 keySize, void* heap)
+{
+    (void)heap;
+
+    if (keySize != ASCON_AEAD128_KEY_SZ)
+        return BAD_FUNC_ARG;
+
+    if (c->ascon == NULL) {
+        c->ascon = (byte*)XMALLOC(ASCON_AEAD128_KEY_SZ, heap,
+            DYNAMIC_TYPE_CIPHER);
+
+        if (c->ascon == NULL)
+            return MEMORY_E;
+    }
+
+    XMEMCPY(c->ascon, key, ASCON_AEAD128_KEY_SZ);
+    return 0;
+}
+#endif /* BUILD_TLS_ASCON_AEAD128_SHA256 */
+
 struct Dtls13Epoch* Dtls13GetEpoch(WOLFSSL* ssl, w64wrapper epochNumber)
 {
     Dtls13Epoch* e;
@@ -2506,6 +2546,34 @@ int Dtls13SetRecordNumberKeys(WOLFSSL* ssl, enum encrypt_side side)
     }
 #endif /* HAVE_CHACHA */
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    if (ssl->specs.bulk_cipher_algorithm == wolfssl_ascon_aead) {
+        if (enc) {
+            ret = Dtls13InitAsconCipher(enc, encKey, ssl->specs.key_size,
+                ssl->heap);
+            if (ret != 0)
+                return ret;
+#ifdef WOLFSSL_DEBUG_TLS
+            WOLFSSL_MSG("Provisioning Ascon Record Number enc key:");
+            WOLFSSL_BUFFER(encKey, ssl->specs.key_size);
+#endif /* WOLFSSL_DEBUG_TLS */
+        }
+
+        if (dec) {
+            ret = Dtls13InitAsconCipher(dec, decKey, ssl->specs.key_size,
+                ssl->heap);
+            if (ret != 0)
+                return ret;
+#ifdef WOLFSSL_DEBUG_TLS
+            WOLFSSL_MSG("Provisioning Ascon Record Number dec key:");
+            WOLFSSL_BUFFER(decKey, ssl->specs.key_size);
+#endif /* WOLFSSL_DEBUG_TLS */
+        }
+
+        return 0;
+    }
+#endif /* BUILD_TLS_ASCON_AEAD128_SHA256 */
+
 #ifdef HAVE_NULL_CIPHER
     if (ssl->specs.bulk_cipher_algorithm == wolfssl_cipher_null) {
 #ifdef WOLFSSL_DEBUG_TLS
@@ -2988,6 +3056,13 @@ int Dtls13CheckAEADFailLimit(WOLFSSL* ssl)
             keyUpdateLimit = DTLS_AEAD_AES_GCM_CHACHA_FAIL_KU_LIMIT;
             break;
 #endif
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+        case wolfssl_ascon_aead:
+            /* 128-bit tag - use the same limits as AES-GCM/ChaCha20. */
+            hardLimit = DTLS_AEAD_AES_GCM_CHACHA_FAIL_LIMIT;
+            keyUpdateLimit = DTLS_AEAD_AES_GCM_CHACHA_FAIL_KU_LIMIT;
+            break;
+#endif
 #ifdef HAVE_AESCCM
         case wolfssl_aes_ccm:
             if (ssl->specs.aead_mac_size == AES_CCM_8_AUTH_SZ) {
@@ -2464,7 +2464,12 @@ int InitSSL_Ctx(WOLFSSL_CTX* ctx, WOLFSSL_METHOD* method, void* heap)
         ctx->heap = ctx;  /* defaults to self */
     }
     else {
-        ctx->heap = heap; /* wolfSSL_CTX_load_static_memory sets */
+    #ifdef WOLFSSL_DYN_REC
+    ctx->dynRec.smallSz = WOLFSSL_DYN_REC_SMALL_SZ;
+    ctx->dynRec.rampSz = WOLFSSL_DYN_REC_RAMP_SZ;
+    ctx->dynRec.idleSec = WOLFSSL_DYN_REC_IDLE_SEC;
+#endif
+    ctx->heap = heap; /* wolfSSL_CTX_load_static_memory sets */
     }
     ctx->timeout  = WOLFSSL_SESSION_TIMEOUT;
 
@@ -2719,6 +2724,38 @@ int InitSSL_Ctx(WOLFSSL_CTX* ctx, WOLFSSL_METHOD* method, void* heap)
     ret = wolfEventQueue_Init(&ctx->event_queue);
 #endif /* HAVE_WOLF_EVENT */
 
+#ifdef WOLFSSL_CTX_PARENT_RNG
+    /* Parent DRBG that seeds the DRBG of each SSL object. */
+    if ((ret == 0) && (wc_InitMutex(&ctx->parentRngMutex) != 0)) {
+        WOLFSSL_MSG("Bad mutex init");
+        WOLFSSL_ERROR_VERBOSE(BAD_MUTEX_E);
+        return BAD_MUTEX_E;
+    }
+    if (ret == 0) {
+    #ifdef WC_RNG_CTR_DRBG
+        ctx->parentRng = (WC_RNG*)XMALLOC(sizeof(WC_RNG), heap,
+            DYNAMIC_TYPE_RNG);
+        if (ctx->parentRng == NULL) {
+            ret = MEMORY_E;
+        }
+        else {
+            ret = wc_InitRngCtrDrbg_ex(ctx->parentRng, heap, ctx->devId);
+            if (ret != 0) {
+                XFREE(ctx->parentRng, heap, DYNAMIC_TYPE_RNG);
+                ctx->parentRng = NULL;
+            }
+        }
+    #else
+        ret = wc_rng_new_ex(&ctx->parentRng, NULL, 0, heap, ctx->devId);
+    #endif
+        if (ret != 0) {
+            WOLFSSL_MSG("Parent RNG init error");
+            wc_FreeMutex(&ctx->parentRngMutex);
+            return ret;
+        }
+    }
+#endif
+
 #ifdef WOLFSSL_MAXQ10XX_TLS
     /* Let maxq10xx know what TLS version we are using. */
     ctx->devId = MAXQ_DEVICE_ID;
@@ -2811,6 +2848,14 @@ void SSL_CtxResourceFree(WOLFSSL_CTX* ctx)
     wolfEventQueue_Free(&ctx->event_queue);
 #endif /* HAVE_WOLF_EVENT */
 
+#ifdef WOLFSSL_IO_POOL
+    IOPoolFree(ctx);
+#endif
+
+#if defined(WOLFSSL_EARLY_DATA) && defined(WOLFSSL_EARLY_DATA_ANTI_REPLAY)
+    AntiReplayFree(ctx);
+#endif
+
 #ifndef NO_TLS /* its a static global see ssl.c "gNoTlsMethod" */
     XFREE(ctx->method, heapAtCTXInit, DYNAMIC_TYPE_METHOD);
 #endif
@@ -2833,11 +2878,21 @@ void SSL_CtxResourceFree(WOLFSSL_CTX* ctx)
         ctx->rng = NULL;
     }
 #endif /* SINGLE_THREADED */
+#ifdef WOLFSSL_CTX_PARENT_RNG
+    if (ctx->parentRng != NULL) {
+        wc_rng_free(ctx->parentRng);
+        ctx->parentRng = NULL;
+        wc_FreeMutex(&ctx->parentRngMutex);
+    }
+#endif
 
 #ifndef NO_CERTS
     if (ctx->privateKey != NULL && ctx->privateKey->buffer != NULL) {
         ForceZero(ctx->privateKey->buffer, ctx->privateKey->length);
     }
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    FreeCtxDecodedKey(ctx);
+#endif
     FreeDer(&ctx->privateKey);
 #ifdef WOLFSSL_BLIND_PRIVATE_KEY
     FreeDer(&ctx->privateKeyMask);
@@ -3094,6 +3149,12 @@ static void FreeCiphersSide(Ciphers *cipher, void* heap)
     XFREE(cipher->sm4, heap, DYNAMIC_TYPE_CIPHER);
     cipher->sm4 = NULL;
 #endif
+#ifdef HAVE_ASCON
+    if (cipher->ascon)
+        ForceZero(cipher->ascon, ASCON_AEAD128_KEY_SZ + ASCON_AEAD128_NONCE_SZ);
+    XFREE(cipher->ascon, heap, DYNAMIC_TYPE_CIPHER);
+    cipher->ascon = NULL;
+#endif
 #if (defined(BUILD_AESGCM) || defined(BUILD_AESCCM) || defined(HAVE_ARIA)) && \
     !defined(WOLFSSL_NO_TLS12)
     XFREE(cipher->additional, heap, DYNAMIC_TYPE_CIPHER);
@@ -3153,6 +3214,16 @@ void FreeCiphers(WOLFSSL* ssl)
     ssl->dtlsRecordNumberEncrypt.chacha = NULL;
     ssl->dtlsRecordNumberDecrypt.chacha = NULL;
 #endif /* HAVE_CHACHA */
+#ifdef HAVE_ASCON
+    if (ssl->dtlsRecordNumberEncrypt.ascon)
+        ForceZero(ssl->dtlsRecordNumberEncrypt.ascon, ASCON_AEAD128_KEY_SZ);
+    if (ssl->dtlsRecordNumberDecrypt.ascon)
+        ForceZero(ssl->dtlsRecordNumberDecrypt.ascon, ASCON_AEAD128_KEY_SZ);
+    XFREE(ssl->dtlsRecordNumberEncrypt.ascon, ssl->heap, DYNAMIC_TYPE_CIPHER);
+    XFREE(ssl->dtlsRecordNumberDecrypt.ascon, ssl->heap, DYNAMIC_TYPE_CIPHER);
+    ssl->dtlsRecordNumberEncrypt.ascon = NULL;
+    ssl->dtlsRecordNumberDecrypt.ascon = NULL;
+#endif /* HAVE_ASCON */
 #endif /* WOLFSSL_DTLS13 */
 }
 
@@ -7183,6 +7254,8 @@ int SetSSL_CTX(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
 #ifdef OPENSSL_EXTRA
     ssl->readAhead = ctx->readAhead;
 #endif
+    ssl->readAheadSz = ctx->readAheadSz;
+    ssl->dynRec = ctx->dynRec;
 #if defined(OPENSSL_EXTRA) && !defined(NO_BIO)
     /* Don't change recv callback if currently using BIO's */
     if (ssl->CBIORecv != SslBioReceive)
@@ -7434,8 +7507,31 @@ int ReinitSSL(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
         XMEMSET(ssl->rng, 0, sizeof(WC_RNG));
         ssl->options.weOwnRng = 1;
 
+#ifdef WOLFSSL_CTX_PARENT_RNG
+        /* Seed from the context's DRBG instead of the entropy source. */
+        if (ctx->parentRng != NULL) {
+            if (wc_LockMutex(&ctx->parentRngMutex) != 0) {
+                WOLFSSL_MSG("Couldn't lock parent RNG mutex");
+                return BAD_MUTEX_E;
+            }
+            ret = wc_InitRngChild_ex(ssl->rng, ctx->parentRng, ssl->heap,
+                ssl->devId);
+            wc_UnLockMutex(&ctx->parentRngMutex);
+            if (ret != 0) {
+                WOLFSSL_MSG("RNG Init error");
+                return ret;
+            }
+        }
+        else
+#endif
         /* FIPS RNG API does not accept a heap hint */
-#ifndef HAVE_FIPS
+#ifdef WC_RNG_CTR_DRBG
+        if ((ret = wc_InitRngCtrDrbg_ex(ssl->rng, ssl->heap,
+                ssl->devId)) != 0) {
+            WOLFSSL_MSG("RNG Init error");
+            return ret;
+        }
+#elif !defined(HAVE_FIPS)
         if ( (ret = wc_InitRng_ex(ssl->rng, ssl->heap, ssl->devId)) != 0) {
             WOLFSSL_MSG("RNG Init error");
             return ret;
@@ -7981,6 +8077,9 @@ int InitSSL(WOLFSSL* ssl, WOLFSSL_CTX* ctx, int writeDup)
             return ret;
     }
 #endif
+#ifdef WOLFSSL_KTLS
+    ssl->ktls.want = ctx->ktls;
+#endif
 
 #if defined(WOLFSSL_MAXQ10XX_TLS)
     ret = wolfSSL_maxq10xx_load_certificate(ssl);
@@ -8387,6 +8486,13 @@ void FreeKeyExchange(WOLFSSL* ssl)
     }
 
     /* Free handshake key */
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    if (ssl->options.hsKeyShared) {
+        /* Key object is owned by the SSL context. */
+        ssl->hsKey = NULL;
+        ssl->options.hsKeyShared = 0;
+    }
+#endif
     FreeKey(ssl, (int)ssl->hsType, &ssl->hsKey);
 #ifdef WOLFSSL_DUAL_ALG_CERTS
     FreeKey(ssl, ssl->hsAltType, &ssl->hsAltKey);
@@ -8442,6 +8548,10 @@ void wolfSSL_ResourceFree(WOLFSSL* ssl)
 #ifdef HAVE_EX_DATA_CLEANUP_HOOKS
     wolfSSL_CRYPTO_cleanup_ex_data(&ssl->ex_data);
 #endif
+#if defined(WOLFSSL_IO_URING) && defined(USE_WOLFSSL_IO)
+    /* the ring must not keep a pointer to the freed object */
+    wolfIO_IoUringFree(ssl);
+#endif
 
     FreeCiphers(ssl);
     FreeArrays(ssl, 0);
@@ -10859,6 +10969,15 @@ static int wolfSSLReceive(WOLFSSL* ssl, byte* buf, word32 sz)
     }
 
 retry:
+#ifdef WOLFSSL_KTLS
+    if (IsKtlsRx(ssl)) {
+        recvd = wolfIO_KtlsRecv(ssl->rfd, &ssl->ktls.rxType, buf, (int)sz,
+                                ssl->rflags);
+        if (recvd == 0)
+            recvd = WOLFSSL_CBIO_ERR_CONN_CLOSE;
+    }
+    else
+#endif
     recvd = ssl->CBIORecv(ssl, (char *)buf, (int)sz, ssl->IOCB_ReadCtx);
     if (recvd < 0) {
         switch (recvd) {
@@ -10952,12 +11071,213 @@ retry:
 }
 
 
+#ifdef WOLFSSL_IO_POOL
+/* Sizes of the buffers in each class of the CTX I/O buffer pool: small and
+ * large handshake messages, one full record, a default read ahead buffer or
+ * batch of records, and a larger one. */
+static const word32 ioPoolSz[WOLFSSL_IO_POOL_CLASSES] = {
+    2048, 8192, 20480, 73728, 98304
+};
+
+/* Get the CTX I/O buffer pool that the connection's buffers come from.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  Pool when it has been set up.
+ * @return  NULL otherwise.
+ */
+static IOPool* IOPoolGet(WOLFSSL* ssl)
+{
+    if (ssl->ctx == NULL || !ssl->ctx->ioPool.init ||
+            ssl->heap != ssl->ctx->heap) {
+        return NULL;
+    }
+    return &ssl->ctx->ioPool;
+}
+#endif /* WOLFSSL_IO_POOL */
+
+/* Check whether the connection borrows I/O buffers from a CTX pool.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  1 when pooling is on.
+ * @return  0 otherwise.
+ */
+static int IOPoolOn(WOLFSSL* ssl)
+{
+#ifdef WOLFSSL_IO_POOL
+    IOPool* pool = IOPoolGet(ssl);
+    return (pool != NULL) && (pool->maxFree != 0);
+#else
+    (void)ssl;
+    return 0;
+#endif
+}
+
+#ifdef WOLFSSL_IO_POOL
+
+/* Get the size of the buffers in a class of the CTX I/O buffer pool.
+ *
+ * @param [in] c  Size class.
+ * @return  Size of buffers in bytes.
+ */
+word32 IOPoolSize(int c)
+{
+    return ioPoolSz[c];
+}
+
+/* Release the free buffers of the CTX I/O buffer pool.
+ *
+ * @param [in, out] ctx  SSL/TLS context.
+ */
+void IOPoolFree(WOLFSSL_CTX* ctx)
+{
+    IOPool* pool = &ctx->ioPool;
+    int c;
+
+    if (!pool->init)
+        return;
+
+    for (c = 0; c < WOLFSSL_IO_POOL_CLASSES; c++) {
+        while (pool->free[c] != NULL) {
+            byte* buf = pool->free[c];
+            XMEMCPY(&pool->free[c], buf, sizeof(byte*));
+            XFREE(buf, ctx->heap, DYNAMIC_TYPE_IO_POOL);
+        }
+        pool->freeCnt[c] = 0;
+    }
+    wc_FreeMutex(&pool->lock);
+    pool->init = 0;
+}
+
+/* Stop counting a borrowed I/O buffer as held from its pool.
+ *
+ * @param [in, out] b  I/O buffer.
+ */
+static void IOPoolDisownBuffer(bufferStatic* b)
+{
+    IOPool* pool = b->pool;
+
+    if (b->dynamicFlag && pool != NULL && wc_LockMutex(&pool->lock) == 0) {
+        if (pool->inUse[b->poolClass - 1] > 0)
+            pool->inUse[b->poolClass - 1]--;
+        wc_UnLockMutex(&pool->lock);
+    }
+    b->pool = NULL;
+}
+
+/* Keep the buffers the connection borrowed from the pool of its CTX as its
+ * own. Called before the connection leaves the CTX, which may then be freed.
+ * The buffers are freed rather than returned when done with.
+ *
+ * @param [in, out] ssl  SSL/TLS object.
+ */
+void IOPoolDisown(WOLFSSL* ssl)
+{
+    IOPoolDisownBuffer(&ssl->buffers.inputBuffer);
+    IOPoolDisownBuffer(&ssl->buffers.outputBuffer);
+}
+#endif /* WOLFSSL_IO_POOL */
+
+/* Allocate memory for an I/O buffer, borrowing it from the CTX pool when on.
+ *
+ * @param [in]  ssl        SSL/TLS object.
+ * @param [in]  sz         Size of buffer in bytes.
+ * @param [out] poolClass  Size class + 1 when from pool, 0 otherwise.
+ * @param [in]  type       Dynamic memory type when not from pool.
+ * @return  Buffer on success.
+ * @return  NULL when out of memory.
+ */
+static byte* IOBufferAlloc(WOLFSSL* ssl, word32 sz, byte* poolClass,
+    int type)
+{
+#ifdef WOLFSSL_IO_POOL
+    IOPool* pool = IOPoolGet(ssl);
+    int c = 0;
+
+    while (c < WOLFSSL_IO_POOL_CLASSES && sz > ioPoolSz[c])
+        c++;
+    if (pool != NULL && c < WOLFSSL_IO_POOL_CLASSES &&
+            wc_LockMutex(&pool->lock) == 0) {
+        byte* buf = NULL;
+        int on = (pool->maxFree != 0);
+
+        if (on) {
+            buf = pool->free[c];
+            if (buf != NULL) {
+                XMEMCPY(&pool->free[c], buf, sizeof(byte*));
+                pool->freeCnt[c]--;
+                pool->hits++;
+            }
+            pool->gets++;
+            pool->inUse[c]++;
+        }
+        wc_UnLockMutex(&pool->lock);
+
+        if (on) {
+            if (buf == NULL) {
+                /* input and output buffers share the pool */
+                buf = (byte*)XMALLOC(ioPoolSz[c], ssl->heap,
+                    DYNAMIC_TYPE_IO_POOL);
+            }
+            if (buf == NULL && wc_LockMutex(&pool->lock) == 0) {
+                pool->inUse[c]--;
+                wc_UnLockMutex(&pool->lock);
+            }
+            *poolClass = (byte)(c + 1);
+            return buf;
+        }
+    }
+#endif
+
+    *poolClass = 0;
+    return (byte*)XMALLOC(sz, ssl->heap, type);
+}
+
+/* Free the dynamic memory of an I/O buffer, returning it to the pool it was
+ * borrowed from. The caller zeroizes the part that was used.
+ *
+ * @param [in]      ssl   SSL/TLS object.
+ * @param [in, out] b     I/O buffer.
+ * @param [in]      type  Dynamic memory type when not from pool.
+ */
+static void IOBufferFree(WOLFSSL* ssl, bufferStatic* b, int type)
+{
+    byte* buf = b->buffer - b->offset;
+#ifdef WOLFSSL_IO_POOL
+    IOPool* pool = b->pool;
+
+    if (b->poolClass != 0)
+        type = DYNAMIC_TYPE_IO_POOL;
+    if (pool != NULL && wc_LockMutex(&pool->lock) == 0) {
+        int c = b->poolClass - 1;
+
+        if (pool->inUse[c] > 0)
+            pool->inUse[c]--;
+        if (pool->freeCnt[c] < pool->maxFree) {
+            XMEMCPY(buf, &pool->free[c], sizeof(byte*));
+            pool->free[c] = buf;
+            pool->freeCnt[c]++;
+            buf = NULL;
+        }
+        wc_UnLockMutex(&pool->lock);
+    }
+    b->pool = NULL;
+#endif
+    b->poolClass = 0;
+
+    XFREE(buf, ssl->heap, type);
+    (void)type;
+}
+
 /* Switch dynamic output buffer back to static, buffer is assumed clear */
 void ShrinkOutputBuffer(WOLFSSL* ssl)
 {
     WOLFSSL_MSG("Shrinking output buffer");
-    XFREE(ssl->buffers.outputBuffer.buffer - ssl->buffers.outputBuffer.offset,
-          ssl->heap, DYNAMIC_TYPE_OUT_BUFFER);
+    /* leave no record data for the next borrower of a pooled buffer */
+    if (ssl->buffers.outputBuffer.poolClass != 0) {
+        ForceZero(ssl->buffers.outputBuffer.buffer,
+            ssl->buffers.outputBuffer.idx + ssl->buffers.outputBuffer.length);
+    }
+    IOBufferFree(ssl, &ssl->buffers.outputBuffer, DYNAMIC_TYPE_OUT_BUFFER);
     ssl->buffers.outputBuffer.buffer = ssl->buffers.outputBuffer.staticBuffer;
     ssl->buffers.outputBuffer.bufferSize  = STATIC_BUFFER_LEN;
     ssl->buffers.outputBuffer.dynamicFlag = 0;
@@ -10975,8 +11295,11 @@ void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree)
 {
     int usedLength = (int)(ssl->buffers.inputBuffer.length -
                      ssl->buffers.inputBuffer.idx);
+    /* keep the read ahead buffer while it holds part of a record, unless it
+     * can be borrowed again from the CTX pool */
     if (!forcedFree && (usedLength > STATIC_BUFFER_LEN ||
-            ssl->buffers.clearOutputBuffer.length > 0))
+            ssl->buffers.clearOutputBuffer.length > 0 ||
+            (ssl->readAheadSz > 0 && !IOPoolOn(ssl) && usedLength > 0)))
         return;
 
     WOLFSSL_MSG("Shrinking input buffer");
@@ -10989,8 +11312,7 @@ void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree)
 
     ForceZero(ssl->buffers.inputBuffer.buffer,
         ssl->buffers.inputBuffer.bufferSize);
-    XFREE(ssl->buffers.inputBuffer.buffer - ssl->buffers.inputBuffer.offset,
-          ssl->heap, DYNAMIC_TYPE_IN_BUFFER);
+    IOBufferFree(ssl, &ssl->buffers.inputBuffer, DYNAMIC_TYPE_IN_BUFFER);
     ssl->buffers.inputBuffer.buffer = ssl->buffers.inputBuffer.staticBuffer;
     ssl->buffers.inputBuffer.bufferSize  = STATIC_BUFFER_LEN;
     ssl->buffers.inputBuffer.dynamicFlag = 0;
@@ -10999,6 +11321,278 @@ void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree)
     ssl->buffers.inputBuffer.length = (word32)usedLength;
 }
 
+#ifdef WOLFSSL_KTLS
+/* Check whether the negotiated connection can be protected by Linux kernel
+ * TLS.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  1 when the kernel can take over record protection.
+ * @return  0 otherwise.
+ */
+static int KtlsSupported(WOLFSSL* ssl)
+{
+    if (ssl->options.dtls || WOLFSSL_IS_QUIC(ssl) ||
+            ssl->options.usingCompression) {
+        return 0;
+    }
+    if (ssl->version.major != SSLv3_MAJOR ||
+            (ssl->version.minor != TLSv1_2_MINOR &&
+             ssl->version.minor != TLSv1_3_MINOR)) {
+        return 0;
+    }
+    /* AES-GCM and ChaCha20-Poly1305 only */
+    if (ssl->specs.bulk_cipher_algorithm == wolfssl_aes_gcm) {
+        if (ssl->specs.key_size != AES_128_KEY_SIZE &&
+                ssl->specs.key_size != AES_256_KEY_SIZE) {
+            return 0;
+        }
+    }
+    else if (ssl->specs.bulk_cipher_algorithm == wolfssl_chacha) {
+    #ifdef HAVE_POLY1305
+        if (ssl->options.oldPoly)
+            return 0;
+    #endif
+    }
+    else {
+        return 0;
+    }
+#ifdef HAVE_MAX_FRAGMENT
+    /* kernel always fills records to the maximum size */
+    if (ssl->max_fragment < MAX_RECORD_SIZE)
+        return 0;
+#endif
+    /* kernel needs to own the socket the default callbacks use */
+    if (ssl->CBIOSend != EmbedSend || ssl->CBIORecv != EmbedReceive ||
+            ssl->IOCB_WriteCtx != &ssl->wfd || ssl->IOCB_ReadCtx != &ssl->rfd ||
+            ssl->rfd != ssl->wfd || ssl->wfd < 0) {
+        return 0;
+    }
+    /* a KeyUpdate would fail the connection when the kernel can't rekey */
+    if (IsAtLeastTLSv1_3(ssl->version) && !wolfIO_KtlsRekeySupported()) {
+        WOLFSSL_MSG("Kernel can't take TLS 1.3 KeyUpdate keys");
+        return 0;
+    }
+
+    return 1;
+}
+
+/* Install the current traffic keys for one direction into the socket.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @param [in] rx   1 for the keys of records received, 0 for records sent.
+ * @return  0 on success.
+ * @return  Negative on failure.
+ */
+static int KtlsSetKey(WOLFSSL* ssl, int rx)
+{
+    int client = (ssl->options.side == WOLFSSL_CLIENT_END);
+    byte seq[SEQ_SZ];
+    const byte* key;
+    const byte* iv;
+
+    /* records sent use our keys, records received use the peer's */
+    if (client != rx) {
+        key = ssl->keys.client_write_key;
+        iv = ssl->keys.client_write_IV;
+    }
+    else {
+        key = ssl->keys.server_write_key;
+        iv = ssl->keys.server_write_IV;
+    }
+    if (rx) {
+        c32toa(ssl->keys.peer_sequence_number_hi, seq);
+        c32toa(ssl->keys.peer_sequence_number_lo, seq + OPAQUE32_LEN);
+    }
+    else {
+        c32toa(ssl->keys.sequence_number_hi, seq);
+        c32toa(ssl->keys.sequence_number_lo, seq + OPAQUE32_LEN);
+    }
+
+    return wolfIO_KtlsSetKey(ssl->wfd, rx, IsAtLeastTLSv1_3(ssl->version),
+        ssl->specs.bulk_cipher_algorithm, key, ssl->specs.key_size, iv, seq);
+}
+
+/* Hand record protection over to the kernel in the directions requested with
+ * wolfSSL_UseKTLS() once the handshake is done and no records are part way
+ * through being sent or processed. Directions that can't be offloaded stay in
+ * software.
+ *
+ * @param [in, out] ssl  SSL/TLS object.
+ */
+void KtlsEnable(WOLFSSL* ssl)
+{
+    if (ssl->ktls.want == 0 || !ssl->options.handShakeDone ||
+            !IsEncryptionOn(ssl, 1)) {
+        return;
+    }
+    if (!KtlsSupported(ssl)) {
+        WOLFSSL_MSG("Connection can't be offloaded to kTLS");
+        ssl->ktls.want = 0;
+        return;
+    }
+
+    if ((ssl->ktls.want & WOLFSSL_KTLS_TX) &&
+            ssl->buffers.outputBuffer.length == 0) {
+        ssl->ktls.want &= (byte)~WOLFSSL_KTLS_TX;
+        if (!ssl->ktls.ulp && wolfIO_KtlsAttach(ssl->wfd) == 0)
+            ssl->ktls.ulp = 1;
+        if (ssl->ktls.ulp && KtlsSetKey(ssl, 0) == 0) {
+            WOLFSSL_MSG("kTLS send offload enabled");
+            ssl->ktls.tx = 1;
+            /* no software records left to resume */
+            ssl->buffers.prevSent = 0;
+            ssl->buffers.plainSz = 0;
+        }
+    }
+    if ((ssl->ktls.want & WOLFSSL_KTLS_RX) &&
+            ssl->options.processReply == doProcessInit &&
+            ssl->buffers.inputBuffer.length == ssl->buffers.inputBuffer.idx) {
+        ssl->ktls.want &= (byte)~WOLFSSL_KTLS_RX;
+        if (!ssl->ktls.ulp && wolfIO_KtlsAttach(ssl->wfd) == 0)
+            ssl->ktls.ulp = 1;
+        if (ssl->ktls.ulp && KtlsSetKey(ssl, 1) == 0) {
+            WOLFSSL_MSG("kTLS receive offload enabled");
+            ssl->ktls.rx = 1;
+        }
+    }
+}
+
+/* Give the kernel the new traffic keys after a TLS 1.3 KeyUpdate.
+ * New send keys are installed once the KeyUpdate message has left the output
+ * buffer.
+ *
+ * @param [in, out] ssl   SSL/TLS object.
+ * @param [in]      side  ENCRYPT_SIDE_ONLY or DECRYPT_SIDE_ONLY.
+ * @return  0 on success.
+ * @return  SOCKET_ERROR_E when the kernel rejects the keys.
+ */
+int KtlsRekey(WOLFSSL* ssl, int side)
+{
+    if (side == ENCRYPT_SIDE_ONLY && ssl->ktls.tx) {
+        ssl->ktls.txRekey = 1;
+        if (ssl->buffers.outputBuffer.length == 0) {
+            ssl->ktls.txRekey = 0;
+            if (KtlsSetKey(ssl, 0) != 0) {
+                WOLFSSL_MSG("kTLS send rekey failed");
+                return SOCKET_ERROR_E;
+            }
+        }
+    }
+    else if (side == DECRYPT_SIDE_ONLY && ssl->ktls.rx) {
+        if (KtlsSetKey(ssl, 1) != 0) {
+            WOLFSSL_MSG("kTLS receive rekey failed");
+            return SOCKET_ERROR_E;
+        }
+    }
+
+    return 0;
+}
+
+/* Put a record into the output buffer in plaintext for the kernel to
+ * protect. Only the content type and length in the header are used.
+ *
+ * @param [in]  ssl         SSL/TLS object.
+ * @param [out] output      Buffer to hold record.
+ * @param [in]  outSz       Size of output buffer in bytes.
+ * @param [in]  input       Record content. May be output + RECORD_HEADER_SZ.
+ * @param [in]  inSz        Size of content in bytes.
+ * @param [in]  type        Record content type.
+ * @param [in]  hashOutput  Whether to hash the handshake message.
+ * @param [in]  sizeOnly    Only calculate the size of the record.
+ * @return  Size of record on success.
+ * @return  BUFFER_E when output is too small.
+ */
+int KtlsBuildRecord(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
+                    int inSz, int type, int hashOutput, int sizeOnly)
+{
+    int sz = RECORD_HEADER_SZ + inSz;
+
+    if (sizeOnly)
+        return sz;
+    if (output == NULL || input == NULL)
+        return BAD_FUNC_ARG;
+    if (sz > outSz)
+        return BUFFER_E;
+
+    output[0] = (byte)type;
+    output[1] = SSLv3_MAJOR;
+    output[2] = TLSv1_2_MINOR;
+    c16toa((word16)inSz, output + OPAQUE8_LEN + VERSION_SZ);
+    if (input != output + RECORD_HEADER_SZ)
+        XMEMMOVE(output + RECORD_HEADER_SZ, input, (size_t)inSz);
+    if (hashOutput) {
+        int ret = HashOutput(ssl, output, sz, 0);
+        if (ret != 0)
+            return ret;
+    }
+
+    return sz;
+}
+
+/* Read the content of the next record from a kTLS socket and lay it out in
+ * the input buffer as a decrypted record, so that ProcessReply() only has to
+ * skip the authentication tag.
+ *
+ * @param [in, out] ssl   SSL/TLS object.
+ * @param [in]      size  Number of bytes of record wanted.
+ * @return  0 on success.
+ * @return  WANT_READ when no data is available.
+ * @return  Negative on failure.
+ */
+static int KtlsGetInputData(WOLFSSL* ssl, word32 size)
+{
+    bufferStatic* in = &ssl->buffers.inputBuffer;
+    int tls13 = IsAtLeastTLSv1_3(ssl->version);
+    word32 extra = ssl->specs.aead_mac_size + (tls13 ? OPAQUE8_LEN : 0);
+    word32 recSz;
+    int recvd;
+
+    if (size <= in->length - in->idx)
+        return 0;
+    if (in->length != in->idx)
+        return BUFFER_ERROR;   /* records are always read whole */
+
+    in->idx = 0;
+    in->length = 0;
+    if (in->bufferSize < RECORD_HEADER_SZ + MAX_RECORD_SIZE + extra) {
+        if (GrowInputBuffer(ssl, (int)(RECORD_HEADER_SZ + MAX_RECORD_SIZE +
+                extra), 0) < 0) {
+            return MEMORY_E;
+        }
+    }
+
+    recvd = wolfSSLReceive(ssl, in->buffer + RECORD_HEADER_SZ,
+                           MAX_RECORD_SIZE);
+    if (recvd == WC_NO_ERR_TRACE(WANT_READ))
+        return WC_NO_ERR_TRACE(WANT_READ);
+    if (recvd < 0) {
+        WOLFSSL_ERROR_VERBOSE(SOCKET_ERROR_E);
+        return SOCKET_ERROR_E;
+    }
+    if (!tls13 && ssl->ktls.rxType != application_data &&
+            ssl->ktls.rxType != alert) {
+        WOLFSSL_MSG("Renegotiation not possible with kTLS");
+        SendAlert(ssl, alert_fatal, unexpected_message);
+        WOLFSSL_ERROR_VERBOSE(OUT_OF_ORDER_E);
+        return OUT_OF_ORDER_E;
+    }
+
+    recSz = (word32)recvd + extra;
+    in->buffer[0] = tls13 ? application_data : ssl->ktls.rxType;
+    in->buffer[1] = SSLv3_MAJOR;
+    in->buffer[2] = TLSv1_2_MINOR;
+    c16toa((word16)recSz, in->buffer + OPAQUE8_LEN + VERSION_SZ);
+    in->length = RECORD_HEADER_SZ + (word32)recvd;
+    if (tls13)
+        in->buffer[in->length++] = ssl->ktls.rxType;
+    /* tag already checked by kernel */
+    XMEMSET(in->buffer + in->length, 0, ssl->specs.aead_mac_size);
+    in->length += ssl->specs.aead_mac_size;
+
+    return 0;
+}
+#endif /* WOLFSSL_KTLS */
+
 int SendBuffered(WOLFSSL* ssl)
 {
     int retryLimit = WOLFSSL_MODE_AUTO_RETRY_ATTEMPTS;
@@ -11029,7 +11623,21 @@ int SendBuffered(WOLFSSL* ssl)
 
     while (ssl->buffers.outputBuffer.length > 0) {
         int sent = 0;
+#ifdef WOLFSSL_KTLS
+        byte* rec = ssl->buffers.outputBuffer.buffer +
+                    ssl->buffers.outputBuffer.idx;
+        word16 recSz = 0;
+#endif
 retry:
+#ifdef WOLFSSL_KTLS
+        if (IsKtlsTx(ssl)) {
+            /* plaintext record - kernel frames the content by type */
+            ato16(rec + OPAQUE8_LEN + VERSION_SZ, &recSz);
+            sent = wolfIO_KtlsSend(ssl->wfd, rec[0], rec + RECORD_HEADER_SZ,
+                                   recSz, ssl->wflags, 0);
+        }
+        else
+#endif
         sent = ssl->CBIOSend(ssl,
                              (char*)ssl->buffers.outputBuffer.buffer +
                              ssl->buffers.outputBuffer.idx,
@@ -11086,14 +11694,38 @@ retry:
             return SEND_OOB_READ_E;
         }
 
+#ifdef WOLFSSL_KTLS
+        if (IsKtlsTx(ssl)) {
+            if (sent == (int)recSz) {
+                sent += RECORD_HEADER_SZ;
+            }
+            else {
+                /* header for the rest of the content goes in front of it */
+                rec[sent] = rec[0];
+                rec[sent + 1] = rec[1];
+                rec[sent + 2] = rec[2];
+                c16toa((word16)(recSz - sent),
+                       rec + sent + OPAQUE8_LEN + VERSION_SZ);
+            }
+        }
+#endif
         ssl->buffers.outputBuffer.idx += (word32)sent;
         ssl->buffers.outputBuffer.length -= (word32)sent;
     }
 
-    ssl->buffers.outputBuffer.idx = 0;
-
+    /* idx is how much of the buffer was used */
     if (ssl->buffers.outputBuffer.dynamicFlag)
         ShrinkOutputBuffer(ssl);
+    ssl->buffers.outputBuffer.idx = 0;
+
+#ifdef WOLFSSL_KTLS
+    if (ssl->ktls.txRekey) {
+        /* KeyUpdate sent - records from now on use the new keys */
+        int ret = KtlsRekey(ssl, ENCRYPT_SIDE_ONLY);
+        if (ret != 0)
+            return ret;
+    }
+#endif
 
     return 0;
 }
@@ -11182,6 +11814,7 @@ static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
     const byte align = WOLFSSL_GENERAL_ALIGNMENT;
 #endif
     word32 newSz;
+    byte   poolClass;
 
 #if WOLFSSL_GENERAL_ALIGNMENT > 0
     /* the encrypted data will be offset from the front of the buffer by
@@ -11201,7 +11834,7 @@ static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
     if (! WC_SAFE_SUM_WORD32(newSz, align, newSz))
         return BUFFER_E;
 #endif
-    tmp = (byte*)XMALLOC(newSz, ssl->heap, DYNAMIC_TYPE_OUT_BUFFER);
+    tmp = IOBufferAlloc(ssl, newSz, &poolClass, DYNAMIC_TYPE_OUT_BUFFER);
     newSz -= align;
     WOLFSSL_MSG("growing output buffer");
 
@@ -11228,11 +11861,18 @@ static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
                ssl->buffers.outputBuffer.length);
 
     if (ssl->buffers.outputBuffer.dynamicFlag) {
-        XFREE(ssl->buffers.outputBuffer.buffer -
-              ssl->buffers.outputBuffer.offset, ssl->heap,
-              DYNAMIC_TYPE_OUT_BUFFER);
+        if (ssl->buffers.outputBuffer.poolClass != 0) {
+            ForceZero(ssl->buffers.outputBuffer.buffer,
+                ssl->buffers.outputBuffer.idx +
+                ssl->buffers.outputBuffer.length);
+        }
+        IOBufferFree(ssl, &ssl->buffers.outputBuffer, DYNAMIC_TYPE_OUT_BUFFER);
     }
     ssl->buffers.outputBuffer.dynamicFlag = 1;
+    ssl->buffers.outputBuffer.poolClass = poolClass;
+#ifdef WOLFSSL_IO_POOL
+    ssl->buffers.outputBuffer.pool = (poolClass != 0) ? IOPoolGet(ssl) : NULL;
+#endif
 
 #if WOLFSSL_GENERAL_ALIGNMENT > 0
     if (align)
@@ -11251,6 +11891,7 @@ static WC_INLINE int GrowOutputBuffer(WOLFSSL* ssl, int size)
 int GrowInputBuffer(WOLFSSL* ssl, int size, int usedLength)
 {
     byte* tmp;
+    byte  poolClass;
 #if defined(WOLFSSL_DTLS) || WOLFSSL_GENERAL_ALIGNMENT > 0
     byte  align = ssl->options.dtls ? WOLFSSL_GENERAL_ALIGNMENT : 0;
     byte  hdrSz = DTLS_RECORD_HEADER_SZ;
@@ -11275,8 +11916,8 @@ int GrowInputBuffer(WOLFSSL* ssl, int size, int usedLength)
         return BAD_FUNC_ARG;
     }
 
-    tmp = (byte*)XMALLOC((size_t)(size + usedLength + align),
-                             ssl->heap, DYNAMIC_TYPE_IN_BUFFER);
+    tmp = IOBufferAlloc(ssl, (word32)(size + usedLength + align), &poolClass,
+                        DYNAMIC_TYPE_IN_BUFFER);
     WOLFSSL_MSG("growing input buffer");
 
     if (tmp == NULL)
@@ -11302,15 +11943,19 @@ int GrowInputBuffer(WOLFSSL* ssl, int size, int usedLength)
                     ssl->buffers.inputBuffer.idx, (size_t)(usedLength));
 
     if (ssl->buffers.inputBuffer.dynamicFlag) {
-        if (IsEncryptionOn(ssl, 1)) {
+        if (IsEncryptionOn(ssl, 1) ||
+                ssl->buffers.inputBuffer.poolClass != 0) {
             ForceZero(ssl->buffers.inputBuffer.buffer,
                 ssl->buffers.inputBuffer.length);
         }
-        XFREE(ssl->buffers.inputBuffer.buffer - ssl->buffers.inputBuffer.offset,
-              ssl->heap, DYNAMIC_TYPE_IN_BUFFER);
+        IOBufferFree(ssl, &ssl->buffers.inputBuffer, DYNAMIC_TYPE_IN_BUFFER);
     }
 
     ssl->buffers.inputBuffer.dynamicFlag = 1;
+    ssl->buffers.inputBuffer.poolClass = poolClass;
+#ifdef WOLFSSL_IO_POOL
+    ssl->buffers.inputBuffer.pool = (poolClass != 0) ? IOPoolGet(ssl) : NULL;
+#endif
 #if defined(WOLFSSL_DTLS) || WOLFSSL_GENERAL_ALIGNMENT > 0
     if (align)
         ssl->buffers.inputBuffer.offset = align - hdrSz;
@@ -12708,6 +13353,22 @@ int CipherRequires(byte first, byte second, int requirement)
         }
     }
 #endif /* WOLFSSL_SM2 && WOLFSSL_SM3 && WOLFSSL_SM4 */
+
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    if (first == ASCON_BYTE) {
+        switch (second) {
+            case TLS_ASCON_AEAD128_SHA256:
+                if (requirement == REQUIRES_AEAD)
+                    return 1;
+                return 0;
+
+            default:
+                WOLFSSL_MSG("Unsupported cipher suite, CipherRequires "
+                            "Ascon");
+                return 0;
+        }
+    }
+#endif /* BUILD_TLS_ASCON_AEAD128_SHA256 */
 #endif /* WOLFSSL_TLS13 */
 
 #ifndef WOLFSSL_NO_TLS12
@@ -17327,6 +17988,7 @@ int DoFinished(WOLFSSL* ssl, const byte* input, word32* inOutIdx, word32 size,
 #endif
             ssl->options.handShakeState = HANDSHAKE_DONE;
             ssl->options.handShakeDone  = 1;
+            ssl->dynRec.sent = 0;
 #ifdef HAVE_SECURE_RENEGOTIATION
             ssl->options.resumed = ssl->options.resuming;
 #endif
@@ -17346,6 +18008,7 @@ int DoFinished(WOLFSSL* ssl, const byte* input, word32* inOutIdx, word32 size,
 #endif
             ssl->options.handShakeState = HANDSHAKE_DONE;
             ssl->options.handShakeDone  = 1;
+            ssl->dynRec.sent = 0;
 #ifdef HAVE_SECURE_RENEGOTIATION
             ssl->options.resumed = ssl->options.resuming;
 #endif
@@ -21603,9 +22266,15 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
     int maxLength;
     int usedLength;
     int dtlsExtra = 0;
+    int readAhead = 0;
 
-    if (ssl->options.disableRead)
-        return WC_NO_ERR_TRACE(WANT_READ);
+#ifdef WOLFSSL_KTLS
+    if (IsKtlsRx(ssl)) {
+        if (ssl->options.disableRead)
+            return WC_NO_ERR_TRACE(WANT_READ);
+        return KtlsGetInputData(ssl, size);
+    }
+#endif
 
     /* check max input length */
     usedLength = (int)(ssl->buffers.inputBuffer.length -
@@ -21639,10 +22308,26 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
         }
 
         inSz = (int)(size - (word32)usedLength); /* from last partial read */
+
+        /* read ahead: take as many records as the socket has in one go */
+        if (ssl->readAheadSz > size && !ssl->options.dtls
+        #ifdef WOLFSSL_KTLS
+            /* leave records after the handshake for the kernel */
+            && (ssl->ktls.want & WOLFSSL_KTLS_RX) == 0
+        #endif
+            ) {
+            readAhead = (int)(ssl->readAheadSz - size);
+            inSz += readAhead;
+        }
     }
 
+    /* data already in the buffer can still be processed */
+    if (ssl->options.disableRead)
+        return WC_NO_ERR_TRACE(WANT_READ);
+
     if (inSz > maxLength) {
-        if (GrowInputBuffer(ssl, (int)(size + (word32)dtlsExtra), usedLength) < 0)
+        if (GrowInputBuffer(ssl, (int)(size + (word32)dtlsExtra +
+                (word32)readAhead), usedLength) < 0)
             return MEMORY_E;
     }
 
@@ -21662,8 +22347,14 @@ static int GetInputData(WOLFSSL *ssl, word32 size)
                      ssl->buffers.inputBuffer.buffer +
                      ssl->buffers.inputBuffer.length,
                      (word32)inSz);
-        if (in == WC_NO_ERR_TRACE(WANT_READ))
+        if (in == WC_NO_ERR_TRACE(WANT_READ)) {
+            /* don't hold a buffer grown for read ahead while waiting */
+            if (ssl->buffers.inputBuffer.length == 0 &&
+                    ssl->buffers.inputBuffer.dynamicFlag) {
+                ShrinkInputBuffer(ssl, NO_FORCED_FREE);
+            }
             return WC_NO_ERR_TRACE(WANT_READ);
+        }
 
         if (in < 0) {
             WOLFSSL_ERROR_VERBOSE(SOCKET_ERROR_E);
@@ -22451,6 +23142,7 @@ default:
         case decryptMessage:
 
             if (IsEncryptionOn(ssl, 0) && ssl->keys.decryptedCur == 0 &&
+                                        !IsKtlsRx(ssl) &&
                                         (!IsAtLeastTLSv1_3(ssl->version) ||
                                          ssl->curRL.type != change_cipher_spec))
             {
@@ -23061,6 +23753,10 @@ default:
 
             /* input exhausted */
             if (ssl->buffers.inputBuffer.idx >= ssl->buffers.inputBuffer.length
+                /* records read ahead: hand over application data before the
+                 * next record replaces it */
+                || (ssl->readAheadSz > 0 &&
+                    ssl->buffers.clearOutputBuffer.length > 0)
 #ifdef WOLFSSL_DTLS
                 || (ssl->options.dtls &&
                     /* If app data was processed then return now to avoid
@@ -23594,6 +24290,28 @@ void FreeBuildMsgArgs(WOLFSSL* ssl, BuildMsgArgs* args)
 }
 #endif
 
+#ifndef WOLFSSL_NO_TLS12
+/* Size of the explicit IV or nonce that BuildMessage() puts between the
+ * record header and the content.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  Size of explicit IV in bytes.
+ */
+static word32 BuildMessageIvSz(WOLFSSL* ssl)
+{
+#ifndef WOLFSSL_AEAD_ONLY
+    if ((ssl->specs.cipher_type == block) && ssl->options.tls1_1)
+        return ssl->specs.block_size;
+#endif
+#ifdef HAVE_AEAD
+    if ((ssl->specs.cipher_type == aead) &&
+            (ssl->specs.bulk_cipher_algorithm != wolfssl_chacha))
+        return AESGCM_EXP_IV_SZ;
+#endif
+    return 0;
+}
+#endif
+
 /* Build SSL Message, encrypted */
 int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
              int inSz, int type, int hashOutput, int sizeOnly, int asyncOkay,
@@ -23624,6 +24342,14 @@ int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
 
     (void)epochOrder;
 
+#ifdef WOLFSSL_KTLS
+    if (IsKtlsTx(ssl)) {
+        /* The kernel protects the record. */
+        return KtlsBuildRecord(ssl, output, outSz, input, inSz, type,
+                               hashOutput, sizeOnly);
+    }
+#endif
+
 #if defined(WOLFSSL_NO_TLS12) && defined(WOLFSSL_TLS13)
     /* TLS v1.3 only */
     return BuildTls13Message(ssl, output, outSz, input, inSz, type,
@@ -23761,7 +24487,7 @@ int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
                 }
 
                 if (ssl->options.tls1_1) {
-                    args->ivSz = blockSz;
+                    args->ivSz = BuildMessageIvSz(ssl);
                     args->sz  += args->ivSz;
 
                     if (args->ivSz > MAX_IV_SZ)
@@ -23786,8 +24512,7 @@ int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
 
         #ifdef HAVE_AEAD
             if (ssl->specs.cipher_type == aead) {
-                if (ssl->specs.bulk_cipher_algorithm != wolfssl_chacha)
-                    args->ivSz = AESGCM_EXP_IV_SZ;
+                args->ivSz = BuildMessageIvSz(ssl);
 
                 args->sz += (args->ivSz + ssl->specs.aead_mac_size - args->digestSz);
             }
@@ -23842,7 +24567,9 @@ int BuildMessage(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
                                         min(args->ivSz, MAX_IV_SZ));
                 args->idx += min(args->ivSz, MAX_IV_SZ);
             }
-            XMEMCPY(output + args->idx, input, (size_t)(inSz));
+            /* Data may already have been gathered in place by SendDataV(). */
+            if (input != output + args->idx)
+                XMEMCPY(output + args->idx, input, (size_t)(inSz));
             args->idx += (word32)inSz;
 #if defined(WOLFSSL_DTLS) && defined(WOLFSSL_DTLS_CID)
             if (ssl->options.dtls && DtlsGetCidTxSize(ssl) > 0) {
@@ -24269,6 +24996,7 @@ int SendFinished(WOLFSSL* ssl)
         #endif
             ssl->options.handShakeState = HANDSHAKE_DONE;
             ssl->options.handShakeDone  = 1;
+            ssl->dynRec.sent = 0;
 #ifdef HAVE_SECURE_RENEGOTIATION
             ssl->options.resumed = ssl->options.resuming;
 #endif
@@ -24284,6 +25012,7 @@ int SendFinished(WOLFSSL* ssl)
         #endif
             ssl->options.handShakeState = HANDSHAKE_DONE;
             ssl->options.handShakeDone  = 1;
+            ssl->dynRec.sent = 0;
 #ifdef HAVE_SECURE_RENEGOTIATION
             ssl->options.resumed = ssl->options.resuming;
 #endif
@@ -25506,6 +26235,12 @@ static int CheckTLS13AEADSendLimit(WOLFSSL* ssl)
             /* Limit is 2^10 - 1 */
             limit = AEAD_SM4_CCM_LIMIT;
             break;
+#endif
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+        case wolfssl_ascon_aead:
+            /* Limit is 2^40 full records */
+            limit = AEAD_ASCON_LIMIT;
+            break;
 #endif
         case wolfssl_cipher_null:
             /* No encryption being done */
@@ -25630,11 +26365,222 @@ int SendAsyncData = 1;
     return 0;
 }
 
-int SendData(WOLFSSL* ssl, const void* data, size_t sz)
+typedef struct SendIov SendIov;
+
+#ifdef WOLFSSL_NATIVE_WRITEV
+/* Position in the caller's iovec list while it is packed into records. */
+struct SendIov {
+    const struct iovec* iov;
+    int    cnt;
+    int    i;    /* current iovec */
+    size_t off;  /* offset into current iovec */
+};
+
+/* Move the iovec cursor to an absolute position in the data.
+ *
+ * @param [in, out] v    iovec cursor.
+ * @param [in]      pos  Number of bytes from start of data.
+ */
+static void SendIovSeek(SendIov* v, size_t pos)
+{
+    v->i = 0;
+    while ((v->i < v->cnt) && (pos >= v->iov[v->i].iov_len)) {
+        pos -= v->iov[v->i].iov_len;
+        v->i++;
+    }
+    v->off = pos;
+}
+
+/* Copy data from the iovec list and advance the cursor.
+ *
+ * @param [in, out] v    iovec cursor.
+ * @param [out]     out  Buffer to gather into.
+ * @param [in]      sz   Number of bytes to gather.
+ */
+static void SendIovGather(SendIov* v, byte* out, word32 sz)
+{
+    while ((sz > 0) && (v->i < v->cnt)) {
+        size_t len = v->iov[v->i].iov_len - v->off;
+
+        if (len > sz)
+            len = sz;
+        XMEMCPY(out, (const byte*)v->iov[v->i].iov_base + v->off, len);
+        out    += len;
+        sz     -= (word32)len;
+        v->off += len;
+        if (v->off == v->iov[v->i].iov_len) {
+            v->i++;
+            v->off = 0;
+        }
+    }
+}
+
+/* Offset of the plaintext in an application data record when built by
+ * BuildMessage() or BuildTls13Message() for TLS (not DTLS).
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  Offset of plaintext from start of record header.
+ */
+static word32 SendDataPayloadOffset(WOLFSSL* ssl)
+{
+    word32 idx = RECORD_HEADER_SZ;
+
+#ifndef WOLFSSL_NO_TLS12
+    if (!ssl->options.tls1_3)
+        idx += BuildMessageIvSz(ssl);
+#else
+    (void)ssl;
+#endif
+    return idx;
+}
+#endif /* WOLFSSL_NATIVE_WRITEV */
+
+#ifdef WOLFSSL_KTLS
+/* Send application data in plaintext over a socket with kTLS send offload.
+ *
+ * @param [in, out] ssl   SSL/TLS object.
+ * @param [in]      data  Data to send when iov is NULL.
+ * @param [in]      sz    Number of bytes to send.
+ * @param [in, out] iov   iovec cursor over data to send, or NULL.
+ * @return  Number of bytes sent on success.
+ * @return  0 when the peer closed the connection.
+ * @return  Negative on failure.
+ */
+static int KtlsSendData(WOLFSSL* ssl, const byte* data, size_t sz,
+                        SendIov* iov)
+{
+    word32 sent = 0;
+
+    /* pick up where a write that would have blocked left off */
+    if (ssl->ktls.txPending) {
+        ssl->ktls.txPending = 0;
+        sent = ssl->ktls.txSent;
+        if (sent > (word32)sz) {
+            WOLFSSL_MSG("error: write() after WANT_WRITE with short size");
+            return (ssl->error = BAD_FUNC_ARG);
+        }
+    }
+#ifdef WOLFSSL_NATIVE_WRITEV
+    if (iov != NULL)
+        SendIovSeek(iov, sent);
+#else
+    (void)iov;
+#endif
+
+    while (sent < (word32)sz) {
+        const byte* buf;
+        word32 len;
+        int more = 0;
+        int ret;
+
+#ifdef WOLFSSL_NATIVE_WRITEV
+        if (iov != NULL) {
+            /* hold back records until the last segment is queued */
+            buf = (const byte*)iov->iov[iov->i].iov_base + iov->off;
+            len = (word32)(iov->iov[iov->i].iov_len - iov->off);
+            more = (sent + len < (word32)sz);
+        }
+        else
+#endif
+        {
+            buf = data + sent;
+            len = (word32)sz - sent;
+        }
+
+        ret = wolfIO_KtlsSend(ssl->wfd, application_data, buf, (int)len,
+                              ssl->wflags, more);
+        if (ret < 0) {
+            switch (ret) {
+                case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_ISR):
+                    continue;
+
+                case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_WANT_WRITE):
+                    ssl->ktls.txSent = sent;
+                    ssl->ktls.txPending = 1;
+                    return (ssl->error = WANT_WRITE);
+
+                case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_CONN_RST):
+                case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_CONN_CLOSE):
+                    ssl->options.connReset = 1;
+                    ssl->error = SOCKET_PEER_CLOSED_E;
+                    WOLFSSL_ERROR(ssl->error);
+                    return 0;  /* peer reset or closed */
+
+                default:
+                    return (ssl->error = SOCKET_ERROR_E);
+            }
+        }
+
+        sent += (word32)ret;
+#ifdef WOLFSSL_NATIVE_WRITEV
+        if (iov != NULL)
+            SendIovSeek(iov, sent);
+#endif
+        if (ssl->options.partialWrite == 1)
+            break;
+    }
+
+    return (int)sent;
+}
+#endif /* WOLFSSL_KTLS */
+
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+/* Check whether application data records are encrypted in pairs.
+ *
+ * Only TLS 1.3 AES-GCM records encrypted by wolfSSL are paired.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  1 when records are paired.
+ * @return  0 otherwise.
+ */
+static int SendGcmRecordsOn(WOLFSSL* ssl)
+{
+    if (!ssl->options.tls1_3 || ssl->options.dtls || !IsEncryptionOn(ssl, 1) ||
+            (ssl->specs.bulk_cipher_algorithm != wolfssl_aes_gcm)) {
+        return 0;
+    }
+#ifdef WOLFSSL_QUIC
+    if (WOLFSSL_IS_QUIC(ssl))
+        return 0;
+#endif
+#ifdef HAVE_PK_CALLBACKS
+    if (ssl->ctx->PerformTlsRecordProcessingCb != NULL)
+        return 0;
+#endif
+#ifdef ATOMIC_USER
+    if (ssl->ctx->MacEncryptCb != NULL)
+        return 0;
+#endif
+    return 1;
+}
+#endif /* WOLFSSL_SEND_GCM_RECORDS */
+
+/* Send application data from a buffer or, when iov is not NULL, gathered
+ * from an iovec list straight into the records.
+ *
+ * With TLS, records built from an iovec list are packed into the output
+ * buffer and sent together, up to WOLFSSL_WRITEV_BATCH_SZ bytes of plaintext
+ * at a time. When WOLFSSL_SEND_BATCH_SZ is defined, the records of every
+ * large write are packed, up to WOLFSSL_SEND_BATCH_SZ bytes at a time.
+ *
+ * With TLS 1.3 and AES-GCM, consecutive records are encrypted in pairs with
+ * wc_AesGcmEncryptRecords(). The records of a pair are always sent together.
+ */
+static int SendDataEx(WOLFSSL* ssl, const void* data, size_t sz, SendIov* iov)
 {
     word32 sent = 0; /* plainText size */
     int sendSz,
         ret;
+#ifdef WOLFSSL_SEND_BATCH
+    int    batch;       /* pack records before sending */
+    word32 batchSz = 0; /* plainText in records not yet sent */
+    word32 batchIdx = 0; /* output buffer length before the batch */
+    word32 batchMax = WOLFSSL_WRITEV_BATCH_SZ; /* plainText per batch */
+#endif
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+    int    gcmPairs;    /* encrypt records in pairs */
+    int    pairOnly = 0; /* batch is only the pair of records */
+#endif
 #if defined(WOLFSSL_EARLY_DATA) && defined(WOLFSSL_EARLY_DATA_GROUP)
     int groupMsgs = 0;
 #endif
@@ -25667,6 +26613,12 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
             return WOLFSSL_FATAL_ERROR;
         }
     }
+    /* don't allow write after a record failed to build - records not sent
+     * leave a gap in sequence numbers the peer won't verify across */
+    if (error == WC_NO_ERR_TRACE(BUILD_MSG_ERROR) && !ssl->options.dtls) {
+        WOLFSSL_MSG("Not allowing write after failing to build a record");
+        return WOLFSSL_FATAL_ERROR;
+    }
 
 #ifdef WOLFSSL_EARLY_DATA
     if (ssl->options.side == WOLFSSL_CLIENT_END &&
@@ -25775,11 +26727,56 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
     }
 #endif
 
+#ifdef WOLFSSL_KTLS
+    if (ssl->ktls.want != 0)
+        KtlsEnable(ssl);
+    if (IsKtlsTx(ssl))
+        return KtlsSendData(ssl, (const byte*)data, sz, iov);
+#endif
+
+#ifdef WOLFSSL_NATIVE_WRITEV
+    if (iov != NULL)
+        SendIovSeek(iov, sent);
+#else
+    (void)iov;
+#endif
+#ifdef WOLFSSL_SEND_BATCH
+    batch = !ssl->options.dtls && !ssl->options.usingCompression &&
+            (ssl->options.partialWrite == 0);
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+    gcmPairs = batch && SendGcmRecordsOn(ssl);
+#endif
+#ifdef WOLFSSL_SEND_BATCH_ALL
+    if (iov == NULL)
+        batchMax = WOLFSSL_SEND_BATCH_SZ;
+#elif defined(WOLFSSL_SEND_GCM_RECORDS)
+    if (iov == NULL) {
+        /* only the records encrypted together are sent together */
+        batch = gcmPairs;
+        pairOnly = 1;
+    }
+#else
+    batch = batch && (iov != NULL);
+#endif
+#endif
+#ifndef NO_ASN_TIME
+    if (ssl->dynRec.smallSz != 0) {
+        /* back to small records after the connection has been idle */
+        word32 now = LowResTimer();
+        if (ssl->dynRec.idleSec != 0 &&
+                now - ssl->dynRec.last >= ssl->dynRec.idleSec) {
+            ssl->dynRec.sent = 0;
+        }
+        ssl->dynRec.last = now;
+    }
+#endif
+
     for (;;) {
         byte* out;
-        byte* sendBuffer = (byte*)data + sent;  /* may switch on comp */
+        byte* sendBuffer;                       /* may switch on comp */
         int   buffSz;                           /* may switch on comp */
         int   outputSz;
+        int   reserveSz;
 #ifdef HAVE_LIBZ
         byte  comp[MAX_RECORD_SIZE + MAX_COMP_EXTRA];
 #endif
@@ -25792,6 +26789,10 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
         if (IsAtLeastTLSv1_3(ssl->version)) {
             ret = CheckTLS13AEADSendLimit(ssl);
             if (ret != 0) {
+            #ifdef WOLFSSL_SEND_GCM_RECORDS
+                /* never leave a built record unencrypted */
+                (void)Tls13GcmRecordsFlush(ssl);
+            #endif
                 ssl->error = ret;
                 return WOLFSSL_FATAL_ERROR;
             }
@@ -25844,7 +26845,12 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
 #endif
         {
             buffSz = wolfSSL_GetMaxFragSize(ssl, (word32)sz - sent);
-
+            /* small records until the ramp up is done */
+            if (ssl->dynRec.sent < ssl->dynRec.rampSz &&
+                    buffSz > (int)ssl->dynRec.smallSz &&
+                    ssl->dynRec.smallSz != 0) {
+                buffSz = (int)ssl->dynRec.smallSz;
+            }
         }
 
         if (sent == (word32)sz) break;
@@ -25869,9 +26875,32 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
         }
 #endif
 
+        reserveSz = outputSz;
+#ifdef WOLFSSL_SEND_BATCH
+        if (batch && (batchSz == 0)) {
+            /* make room for all records of the batch up front */
+            word32 left = min((word32)sz - sent, batchMax);
+
+        #ifdef WOLFSSL_SEND_GCM_RECORDS
+            if (pairOnly)
+                left = min(left, 2 * (word32)buffSz);
+        #endif
+            reserveSz = outputSz *
+                (int)((left + (word32)buffSz - 1) / (word32)buffSz);
+        }
+#endif
+
         /* check for available size */
-        if ((ret = CheckAvailableSize(ssl, outputSz)) != 0)
+        if ((ret = CheckAvailableSize(ssl, reserveSz)) != 0) {
+        #ifdef WOLFSSL_SEND_GCM_RECORDS
+            (void)Tls13GcmRecordsFlush(ssl);
+        #endif
             return (ssl->error = ret);
+        }
+#ifdef WOLFSSL_SEND_BATCH
+        if (batch && (batchSz == 0))
+            batchIdx = ssl->buffers.outputBuffer.length;
+#endif
 
         /* get output buffer */
 #ifndef WOLFSSL_THREADED_CRYPT
@@ -25899,6 +26928,18 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
         out = encrypt->buffer.buffer;
 #endif
 
+#ifdef WOLFSSL_NATIVE_WRITEV
+        if (iov != NULL) {
+            /* gather plaintext where the record is built and encrypted */
+            sendBuffer = out + SendDataPayloadOffset(ssl);
+            SendIovGather(iov, sendBuffer, (word32)buffSz);
+        }
+        else
+#endif
+        {
+            sendBuffer = (byte*)data + sent;
+        }
+
 #ifdef HAVE_LIBZ
         if (ssl->options.usingCompression) {
             buffSz = myCompress(ssl, sendBuffer, buffSz, comp, sizeof(comp));
@@ -25924,8 +26965,17 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
         }
         else {
 #ifdef WOLFSSL_TLS13
+        #ifdef WOLFSSL_SEND_GCM_RECORDS
+            /* wait for the next record of the batch to encrypt both */
+            ssl->sendGcm.defer = gcmPairs && (ssl->sendGcm.cnt == 0) &&
+                (sent + (word32)buffSz < (word32)sz) &&
+                (batchSz + (word32)buffSz < batchMax);
+        #endif
             sendSz = BuildTls13Message(ssl, out, outputSz, sendBuffer, buffSz,
                                        application_data, 0, 0, 1);
+        #ifdef WOLFSSL_SEND_GCM_RECORDS
+            ssl->sendGcm.defer = 0;
+        #endif
 #else
             sendSz = BUFFER_ERROR;
 #endif
@@ -25935,8 +26985,26 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
             if (sendSz == WC_NO_ERR_TRACE(WC_PENDING_E))
                 ssl->error = sendSz;
         #endif
+        #ifdef WOLFSSL_SEND_GCM_RECORDS
+            (void)Tls13GcmRecordsFlush(ssl);
+        #endif
+        #ifdef WOLFSSL_SEND_BATCH
+            /* records of the batch built so far are not sent */
+            if (batch)
+                ssl->buffers.outputBuffer.length = batchIdx;
+        #endif
+            /* sequence number of the record is used - fatal for TLS */
+            if (!ssl->options.dtls
+            #ifdef WOLFSSL_ASYNC_CRYPT
+                    && sendSz != WC_NO_ERR_TRACE(WC_PENDING_E)
+            #endif
+                ) {
+                ssl->error = BUILD_MSG_ERROR;
+            }
             return BUILD_MSG_ERROR;
         }
+        if (ssl->dynRec.sent < ssl->dynRec.rampSz)
+            ssl->dynRec.sent += (word32)buffSz;
 
 #ifdef WOLFSSL_ASYNC_CRYPT
         FreeAsyncCtx(ssl, 0);
@@ -25990,6 +27058,26 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
 #else
         ssl->buffers.outputBuffer.length += (word32)sendSz;
 
+#ifdef WOLFSSL_SEND_BATCH
+        if (batch) {
+            /* keep packing records until the batch is full */
+            if ((sent + (word32)buffSz < (word32)sz) &&
+                    (batchSz + (word32)buffSz < batchMax)
+            #ifdef WOLFSSL_SEND_GCM_RECORDS
+                    && (!pairOnly || (ssl->sendGcm.cnt > 0))
+            #endif
+                    ) {
+                batchSz += (word32)buffSz;
+                sent += (word32)buffSz;
+                continue;
+            }
+            /* send all records of the batch at once */
+            sent -= batchSz;
+            buffSz += (int)batchSz;
+            batchSz = 0;
+        }
+#endif
+
         if ( (error = SendBuffered(ssl)) < 0) {
             ssl->error = error;
             WOLFSSL_ERROR(error);
@@ -26023,8 +27111,128 @@ int SendData(WOLFSSL* ssl, const void* data, size_t sz)
     return sent;
 }
 
-/* process input data */
-int ReceiveData(WOLFSSL* ssl, byte* output, size_t sz, int peek)
+int SendData(WOLFSSL* ssl, const void* data, size_t sz)
+{
+    return SendDataEx(ssl, data, sz, NULL);
+}
+
+#ifdef WOLFSSL_NATIVE_WRITEV
+/* Send application data gathered from an iovec list.
+ *
+ * The data is copied once, straight into the records in the output buffer.
+ * Only for TLS without compression.
+ *
+ * @param [in] ssl     SSL/TLS object.
+ * @param [in] iov     List of buffers to send.
+ * @param [in] iovcnt  Number of buffers in list.
+ * @param [in] sz      Total length of data in buffers.
+ * @return  Number of bytes sent on success.
+ * @return  BAD_STATE_E when DTLS or compression in use.
+ * @return  Other negative value on failure.
+ */
+int SendDataV(WOLFSSL* ssl, const struct iovec* iov, int iovcnt, size_t sz)
+{
+    SendIov v;
+
+    if (ssl->options.dtls
+    #ifdef HAVE_LIBZ
+        || ssl->options.usingCompression
+    #endif
+        ) {
+        return BAD_STATE_E;
+    }
+
+    v.iov = iov;
+    v.cnt = iovcnt;
+    v.i   = 0;
+    v.off = 0;
+
+    return SendDataEx(ssl, NULL, sz, &v);
+}
+#endif /* WOLFSSL_NATIVE_WRITEV */
+
+/* Get the value for ReceiveDataEx() to return when processing records failed.
+ *
+ * @param [in, out] ssl    SSL/TLS object.
+ * @param [in]      error  Error from processing records.
+ * @return  0 when the peer closed the connection.
+ * @return  error otherwise.
+ */
+static int ReceiveDataError(WOLFSSL* ssl, int error)
+{
+    if (error == WC_NO_ERR_TRACE(ZERO_RETURN)) {
+        ssl->error = error;
+        WOLFSSL_MSG("Zero return, no more data coming");
+        return 0; /* no more data coming */
+    }
+    if (error == WC_NO_ERR_TRACE(SOCKET_ERROR_E)) {
+        if (ssl->options.connReset || ssl->options.isClosed) {
+            WOLFSSL_MSG("Peer reset or closed, connection done");
+            error = SOCKET_PEER_CLOSED_E;
+            ssl->error = error;
+            WOLFSSL_ERROR(error);
+            return 0; /* peer reset or closed */
+        }
+    }
+    ssl->error = error;
+    WOLFSSL_ERROR(error);
+    return error;
+}
+
+/* Append application data from records already read ahead into the input
+ * buffer, without reading from the socket.
+ *
+ * An error processing the records is kept for the next read as the data
+ * already copied has to be returned first.
+ *
+ * @param [in, out] ssl     SSL/TLS object.
+ * @param [out]     output  Buffer to copy application data into.
+ * @param [in]      sz      Size of output in bytes.
+ * @return  Number of bytes of application data copied.
+ */
+static int ReceiveDataReadAhead(WOLFSSL* ssl, byte* output, size_t sz)
+{
+    bufferStatic* in = &ssl->buffers.inputBuffer;
+    size_t size = 0;
+    byte disableRead = ssl->options.disableRead;
+
+    ssl->options.disableRead = 1;
+    while (size < sz && ssl->buffers.clearOutputBuffer.length == 0 &&
+            ssl->options.processReply == doProcessInit &&
+            in->length - in->idx >= RECORD_HEADER_SZ &&
+            /* TLS 1.2 handshake and alert records go to the next read */
+            in->buffer[in->idx] == application_data) {
+        word32 n;
+        int ret = ProcessReply(ssl);
+
+        if (ret == WC_NO_ERR_TRACE(WANT_READ)) {
+            /* record not all read yet */
+            break;
+        }
+        if (ret < 0) {
+            ssl->readAheadErr = ret;
+            break;
+        }
+
+        n = ssl->buffers.clearOutputBuffer.length;
+        if (n > sz - size)
+            n = (word32)(sz - size);
+        XMEMCPY(output + size, ssl->buffers.clearOutputBuffer.buffer, n);
+        ssl->buffers.clearOutputBuffer.length -= n;
+        ssl->buffers.clearOutputBuffer.buffer += n;
+        size += n;
+    }
+    ssl->options.disableRead = disableRead;
+
+    return (int)size;
+}
+
+/* process input data
+ *
+ * When zc is not NULL, it is set to the plaintext in the input buffer instead
+ * of copying into output. */
+static int ReceiveDataEx(WOLFSSL* ssl, byte* output, const byte** zc,
+    size_t sz, int peek)
 {
     int size;
     int error = ssl->error;
@@ -26036,6 +27244,13 @@ int ReceiveData(WOLFSSL* ssl, byte* output, size_t sz, int peek)
         return WOLFSSL_FATAL_ERROR;
     }
 
+    if (ssl->readAheadErr != 0) {
+        /* data before the failing record has been returned */
+        error = ssl->readAheadErr;
+        ssl->readAheadErr = 0;
+        return ReceiveDataError(ssl, error);
+    }
+
     /* reset error state */
     if (error == WC_NO_ERR_TRACE(WANT_READ) ||
         error == WOLFSSL_ERROR_WANT_READ) {
@@ -26104,24 +27319,12 @@ startScr:
 #endif
 
     while (ssl->buffers.clearOutputBuffer.length == 0) {
+    #ifdef WOLFSSL_KTLS
+        if (ssl->ktls.want != 0)
+            KtlsEnable(ssl);
+    #endif
         if ( (error = ProcessReply(ssl)) < 0) {
-            if (error == WC_NO_ERR_TRACE(ZERO_RETURN)) {
-                ssl->error = error;
-                WOLFSSL_MSG("Zero return, no more data coming");
-                return 0; /* no more data coming */
-            }
-            if (error == WC_NO_ERR_TRACE(SOCKET_ERROR_E)) {
-                if (ssl->options.connReset || ssl->options.isClosed) {
-                    WOLFSSL_MSG("Peer reset or closed, connection done");
-                    error = SOCKET_PEER_CLOSED_E;
-                    ssl->error = error;
-                    WOLFSSL_ERROR(error);
-                    return 0; /* peer reset or closed */
-                }
-            }
-            ssl->error = error;
-            WOLFSSL_ERROR(error);
-            return error;
+            return ReceiveDataError(ssl, error);
         }
 
 #ifndef WOLFSSL_RW_THREADED
@@ -26188,11 +27391,21 @@ startScr:
     size = (sz < (size_t)ssl->buffers.clearOutputBuffer.length) ?
         (int)sz : (int)ssl->buffers.clearOutputBuffer.length;
 
-    XMEMCPY(output, ssl->buffers.clearOutputBuffer.buffer, (size_t)(size));
+    if (zc != NULL)
+        *zc = ssl->buffers.clearOutputBuffer.buffer;
+    else
+        XMEMCPY(output, ssl->buffers.clearOutputBuffer.buffer, (size_t)(size));
 
     if (peek == 0) {
         ssl->buffers.clearOutputBuffer.length -= (word32)size;
         ssl->buffers.clearOutputBuffer.buffer += size;
+
+        /* fill the rest of output from the records read ahead */
+        if (zc == NULL && ssl->readAheadSz > 0 && !ssl->options.dtls &&
+                ssl->options.handShakeDone) {
+            size += ReceiveDataReadAhead(ssl, output + size,
+                sz - (size_t)size);
+        }
     }
 
     if (ssl->buffers.inputBuffer.dynamicFlag)
@@ -26202,6 +27415,52 @@ startScr:
     return size;
 }
 
+int ReceiveData(WOLFSSL* ssl, byte* output, size_t sz, int peek)
+{
+    return ReceiveDataEx(ssl, output, NULL, sz, peek);
+}
+
+/* Get decrypted application data in place without consuming it.
+ *
+ * The plaintext stays in the input buffer until released with
+ * ReceiveDataRelease(). The input buffer is not shrunk or moved while there is
+ * plaintext left in it.
+ *
+ * @param [in]  ssl   SSL/TLS object.
+ * @param [out] data  Pointer to plaintext in input buffer.
+ * @param [in]  sz    Maximum number of bytes wanted.
+ * @return  Number of bytes of plaintext at data on success.
+ * @return  0 when no more data is coming.
+ * @return  Negative value on failure.
+ */
+int ReceiveDataZc(WOLFSSL* ssl, const byte** data, size_t sz)
+{
+    return ReceiveDataEx(ssl, NULL, data, sz, TRUE);
+}
+
+/* Consume plaintext returned by ReceiveDataZc().
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @param [in] sz   Number of bytes of plaintext to consume.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when sz is more than the plaintext available.
+ */
+int ReceiveDataRelease(WOLFSSL* ssl, size_t sz)
+{
+    if (sz > ssl->buffers.clearOutputBuffer.length) {
+        WOLFSSL_MSG("Releasing more data than was read");
+        return BAD_FUNC_ARG;
+    }
+
+    ssl->buffers.clearOutputBuffer.length -= (word32)sz;
+    ssl->buffers.clearOutputBuffer.buffer += sz;
+
+    if (ssl->buffers.inputBuffer.dynamicFlag)
+       ShrinkInputBuffer(ssl, NO_FORCED_FREE);
+
+    return 0;
+}
+
 static int SendAlert_ex(WOLFSSL* ssl, int severity, int type)
 {
     byte input[ALERT_SIZE];
@@ -27215,6 +28474,11 @@ static const CipherSuiteInfo cipher_names[] =
     SUITE_INFO("TLS13-SM4-CCM-SM3","TLS_SM4_CCM_SM3",CIPHER_BYTE,TLS_SM4_CCM_SM3, TLSv1_3_MINOR, SSLv3_MAJOR),
 #endif
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    /* Private use code point - not in InitSuites(), only used when named. */
+    SUITE_INFO("TLS13-ASCON-AEAD128-SHA256","TLS_ASCON_AEAD128_SHA256",ASCON_BYTE,TLS_ASCON_AEAD128_SHA256, TLSv1_3_MINOR, SSLv3_MAJOR),
+#endif
+
 #ifdef BUILD_TLS_SHA256_SHA256
     SUITE_INFO("TLS13-SHA256-SHA256","TLS_SHA256_SHA256",ECC_BYTE,TLS_SHA256_SHA256,TLSv1_3_MINOR, SSLv3_MAJOR),
 #endif
@@ -28451,7 +29715,8 @@ static int ParseCipherList(Suites* suites,
                 if (cipher_names[i].cipherSuite0 == TLS13_BYTE ||
                          (cipher_names[i].cipherSuite0 == ECC_BYTE &&
                           (cipher_names[i].cipherSuite == TLS_SHA256_SHA256 ||
-                           cipher_names[i].cipherSuite == TLS_SHA384_SHA384))) {
+                           cipher_names[i].cipherSuite == TLS_SHA384_SHA384)) ||
+                         cipher_names[i].cipherSuite0 == ASCON_BYTE) {
                 #ifndef NO_RSA
                     haveSig |= SIG_RSA;
                 #endif
@@ -28687,7 +29952,7 @@ int SetCipherListFromBytes(WOLFSSL_CTX* ctx, Suites* suites, const byte* list,
              (secondByte == TLS_SHA256_SHA256 ||
               secondByte == TLS_SHA384_SHA384)) ||
             (firstByte == CIPHER_BYTE && (secondByte == TLS_SM4_GCM_SM3 ||
-              secondByte == TLS_SM4_CCM_SM3))) {
+              secondByte == TLS_SM4_CCM_SM3)) || firstByte == ASCON_BYTE) {
         #ifndef NO_RSA
             haveRSAsig = 1;
         #endif
@@ -29615,6 +30880,343 @@ int CreateDevPrivateKey(void** pkey, byte* data, word32 length, int hsType,
 }
 #endif /* WOLF_PRIVATE_KEY_ID && !NO_CHECK_PRIVATE_KEY */
 
+#ifdef WOLFSSL_CTX_DECODED_KEY
+/* Dispose of the key object that the SSL context decoded.
+ *
+ * @param [in, out] ctx  SSL context object.
+ */
+void FreeCtxDecodedKey(WOLFSSL_CTX* ctx)
+{
+    if (ctx->decodedKey == NULL) {
+        return;
+    }
+
+    switch (ctx->decodedKeyType) {
+    #if !defined(NO_RSA) && !defined(WOLFSSL_RSA_PUBLIC_ONLY)
+        case DYNAMIC_TYPE_RSA:
+            wc_FreeRsaKey((RsaKey*)ctx->decodedKey);
+            break;
+    #endif
+    #if defined(HAVE_ECC) && !defined(WOLFSSL_ECC_BLIND_K) && \
+        !defined(WOLFSSL_CUSTOM_CURVES)
+        case DYNAMIC_TYPE_ECC:
+            wc_ecc_free((ecc_key*)ctx->decodedKey);
+            break;
+    #endif
+    #if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED25519_PERSISTENT_SHA)
+        case DYNAMIC_TYPE_ED25519:
+            wc_ed25519_free((ed25519_key*)ctx->decodedKey);
+            break;
+    #endif
+    #if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED448_PERSISTENT_SHA)
+        case DYNAMIC_TYPE_ED448:
+            wc_ed448_free((ed448_key*)ctx->decodedKey);
+            break;
+    #endif
+        default:
+            break;
+    }
+    XFREE(ctx->decodedKey, ctx->heap, ctx->decodedKeyType);
+    ctx->decodedKey = NULL;
+    ctx->decodedKeyType = 0;
+}
+
+/* Decode the SSL context's private key once so that SSL objects can sign
+ * without parsing the DER encoding on every handshake.
+ *
+ * Only RSA, ECC, Ed25519 and Ed448 private keys are decoded. Other keys, and
+ * keys that are not private keys, are left to DecodePrivateKey().
+ *
+ * @param [in, out] ctx  SSL context object.
+ * @return  0 on success or when the key is not decoded.
+ * @return  MEMORY_E when dynamic memory allocation fails.
+ */
+int DecodeCtxPrivateKey(WOLFSSL_CTX* ctx)
+{
+    int    ret = 0;
+    word32 type = 0;
+    word32 sz = 0;
+    word32 idx = 0;
+    void*  key;
+
+    FreeCtxDecodedKey(ctx);
+
+    if ((ctx->privateKey == NULL) || ctx->privateKeyId ||
+            ctx->privateKeyLabel) {
+        return 0;
+    }
+
+    switch (ctx->privateKeyType) {
+    #if !defined(NO_RSA) && !defined(WOLFSSL_RSA_PUBLIC_ONLY)
+        case rsa_sa_algo:
+            type = DYNAMIC_TYPE_RSA;
+            sz = (word32)sizeof(RsaKey);
+            break;
+    #endif
+    #if defined(HAVE_ECC) && !defined(WOLFSSL_ECC_BLIND_K) && \
+        !defined(WOLFSSL_CUSTOM_CURVES)
+        case ecc_dsa_sa_algo:
+            type = DYNAMIC_TYPE_ECC;
+            sz = (word32)sizeof(ecc_key);
+            break;
+    #endif
+    #if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED25519_PERSISTENT_SHA)
+        case ed25519_sa_algo:
+            type = DYNAMIC_TYPE_ED25519;
+            sz = (word32)sizeof(ed25519_key);
+            break;
+    #endif
+    #if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED448_PERSISTENT_SHA)
+        case ed448_sa_algo:
+            type = DYNAMIC_TYPE_ED448;
+            sz = (word32)sizeof(ed448_key);
+            break;
+    #endif
+        default:
+            return 0;
+    }
+
+    key = XMALLOC(sz, ctx->heap, type);
+    if (key == NULL) {
+        return MEMORY_E;
+    }
+
+    /* Key is initialized and then decoded without a device so that each SSL
+     * object can use its own. */
+    switch (type) {
+    #if !defined(NO_RSA) && !defined(WOLFSSL_RSA_PUBLIC_ONLY)
+        case DYNAMIC_TYPE_RSA:
+            ret = wc_InitRsaKey_ex((RsaKey*)key, ctx->heap, INVALID_DEVID);
+            if (ret == 0) {
+                ret = wc_RsaPrivateKeyDecode(ctx->privateKey->buffer, &idx,
+                    (RsaKey*)key, ctx->privateKey->length);
+                if (ret != 0) {
+                    wc_FreeRsaKey((RsaKey*)key);
+                }
+            }
+            break;
+    #endif
+    #if defined(HAVE_ECC) && !defined(WOLFSSL_ECC_BLIND_K) && \
+        !defined(WOLFSSL_CUSTOM_CURVES)
+        case DYNAMIC_TYPE_ECC:
+            ret = wc_ecc_init_ex((ecc_key*)key, ctx->heap, INVALID_DEVID);
+            if (ret == 0) {
+                ret = wc_EccPrivateKeyDecode(ctx->privateKey->buffer, &idx,
+                    (ecc_key*)key, ctx->privateKey->length);
+                if (ret != 0) {
+                    wc_ecc_free((ecc_key*)key);
+                }
+            }
+            break;
+    #endif
+    #if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED25519_PERSISTENT_SHA)
+        case DYNAMIC_TYPE_ED25519:
+            ret = wc_ed25519_init_ex((ed25519_key*)key, ctx->heap,
+                INVALID_DEVID);
+            if (ret == 0) {
+                ret = wc_Ed25519PrivateKeyDecode(ctx->privateKey->buffer, &idx,
+                    (ed25519_key*)key, ctx->privateKey->length);
+                if (ret != 0) {
+                    wc_ed25519_free((ed25519_key*)key);
+                }
+            }
+            break;
+    #endif
+    #if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED448_PERSISTENT_SHA)
+        case DYNAMIC_TYPE_ED448:
+            ret = wc_ed448_init_ex((ed448_key*)key, ctx->heap, INVALID_DEVID);
+            if (ret == 0) {
+                ret = wc_Ed448PrivateKeyDecode(ctx->privateKey->buffer, &idx,
+                    (ed448_key*)key, ctx->privateKey->length);
+                if (ret != 0) {
+                    wc_ed448_free((ed448_key*)key);
+                }
+            }
+            break;
+    #endif
+        default:
+            break;
+    }
+
+    if (ret == 0) {
+        ctx->decodedKey = key;
+        ctx->decodedKeyType = type;
+    }
+    else {
+        /* Not a private key - may be a public key used with a device or
+         * callback. Leave decoding to each SSL object. */
+        WOLFSSL_MSG("CTX private key not decoded");
+        XFREE(key, ctx->heap, type);
+        ret = 0;
+    }
+
+    return ret;
+}
+
+/* Set the handshake key from the key the SSL context decoded.
+ *
+ * Ed25519 and Ed448 signing only reads the key so the context's key object is
+ * shared. RSA and ECC operations keep state in the key object, and set the
+ * RNG in it, so they can't share one across threads. The decoded values are
+ * copied into a key allocated for the SSL object - only the DER parse is
+ * saved.
+ *
+ * @param [in, out] ssl     SSL object.
+ * @param [out]     length  Maximum length of a signature.
+ * @return  0 on success.
+ * @return  RSA_KEY_SIZE_E or ECC_KEY_SIZE_E when the key is too small.
+ * @return  BAD_STATE_E when a handshake key is already set.
+ * @return  Other negative value on failure.
+ */
+static int UseCtxDecodedKey(WOLFSSL* ssl, word32* length)
+{
+    WOLFSSL_CTX* ctx = ssl->ctx;
+    int ret = 0;
+    int keySz;
+
+    ssl->hsType = ctx->decodedKeyType;
+    switch (ctx->decodedKeyType) {
+    #if !defined(NO_RSA) && !defined(WOLFSSL_RSA_PUBLIC_ONLY)
+        case DYNAMIC_TYPE_RSA:
+        {
+            RsaKey* src = (RsaKey*)ctx->decodedKey;
+            RsaKey* dst;
+
+            ret = AllocKey(ssl, (int)ssl->hsType, &ssl->hsKey);
+            if (ret != 0) {
+                break;
+            }
+            dst = (RsaKey*)ssl->hsKey;
+
+            ret = mp_copy(&src->n, &dst->n);
+            if (ret == 0)
+                ret = mp_copy(&src->e, &dst->e);
+            if (ret == 0)
+                ret = mp_copy(&src->d, &dst->d);
+            if (ret == 0)
+                ret = mp_copy(&src->p, &dst->p);
+            if (ret == 0)
+                ret = mp_copy(&src->q, &dst->q);
+        #if defined(WOLFSSL_KEY_GEN) || defined(OPENSSL_EXTRA) || \
+            !defined(RSA_LOW_MEM)
+            if (ret == 0)
+                ret = mp_copy(&src->dP, &dst->dP);
+            if (ret == 0)
+                ret = mp_copy(&src->dQ, &dst->dQ);
+            if (ret == 0)
+                ret = mp_copy(&src->u, &dst->u);
+        #endif
+            if (ret != 0) {
+                break;
+            }
+            dst->type = src->type;
+
+            /* Check it meets the minimum RSA key size requirements. */
+            keySz = wc_RsaEncryptSize(dst);
+            if (keySz < 0) {
+                ret = keySz;
+                break;
+            }
+            if (keySz < ssl->options.minRsaKeySz) {
+                WOLFSSL_MSG("RSA key size too small");
+                ret = RSA_KEY_SIZE_E;
+                break;
+            }
+
+            /* Return the maximum signature length. */
+            *length = (word32)keySz;
+            break;
+        }
+    #endif
+    #if defined(HAVE_ECC) && !defined(WOLFSSL_ECC_BLIND_K) && \
+        !defined(WOLFSSL_CUSTOM_CURVES)
+        case DYNAMIC_TYPE_ECC:
+        {
+            ecc_key* src = (ecc_key*)ctx->decodedKey;
+            ecc_key* dst;
+
+            ret = AllocKey(ssl, (int)ssl->hsType, &ssl->hsKey);
+            if (ret != 0) {
+                break;
+            }
+            dst = (ecc_key*)ssl->hsKey;
+
+            ret = wc_ecc_set_curve(dst, 0, src->dp->id);
+            if (ret == 0)
+                ret = wc_ecc_copy_point(&src->pubkey, &dst->pubkey);
+            if (ret == 0)
+                ret = mp_copy(wc_ecc_key_get_priv(src),
+                    wc_ecc_key_get_priv(dst));
+            if (ret != 0) {
+                break;
+            }
+            dst->type = src->type;
+
+            /* Check it meets the minimum ECC key size requirements. */
+            keySz = wc_ecc_size(dst);
+            if (keySz < ssl->options.minEccKeySz) {
+                WOLFSSL_MSG("ECC key size too small");
+                ret = ECC_KEY_SIZE_E;
+                break;
+            }
+
+            /* Return the maximum signature length. */
+            *length = (word32)wc_ecc_sig_size(dst);
+            break;
+        }
+    #endif
+    #if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED25519_PERSISTENT_SHA)
+        case DYNAMIC_TYPE_ED25519:
+            if (ED25519_KEY_SIZE < ssl->options.minEccKeySz) {
+                WOLFSSL_MSG("ED25519 key size too small");
+                ret = ECC_KEY_SIZE_E;
+                break;
+            }
+            /* Return the maximum signature length. */
+            *length = ED25519_SIG_SIZE;
+            break;
+    #endif
+    #if defined(HAVE_ED448) && defined(HAVE_ED448_KEY_IMPORT) && \
+        !defined(WOLFSSL_ED448_PERSISTENT_SHA)
+        case DYNAMIC_TYPE_ED448:
+            if (ED448_KEY_SIZE < ssl->options.minEccKeySz) {
+                WOLFSSL_MSG("ED448 key size too small");
+                ret = ECC_KEY_SIZE_E;
+                break;
+            }
+            /* Return the maximum signature length. */
+            *length = ED448_SIG_SIZE;
+            break;
+    #endif
+        default:
+            ret = BAD_STATE_E;
+            break;
+    }
+
+    if ((ret == 0) && ((ssl->hsType == DYNAMIC_TYPE_ED25519) ||
+            (ssl->hsType == DYNAMIC_TYPE_ED448))) {
+        if (ssl->hsKey != NULL) {
+            WOLFSSL_MSG("Key already present!");
+            ret = BAD_STATE_E;
+        }
+        else {
+            /* Key object is owned by the SSL context. */
+            ssl->hsKey = ctx->decodedKey;
+            ssl->options.hsKeyShared = 1;
+        }
+    }
+
+    return ret;
+}
+#endif /* WOLFSSL_CTX_DECODED_KEY */
+
 /* Decode the private key - RSA/ECC/Ed25519/Ed448/Falcon/Dilithium - and
  * creates a key object.
  *
@@ -29802,6 +31404,16 @@ int DecodePrivateKey(WOLFSSL *ssl, word32* length)
     }
 #endif /* WOLF_PRIVATE_KEY_ID */
 
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    /* Use the context's decoded key when signing with the context's key. */
+    if ((ssl->ctx->decodedKey != NULL) &&
+            (ssl->buffers.key == ssl->ctx->privateKey) &&
+            (ssl->devId == INVALID_DEVID)) {
+        ret = UseCtxDecodedKey(ssl, length);
+        goto exit_dpk;
+    }
+#endif
+
 #ifndef NO_RSA
     if (ssl->buffers.keyType == rsa_sa_algo || ssl->buffers.keyType == 0) {
         ssl->hsType = DYNAMIC_TYPE_RSA;
@@ -37444,7 +39056,7 @@ static int DoSessionTicket(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
                  ((second == TLS_SHA256_SHA256) ||
                   (second == TLS_SHA384_SHA384))) ||
                  ((first == CIPHER_BYTE) && ((second == TLS_SM4_GCM_SM3) ||
-                  (second == TLS_SM4_CCM_SM3)))) {
+                  (second == TLS_SM4_CCM_SM3))) || (first == ASCON_BYTE)) {
             /* Can't negotiate TLS 1.3 cipher suites with lower protocol
              * version. */
             return 0;
@@ -40077,6 +41689,143 @@ cleanup:
 
 #if !defined(WOLFSSL_NO_DEF_TICKET_ENC_CB) && !defined(NO_TLS)
 
+#ifndef WOLFSSL_TICKET_KEY_RING
+    #define TicketEncCbCtx_NotSetup(keyCtx)     ((keyCtx)->expirary[0] == 0)
+#else
+    #define TicketEncCbCtx_NotSetup(keyCtx)     \
+        (__atomic_load_n(&(keyCtx)->setup, __ATOMIC_ACQUIRE) == 0)
+
+#ifndef WOLFSSL_TICKET_KEY_RING_TRIES
+    /* Attempts at a consistent copy of a key being replaced. */
+    #define WOLFSSL_TICKET_KEY_RING_TRIES   4
+#endif
+
+/* Replace the key in a slot of the ring.
+ *
+ * Caller holds the mutex. Readers do not lock - the sequence number of the
+ * slot is odd while the key is changed so that readers retry their copy.
+ *
+ * @param [in]  keyCtx    Context for session ticket encryption.
+ * @param [in]  idx       Index of slot in ring.
+ * @param [in]  name      Name of key. NULL to generate.
+ * @param [in]  key       Key data. NULL to generate.
+ * @param [in]  expirary  Time at which key expires for decryption.
+ * @param [in]  now       Current time in seconds.
+ * @return  0 on success.
+ * @return  Other value when random number generation fails.
+ */
+static int TicketKeyRing_Set(TicketEncCbCtx* keyCtx, int idx, const byte* name,
+    const byte* key, word32 expirary, word32 now)
+{
+    int ret = 0;
+    TicketKey* tk = &keyCtx->ring[idx];
+
+    __atomic_store_n(&tk->seq, tk->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    if (name != NULL) {
+        XMEMCPY(tk->name, name, WOLFSSL_TICKET_NAME_SZ);
+    }
+    else {
+        ret = wc_RNG_GenerateBlock(&keyCtx->rng, tk->name,
+                                   WOLFSSL_TICKET_NAME_SZ);
+        /* Bottom bits of generated name are the index of the slot. */
+        tk->name[WOLFSSL_TICKET_NAME_SZ - 1] &=
+            (byte)~(WOLFSSL_TICKET_KEY_RING_SZ - 1);
+        tk->name[WOLFSSL_TICKET_NAME_SZ - 1] |= (byte)idx;
+    }
+    if (ret == 0) {
+        if (key != NULL) {
+            XMEMCPY(tk->key, key, WOLFSSL_TICKET_KEY_SZ);
+        }
+        else {
+            ret = wc_RNG_GenerateBlock(&keyCtx->rng, tk->key,
+                                       WOLFSSL_TICKET_KEY_SZ);
+        }
+    }
+    if (ret == 0) {
+        tk->expirary = expirary;
+        tk->encEnd = now + WOLFSSL_TICKET_KEY_ROTATE;
+        tk->added = (key != NULL);
+    }
+    else {
+        /* Slot no longer has a usable key. */
+        ForceZero(tk->key, sizeof(tk->key));
+        tk->expirary = now;
+        tk->encEnd = now;
+        tk->added = 0;
+    }
+
+    __atomic_store_n(&tk->seq, tk->seq + 1, __ATOMIC_RELEASE);
+
+    return ret;
+}
+
+/* Make a new key, in the slot after the current one, the key to encrypt with.
+ *
+ * The slot reused holds the oldest key. Keys encrypt for
+ * WOLFSSL_TICKET_KEY_ROTATE seconds and so the oldest key has expired when
+ * rotation is on schedule. Caller holds the mutex.
+ *
+ * @param [in]  keyCtx    Context for session ticket encryption.
+ * @param [in]  name      Name of key. NULL to generate.
+ * @param [in]  key       Key data. NULL to generate.
+ * @param [in]  expirary  Time at which key expires for decryption.
+ * @param [in]  now       Current time in seconds.
+ * @return  0 on success.
+ * @return  Other value when random number generation fails.
+ */
+static int TicketKeyRing_Rotate(TicketEncCbCtx* keyCtx, const byte* name,
+    const byte* key, word32 expirary, word32 now)
+{
+    int ret;
+    int idx = (keyCtx->cur + 1) & (WOLFSSL_TICKET_KEY_RING_SZ - 1);
+
+    ret = TicketKeyRing_Set(keyCtx, idx, name, key, expirary, now);
+    if (ret == 0) {
+        __atomic_store_n(&keyCtx->cur, idx, __ATOMIC_RELEASE);
+    }
+
+    return ret;
+}
+
+/* Copy out the key in a slot of the ring without locking.
+ *
+ * @param [in]   keyCtx  Context for session ticket encryption.
+ * @param [in]   idx     Index of slot in ring.
+ * @param [in]   name    Name key must have. NULL for any.
+ * @param [out]  tk      Copy of key.
+ * @return  1 when key with name copied.
+ * @return  0 when name is different or the key kept changing.
+ */
+static int TicketKeyRing_Get(TicketEncCbCtx* keyCtx, int idx, const byte* name,
+    TicketKey* tk)
+{
+    TicketKey* slot = &keyCtx->ring[idx];
+    word32 seq;
+    int found;
+    int tries;
+
+    for (tries = 0; tries < WOLFSSL_TICKET_KEY_RING_TRIES; tries++) {
+        seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if ((seq & 1) != 0)
+            continue; /* key being replaced */
+
+        found = (name == NULL) ||
+            (XMEMCMP(slot->name, name, WOLFSSL_TICKET_NAME_SZ) == 0);
+        if (found) {
+            XMEMCPY(tk, slot, sizeof(TicketKey));
+        }
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq)
+            return found;
+    }
+
+    return 0;
+}
+#endif /* WOLFSSL_TICKET_KEY_RING */
+
 /* Initialize the context for session ticket encryption.
  *
  * @param [in]  ctx     SSL context.
@@ -40087,17 +41836,27 @@ cleanup:
 static int TicketEncCbCtx_Init(WOLFSSL_CTX* ctx, TicketEncCbCtx* keyCtx)
 {
     int ret = 0;
+#if defined(WOLFSSL_TICKET_KEY_RING) && defined(WOLFSSL_CHECK_MEM_ZERO)
+    int i;
+#endif
 
     XMEMSET(keyCtx, 0, sizeof(*keyCtx));
     keyCtx->ctx = ctx;
 
 #ifdef WOLFSSL_CHECK_MEM_ZERO
+#ifndef WOLFSSL_TICKET_KEY_RING
     wc_MemZero_Add("TicketEncCbCtx_Init keyCtx->name", keyCtx->name,
         sizeof(keyCtx->name));
     wc_MemZero_Add("TicketEncCbCtx_Init keyCtx->key[0]", keyCtx->key[0],
         sizeof(keyCtx->key[0]));
     wc_MemZero_Add("TicketEncCbCtx_Init keyCtx->key[1]", keyCtx->key[1],
         sizeof(keyCtx->key[1]));
+#else
+    for (i = 0; i < WOLFSSL_TICKET_KEY_RING_SZ; i++) {
+        wc_MemZero_Add("TicketEncCbCtx_Init keyCtx->ring[i].key",
+            keyCtx->ring[i].key, sizeof(keyCtx->ring[i].key));
+    }
+#endif
 #endif
 
 #ifndef SINGLE_THREADED
@@ -40126,10 +41885,11 @@ static int TicketEncCbCtx_Setup(TicketEncCbCtx* keyCtx, void* heap, int devId)
     ret = 0;
 
     /* Check that key wasn't set up while waiting. */
-    if (keyCtx->expirary[0] == 0)
+    if (TicketEncCbCtx_NotSetup(keyCtx))
 #endif
     {
         ret = wc_InitRng_ex(&keyCtx->rng, heap, devId);
+    #ifndef WOLFSSL_TICKET_KEY_RING
         if (ret == 0) {
             ret = wc_RNG_GenerateBlock(&keyCtx->rng, keyCtx->name,
                                        sizeof(keyCtx->name));
@@ -40145,6 +41905,18 @@ static int TicketEncCbCtx_Setup(TicketEncCbCtx* keyCtx, void* heap, int devId)
         if (ret == 0) {
             keyCtx->expirary[0] = LowResTimer() + WOLFSSL_TICKET_KEY_LIFETIME;
         }
+    #else
+        if (ret == 0) {
+            word32 now = LowResTimer();
+
+            /* Generate first key into current slot. */
+            ret = TicketKeyRing_Set(keyCtx, keyCtx->cur, NULL, NULL,
+                now + WOLFSSL_TICKET_KEY_LIFETIME, now);
+        }
+        if (ret == 0) {
+            __atomic_store_n(&keyCtx->setup, 1, __ATOMIC_RELEASE);
+        }
+    #endif
     }
 
     return ret;
@@ -40157,6 +41929,7 @@ static int TicketEncCbCtx_Setup(TicketEncCbCtx* keyCtx, void* heap, int devId)
  */
 static void TicketEncCbCtx_Free(TicketEncCbCtx* keyCtx)
 {
+#ifndef WOLFSSL_TICKET_KEY_RING
     /* Zeroize sensitive data. */
     ForceZero(keyCtx->name, sizeof(keyCtx->name));
     ForceZero(keyCtx->key[0], sizeof(keyCtx->key[0]));
@@ -40167,6 +41940,17 @@ static void TicketEncCbCtx_Free(TicketEncCbCtx* keyCtx)
     wc_MemZero_Check(keyCtx->key[0], sizeof(keyCtx->key[0]));
     wc_MemZero_Check(keyCtx->key[1], sizeof(keyCtx->key[1]));
 #endif
+#else
+    int i;
+
+    /* Zeroize sensitive data. */
+    for (i = 0; i < WOLFSSL_TICKET_KEY_RING_SZ; i++) {
+        ForceZero(&keyCtx->ring[i], sizeof(keyCtx->ring[i]));
+    #ifdef WOLFSSL_CHECK_MEM_ZERO
+        wc_MemZero_Check(keyCtx->ring[i].key, sizeof(keyCtx->ring[i].key));
+    #endif
+    }
+#endif
 
 #ifndef SINGLE_THREADED
     wc_FreeMutex(&keyCtx->mutex);
@@ -40474,6 +42258,7 @@ static int TicketEncDec(byte* key, int keyLen, byte* iv, byte* aad, int aadSz,
     #error "No encryption algorithm available for default ticket encryption."
 #endif
 
+#ifndef WOLFSSL_TICKET_KEY_RING
 /* Choose a key to use for encryption.
  *
  * Generate a new key if the current ones are expired.
@@ -40707,6 +42492,456 @@ static int DefTicketEncCb(WOLFSSL* ssl, byte key_name[WOLFSSL_TICKET_NAME_SZ],
 #endif
     return WOLFSSL_TICKET_RET_OK;
 }
+#else
+
+/* Get a copy of the key to encrypt tickets with.
+ *
+ * When the current key is due to be replaced, one thread makes the new key
+ * while others carry on with the current key.
+ *
+ * @param [in]   keyCtx      Context for session ticket encryption.
+ * @param [in]   ticketHint  Session ticket lifetime.
+ * @param [out]  tk          Copy of key.
+ * @return  0 on success.
+ * @return  WOLFSSL_TICKET_RET_REJECT when no key is available.
+ */
+static int TicketKeyRing_EncKey(TicketEncCbCtx* keyCtx, int ticketHint,
+                                TicketKey* tk)
+{
+    word32 now = LowResTimer();
+    int idx = __atomic_load_n(&keyCtx->cur, __ATOMIC_ACQUIRE);
+    int rotating = 0;
+
+    if (!TicketKeyRing_Get(keyCtx, idx, NULL, tk)) {
+        return WOLFSSL_TICKET_RET_REJECT;
+    }
+    /* Replace key when used long enough or a ticket would outlive it.
+     * Keys added through the API are used until they are about to expire. */
+    if (((!tk->added && now >= tk->encEnd) ||
+            tk->expirary <= now + (word32)ticketHint) &&
+            __atomic_compare_exchange_n(&keyCtx->rotating, &rotating, 1, 0,
+                __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        int ret = 0;
+
+    #ifndef SINGLE_THREADED
+        if (wc_LockMutex(&keyCtx->mutex) != 0) {
+            WOLFSSL_MSG("Couldn't lock key context mutex");
+            ret = BAD_MUTEX_E;
+        }
+        else
+    #endif
+        {
+            /* Key may have been replaced through API while waiting. */
+            if (keyCtx->cur == idx) {
+                ret = TicketKeyRing_Rotate(keyCtx, NULL, NULL,
+                    now + WOLFSSL_TICKET_KEY_LIFETIME, now);
+            }
+        #ifndef SINGLE_THREADED
+            wc_UnLockMutex(&keyCtx->mutex);
+        #endif
+        }
+        __atomic_store_n(&keyCtx->rotating, 0, __ATOMIC_RELEASE);
+
+        if (ret == 0) {
+            idx = __atomic_load_n(&keyCtx->cur, __ATOMIC_ACQUIRE);
+            if (!TicketKeyRing_Get(keyCtx, idx, NULL, tk)) {
+                return WOLFSSL_TICKET_RET_REJECT;
+            }
+        }
+    }
+    /* Ticket can't be decrypted with a key that has expired. */
+    if (tk->expirary <= now) {
+        return WOLFSSL_TICKET_RET_REJECT;
+    }
+
+    return 0;
+}
+
+/* Find the key with the name from the ticket.
+ *
+ * The bottom bits of generated names are the index of the key's slot.
+ * Other slots are checked for keys added with a name through the API.
+ *
+ * @param [in]   keyCtx    Context for session ticket encryption.
+ * @param [in]   key_name  Name of key from ticket.
+ * @param [out]  tk        Copy of key.
+ * @return  1 when found.
+ * @return  0 when no key has the name.
+ */
+static int TicketKeyRing_Find(TicketEncCbCtx* keyCtx, const byte* key_name,
+                              TicketKey* tk)
+{
+    int idx = key_name[WOLFSSL_TICKET_NAME_SZ - 1] &
+              (WOLFSSL_TICKET_KEY_RING_SZ - 1);
+    int i;
+
+    if (TicketKeyRing_Get(keyCtx, idx, key_name, tk)) {
+        return 1;
+    }
+    for (i = 0; i < WOLFSSL_TICKET_KEY_RING_SZ; i++) {
+        if (i != idx && TicketKeyRing_Get(keyCtx, i, key_name, tk)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Default Session Ticket encryption/decryption callback with ring of keys.
+ *
+ * Use ChaCha20-Poly1305, AES-GCM or SM4-GCM to encrypt/decrypt the ticket.
+ * WOLFSSL_TICKET_KEY_RING_SZ keys are kept, each with its own name:
+ *  - The current key encrypts for WOLFSSL_TICKET_KEY_ROTATE seconds, or
+ *    until a ticket would outlive it, and then a new key is made in the slot
+ *    of the oldest key. Keys added through the API encrypt until a ticket
+ *    would outlive them.
+ *  - Keys decrypt until WOLFSSL_TICKET_KEY_LIFETIME after being made.
+ *  - Keys are found by the name in the ticket.
+ * Keys are read without locking and replaced under the mutex.
+ * AAD = key_name | iv | ticket len (16-bits network order)
+ *
+ * @param [in]      ssl       SSL connection.
+ * @param [in,out]  key_name  Name of key from client.
+ *                            Encrypt: name of key returned.
+ *                            Decrypt: name from ticket message to check.
+ * @param [in]      iv        IV to use in encryption/decryption.
+ * @param [in]      mac       MAC for authentication of encrypted data.
+ * @param [in]      enc       1 when encrypting ticket, 0 when decrypting.
+ * @param [in,out]  ticket    Encrypted/decrypted session ticket bytes.
+ * @param [in]      inLen     Length of incoming ticket.
+ * @param [out]     outLen    Length of outgoing ticket.
+ * @param [in]      userCtx   Context for encryption/decryption of ticket.
+ * @return  WOLFSSL_TICKET_RET_OK when successful.
+ * @return  WOLFSSL_TICKET_RET_CREATE when successful and a new ticket is to
+ *          be created for TLS 1.2 and below.
+ * @return  WOLFSSL_TICKET_RET_REJECT when failed to produce valid encrypted or
+ *          decrypted ticket.
+ * @return  WOLFSSL_TICKET_RET_FATAL when no key has the name.
+ */
+static int DefTicketEncCb(WOLFSSL* ssl, byte key_name[WOLFSSL_TICKET_NAME_SZ],
+                          byte iv[WOLFSSL_TICKET_IV_SZ],
+                          byte mac[WOLFSSL_TICKET_MAC_SZ],
+                          int enc, byte* ticket, int inLen, int* outLen,
+                          void* userCtx)
+{
+    int ret;
+    TicketEncCbCtx* keyCtx = (TicketEncCbCtx*)userCtx;
+    WOLFSSL_CTX* ctx = keyCtx->ctx;
+    word16 sLen = XHTONS((word16)inLen);
+    byte aad[WOLFSSL_TICKET_NAME_SZ + WOLFSSL_TICKET_IV_SZ + sizeof(sLen)];
+    int  aadSz = WOLFSSL_TICKET_NAME_SZ + WOLFSSL_TICKET_IV_SZ + sizeof(sLen);
+    byte* p = aad;
+#ifdef WOLFSSL_SMALL_STACK
+    TicketKey* tk;
+#else
+    TicketKey tk[1];
+#endif
+
+    WOLFSSL_ENTER("DefTicketEncCb");
+
+    if ((!enc) && (inLen != WOLFSSL_INTERNAL_TICKET_LEN)) {
+        return BUFFER_E;
+    }
+
+    /* Check we have setup the RNG and first key. */
+    if (TicketEncCbCtx_NotSetup(keyCtx)) {
+#ifndef SINGLE_THREADED
+        if (wc_LockMutex(&keyCtx->mutex) != 0) {
+            WOLFSSL_MSG("Couldn't lock key context mutex");
+            return WOLFSSL_TICKET_RET_REJECT;
+        }
+#endif
+        ret = TicketEncCbCtx_Setup(keyCtx, ssl->ctx->heap, ssl->ctx->devId);
+#ifndef SINGLE_THREADED
+        wc_UnLockMutex(&keyCtx->mutex);
+#endif
+        if (ret != 0)
+            return ret;
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    tk = (TicketKey*)XMALLOC(sizeof(TicketKey), ssl->heap,
+                             DYNAMIC_TYPE_TMP_BUFFER);
+    if (tk == NULL)
+        return WOLFSSL_TICKET_RET_REJECT;
+#endif
+
+    if (enc) {
+        ret = TicketKeyRing_EncKey(keyCtx, ctx->ticketHint, tk);
+        if (ret == 0) {
+            XMEMCPY(key_name, tk->name, WOLFSSL_TICKET_NAME_SZ);
+
+            /* Generate a new IV into buffer to be returned.
+             * Don't use the RNG in keyCtx as it's for generating private
+             * data. */
+            if (wc_RNG_GenerateBlock(ssl->rng, iv, WOLFSSL_TICKET_IV_SZ) != 0)
+                ret = WOLFSSL_TICKET_RET_REJECT;
+        }
+    }
+    else if (!TicketKeyRing_Find(keyCtx, key_name, tk)) {
+        ret = WOLFSSL_TICKET_RET_FATAL;
+    }
+    else if (tk->expirary <= LowResTimer()) {
+        ret = WOLFSSL_TICKET_RET_REJECT;
+    }
+    else {
+        ret = 0;
+    }
+
+    if (ret == 0) {
+        /* Build AAD from: key name, iv, and length of ticket. */
+        XMEMCPY(p, key_name, WOLFSSL_TICKET_NAME_SZ);
+        p += WOLFSSL_TICKET_NAME_SZ;
+        XMEMCPY(p, iv, WOLFSSL_TICKET_IV_SZ);
+        p += WOLFSSL_TICKET_IV_SZ;
+        XMEMCPY(p, &sLen, sizeof(sLen));
+
+        if (TicketEncDec(tk->key, WOLFSSL_TICKET_KEY_SZ, iv, aad, aadSz,
+                         ticket, inLen, ticket, outLen, mac, ssl->heap,
+                         enc) != 0) {
+            ret = WOLFSSL_TICKET_RET_REJECT;
+        }
+    }
+
+    ForceZero(tk, sizeof(TicketKey));
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(tk, ssl->heap, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    if (ret != 0)
+        return ret;
+#ifndef WOLFSSL_TICKET_DECRYPT_NO_CREATE
+    if (!IsAtLeastTLSv1_3(ssl->version) && !enc)
+        return WOLFSSL_TICKET_RET_CREATE;
+#endif
+    return WOLFSSL_TICKET_RET_OK;
+}
+
+/* Add a key to the ring as the key to encrypt with, or make a new one.
+ *
+ * @param [in]  ctx   SSL/TLS context object.
+ * @param [in]  name  Name of key. NULL to generate.
+ * @param [in]  key   Key data. NULL to generate.
+ * @return  0 on success.
+ * @return  BAD_MUTEX_E when locking mutex fails.
+ * @return  Other value when random number generation fails.
+ */
+static int TicketKeyRing_Add(WOLFSSL_CTX* ctx, const byte* name,
+                             const byte* key)
+{
+    int ret = 0;
+    TicketEncCbCtx* keyCtx = &ctx->ticketKeyCtx;
+
+#ifndef SINGLE_THREADED
+    if (wc_LockMutex(&keyCtx->mutex) != 0) {
+        WOLFSSL_MSG("Couldn't lock key context mutex");
+        return BAD_MUTEX_E;
+    }
+#endif
+    if (TicketEncCbCtx_NotSetup(keyCtx)) {
+        ret = TicketEncCbCtx_Setup(keyCtx, ctx->heap, ctx->devId);
+    }
+    if (ret == 0) {
+        word32 now = LowResTimer();
+
+        ret = TicketKeyRing_Rotate(keyCtx, name, key,
+            now + WOLFSSL_TICKET_KEY_LIFETIME, now);
+    }
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&keyCtx->mutex);
+#endif
+
+    return ret;
+}
+
+/* Add a named session ticket key to encrypt new tickets with.
+ *
+ * Servers given the same name and key can decrypt each other's tickets.
+ * The key is not replaced after WOLFSSL_TICKET_KEY_ROTATE seconds - only when
+ * another key is added or made, or a ticket would outlive it.
+ * Keys already in the ring are kept for decryption until they expire or
+ * their slot is reused.
+ *
+ * @param [in]  ctx    SSL/TLS context object.
+ * @param [in]  name   Name of key of WOLFSSL_TICKET_NAME_SZ bytes.
+ * @param [in]  key    Key data.
+ * @param [in]  keySz  Length of key data in bytes.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx, name or key is NULL or keySz is not
+ *          WOLFSSL_TICKET_KEY_SZ.
+ * @return  SIDE_ERROR when ctx is not for a server.
+ * @return  Other negative value on failure.
+ */
+int wolfSSL_CTX_add_ticket_key(WOLFSSL_CTX* ctx, const unsigned char* name,
+                               const unsigned char* key, unsigned int keySz)
+{
+    int ret;
+
+    WOLFSSL_ENTER("wolfSSL_CTX_add_ticket_key");
+
+    if (ctx == NULL || name == NULL || key == NULL ||
+            keySz != WOLFSSL_TICKET_KEY_SZ) {
+        return BAD_FUNC_ARG;
+    }
+    if (ctx->method->side == WOLFSSL_CLIENT_END) {
+        return SIDE_ERROR;
+    }
+
+    ret = TicketKeyRing_Add(ctx, name, key);
+    if (ret == 0) {
+        ret = WOLFSSL_SUCCESS;
+    }
+
+    WOLFSSL_LEAVE("wolfSSL_CTX_add_ticket_key", ret);
+    return ret;
+}
+
+/* Make a new session ticket key to encrypt new tickets with.
+ *
+ * For rotating keys on a schedule other than WOLFSSL_TICKET_KEY_ROTATE.
+ *
+ * @param [in]  ctx  SSL/TLS context object.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx is NULL.
+ * @return  SIDE_ERROR when ctx is not for a server.
+ * @return  Other negative value on failure.
+ */
+int wolfSSL_CTX_rotate_ticket_key(WOLFSSL_CTX* ctx)
+{
+    int ret;
+
+    WOLFSSL_ENTER("wolfSSL_CTX_rotate_ticket_key");
+
+    if (ctx == NULL) {
+        return BAD_FUNC_ARG;
+    }
+    if (ctx->method->side == WOLFSSL_CLIENT_END) {
+        return SIDE_ERROR;
+    }
+
+    ret = TicketKeyRing_Add(ctx, NULL, NULL);
+    if (ret == 0) {
+        ret = WOLFSSL_SUCCESS;
+    }
+
+    WOLFSSL_LEAVE("wolfSSL_CTX_rotate_ticket_key", ret);
+    return ret;
+}
+
+/* Serialize the current key in the format of two keys with one name.
+ *
+ * Key at index (bottom bit of name) of the name is the current key. The other
+ * key is zero and has expired.
+ *
+ * @param [in]   ctx   SSL/TLS context object.
+ * @param [out]  keys  Buffer of WOLFSSL_TICKET_KEYS_SZ bytes.
+ * @return  0 on success.
+ * @return  WOLFSSL_FAILURE when key can't be read.
+ */
+int TicketKeyRing_Export(WOLFSSL_CTX* ctx, byte* keys)
+{
+    int ret = 0;
+    int keyIdx;
+    TicketEncCbCtx* keyCtx = &ctx->ticketKeyCtx;
+#ifdef WOLFSSL_SMALL_STACK
+    TicketKey* tk;
+#else
+    TicketKey tk[1];
+#endif
+
+#ifdef WOLFSSL_SMALL_STACK
+    tk = (TicketKey*)XMALLOC(sizeof(TicketKey), ctx->heap,
+                             DYNAMIC_TYPE_TMP_BUFFER);
+    if (tk == NULL)
+        return WOLFSSL_FAILURE;
+#endif
+
+    XMEMSET(keys, 0, WOLFSSL_TICKET_KEYS_SZ);
+    if (TicketEncCbCtx_NotSetup(keyCtx)) {
+        /* No keys yet. */
+    }
+    else if (!TicketKeyRing_Get(keyCtx,
+            __atomic_load_n(&keyCtx->cur, __ATOMIC_ACQUIRE), NULL, tk)) {
+        ret = WOLFSSL_FAILURE;
+    }
+    else {
+        keyIdx = tk->name[WOLFSSL_TICKET_NAME_SZ - 1] & 0x1;
+
+        XMEMCPY(keys, tk->name, WOLFSSL_TICKET_NAME_SZ);
+        keys[WOLFSSL_TICKET_NAME_SZ - 1] &= 0xfe;
+        keys += WOLFSSL_TICKET_NAME_SZ;
+        XMEMCPY(keys + keyIdx * WOLFSSL_TICKET_KEY_SZ, tk->key,
+                WOLFSSL_TICKET_KEY_SZ);
+        keys += 2 * WOLFSSL_TICKET_KEY_SZ;
+        c32toa(tk->expirary, keys + keyIdx * OPAQUE32_LEN);
+    }
+
+    ForceZero(tk, sizeof(TicketKey));
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(tk, ctx->heap, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return ret;
+}
+
+/* Deserialize two keys with one name into the ring.
+ *
+ * The keys are named with the bottom bit of the name set to their index, as
+ * the default callback without a ring names them. Keys that have expired are
+ * not added. The key that expires last is the key to encrypt with.
+ *
+ * @param [in]  ctx   SSL/TLS context object.
+ * @param [in]  keys  Buffer of WOLFSSL_TICKET_KEYS_SZ bytes.
+ * @return  0 on success.
+ * @return  Other value on failure.
+ */
+int TicketKeyRing_Import(WOLFSSL_CTX* ctx, const byte* keys)
+{
+    int ret = 0;
+    int i;
+    int first;
+    word32 now = LowResTimer();
+    word32 expirary[2];
+    byte name[WOLFSSL_TICKET_NAME_SZ];
+    TicketEncCbCtx* keyCtx = &ctx->ticketKeyCtx;
+
+    ato32(keys + WOLFSSL_TICKET_NAME_SZ + 2 * WOLFSSL_TICKET_KEY_SZ,
+          &expirary[0]);
+    ato32(keys + WOLFSSL_TICKET_NAME_SZ + 2 * WOLFSSL_TICKET_KEY_SZ +
+          OPAQUE32_LEN, &expirary[1]);
+    /* Add key expiring last, to encrypt with, last. */
+    first = (expirary[0] > expirary[1]) ? 1 : 0;
+
+#ifndef SINGLE_THREADED
+    if (wc_LockMutex(&keyCtx->mutex) != 0) {
+        WOLFSSL_MSG("Couldn't lock key context mutex");
+        return BAD_MUTEX_E;
+    }
+#endif
+    if (TicketEncCbCtx_NotSetup(keyCtx)) {
+        ret = TicketEncCbCtx_Setup(keyCtx, ctx->heap, ctx->devId);
+    }
+    for (i = 0; (ret == 0) && (i < 2); i++) {
+        int keyIdx = i ^ first;
+
+        if (expirary[keyIdx] <= now)
+            continue;
+
+        XMEMCPY(name, keys, WOLFSSL_TICKET_NAME_SZ);
+        name[WOLFSSL_TICKET_NAME_SZ - 1] =
+            (byte)((name[WOLFSSL_TICKET_NAME_SZ - 1] & 0xfe) | keyIdx);
+        ret = TicketKeyRing_Rotate(keyCtx, name,
+            keys + WOLFSSL_TICKET_NAME_SZ + keyIdx * WOLFSSL_TICKET_KEY_SZ,
+            expirary[keyIdx], now);
+    }
+#ifndef SINGLE_THREADED
+    wc_UnLockMutex(&keyCtx->mutex);
+#endif
+
+    return ret;
+}
+
+#endif /* WOLFSSL_TICKET_KEY_RING */
 
 #endif /* !WOLFSSL_NO_DEF_TICKET_ENC_CB */
 
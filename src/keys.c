@@ -1450,6 +1450,32 @@ int GetCipherSpec(word16 side, byte cipherSuite0, byte cipherSuite,
     }
     }
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    if (cipherSuite0 == ASCON_BYTE) {
+
+    switch (cipherSuite) {
+    case TLS_ASCON_AEAD128_SHA256 :
+        specs->bulk_cipher_algorithm = wolfssl_ascon_aead;
+        specs->cipher_type           = aead;
+        specs->mac_algorithm         = sha256_mac;
+        specs->kea                   = any_kea;
+        specs->sig_algo              = any_sa_algo;
+        specs->hash_size             = WC_SHA256_DIGEST_SIZE;
+        specs->pad_size              = PAD_SHA;
+        specs->static_ecdh           = 0;
+        specs->key_size              = ASCON_AEAD128_KEY_SZ;
+        specs->block_size            = 16; /* Ascon-AEAD128 rate */
+        specs->iv_size               = ASCON_AEAD128_NONCE_SZ;
+        specs->aead_mac_size         = ASCON_AEAD128_TAG_SZ;
+
+        break;
+
+    default:
+        break;
+    }
+    }
+#endif
+
     if (cipherSuite0 != ECC_BYTE &&
         cipherSuite0 != ECDHE_PSK_BYTE &&
         cipherSuite0 != CHACHA_BYTE &&
@@ -1457,6 +1483,9 @@ int GetCipherSpec(word16 side, byte cipherSuite0, byte cipherSuite,
     (defined(WOLFSSL_SM4_CBC) || defined(WOLFSSL_SM4_GCM) || \
      defined(WOLFSSL_SM4_CCM))
         cipherSuite0 != SM_BYTE &&
+#endif
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+        cipherSuite0 != ASCON_BYTE &&
 #endif
         cipherSuite0 != TLS13_BYTE) {   /* normal suites */
     switch (cipherSuite) {
@@ -3294,6 +3323,74 @@ int SetKeys(Ciphers* enc, Ciphers* dec, Keys* keys, CipherSpecs* specs,
     }
 #endif /* WOLFSSL_SM4_CCM */
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    /* check that buffer sizes are sufficient */
+    #if (MAX_WRITE_IV_SZ < ASCON_AEAD128_NONCE_SZ)
+        #error MAX_WRITE_IV_SZ too small for Ascon-AEAD128
+    #endif
+
+    if (specs->bulk_cipher_algorithm == wolfssl_ascon_aead) {
+        /* Key and full write IV kept together - one-shot API per record. */
+        if (enc) {
+            if (enc->ascon == NULL) {
+                enc->ascon = (byte*)XMALLOC(ASCON_AEAD128_KEY_SZ +
+                    ASCON_AEAD128_NONCE_SZ, heap, DYNAMIC_TYPE_CIPHER);
+                if (enc->ascon == NULL)
+                    return MEMORY_E;
+            }
+        }
+        if (dec) {
+            if (dec->ascon == NULL) {
+                dec->ascon = (byte*)XMALLOC(ASCON_AEAD128_KEY_SZ +
+                    ASCON_AEAD128_NONCE_SZ, heap, DYNAMIC_TYPE_CIPHER);
+                if (dec->ascon == NULL)
+                    return MEMORY_E;
+            }
+        }
+
+        if (side == WOLFSSL_CLIENT_END) {
+            if (enc) {
+                XMEMCPY(enc->ascon, keys->client_write_key,
+                        ASCON_AEAD128_KEY_SZ);
+                XMEMCPY(enc->ascon + ASCON_AEAD128_KEY_SZ,
+                        keys->client_write_IV, ASCON_AEAD128_NONCE_SZ);
+                XMEMCPY(keys->aead_enc_imp_IV, keys->client_write_IV,
+                        AEAD_MAX_IMP_SZ);
+            }
+            if (dec) {
+                XMEMCPY(dec->ascon, keys->server_write_key,
+                        ASCON_AEAD128_KEY_SZ);
+                XMEMCPY(dec->ascon + ASCON_AEAD128_KEY_SZ,
+                        keys->server_write_IV, ASCON_AEAD128_NONCE_SZ);
+                XMEMCPY(keys->aead_dec_imp_IV, keys->server_write_IV,
+                        AEAD_MAX_IMP_SZ);
+            }
+        }
+        else {
+            if (enc) {
+                XMEMCPY(enc->ascon, keys->server_write_key,
+                        ASCON_AEAD128_KEY_SZ);
+                XMEMCPY(enc->ascon + ASCON_AEAD128_KEY_SZ,
+                        keys->server_write_IV, ASCON_AEAD128_NONCE_SZ);
+                XMEMCPY(keys->aead_enc_imp_IV, keys->server_write_IV,
+                        AEAD_MAX_IMP_SZ);
+            }
+            if (dec) {
+                XMEMCPY(dec->ascon, keys->client_write_key,
+                        ASCON_AEAD128_KEY_SZ);
+                XMEMCPY(dec->ascon + ASCON_AEAD128_KEY_SZ,
+                        keys->client_write_IV, ASCON_AEAD128_NONCE_SZ);
+                XMEMCPY(keys->aead_dec_imp_IV, keys->client_write_IV,
+                        AEAD_MAX_IMP_SZ);
+            }
+        }
+        if (enc)
+            enc->setup = 1;
+        if (dec)
+            dec->setup = 1;
+    }
+#endif /* BUILD_TLS_ASCON_AEAD128_SHA256 */
+
 #ifdef HAVE_NULL_CIPHER
     if (specs->bulk_cipher_algorithm == wolfssl_cipher_null) {
     #ifdef WOLFSSL_TLS13
@@ -3106,14 +3106,19 @@ int wolfSSL_GetDhKey_Sz(WOLFSSL* ssl)
 #endif /* !NO_DH */
 
 
-static int wolfSSL_write_internal(WOLFSSL* ssl, const void* data, size_t sz)
+/* Checks common to the write APIs before application data is sent.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  0 when data may be written.
+ * @return  Negative value when writing is not allowed.
+ */
+static int wolfSSL_write_check(WOLFSSL* ssl)
 {
+#ifdef HAVE_WRITE_DUP
     int ret;
+#endif
 
-    WOLFSSL_ENTER("wolfSSL_write");
-
-    if (ssl == NULL || data == NULL)
-        return BAD_FUNC_ARG;
+    (void)ssl;
 
 #ifdef WOLFSSL_QUIC
     if (WOLFSSL_IS_QUIC(ssl)) {
@@ -3162,6 +3167,23 @@ static int wolfSSL_write_internal(WOLFSSL* ssl, const void* data, size_t sz)
         ssl->cbmode = WOLFSSL_CB_WRITE;
     }
     #endif
+
+    return 0;
+}
+
+static int wolfSSL_write_internal(WOLFSSL* ssl, const void* data, size_t sz)
+{
+    int ret;
+
+    WOLFSSL_ENTER("wolfSSL_write");
+
+    if (ssl == NULL || data == NULL)
+        return BAD_FUNC_ARG;
+
+    ret = wolfSSL_write_check(ssl);
+    if (ret != 0)
+        return ret;
+
     ret = SendData(ssl, data, sz);
 
     WOLFSSL_LEAVE("wolfSSL_write", ret);
@@ -3256,13 +3278,16 @@ int wolfSSL_write_ex(WOLFSSL* ssl, const void* data, size_t sz, size_t* wr)
 }
 
 
-static int wolfSSL_read_internal(WOLFSSL* ssl, void* data, size_t sz, int peek)
+/* Read application data into data or, when zc is not NULL, return a pointer
+ * to it in the input buffer. */
+static int wolfSSL_read_internal(WOLFSSL* ssl, void* data, const byte** zc,
+    size_t sz, int peek)
 {
     int ret;
 
     WOLFSSL_ENTER("wolfSSL_read_internal");
 
-    if (ssl == NULL || data == NULL)
+    if (ssl == NULL || (data == NULL && zc == NULL))
         return BAD_FUNC_ARG;
 
 #ifdef WOLFSSL_QUIC
@@ -3307,7 +3332,10 @@ static int wolfSSL_read_internal(WOLFSSL* ssl, void* data, size_t sz, int peek)
         errno = 0;
 #endif
 
-    ret = ReceiveData(ssl, (byte*)data, sz, peek);
+    if (zc != NULL)
+        ret = ReceiveDataZc(ssl, zc, sz);
+    else
+        ret = ReceiveData(ssl, (byte*)data, sz, peek);
 
 #ifdef HAVE_WRITE_DUP
     if (ssl->dupWrite) {
@@ -3343,7 +3371,7 @@ int wolfSSL_peek(WOLFSSL* ssl, void* data, int sz)
     if (sz < 0)
         return BAD_FUNC_ARG;
 
-    return wolfSSL_read_internal(ssl, data, (size_t)sz, TRUE);
+    return wolfSSL_read_internal(ssl, data, NULL, (size_t)sz, TRUE);
 }
 
 
@@ -3364,7 +3392,56 @@ int wolfSSL_read(WOLFSSL* ssl, void* data, int sz)
         ssl->cbmode = WOLFSSL_CB_READ;
     }
     #endif
-    return wolfSSL_read_internal(ssl, data, (size_t)sz, FALSE);
+    return wolfSSL_read_internal(ssl, data, NULL, (size_t)sz, FALSE);
+}
+
+/* Read application data without copying it out of the input buffer.
+ *
+ * The data remains valid until released with wolfSSL_read_release() or until
+ * the next read call. Calling again before releasing returns the same data.
+ *
+ * @param [in]  ssl   SSL/TLS object.
+ * @param [out] data  Pointer to the decrypted data.
+ * @return  Number of bytes at data on success.
+ * @return  0 when the connection was closed.
+ * @return  WOLFSSL_FATAL_ERROR on failure. Use wolfSSL_get_error().
+ * @return  BAD_FUNC_ARG when ssl or data is NULL.
+ */
+int wolfSSL_read_zc(WOLFSSL* ssl, const unsigned char** data)
+{
+    WOLFSSL_ENTER("wolfSSL_read_zc");
+
+    if (ssl == NULL || data == NULL)
+        return BAD_FUNC_ARG;
+
+    #ifdef OPENSSL_EXTRA
+    if (ssl->CBIS != NULL) {
+        ssl->CBIS(ssl, WOLFSSL_CB_READ, WOLFSSL_SUCCESS);
+        ssl->cbmode = WOLFSSL_CB_READ;
+    }
+    #endif
+    return wolfSSL_read_internal(ssl, NULL, data, (size_t)INT_MAX, FALSE);
+}
+
+/* Consume data returned by wolfSSL_read_zc().
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @param [in] sz   Number of bytes consumed. May be less than was returned.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ssl is NULL, sz is negative or sz is more than
+ *          is available.
+ */
+int wolfSSL_read_release(WOLFSSL* ssl, int sz)
+{
+    WOLFSSL_ENTER("wolfSSL_read_release");
+
+    if (ssl == NULL || sz < 0)
+        return BAD_FUNC_ARG;
+
+    if (ReceiveDataRelease(ssl, (size_t)sz) != 0)
+        return BAD_FUNC_ARG;
+
+    return WOLFSSL_SUCCESS;
 }
 
 
@@ -3382,7 +3459,7 @@ int wolfSSL_read_ex(WOLFSSL* ssl, void* data, size_t sz, size_t* rd)
         ssl->cbmode = WOLFSSL_CB_READ;
     }
     #endif
-    ret = wolfSSL_read_internal(ssl, data, sz, FALSE);
+    ret = wolfSSL_read_internal(ssl, data, NULL, sz, FALSE);
 
     if (ret > 0 && rd != NULL) {
         *rd = (size_t)ret;
@@ -3402,7 +3479,7 @@ int wolfSSL_mcast_read(WOLFSSL* ssl, word16* id, void* data, int sz)
     if ((ssl == NULL) || (sz < 0))
         return BAD_FUNC_ARG;
 
-    ret = wolfSSL_read_internal(ssl, data, (size_t)sz, FALSE);
+    ret = wolfSSL_read_internal(ssl, data, NULL, (size_t)sz, FALSE);
     if (ssl->options.dtls && ssl->options.haveMcast && id != NULL)
         *id = ssl->keys.curPeerId;
     return ret;
@@ -4034,6 +4111,13 @@ static int _Rehandshake(WOLFSSL* ssl)
         return SECURE_RENEGOTIATION_E;
     }
 
+#ifdef WOLFSSL_KTLS
+    if (IsKtlsTx(ssl) || IsKtlsRx(ssl)) {
+        WOLFSSL_MSG("Secure Renegotiation not possible with kTLS");
+        return SECURE_RENEGOTIATION_E;
+    }
+#endif
+
     if (ssl->secure_renegotiation == NULL) {
         WOLFSSL_MSG("Secure Renegotiation not forced on by user");
         return SECURE_RENEGOTIATION_E;
@@ -11541,8 +11625,9 @@ int wolfSSL_set_compression(WOLFSSL* ssl)
 #ifndef USE_WINDOWS_API
     #if !defined(NO_WRITEV) && !defined(NO_TLS)
 
-        /* simulate writev semantics, doesn't actually do block at a time though
-           because of SSL_write behavior and because front adds may be small */
+        /* writev semantics: with TLS the buffers are gathered straight into
+           full sized records which are sent together, otherwise the buffers
+           are first copied into one and sent with SSL_write behavior */
         int wolfSSL_writev(WOLFSSL* ssl, const struct iovec* iov, int iovcnt)
         {
         #ifdef WOLFSSL_SMALL_STACK
@@ -11559,8 +11644,36 @@ int wolfSSL_set_compression(WOLFSSL* ssl)
 
             WOLFSSL_ENTER("wolfSSL_writev");
 
-            for (i = 0; i < iovcnt; i++)
-                sending += iov[i].iov_len;
+            if (ssl == NULL || iovcnt < 0 || (iov == NULL && iovcnt > 0))
+                return BAD_FUNC_ARG;
+
+            for (i = 0; i < iovcnt; i++) {
+                if (iov[i].iov_base == NULL && iov[i].iov_len > 0)
+                    return BAD_FUNC_ARG;
+                if (iov[i].iov_len > (size_t)INT_MAX - sending)
+                    return BAD_FUNC_ARG;
+                sending += (word32)iov[i].iov_len;
+            }
+
+        #ifdef WOLFSSL_NATIVE_WRITEV
+            if (!ssl->options.dtls
+            #ifdef HAVE_LIBZ
+                && !ssl->options.usingCompression
+            #endif
+                ) {
+                ret = wolfSSL_write_check(ssl);
+                if (ret != 0)
+                    return ret;
+
+                ret = SendDataV(ssl, iov, iovcnt, sending);
+
+                WOLFSSL_LEAVE("wolfSSL_writev", ret);
+
+                if (ret < 0)
+                    return WOLFSSL_FATAL_ERROR;
+                return ret;
+            }
+        #endif
 
             if (sending > sizeof(staticBuffer)) {
                 myBuffer = (byte*)XMALLOC(sending, ssl->heap,
@@ -11592,6 +11705,354 @@ int wolfSSL_set_compression(WOLFSSL* ssl)
     #endif
 #endif
 
+#ifdef WOLFSSL_KTLS
+/* Hand record protection of connections created from the context over to
+ * Linux kernel TLS once their handshake is done.
+ *
+ * @param [in] ctx   SSL/TLS context.
+ * @param [in] dirs  WOLFSSL_KTLS_TX and/or WOLFSSL_KTLS_RX. 0 for none.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx is NULL or dirs has unknown bits set.
+ */
+int wolfSSL_CTX_UseKTLS(WOLFSSL_CTX* ctx, int dirs)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_UseKTLS");
+
+    if (ctx == NULL || (dirs & ~(WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX)) != 0)
+        return BAD_FUNC_ARG;
+
+    ctx->ktls = (byte)dirs;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Hand record protection of the connection over to Linux kernel TLS once the
+ * handshake is done. This happens on the next read or write that finds no
+ * records part way through being sent or processed. Connections that don't
+ * use AES-GCM or ChaCha20-Poly1305 with TLS 1.2 or TLS 1.3 over the socket
+ * set with wolfSSL_set_fd() stay in software.
+ *
+ * @param [in] ssl   SSL/TLS object.
+ * @param [in] dirs  WOLFSSL_KTLS_TX and/or WOLFSSL_KTLS_RX. 0 for none.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ssl is NULL or dirs has unknown bits set.
+ */
+int wolfSSL_UseKTLS(WOLFSSL* ssl, int dirs)
+{
+    WOLFSSL_ENTER("wolfSSL_UseKTLS");
+
+    if (ssl == NULL || (dirs & ~(WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX)) != 0)
+        return BAD_FUNC_ARG;
+
+    /* an offloaded direction can't be taken back from the kernel */
+    ssl->ktls.want = (byte)dirs & (byte)~wolfSSL_GetKTLS(ssl);
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Get the directions the kernel protects records in.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @return  WOLFSSL_KTLS_TX and/or WOLFSSL_KTLS_RX, 0 for none.
+ * @return  BAD_FUNC_ARG when ssl is NULL.
+ */
+int wolfSSL_GetKTLS(WOLFSSL* ssl)
+{
+    int dirs = 0;
+
+    if (ssl == NULL)
+        return BAD_FUNC_ARG;
+
+    if (IsKtlsTx(ssl))
+        dirs |= WOLFSSL_KTLS_TX;
+    if (IsKtlsRx(ssl))
+        dirs |= WOLFSSL_KTLS_RX;
+
+    return dirs;
+}
+
+/* Send part of a file as application data without copying it through user
+ * space. Requires kTLS send offload - see wolfSSL_UseKTLS().
+ *
+ * @param [in] ssl     SSL/TLS object.
+ * @param [in] fd      Descriptor of file to send.
+ * @param [in] offset  Offset into file of data to send.
+ * @param [in] count   Number of bytes to send.
+ * @return  Number of bytes sent on success. May be less than count.
+ * @return  0 when the connection was closed.
+ * @return  WOLFSSL_FATAL_ERROR on failure. Use wolfSSL_get_error().
+ * @return  BAD_FUNC_ARG when ssl is NULL, fd is invalid or offset negative.
+ * @return  BAD_STATE_E when kTLS send offload is not active.
+ */
+int wolfSSL_sendfile(WOLFSSL* ssl, int fd, off_t offset, size_t count)
+{
+    int ret;
+
+    WOLFSSL_ENTER("wolfSSL_sendfile");
+
+    if (ssl == NULL || fd < 0 || offset < 0)
+        return BAD_FUNC_ARG;
+
+    ret = wolfSSL_write_check(ssl);
+    if (ret != 0)
+        return ret;
+
+    /* alerts and KeyUpdates go first */
+    if (ssl->buffers.outputBuffer.length > 0) {
+        ret = SendBuffered(ssl);
+        if (ret < 0) {
+            ssl->error = ret;
+            return WOLFSSL_FATAL_ERROR;
+        }
+    }
+    if (ssl->ktls.want != 0)
+        KtlsEnable(ssl);
+    if (!IsKtlsTx(ssl)) {
+        WOLFSSL_MSG("kTLS send offload not active");
+        return BAD_STATE_E;
+    }
+
+    do {
+        ret = wolfIO_KtlsSendfile(ssl->wfd, fd, &offset, count);
+    } while (ret == WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_ISR));
+
+    if (ret < 0) {
+        switch (ret) {
+            case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_WANT_WRITE):
+                ssl->error = WANT_WRITE;
+                break;
+            case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_CONN_RST):
+            case WC_NO_ERR_TRACE(WOLFSSL_CBIO_ERR_CONN_CLOSE):
+                ssl->options.connReset = 1;
+                ssl->error = SOCKET_PEER_CLOSED_E;
+                return 0;
+            default:
+                ssl->error = SOCKET_ERROR_E;
+                break;
+        }
+        return WOLFSSL_FATAL_ERROR;
+    }
+
+    WOLFSSL_LEAVE("wolfSSL_sendfile", ret);
+
+    return ret;
+}
+#endif /* WOLFSSL_KTLS */
+
+/* Read ahead on connections created from the context: each read from the
+ * socket asks for up to sz bytes so that one call can bring in many records.
+ *
+ * @param [in] ctx  SSL/TLS context.
+ * @param [in] sz   Size of input buffer to fill in bytes. 0 turns off.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx is NULL or sz is too big.
+ */
+int wolfSSL_CTX_SetReadAheadSz(WOLFSSL_CTX* ctx, unsigned int sz)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetReadAheadSz");
+
+    if (ctx == NULL || sz > WOLFSSL_READ_AHEAD_MAX_SZ)
+        return BAD_FUNC_ARG;
+
+    ctx->readAheadSz = sz;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Read ahead on the connection: each read from the socket asks for up to sz
+ * bytes so that one call can bring in many records. Records read ahead are
+ * decrypted into the caller's buffer by one wolfSSL_read() until it is full.
+ * The input buffer is kept at this size for the life of the connection.
+ * Not used with DTLS.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @param [in] sz   Size of input buffer to fill in bytes. 0 turns off.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ssl is NULL or sz is too big.
+ */
+int wolfSSL_SetReadAheadSz(WOLFSSL* ssl, unsigned int sz)
+{
+    WOLFSSL_ENTER("wolfSSL_SetReadAheadSz");
+
+    if (ssl == NULL || sz > WOLFSSL_READ_AHEAD_MAX_SZ)
+        return BAD_FUNC_ARG;
+
+    ssl->readAheadSz = sz;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Check the settings for dynamic record sizing.
+ *
+ * @param [in] smallSz  Size of small records in bytes. 0 turns off.
+ * @param [in] rampSz   Bytes to send in small records.
+ * @return  1 when valid.
+ * @return  0 otherwise.
+ */
+static int DynRecordValid(word16 smallSz, word32 rampSz)
+{
+    return (smallSz <= MAX_RECORD_SIZE) &&
+           (rampSz <= WOLFSSL_MAX_32BIT - MAX_RECORD_SIZE);
+}
+
+/* Send application data of connections created from the context in small
+ * records at first. See wolfSSL_SetDynamicRecordSize().
+ *
+ * @param [in] ctx      SSL/TLS context.
+ * @param [in] smallSz  Size of small records in bytes. 0 turns off.
+ * @param [in] rampSz   Bytes to send in small records before full sized ones.
+ * @param [in] idleSec  Seconds without writes after which records start small
+ *                      again. 0 for never.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx is NULL or smallSz or rampSz is too big.
+ */
+int wolfSSL_CTX_SetDynamicRecordSize(WOLFSSL_CTX* ctx, unsigned short smallSz,
+    unsigned int rampSz, unsigned int idleSec)
+{
+    WOLFSSL_ENTER("wolfSSL_CTX_SetDynamicRecordSize");
+
+    if (ctx == NULL || !DynRecordValid(smallSz, rampSz))
+        return BAD_FUNC_ARG;
+
+    XMEMSET(&ctx->dynRec, 0, sizeof(ctx->dynRec));
+    ctx->dynRec.smallSz = smallSz;
+    ctx->dynRec.rampSz = rampSz;
+    ctx->dynRec.idleSec = idleSec;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Send application data in small records at first. Small records fit in a
+ * TCP segment and can be decrypted by the peer as soon as it arrives, which
+ * cuts the time to the first byte while the congestion window is small.
+ * After rampSz bytes records are filled to the maximum fragment size again.
+ * This starts over when the connection has been idle for idleSec seconds.
+ * Not used with DTLS.
+ *
+ * @param [in] ssl      SSL/TLS object.
+ * @param [in] smallSz  Size of small records in bytes. 0 turns off.
+ * @param [in] rampSz   Bytes to send in small records before full sized ones.
+ * @param [in] idleSec  Seconds without writes after which records start small
+ *                      again. 0 for never.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ssl is NULL or smallSz or rampSz is too big.
+ */
+int wolfSSL_SetDynamicRecordSize(WOLFSSL* ssl, unsigned short smallSz,
+    unsigned int rampSz, unsigned int idleSec)
+{
+    WOLFSSL_ENTER("wolfSSL_SetDynamicRecordSize");
+
+    if (ssl == NULL || !DynRecordValid(smallSz, rampSz))
+        return BAD_FUNC_ARG;
+
+    XMEMSET(&ssl->dynRec, 0, sizeof(ssl->dynRec));
+    ssl->dynRec.smallSz = smallSz;
+    ssl->dynRec.rampSz = rampSz;
+    ssl->dynRec.idleSec = idleSec;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Keep a pool of I/O buffers in the context for its connections to borrow.
+ * A connection only holds buffers while records are being sent or received
+ * and gives them back to the pool when its input and output are drained.
+ * Call before creating connections with the context.
+ *
+ * @param [in] ctx      SSL/TLS context.
+ * @param [in] maxFree  Most free buffers to keep of each size. 0 turns the
+ *                      pool off and frees the buffers in it.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx is NULL.
+ * @return  BAD_MUTEX_E when the lock can't be created or taken.
+ * @return  NOT_COMPILED_IN when pooling is not compiled in.
+ */
+int wolfSSL_CTX_UseIOPool(WOLFSSL_CTX* ctx, unsigned int maxFree)
+{
+#ifdef WOLFSSL_IO_POOL
+    IOPool* pool;
+    int c;
+
+    WOLFSSL_ENTER("wolfSSL_CTX_UseIOPool");
+
+    if (ctx == NULL)
+        return BAD_FUNC_ARG;
+
+    pool = &ctx->ioPool;
+    if (!pool->init) {
+        if (maxFree == 0)
+            return WOLFSSL_SUCCESS;
+        if (wc_InitMutex(&pool->lock) != 0)
+            return BAD_MUTEX_E;
+        pool->init = 1;
+    }
+    if (wc_LockMutex(&pool->lock) != 0)
+        return BAD_MUTEX_E;
+
+    pool->maxFree = maxFree;
+    /* free buffers beyond the new limit */
+    for (c = 0; c < WOLFSSL_IO_POOL_CLASSES; c++) {
+        while (pool->freeCnt[c] > maxFree) {
+            byte* buf = pool->free[c];
+            XMEMCPY(&pool->free[c], buf, sizeof(byte*));
+            XFREE(buf, ctx->heap, DYNAMIC_TYPE_IO_POOL);
+            pool->freeCnt[c]--;
+        }
+    }
+
+    wc_UnLockMutex(&pool->lock);
+
+    return WOLFSSL_SUCCESS;
+#else
+    (void)ctx;
+    (void)maxFree;
+    return NOT_COMPILED_IN;
+#endif
+}
+
+/* Get the statistics of the context's I/O buffer pool.
+ *
+ * @param [in]  ctx    SSL/TLS context.
+ * @param [out] stats  Statistics of pool.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ctx or stats is NULL.
+ * @return  BAD_MUTEX_E when the lock can't be taken.
+ * @return  NOT_COMPILED_IN when pooling is not compiled in.
+ */
+int wolfSSL_CTX_GetIOPoolStats(WOLFSSL_CTX* ctx, WOLFSSL_IO_POOL_STATS* stats)
+{
+#ifdef WOLFSSL_IO_POOL
+    IOPool* pool;
+    int c;
+
+    if (ctx == NULL || stats == NULL)
+        return BAD_FUNC_ARG;
+
+    XMEMSET(stats, 0, sizeof(*stats));
+    pool = &ctx->ioPool;
+    if (!pool->init)
+        return WOLFSSL_SUCCESS;
+    if (wc_LockMutex(&pool->lock) != 0)
+        return BAD_MUTEX_E;
+
+    stats->gets = pool->gets;
+    stats->hits = pool->hits;
+    for (c = 0; c < WOLFSSL_IO_POOL_CLASSES; c++) {
+        stats->inUse += pool->inUse[c];
+        stats->inUseBytes += (size_t)pool->inUse[c] * IOPoolSize(c);
+        stats->free += pool->freeCnt[c];
+        stats->freeBytes += (size_t)pool->freeCnt[c] * IOPoolSize(c);
+    }
+
+    wc_UnLockMutex(&pool->lock);
+
+    return WOLFSSL_SUCCESS;
+#else
+    (void)ctx;
+    (void)stats;
+    return NOT_COMPILED_IN;
+#endif
+}
+
 
 #ifdef WOLFSSL_CALLBACKS
 
@@ -16440,6 +16901,11 @@ static WC_INLINE const char* wolfssl_cipher_to_string(int cipher, int key_size)
                 encStr = "Aria(?)";
             break;
 #endif
+#ifdef HAVE_ASCON
+        case wolfssl_ascon_aead:
+            encStr = "Ascon-AEAD128(128)";
+            break;
+#endif
 #ifdef HAVE_CAMELLIA
         case wolfssl_camellia:
             if (key_size == CAMELLIA_128_KEY_SIZE)
@@ -18149,6 +18615,7 @@ int wolfSSL_set_read_ahead(WOLFSSL* ssl, int v)
     }
 
     ssl->readAhead = (byte)v;
+    ssl->readAheadSz = (v != 0) ? WOLFSSL_READ_AHEAD_SZ : 0;
 
     return WOLFSSL_SUCCESS;
 }
@@ -18171,6 +18638,7 @@ int wolfSSL_CTX_set_read_ahead(WOLFSSL_CTX* ctx, int v)
     }
 
     ctx->readAhead = (byte)v;
+    ctx->readAheadSz = (v != 0) ? WOLFSSL_READ_AHEAD_SZ : 0;
 
     return WOLFSSL_SUCCESS;
 }
@@ -21937,6 +22405,10 @@ WOLFSSL_CTX* wolfSSL_set_SSL_CTX(WOLFSSL* ssl, WOLFSSL_CTX* ctx)
     }
 #else
     (void)ret;
+#endif
+#ifdef WOLFSSL_IO_POOL
+    /* old CTX, and its pool, may be freed while buffers are still held */
+    IOPoolDisown(ssl);
 #endif
     if (ssl->ctx != NULL)
         wolfSSL_CTX_free(ssl->ctx);
@@ -22351,6 +22823,309 @@ int wolfSSL_AsyncPoll(WOLFSSL* ssl, WOLF_EVENT_FLAG flags)
 }
 #endif /* WOLFSSL_ASYNC_CRYPT */
 
+#ifdef WOLFSSL_CRYPT_POOL
+/* Worker thread: runs the next step of each submitted handshake, including
+ * its private key operations, then marks the submission's event done. */
+static THREAD_RETURN WOLFSSL_THREAD CryptPoolWorker(void* arg)
+{
+    WOLFSSL_CRYPTPOOL* pool = (WOLFSSL_CRYPTPOOL*)arg;
+    WOLFSSL* ssl;
+    int ret;
+
+    for (;;) {
+        ssl = NULL;
+        if (wolfSSL_CondStart(&pool->cond) != 0) {
+            WOLFSSL_MSG("wolfSSL_CondStart failed in crypt pool worker");
+            break;
+        }
+        for (;;) {
+            byte stop = 1;
+
+            if (wc_LockMutex(&pool->lock) == 0) {
+                ssl = pool->jobHead;
+                if (ssl != NULL) {
+                    pool->jobHead = ssl->poolNext;
+                    if (pool->jobHead == NULL)
+                        pool->jobTail = NULL;
+                    ssl->poolNext = NULL;
+                }
+                stop = pool->stop;
+                wc_UnLockMutex(&pool->lock);
+            }
+            /* Submitted jobs are finished before stopping. */
+            if (ssl != NULL || stop)
+                break;
+            if (wolfSSL_CondWait(&pool->cond) != 0) {
+                WOLFSSL_MSG("wolfSSL_CondWait failed in crypt pool worker");
+                break;
+            }
+        }
+        if (wolfSSL_CondEnd(&pool->cond) != 0) {
+            WOLFSSL_MSG("wolfSSL_CondEnd failed in crypt pool worker");
+        }
+        if (ssl == NULL)
+            break;
+
+        ret = wolfSSL_negotiate(ssl);
+
+        /* Poll reads the state with the queue locked. */
+        if (wc_LockMutex(&pool->events.lock) == 0) {
+            ssl->poolEvent.ret = ret;
+            ssl->poolEvent.state = WOLF_EVENT_STATE_DONE;
+            wc_UnLockMutex(&pool->events.lock);
+        }
+        if (pool->signal != NULL)
+            pool->signal(pool->signalCtx);
+    }
+
+    WOLFSSL_RETURN_FROM_THREAD(0);
+}
+
+/* Wake one waiting worker. */
+static int CryptPoolWake(WOLFSSL_CRYPTPOOL* pool)
+{
+    int ret, condRet;
+
+    ret = wolfSSL_CondStart(&pool->cond);
+    if (ret != 0)
+        return ret;
+    condRet = wolfSSL_CondSignal(&pool->cond);
+    ret = wolfSSL_CondEnd(&pool->cond);
+    if (ret != 0)
+        return ret;
+
+    return condRet;
+}
+
+/* Create a pool of worker threads to run handshake steps on.
+ *
+ * @param [in] heap     Heap hint for allocations.
+ * @param [in] threads  Number of worker threads.
+ * @return  Pool on success.
+ * @return  NULL when threads is out of range, on allocation failure or when
+ *          a thread can't be created.
+ */
+WOLFSSL_CRYPTPOOL* wolfSSL_CryptPool_new(void* heap, int threads)
+{
+    WOLFSSL_CRYPTPOOL* pool;
+    int ret = 0;
+    int i;
+
+    WOLFSSL_ENTER("wolfSSL_CryptPool_new");
+
+    if (threads <= 0 || threads > WOLFSSL_CRYPT_POOL_MAX_THREADS) {
+        return NULL;
+    }
+
+    pool = (WOLFSSL_CRYPTPOOL*)XMALLOC(sizeof(WOLFSSL_CRYPTPOOL), heap,
+        DYNAMIC_TYPE_ASYNC);
+    if (pool == NULL) {
+        return NULL;
+    }
+    XMEMSET(pool, 0, sizeof(WOLFSSL_CRYPTPOOL));
+    pool->heap = heap;
+
+    pool->threads = (THREAD_TYPE*)XMALLOC(sizeof(THREAD_TYPE) * threads, heap,
+        DYNAMIC_TYPE_ASYNC);
+    if (pool->threads == NULL) {
+        XFREE(pool, heap, DYNAMIC_TYPE_ASYNC);
+        return NULL;
+    }
+
+    if (wolfEventQueue_Init(&pool->events) != 0) {
+        ret = BAD_MUTEX_E;
+    }
+    else if (wc_InitMutex(&pool->lock) != 0) {
+        wolfEventQueue_Free(&pool->events);
+        ret = BAD_MUTEX_E;
+    }
+    else if (wolfSSL_CondInit(&pool->cond) != 0) {
+        wc_FreeMutex(&pool->lock);
+        wolfEventQueue_Free(&pool->events);
+        ret = BAD_COND_E;
+    }
+    if (ret != 0) {
+        XFREE(pool->threads, heap, DYNAMIC_TYPE_ASYNC);
+        XFREE(pool, heap, DYNAMIC_TYPE_ASYNC);
+        return NULL;
+    }
+
+    for (i = 0; i < threads; i++) {
+        if (wolfSSL_NewThread(&pool->threads[i], CryptPoolWorker, pool) != 0) {
+            WOLFSSL_MSG("wolfSSL_NewThread failed for crypt pool");
+            wolfSSL_CryptPool_free(pool);
+            return NULL;
+        }
+        pool->threadCnt++;
+    }
+
+    return pool;
+}
+
+/* Stop the worker threads and free the pool.
+ *
+ * Handshakes already submitted are run before the workers stop. The WOLFSSL
+ * objects submitted must not be freed before this returns.
+ *
+ * @param [in] pool  Pool to free. May be NULL.
+ */
+void wolfSSL_CryptPool_free(WOLFSSL_CRYPTPOOL* pool)
+{
+    int i;
+
+    WOLFSSL_ENTER("wolfSSL_CryptPool_free");
+
+    if (pool == NULL) {
+        return;
+    }
+
+    if (wc_LockMutex(&pool->lock) == 0) {
+        pool->stop = 1;
+        wc_UnLockMutex(&pool->lock);
+    }
+    for (i = 0; i < pool->threadCnt; i++) {
+        if (CryptPoolWake(pool) != 0) {
+            WOLFSSL_MSG("CryptPoolWake failed in wolfSSL_CryptPool_free");
+        }
+    }
+    for (i = 0; i < pool->threadCnt; i++) {
+        if (wolfSSL_JoinThread(pool->threads[i]) != 0) {
+            WOLFSSL_MSG("wolfSSL_JoinThread failed in wolfSSL_CryptPool_free");
+        }
+    }
+
+    if (wolfSSL_CondFree(&pool->cond) != 0) {
+        WOLFSSL_MSG("wolfSSL_CondFree failed in wolfSSL_CryptPool_free");
+    }
+    wc_FreeMutex(&pool->lock);
+    wolfEventQueue_Free(&pool->events);
+    XFREE(pool->threads, pool->heap, DYNAMIC_TYPE_ASYNC);
+    XFREE(pool, pool->heap, DYNAMIC_TYPE_ASYNC);
+}
+
+/* Set the function called, on a worker thread, each time a submitted
+ * handshake step is done. Lets an event loop wake up and poll the pool.
+ *
+ * Set before submitting any handshakes.
+ *
+ * @param [in] pool    Pool to set signal on.
+ * @param [in] signal  Function to call. NULL for none.
+ * @param [in] ctx     Argument passed to signal.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when pool is NULL.
+ */
+int wolfSSL_CryptPool_SetSignal(WOLFSSL_CRYPTPOOL* pool,
+    WOLFSSL_CRYPT_POOL_SIGNAL signal, void* ctx)
+{
+    if (pool == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    pool->signal = signal;
+    pool->signalCtx = ctx;
+
+    return 0;
+}
+
+/* Submit the next step of a handshake to be run on a worker thread.
+ *
+ * The worker calls wolfSSL_negotiate() on the object. The object must not be
+ * used by the caller until its event is returned by wolfSSL_CryptPool_Poll().
+ *
+ * @param [in] pool  Pool to run handshake step on.
+ * @param [in] ssl   SSL/TLS object to run handshake step of.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when pool or ssl is NULL.
+ * @return  BAD_STATE_E when ssl is already submitted or pool is stopping.
+ * @return  BAD_MUTEX_E or BAD_COND_E when locking or signaling fails.
+ */
+int wolfSSL_CryptPool_Submit(WOLFSSL_CRYPTPOOL* pool, WOLFSSL* ssl)
+{
+    int ret;
+
+    WOLFSSL_ENTER("wolfSSL_CryptPool_Submit");
+
+    if (pool == NULL || ssl == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    if (wc_LockMutex(&pool->lock) != 0) {
+        return BAD_MUTEX_E;
+    }
+    if (wc_LockMutex(&pool->events.lock) != 0) {
+        ret = BAD_MUTEX_E;
+    }
+    else {
+        /* Done but not polled yet is still busy. */
+        if (pool->stop || ssl->poolEvent.state != WOLF_EVENT_STATE_READY) {
+            ret = BAD_STATE_E;
+        }
+        else {
+            ret = wolfEvent_Init(&ssl->poolEvent, WOLF_EVENT_TYPE_CRYPT_POOL,
+                ssl);
+        }
+        if (ret == 0) {
+            ssl->poolEvent.state = WOLF_EVENT_STATE_PENDING;
+            ret = wolfEventQueue_Add(&pool->events, &ssl->poolEvent);
+        }
+        wc_UnLockMutex(&pool->events.lock);
+    }
+    if (ret == 0) {
+        ssl->poolNext = NULL;
+        if (pool->jobTail != NULL)
+            pool->jobTail->poolNext = ssl;
+        else
+            pool->jobHead = ssl;
+        pool->jobTail = ssl;
+    }
+    wc_UnLockMutex(&pool->lock);
+
+    if (ret == 0 && CryptPoolWake(pool) != 0) {
+        /* Job is queued and will be picked up by the next idle worker. */
+        WOLFSSL_MSG("CryptPoolWake failed in wolfSSL_CryptPool_Submit");
+    }
+
+    return ret;
+}
+
+/* Get the events of submitted handshake steps that are done.
+ *
+ * The event's context is the WOLFSSL object and its ret field is the return
+ * of wolfSSL_negotiate(). Call wolfSSL_get_error() with it to find out
+ * whether the handshake is complete, wants I/O or failed.
+ *
+ * @param [in]  pool        Pool to poll.
+ * @param [out] events      Array to hold done events.
+ * @param [in]  maxEvents   Number of entries in events.
+ * @param [out] eventCount  Number of events put in events.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a pointer is NULL or maxEvents is less than 1.
+ */
+int wolfSSL_CryptPool_Poll(WOLFSSL_CRYPTPOOL* pool, WOLF_EVENT** events,
+    int maxEvents, int* eventCount)
+{
+    int ret;
+    int i;
+
+    if (pool == NULL || events == NULL || maxEvents <= 0 ||
+            eventCount == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    ret = wolfEventQueue_Poll(&pool->events, NULL, events, maxEvents, 0,
+        eventCount);
+    if (ret == 0) {
+        /* Out of the queue and no longer touched by workers: the objects
+         * can be submitted again. */
+        for (i = 0; i < *eventCount; i++) {
+            events[i]->state = WOLF_EVENT_STATE_READY;
+        }
+    }
+
+    return ret;
+}
+#endif /* WOLFSSL_CRYPT_POOL */
+
 #ifdef OPENSSL_EXTRA
 
 static int peek_ignore_err(int err)
@@ -22970,6 +23745,11 @@ long wolfSSL_CTX_get_tlsext_ticket_keys(WOLFSSL_CTX *ctx,
         return WOLFSSL_FAILURE;
     }
 
+#ifdef WOLFSSL_TICKET_KEY_RING
+    if (TicketKeyRing_Export(ctx, keys) != 0) {
+        return WOLFSSL_FAILURE;
+    }
+#else
     XMEMCPY(keys, ctx->ticketKeyCtx.name, WOLFSSL_TICKET_NAME_SZ);
     keys += WOLFSSL_TICKET_NAME_SZ;
     XMEMCPY(keys, ctx->ticketKeyCtx.key[0], WOLFSSL_TICKET_KEY_SZ);
@@ -22979,6 +23759,7 @@ long wolfSSL_CTX_get_tlsext_ticket_keys(WOLFSSL_CTX *ctx,
     c32toa(ctx->ticketKeyCtx.expirary[0], keys);
     keys += OPAQUE32_LEN;
     c32toa(ctx->ticketKeyCtx.expirary[1], keys);
+#endif
 
     return WOLFSSL_SUCCESS;
 }
@@ -23003,6 +23784,11 @@ long wolfSSL_CTX_set_tlsext_ticket_keys(WOLFSSL_CTX *ctx,
         return WOLFSSL_FAILURE;
     }
 
+#ifdef WOLFSSL_TICKET_KEY_RING
+    if (TicketKeyRing_Import(ctx, keys) != 0) {
+        return WOLFSSL_FAILURE;
+    }
+#else
     XMEMCPY(ctx->ticketKeyCtx.name, keys, WOLFSSL_TICKET_NAME_SZ);
     keys += WOLFSSL_TICKET_NAME_SZ;
     XMEMCPY(ctx->ticketKeyCtx.key[0], keys, WOLFSSL_TICKET_KEY_SZ);
@@ -23012,6 +23798,7 @@ long wolfSSL_CTX_set_tlsext_ticket_keys(WOLFSSL_CTX *ctx,
     ato32(keys, &ctx->ticketKeyCtx.expirary[0]);
     keys += OPAQUE32_LEN;
     ato32(keys, &ctx->ticketKeyCtx.expirary[1]);
+#endif
 
     return WOLFSSL_SUCCESS;
 }
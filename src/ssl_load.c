@@ -1342,6 +1342,9 @@ static int ProcessBufferPrivKeyHandleDer(WOLFSSL_CTX* ctx, WOLFSSL* ssl,
     }
     else if (ctx != NULL) {
         /* Dispose of previous key. */
+#ifdef WOLFSSL_CTX_DECODED_KEY
+        FreeCtxDecodedKey(ctx);
+#endif
         FreeDer(&ctx->privateKey);
         ctx->privateKeyId = 0;
         ctx->privateKeyLabel = 0;
@@ -1402,6 +1405,14 @@ static int ProcessBufferPrivateKey(WOLFSSL_CTX* ctx, WOLFSSL* ssl,
     }
 #endif /* WOLFSSL_ENCRYPTED_KEYS && !NO_PWDBASED */
 
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    /* Decode the context's key once for all SSL objects to sign with. */
+    if ((ret == 0) && (algId != 0) && (ssl == NULL) &&
+            (type == PRIVATEKEY_TYPE)) {
+        ret = DecodeCtxPrivateKey(ctx);
+    }
+#endif
+
 #ifdef WOLFSSL_BLIND_PRIVATE_KEY
 #ifdef WOLFSSL_DUAL_ALG_CERTS
     if (type == ALT_PRIVATEKEY_TYPE) {
@@ -4233,6 +4244,9 @@ int wolfSSL_CTX_use_PrivateKey_Id(WOLFSSL_CTX* ctx, const unsigned char* id,
     int ret = 1;
 
     /* Dispose of old private key and allocate and copy in id. */
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    FreeCtxDecodedKey(ctx);
+#endif
     FreeDer(&ctx->privateKey);
     if (AllocCopyDer(&ctx->privateKey, id, (word32)sz, PRIVATEKEY_TYPE,
             ctx->heap) != 0) {
@@ -4297,6 +4311,9 @@ int wolfSSL_CTX_use_PrivateKey_Label(WOLFSSL_CTX* ctx, const char* label,
     word32 sz = (word32)XSTRLEN(label) + 1;
 
     /* Dispose of old private key and allocate and copy in label. */
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    FreeCtxDecodedKey(ctx);
+#endif
     FreeDer(&ctx->privateKey);
     if (AllocCopyDer(&ctx->privateKey, (const byte*)label, (word32)sz,
             PRIVATEKEY_TYPE, ctx->heap) != 0) {
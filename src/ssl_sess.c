@@ -39,6 +39,11 @@
        ENABLE_SESSION_CACHE_ROW_LOCK: Allows row level locking for increased
        performance with large session caches
 
+       WOLFSSL_SESSION_CACHE_SEQLOCK: Lookups of sessions by ID copy the
+       session out of its row without locking. Writers, which keep row
+       locks, bump a sequence number per row that readers check to retry
+       torn copies. Scales resumption across many threads.
+
        HUGE_SESSION_CACHE yields 65,791 sessions, for servers under heavy load,
        allows over 13,000 new sessions per minute or over 200 new sessions per
        second
@@ -90,6 +95,16 @@
         #undef ENABLE_SESSION_CACHE_ROW_LOCK
     #endif
 
+    #ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+        #if defined(SINGLE_THREADED) || defined(NO_SESSION_CACHE_ROW_LOCK) || \
+            defined(SESSION_CACHE_DYNAMIC_MEM) || !defined(HAVE_C___ATOMIC)
+            #error WOLFSSL_SESSION_CACHE_SEQLOCK not supported in this build
+        #endif
+        /* writers are serialized per row */
+        #undef ENABLE_SESSION_CACHE_ROW_LOCK
+        #define ENABLE_SESSION_CACHE_ROW_LOCK
+    #endif
+
     typedef struct SessionRow {
         int nextIdx;                           /* where to place next one   */
         int totalCount;                        /* sessions ever on this row */
@@ -105,6 +120,9 @@
         wolfSSL_RwLock row_lock;
         int lock_valid;
     #endif
+    #ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+        word32 seq;                  /* odd while a writer holds the row */
+    #endif
     } SessionRow;
     #define SIZEOF_SESSION_ROW (sizeof(WOLFSSL_SESSION) + (sizeof(int) * 2))
 
@@ -114,7 +132,31 @@
         static WC_THREADSHARED word32 PeakSessions;
     #endif
 
-    #ifdef ENABLE_SESSION_CACHE_ROW_LOCK
+    #ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+    /* Take the row's write lock and make its sequence odd before the row is
+     * changed. */
+    static WC_INLINE int SessionRowWrLock(SessionRow* row)
+    {
+        int ret = wc_LockRwLock_Wr(&row->row_lock);
+        if (ret == 0) {
+            __atomic_store_n(&row->seq, row->seq + 1, __ATOMIC_RELAXED);
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+        }
+        return ret;
+    }
+    /* Release a read or write lock on the row. Only a writer leaves the
+     * sequence odd: make it even once the changes are visible. */
+    static WC_INLINE void SessionRowUnlock(SessionRow* row)
+    {
+        if ((row->seq & 1) != 0) {
+            __atomic_store_n(&row->seq, row->seq + 1, __ATOMIC_RELEASE);
+        }
+        wc_UnLockRwLock(&row->row_lock);
+    }
+    #define SESSION_ROW_RD_LOCK(row)   wc_LockRwLock_Rd(&(row)->row_lock)
+    #define SESSION_ROW_WR_LOCK(row)   SessionRowWrLock(row)
+    #define SESSION_ROW_UNLOCK(row)    SessionRowUnlock(row);
+    #elif defined(ENABLE_SESSION_CACHE_ROW_LOCK)
     #define SESSION_ROW_RD_LOCK(row)   wc_LockRwLock_Rd(&(row)->row_lock)
     #define SESSION_ROW_WR_LOCK(row)   wc_LockRwLock_Wr(&(row)->row_lock)
     #define SESSION_ROW_UNLOCK(row)    wc_UnLockRwLock(&(row)->row_lock);
@@ -1160,6 +1202,128 @@ int TlsSessionCacheGetAndWrLock(const byte *id, WOLFSSL_SESSION **sess,
             lockedRow, 0, side);
 }
 
+#ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+#ifndef WOLFSSL_SESSION_SEQLOCK_TRIES
+    /* lock-free copies tried before falling back to the row lock */
+    #define WOLFSSL_SESSION_SEQLOCK_TRIES 4
+#endif
+
+/* Results of TlsSessionCacheSnapshot() */
+enum {
+    SESSION_SNAPSHOT_MISS = 0,  /* no session with the ID */
+    SESSION_SNAPSHOT_HIT  = 1,  /* consistent copy made */
+    SESSION_SNAPSHOT_LOCK = 2   /* look up again with the row locked */
+};
+
+/* Copy the cached session with the ID without locking its row.
+ *
+ * The copy is only used when the row's sequence shows no writer changed the
+ * row while it was made. Sessions that reference memory outside of their
+ * slot (dynamic ticket or nonce, peer certificate object, ex_data) are left to
+ * the locked lookup as a writer may free that memory at any time.
+ * The copy holds the master secret and is zeroized unless the session is
+ * returned.
+ *
+ * @param [in]  id    Session ID of ID_LEN bytes.
+ * @param [in]  side  Side of the connection the session is for.
+ * @param [out] snap  Session to copy into.
+ * @return  SESSION_SNAPSHOT_HIT when snap holds the session.
+ * @return  SESSION_SNAPSHOT_MISS when no session in the cache has the ID.
+ * @return  SESSION_SNAPSHOT_LOCK when the lookup needs the row lock.
+ */
+static int TlsSessionCacheSnapshot(const byte* id, byte side,
+    WOLFSSL_SESSION* snap)
+{
+    SessionRow* sessRow;
+    const WOLFSSL_SESSION* s = NULL;
+    word32 row;
+    word32 seq;
+    int error = 0;
+    int ret = SESSION_SNAPSHOT_HIT;
+    int tries;
+    int count;
+    int idx;
+#ifdef HAVE_EX_DATA
+    int i;
+#endif
+
+    row = HashObject(id, ID_LEN, &error) % SESSION_ROWS;
+    if (error != 0)
+        return SESSION_SNAPSHOT_LOCK;
+    sessRow = &SessionCache[row];
+
+    for (tries = 0; tries < WOLFSSL_SESSION_SEQLOCK_TRIES; tries++) {
+        seq = __atomic_load_n(&sessRow->seq, __ATOMIC_ACQUIRE);
+        if ((seq & 1) != 0)
+            continue; /* writer busy with row */
+
+        /* start from most recently used, values may be torn */
+        s = NULL;
+        count = (int)min((word32)sessRow->totalCount, SESSIONS_PER_ROW);
+        idx = sessRow->nextIdx - 1;
+        if (idx < 0 || idx >= SESSIONS_PER_ROW) {
+            idx = SESSIONS_PER_ROW - 1;
+        }
+        for (; count > 0; --count) {
+            if (sessRow->Sessions[idx].sessionIDSz == ID_LEN &&
+                    sessRow->Sessions[idx].side == side &&
+                    XMEMCMP(sessRow->Sessions[idx].sessionID, id,
+                        ID_LEN) == 0) {
+                s = &sessRow->Sessions[idx];
+                XMEMCPY(snap, s, sizeof(WOLFSSL_SESSION));
+                break;
+            }
+            idx = idx > 0 ? idx - 1 : SESSIONS_PER_ROW - 1;
+        }
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&sessRow->seq, __ATOMIC_RELAXED) == seq)
+            break;
+    }
+    if (tries == WOLFSSL_SESSION_SEQLOCK_TRIES)
+        ret = SESSION_SNAPSHOT_LOCK;
+    else if (s == NULL)
+        ret = SESSION_SNAPSHOT_MISS;
+
+#if defined(SESSION_CERTS) && defined(OPENSSL_EXTRA)
+    if ((ret == SESSION_SNAPSHOT_HIT) && (snap->peer != NULL))
+        ret = SESSION_SNAPSHOT_LOCK;
+#endif
+#ifdef HAVE_EX_DATA
+    for (i = 0; (ret == SESSION_SNAPSHOT_HIT) && (i < MAX_EX_DATA); i++) {
+        if (snap->ex_data.ex_data[i] != NULL)
+            ret = SESSION_SNAPSHOT_LOCK;
+    }
+#endif
+#ifdef HAVE_SESSION_TICKET
+    if ((ret == SESSION_SNAPSHOT_HIT) && (snap->ticketLenAlloc > 0))
+        ret = SESSION_SNAPSHOT_LOCK;
+#if defined(WOLFSSL_TLS13) && defined(WOLFSSL_TICKET_NONCE_MALLOC) &&          \
+    (!defined(HAVE_FIPS) || (defined(FIPS_VERSION_GE) && FIPS_VERSION_GE(5,3)))
+    if ((ret == SESSION_SNAPSHOT_HIT) &&
+            (snap->ticketNonce.data != s->ticketNonce.dataStatic))
+        ret = SESSION_SNAPSHOT_LOCK;
+#endif
+#endif /* HAVE_SESSION_TICKET */
+
+    if (ret != SESSION_SNAPSHOT_HIT) {
+        /* copies made on any try are not used */
+        ForceZero(snap, sizeof(WOLFSSL_SESSION));
+        return ret;
+    }
+
+#ifdef HAVE_SESSION_TICKET
+    snap->ticket = snap->staticTicket;
+#if defined(WOLFSSL_TLS13) && defined(WOLFSSL_TICKET_NONCE_MALLOC) &&          \
+    (!defined(HAVE_FIPS) || (defined(FIPS_VERSION_GE) && FIPS_VERSION_GE(5,3)))
+    snap->ticketNonce.data = snap->ticketNonce.dataStatic;
+#endif
+#endif /* HAVE_SESSION_TICKET */
+
+    return SESSION_SNAPSHOT_HIT;
+}
+#endif /* WOLFSSL_SESSION_CACHE_SEQLOCK */
+
 int wolfSSL_GetSessionFromCache(WOLFSSL* ssl, WOLFSSL_SESSION* output)
 {
     const WOLFSSL_SESSION* sess = NULL;
@@ -1181,6 +1345,15 @@ int wolfSSL_GetSessionFromCache(WOLFSSL* ssl, WOLFSSL_SESSION* output)
 #endif
     byte         bogusID[ID_LEN];
     byte         bogusIDSz = 0;
+    byte         rowLocked = 1;
+#ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+#ifndef WOLFSSL_SMALL_STACK
+    WOLFSSL_SESSION snap[1];
+#else
+    WOLFSSL_SESSION* snap = NULL;
+#endif
+    int          snapRet = SESSION_SNAPSHOT_LOCK;
+#endif
 
     WOLFSSL_ENTER("wolfSSL_GetSessionFromCache");
 
@@ -1309,8 +1482,27 @@ int wolfSSL_GetSessionFromCache(WOLFSSL* ssl, WOLFSSL_SESSION* output)
 
     /* init to avoid clang static analyzer false positive */
     row = 0;
-    error = TlsSessionCacheGetAndRdLock(id, &sess, &row,
-        (byte)ssl->options.side);
+#ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+#ifdef WOLFSSL_SMALL_STACK
+    snap = (WOLFSSL_SESSION*)XMALLOC(sizeof(WOLFSSL_SESSION), output->heap,
+        DYNAMIC_TYPE_SESSION);
+    if (snap != NULL)
+#endif
+    {
+        snapRet = TlsSessionCacheSnapshot(id, (byte)ssl->options.side, snap);
+    }
+    if (snapRet != SESSION_SNAPSHOT_LOCK) {
+        rowLocked = 0;
+        error = 0;
+        if (snapRet == SESSION_SNAPSHOT_HIT)
+            sess = snap;
+    }
+    else
+#endif
+    {
+        error = TlsSessionCacheGetAndRdLock(id, &sess, &row,
+            (byte)ssl->options.side);
+    }
     error = (error == 0) ? WOLFSSL_SUCCESS : WOLFSSL_FAILURE;
     if (error != WOLFSSL_SUCCESS || sess == NULL) {
         WOLFSSL_MSG("Get Session from cache failed");
@@ -1333,14 +1525,16 @@ int wolfSSL_GetSessionFromCache(WOLFSSL* ssl, WOLFSSL_SESSION* output)
     else {
         if (!CheckSessionMatch(ssl, sess)) {
             WOLFSSL_MSG("Invalid session: can't be used in this context");
-            TlsSessionCacheUnlockRow(row);
+            if (rowLocked)
+                TlsSessionCacheUnlockRow(row);
             error = WOLFSSL_FAILURE;
         }
         else if (LowResTimer() >= (sess->bornOn + sess->timeout)) {
             WOLFSSL_SESSION* wrSess = NULL;
             WOLFSSL_MSG("Invalid session: timed out");
             sess = NULL;
-            TlsSessionCacheUnlockRow(row);
+            if (rowLocked)
+                TlsSessionCacheUnlockRow(row);
             /* Attempt to get a write lock */
             error = TlsSessionCacheGetAndWrLock(id, &wrSess, &row,
                     (byte)ssl->options.side);
@@ -1366,8 +1560,20 @@ int wolfSSL_GetSessionFromCache(WOLFSSL* ssl, WOLFSSL_SESSION* output)
 #ifdef HAVE_EX_DATA
         output->ownExData = !sess->ownExData; /* Session may own ex_data */
 #endif
-        TlsSessionCacheUnlockRow(row);
+        if (rowLocked)
+            TlsSessionCacheUnlockRow(row);
     }
+#ifdef WOLFSSL_SESSION_CACHE_SEQLOCK
+    /* copy of the cached session holds the master secret */
+#ifdef WOLFSSL_SMALL_STACK
+    if (snap != NULL) {
+        ForceZero(snap, sizeof(WOLFSSL_SESSION));
+        XFREE(snap, output->heap, DYNAMIC_TYPE_SESSION);
+    }
+#else
+    ForceZero(snap, sizeof(WOLFSSL_SESSION));
+#endif
+#endif
 
     /* We want to restore the bogus ID for TLS compatibility */
     if (ssl->session->haveAltSessionID &&
@@ -4875,6 +4875,11 @@ static void TLSX_SupportedCurve_ValidateRequest(WOLFSSL* ssl, byte* semaphore)
             (suites->suites[i+1] == TLS_SM4_CCM_SM3))
             return;
     #endif
+    #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+        if ((suites->suites[i] == ASCON_BYTE) &&
+            (suites->suites[i+1] == TLS_ASCON_AEAD128_SHA256))
+            return;
+    #endif
     #ifdef BUILD_TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3
         if ((suites->suites[i] == SM_BYTE) &&
             (suites->suites[i+1] == TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3))
@@ -4927,6 +4932,11 @@ static void TLSX_PointFormat_ValidateRequest(WOLFSSL* ssl, byte* semaphore)
             (suites->suites[i+1] == TLS_SM4_CCM_SM3))
             return;
     #endif
+    #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+        if ((suites->suites[i] == ASCON_BYTE) &&
+            (suites->suites[i+1] == TLS_ASCON_AEAD128_SHA256))
+            return;
+    #endif
     #ifdef BUILD_TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3
         if ((suites->suites[i] == SM_BYTE) &&
             (suites->suites[i+1] == TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3))
@@ -4969,6 +4979,11 @@ static void TLSX_PointFormat_ValidateResponse(WOLFSSL* ssl, byte* semaphore)
         (ssl->options.cipherSuite == TLS_SM4_CCM_SM3))
         return;
 #endif
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    if ((ssl->options.cipherSuite0 == ASCON_BYTE) &&
+        (ssl->options.cipherSuite == TLS_ASCON_AEAD128_SHA256))
+        return;
+#endif
 #ifdef BUILD_TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3
     if ((ssl->options.cipherSuite0 == SM_BYTE) &&
         (ssl->options.cipherSuite == TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3))
@@ -14907,6 +14922,14 @@ int TLSX_PopulateExtensions(WOLFSSL* ssl, byte isServer)
                         }
                     }
                     else
+                #endif
+                #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+                    if (cipherSuite0 == ASCON_BYTE) {
+                        if (cipherSuite != TLS_ASCON_AEAD128_SHA256) {
+                            continue;
+                        }
+                    }
+                    else
                 #endif
                     if (cipherSuite0 != TLS13_BYTE)
                         continue;
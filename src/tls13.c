@@ -2538,6 +2538,151 @@ static int Tls13IntegrityOnly_Encrypt(WOLFSSL* ssl, byte* output,
 }
 #endif
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+/* Build the 16 byte Ascon-AEAD128 nonce for a TLS v1.3 record.
+ *
+ * ssl    The SSL/TLS object.
+ * nonce  The nonce data to use when encrypting or decrypting.
+ * iv     The derived IV - full Ascon nonce length.
+ * order  The side on which the message is to be or was sent.
+ */
+static WC_INLINE void BuildTls13AsconNonce(WOLFSSL* ssl, byte* nonce,
+                                           const byte* iv, int order)
+{
+    int seq_offset = ASCON_AEAD128_NONCE_SZ - SEQ_SZ;
+    /* The nonce is the IV with the sequence XORed into the last bytes. */
+    WriteSEQTls13(ssl, order, nonce + seq_offset);
+    XMEMCPY(nonce, iv, seq_offset);
+    xorbuf(nonce + seq_offset, iv + seq_offset, SEQ_SZ);
+}
+
+/* Encrypt with Ascon-AEAD128 and create authentication tag.
+ *
+ * ssl     The SSL/TLS object.
+ * output  The buffer to write encrypted data into.
+ *         May be the same pointer as input.
+ * input   The data to encrypt.
+ * sz      The number of bytes to encrypt.
+ * aad     The additional authentication data.
+ * aadSz   The size of the addition authentication data.
+ * tag     The authentication tag buffer.
+ * returns 0 on success, otherwise failure.
+ */
+static int Tls13Ascon_Encrypt(WOLFSSL* ssl, byte* output, const byte* input,
+                              word16 sz, const byte* aad, word16 aadSz,
+                              byte* tag)
+{
+    int  ret;
+    byte nonce[ASCON_AEAD128_NONCE_SZ];
+
+    BuildTls13AsconNonce(ssl, nonce, ssl->encrypt.ascon + ASCON_AEAD128_KEY_SZ,
+                         CUR_ORDER);
+    ret = wc_AsconAEAD128_Encrypt(ssl->encrypt.ascon, nonce, aad, aadSz, input,
+                                  sz, output, tag);
+    ForceZero(nonce, sizeof(nonce));
+    return ret;
+}
+#endif
+
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+/* Encrypt the AES-GCM records waiting in the output buffer.
+ *
+ * Records of the same size are encrypted together by
+ * wc_AesGcmEncryptRecords().
+ *
+ * ssl  The SSL/TLS object.
+ * returns 0 on success, otherwise failure.
+ */
+int Tls13GcmRecordsFlush(WOLFSSL* ssl)
+{
+    SendGcmRecords* q = &ssl->sendGcm;
+    wc_AesGcmRecord rec[2];
+    word16 macSz = ssl->specs.aead_mac_size;
+    int    ret;
+    int    i;
+
+    if (q->cnt == 0)
+        return 0;
+
+    XMEMSET(rec, 0, sizeof(rec));
+    for (i = 0; i < q->cnt; i++) {
+        byte* hdr = ssl->buffers.outputBuffer.buffer + q->off[i];
+
+        rec[i].out       = hdr + RECORD_HEADER_SZ;
+        rec[i].in        = rec[i].out;
+        rec[i].sz        = q->sz[i];
+        rec[i].iv        = q->nonce[i];
+        rec[i].ivSz      = AESGCM_NONCE_SZ;
+        rec[i].authTag   = rec[i].out + q->sz[i];
+        rec[i].authTagSz = macSz;
+        rec[i].authIn    = hdr;
+        rec[i].authInSz  = RECORD_HEADER_SZ;
+    }
+
+    ret = wc_AesGcmEncryptRecords(ssl->encrypt.aes, rec, q->cnt);
+    if (ret != 0) {
+        /* Zeroize plaintext. */
+        for (i = 0; i < q->cnt; i++)
+            ForceZero(rec[i].out, rec[i].sz + macSz);
+    }
+    ForceZero(q->nonce, sizeof(q->nonce));
+    q->cnt = 0;
+
+    return ret;
+}
+
+/* Check whether the record is to be queued to encrypt with the next one.
+ *
+ * Only records encrypted in place in the output buffer are queued.
+ *
+ * ssl     The SSL/TLS object.
+ * output  The buffer to write encrypted data and authentication tag into.
+ * input   The data to encrypt.
+ * sz      The number of bytes of data and authentication tag.
+ * aad     The additional authentication data.
+ * aadSz   The size of the addition authentication data.
+ * returns 1 when the record is to be queued, otherwise 0.
+ */
+static int Tls13GcmRecordsCanQueue(WOLFSSL* ssl, const byte* output,
+    const byte* input, word16 sz, const byte* aad, word16 aadSz)
+{
+    const byte* buf = ssl->buffers.outputBuffer.buffer;
+
+    if (!ssl->sendGcm.defer && (ssl->sendGcm.cnt == 0))
+        return 0;
+
+    return (buf != NULL) && (input == output) &&
+           (aadSz == RECORD_HEADER_SZ) && (aad + aadSz == output) &&
+           (aad >= buf + ssl->buffers.outputBuffer.idx) &&
+           (output + sz <= buf + ssl->buffers.outputBuffer.bufferSize);
+}
+
+/* Queue a record built in the output buffer for encryption.
+ *
+ * The records are encrypted when the pair is complete or no more records are
+ * to be queued.
+ *
+ * ssl     The SSL/TLS object.
+ * output  The record data after the record header.
+ * dataSz  The number of bytes to encrypt.
+ * returns 0 on success, otherwise failure.
+ */
+static int Tls13GcmRecordsQueue(WOLFSSL* ssl, byte* output, word16 dataSz)
+{
+    SendGcmRecords* q = &ssl->sendGcm;
+
+    q->off[q->cnt] = (word32)(output - RECORD_HEADER_SZ -
+                              ssl->buffers.outputBuffer.buffer);
+    q->sz[q->cnt] = dataSz;
+    XMEMCPY(q->nonce[q->cnt], ssl->encrypt.nonce, AESGCM_NONCE_SZ);
+    q->cnt++;
+
+    if (!q->defer || (q->cnt == 2))
+        return Tls13GcmRecordsFlush(ssl);
+    return 0;
+}
+#endif /* WOLFSSL_SEND_GCM_RECORDS */
+
 /* Encrypt data for TLS v1.3.
  *
  * ssl     The SSL/TLS object.
@@ -2619,8 +2764,14 @@ static int EncryptTls13(WOLFSSL* ssl, byte* output, const byte* input,
             if (ssl->encrypt.nonce == NULL)
                 return MEMORY_E;
 
-            BuildTls13Nonce(ssl, ssl->encrypt.nonce, ssl->keys.aead_enc_imp_IV,
-                            CUR_ORDER);
+        #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+            /* Ascon-AEAD128 uses a 16 byte nonce - built when processing. */
+            if (ssl->specs.bulk_cipher_algorithm != wolfssl_ascon_aead)
+        #endif
+            {
+                BuildTls13Nonce(ssl, ssl->encrypt.nonce,
+                                ssl->keys.aead_enc_imp_IV, CUR_ORDER);
+            }
         #endif
 
             /* Advance state and proceed */
@@ -2655,6 +2806,17 @@ static int EncryptTls13(WOLFSSL* ssl, byte* output, const byte* input,
                     if (ret == WC_NO_ERR_TRACE(NOT_COMPILED_IN))
                 #endif
                     {
+                #ifdef WOLFSSL_SEND_GCM_RECORDS
+                        if (Tls13GcmRecordsCanQueue(ssl, output, input, sz,
+                                aad, aadSz)) {
+                            ret = Tls13GcmRecordsQueue(ssl, output, dataSz);
+                            break;
+                        }
+                        /* records waiting are encrypted before this one */
+                        ret = Tls13GcmRecordsFlush(ssl);
+                        if (ret != 0)
+                            break;
+                #endif
 
                 #if ((defined(HAVE_FIPS) || defined(HAVE_SELFTEST)) && \
                     (!defined(HAVE_FIPS_VERSION) || (HAVE_FIPS_VERSION < 2)))
@@ -2740,6 +2902,13 @@ static int EncryptTls13(WOLFSSL* ssl, byte* output, const byte* input,
                     break;
             #endif
 
+            #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+                case wolfssl_ascon_aead:
+                    ret = Tls13Ascon_Encrypt(ssl, output, input, dataSz, aad,
+                        aadSz, output + dataSz);
+                    break;
+            #endif
+
             #ifdef HAVE_NULL_CIPHER
                 case wolfssl_cipher_null:
                     ret = Tls13IntegrityOnly_Encrypt(ssl, output, input, dataSz,
@@ -2775,7 +2944,7 @@ static int EncryptTls13(WOLFSSL* ssl, byte* output, const byte* input,
         #ifdef WOLFSSL_DEBUG_TLS
             #ifdef CIPHER_NONCE
                 WOLFSSL_MSG("Nonce");
-                WOLFSSL_BUFFER(ssl->encrypt.nonce, ssl->specs.iv_size);
+                WOLFSSL_BUFFER(ssl->encrypt.nonce, AEAD_NONCE_SZ);
             #endif
                 WOLFSSL_MSG("Encrypted data");
                 WOLFSSL_BUFFER(output, dataSz);
@@ -2933,6 +3102,40 @@ static int Tls13IntegrityOnly_Decrypt(WOLFSSL* ssl, byte* output,
 }
 #endif
 
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+/* Decrypt with Ascon-AEAD128 and check authentication tag.
+ *
+ * ssl     The SSL/TLS object.
+ * output  The buffer to write decrypted data into.
+ *         May be the same pointer as input.
+ * input   The data to decrypt.
+ * sz      The number of bytes to decrypt.
+ * aad     The additional authentication data.
+ * aadSz   The size of the addition authentication data.
+ * tagIn   The authentication tag data from packet.
+ * returns 0 on success, VERIFY_MAC_ERROR when tag doesn't match, otherwise
+ * failure.
+ */
+static int Tls13Ascon_Decrypt(WOLFSSL* ssl, byte* output, const byte* input,
+                              word16 sz, const byte* aad, word16 aadSz,
+                              const byte* tagIn)
+{
+    int  ret;
+    byte nonce[ASCON_AEAD128_NONCE_SZ];
+
+    BuildTls13AsconNonce(ssl, nonce, ssl->decrypt.ascon + ASCON_AEAD128_KEY_SZ,
+                         PEER_ORDER);
+    ret = wc_AsconAEAD128_Decrypt(ssl->decrypt.ascon, nonce, aad, aadSz, input,
+                                  sz, output, tagIn);
+    ForceZero(nonce, sizeof(nonce));
+    if (ret == WC_NO_ERR_TRACE(ASCON_AUTH_E)) {
+        WOLFSSL_MSG("Ascon-AEAD128 authentication tag mismatch");
+        ret = VERIFY_MAC_ERROR;
+    }
+    return ret;
+}
+#endif
+
 /* Decrypt data for TLS v1.3.
  *
  * ssl     The SSL/TLS object.
@@ -3020,8 +3223,14 @@ int DecryptTls13(WOLFSSL* ssl, byte* output, const byte* input, word16 sz,
             if (ssl->decrypt.nonce == NULL)
                 return MEMORY_E;
 
-            BuildTls13Nonce(ssl, ssl->decrypt.nonce, ssl->keys.aead_dec_imp_IV,
-                            PEER_ORDER);
+        #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+            /* Ascon-AEAD128 uses a 16 byte nonce - built when processing. */
+            if (ssl->specs.bulk_cipher_algorithm != wolfssl_ascon_aead)
+        #endif
+            {
+                BuildTls13Nonce(ssl, ssl->decrypt.nonce,
+                                ssl->keys.aead_dec_imp_IV, PEER_ORDER);
+            }
         #endif
 
             /* Advance state and proceed */
@@ -3133,6 +3342,13 @@ int DecryptTls13(WOLFSSL* ssl, byte* output, const byte* input, word16 sz,
                     break;
             #endif
 
+            #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+                case wolfssl_ascon_aead:
+                    ret = Tls13Ascon_Decrypt(ssl, output, input, dataSz, aad,
+                        aadSz, input + dataSz);
+                    break;
+            #endif
+
             #ifdef HAVE_NULL_CIPHER
                 case wolfssl_cipher_null:
                     ret = Tls13IntegrityOnly_Decrypt(ssl, output, input, dataSz,
@@ -3161,7 +3377,7 @@ int DecryptTls13(WOLFSSL* ssl, byte* output, const byte* input, word16 sz,
         #ifdef WOLFSSL_DEBUG_TLS
             #ifdef CIPHER_NONCE
                 WOLFSSL_MSG("Nonce");
-                WOLFSSL_BUFFER(ssl->decrypt.nonce, ssl->specs.iv_size);
+                WOLFSSL_BUFFER(ssl->decrypt.nonce, AEAD_NONCE_SZ);
             #endif
                 WOLFSSL_MSG("Decrypted data");
                 WOLFSSL_BUFFER(output, dataSz);
@@ -3233,6 +3449,14 @@ int BuildTls13Message(WOLFSSL* ssl, byte* output, int outSz, const byte* input,
 
     WOLFSSL_ENTER("BuildTls13Message");
 
+#ifdef WOLFSSL_KTLS
+    if (IsKtlsTx(ssl)) {
+        /* The kernel protects the record. */
+        return KtlsBuildRecord(ssl, output, outSz, input, inSz, type,
+                               hashOutput, sizeOnly);
+    }
+#endif
+
 #ifdef WOLFSSL_ASYNC_CRYPT
     ret = WC_NO_PENDING_E;
     if (asyncOkay) {
@@ -3531,6 +3755,17 @@ byte SuiteMac(const byte* suite)
         }
     }
 #endif
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    else if (suite[0] == ASCON_BYTE) {
+        switch (suite[1]) {
+            case TLS_ASCON_AEAD128_SHA256:
+                mac = sha256_mac;
+                break;
+            default:
+                break;
+        }
+    }
+#endif
 #ifdef HAVE_NULL_CIPHER
     else if (suite[0] == ECC_BYTE) {
         switch (suite[1]) {
@@ -5552,6 +5787,13 @@ int DoTls13ServerHello(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
         ; /* Do nothing. */
     }
     else
+#endif
+#ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+    if (ssl->options.cipherSuite0 == ASCON_BYTE &&
+            ssl->options.cipherSuite == TLS_ASCON_AEAD128_SHA256) {
+        ; /* Do nothing. */
+    }
+    else
 #endif
     /* Check that the negotiated ciphersuite matches protocol version. */
     if (ssl->options.cipherSuite0 != TLS13_BYTE) {
@@ -6362,8 +6604,14 @@ static int CheckPreSharedKeys(WOLFSSL* ssl, const byte* input, word32 helloSz,
 
         extEarlyData = TLSX_Find(ssl->extensions, TLSX_EARLY_DATA);
         if (extEarlyData != NULL) {
-            /* Check if accepting early data and first PSK. */
-            if (ssl->earlyData != no_early_data && first) {
+            /* Check if accepting early data and first PSK. The binder is a
+             * MAC over the ClientHello so a replayed one has the same. */
+            if (ssl->earlyData != no_early_data && first
+            #ifdef WOLFSSL_EARLY_DATA_ANTI_REPLAY
+                    && !AntiReplayCheck(ssl, ((PreSharedKey*)ext->data)->binder,
+                                        ((PreSharedKey*)ext->data)->binderLen)
+            #endif
+                    ) {
                 extEarlyData->resp = 1;
 
                 /* Derive early data decryption key. */
@@ -7278,6 +7526,13 @@ int DoTls13ClientHello(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
             ; /* Do nothing. */
         }
         else
+    #endif
+    #ifdef BUILD_TLS_ASCON_AEAD128_SHA256
+        if (ssl->options.cipherSuite0 == ASCON_BYTE &&
+                ssl->options.cipherSuite == TLS_ASCON_AEAD128_SHA256) {
+            ; /* Do nothing. */
+        }
+        else
     #endif
         if (ssl->options.cipherSuite0 != TLS13_BYTE) {
             WOLFSSL_MSG("Negotiated ciphersuite from lesser version than "
@@ -11093,6 +11348,7 @@ int DoTls13Finished(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
         ssl->options.clientState = CLIENT_FINISHED_COMPLETE;
         ssl->options.handShakeState = HANDSHAKE_DONE;
         ssl->options.handShakeDone  = 1;
+        ssl->dynRec.sent = 0;
     }
 #endif
 
@@ -11347,6 +11603,7 @@ static int SendTls13Finished(WOLFSSL* ssl)
         ssl->options.clientState = CLIENT_FINISHED_COMPLETE;
         ssl->options.handShakeState = HANDSHAKE_DONE;
         ssl->options.handShakeDone  = 1;
+        ssl->dynRec.sent = 0;
     }
 #endif
 #ifndef NO_WOLFSSL_SERVER
@@ -11468,6 +11725,11 @@ int SendTls13KeyUpdate(WOLFSSL* ssl)
             return ret;
         if ((ret = SetKeysSide(ssl, ENCRYPT_SIDE_ONLY)) != 0)
             return ret;
+    #ifdef WOLFSSL_KTLS
+        /* Kernel switches keys once the KeyUpdate has been sent. */
+        if ((ret = KtlsRekey(ssl, ENCRYPT_SIDE_ONLY)) != 0)
+            return ret;
+    #endif
     }
 
 
@@ -11527,6 +11789,11 @@ static int DoTls13KeyUpdate(WOLFSSL* ssl, const byte* input, word32* inOutIdx,
     }
     if ((ret = SetKeysSide(ssl, DECRYPT_SIDE_ONLY)) != 0)
         return ret;
+#ifdef WOLFSSL_KTLS
+    /* Kernel holds back records after the KeyUpdate until it has the keys. */
+    if ((ret = KtlsRekey(ssl, DECRYPT_SIDE_ONLY)) != 0)
+        return ret;
+#endif
 
 #ifdef WOLFSSL_DTLS13
     if (ssl->options.dtls) {
@@ -14862,6 +15129,359 @@ int wolfSSL_set_max_early_data(WOLFSSL* ssl, unsigned int sz)
 #endif
 }
 
+#ifdef WOLFSSL_EARLY_DATA_ANTI_REPLAY
+/* Anti-replay of early data (RFC 8446, 8.2).
+ *
+ * The server remembers the binder of each ClientHello that it accepts early
+ * data with, for at least a window of seconds. A ClientHello older than that
+ * fails the ticket age check. The store is split into shards, by key, each
+ * with its own lock. A shard has two generations that are rotated each window
+ * and each generation has a bloom filter, checked first, and a fixed number of
+ * exact entries. All memory is allocated when the store is configured.
+ * When a generation's entries are used up, any hit in its bloom filter is
+ * treated as a replay. Early data is then rejected and the handshake continues
+ * without it.
+ */
+
+/* Number of independently locked shards. */
+#ifndef WOLFSSL_ANTI_REPLAY_SHARDS
+    #define WOLFSSL_ANTI_REPLAY_SHARDS  16
+#endif
+/* Shortest window in seconds - a ClientHello must be remembered for at least
+ * as long as the ticket age check accepts it. */
+#define ANTI_REPLAY_MIN_WINDOW  (MAX_TICKET_AGE_DIFF + 2)
+/* Window in seconds used when not configured. */
+#ifndef WOLFSSL_ANTI_REPLAY_WINDOW
+    #define WOLFSSL_ANTI_REPLAY_WINDOW  ANTI_REPLAY_MIN_WINDOW
+#endif
+#if WOLFSSL_ANTI_REPLAY_WINDOW < ANTI_REPLAY_MIN_WINDOW
+    #error "WOLFSSL_ANTI_REPLAY_WINDOW must be at least MAX_TICKET_AGE_DIFF + 2"
+#endif
+
+#define ANTI_REPLAY_KEY_SZ      16
+#define ANTI_REPLAY_SLOT_SZ     (1 + ANTI_REPLAY_KEY_SZ)  /* used flag and key */
+#define ANTI_REPLAY_BLOOM_K     4
+#define ANTI_REPLAY_MAX_ENTRIES 0x1000000
+
+typedef struct AntiReplayGen {
+    byte*  bloom;
+    byte*  slots;
+    word32 count;
+    byte   full;        /* entries used up, only in bloom filter */
+} AntiReplayGen;
+
+typedef struct AntiReplayShard {
+    wolfSSL_Mutex lock;
+    word32        start;  /* time current generation started in seconds */
+    byte          cur;    /* index of current generation */
+    AntiReplayGen gen[2];
+} AntiReplayShard;
+
+struct AntiReplayStore {
+    word32          window;
+    word32          maxCount;   /* entries per generation */
+    word32          slotMask;
+    word32          bloomMask;
+    void*           heap;
+    byte*           mem;
+    AntiReplayShard shard[WOLFSSL_ANTI_REPLAY_SHARDS];
+};
+
+static void AntiReplayStore_Free(AntiReplayStore* store)
+{
+    int i;
+
+    if (store == NULL)
+        return;
+
+    for (i = 0; i < WOLFSSL_ANTI_REPLAY_SHARDS; i++)
+        wc_FreeMutex(&store->shard[i].lock);
+    XFREE(store->mem, store->heap, DYNAMIC_TYPE_ANTI_REPLAY);
+    XFREE(store, store->heap, DYNAMIC_TYPE_ANTI_REPLAY);
+}
+
+static AntiReplayStore* AntiReplayStore_New(word32 window, word32 maxEntries,
+    void* heap)
+{
+    AntiReplayStore* store;
+    word32 slots = 1;
+    word32 bits = 64;
+    word32 genSz;
+    byte*  p;
+    int    i;
+    int    g;
+
+    store = (AntiReplayStore*)XMALLOC(sizeof(AntiReplayStore), heap,
+                                      DYNAMIC_TYPE_ANTI_REPLAY);
+    if (store == NULL)
+        return NULL;
+    XMEMSET(store, 0, sizeof(AntiReplayStore));
+    store->heap = heap;
+    store->window = window;
+    store->maxCount = (maxEntries + WOLFSSL_ANTI_REPLAY_SHARDS - 1) /
+                      WOLFSSL_ANTI_REPLAY_SHARDS;
+    /* Keep exact set at most half full and 16 bits of filter per entry. */
+    while (slots < 2 * store->maxCount)
+        slots <<= 1;
+    while (bits < 16 * store->maxCount)
+        bits <<= 1;
+    store->slotMask = slots - 1;
+    store->bloomMask = bits - 1;
+    genSz = bits / 8 + slots * ANTI_REPLAY_SLOT_SZ;
+
+    store->mem = (byte*)XMALLOC((size_t)genSz * 2 * WOLFSSL_ANTI_REPLAY_SHARDS,
+                                heap, DYNAMIC_TYPE_ANTI_REPLAY);
+    if (store->mem == NULL) {
+        XFREE(store, heap, DYNAMIC_TYPE_ANTI_REPLAY);
+        return NULL;
+    }
+    XMEMSET(store->mem, 0, (size_t)genSz * 2 * WOLFSSL_ANTI_REPLAY_SHARDS);
+
+    p = store->mem;
+    for (i = 0; i < WOLFSSL_ANTI_REPLAY_SHARDS; i++) {
+        AntiReplayShard* shard = &store->shard[i];
+
+        if (wc_InitMutex(&shard->lock) != 0) {
+            while (--i >= 0)
+                wc_FreeMutex(&store->shard[i].lock);
+            XFREE(store->mem, heap, DYNAMIC_TYPE_ANTI_REPLAY);
+            XFREE(store, heap, DYNAMIC_TYPE_ANTI_REPLAY);
+            return NULL;
+        }
+        shard->start = LowResTimer();
+        for (g = 0; g < 2; g++) {
+            shard->gen[g].bloom = p;
+            shard->gen[g].slots = p + bits / 8;
+            p += genSz;
+        }
+    }
+
+    return store;
+}
+
+static void AntiReplayGen_Clear(AntiReplayStore* store, AntiReplayGen* gen)
+{
+    XMEMSET(gen->bloom, 0, (store->bloomMask + 1) / 8);
+    XMEMSET(gen->slots, 0, (store->slotMask + 1) * ANTI_REPLAY_SLOT_SZ);
+    gen->count = 0;
+    gen->full = 0;
+}
+
+/* Move on to a new generation when the current one is a window old.
+ * Entries of the previous generation are kept for one more window. */
+static void AntiReplayShard_Rotate(AntiReplayStore* store,
+    AntiReplayShard* shard, word32 now)
+{
+    word32 age = now - shard->start;
+
+    /* Time went backwards - start counting again. */
+    if (now < shard->start) {
+        shard->start = now;
+    }
+    else if (age >= 2 * store->window) {
+        AntiReplayGen_Clear(store, &shard->gen[0]);
+        AntiReplayGen_Clear(store, &shard->gen[1]);
+        shard->start = now;
+    }
+    else if (age >= store->window) {
+        shard->cur ^= 1;
+        AntiReplayGen_Clear(store, &shard->gen[shard->cur]);
+        shard->start += store->window;
+    }
+}
+
+/* Find the slot holding key or the empty slot where it would go. */
+static byte* AntiReplayGen_Slot(AntiReplayStore* store, AntiReplayGen* gen,
+    const byte* key)
+{
+    word32 idx;
+    byte*  slot;
+
+    ato32(key + 12, &idx);
+    for (;;) {
+        slot = gen->slots + (idx & store->slotMask) * ANTI_REPLAY_SLOT_SZ;
+        if (slot[0] == 0 ||
+                XMEMCMP(slot + 1, key, ANTI_REPLAY_KEY_SZ) == 0) {
+            return slot;
+        }
+        idx++;
+    }
+}
+
+/* Check whether the key has been seen in the window and record it if not.
+ * The binder is the output of an HMAC and so its bytes are used as hashes.
+ *
+ * store  Anti-replay store.
+ * key    Binder of the ClientHello.
+ * keySz  Size of binder in bytes.
+ * returns 1 when seen or on lock failure and 0 otherwise.
+ */
+static int AntiReplayStore_Check(AntiReplayStore* store, const byte* key,
+    word32 keySz)
+{
+    byte   k[ANTI_REPLAY_KEY_SZ];
+    word32 bit[ANTI_REPLAY_BLOOM_K];
+    word32 h1;
+    word32 h2;
+    int    seen = 0;
+    int    i;
+    int    g;
+    AntiReplayShard* shard;
+    AntiReplayGen* gen;
+    byte*  slot;
+
+    XMEMSET(k, 0, sizeof(k));
+    XMEMCPY(k, key, min(keySz, sizeof(k)));
+    ato32(k, &h1);
+    ato32(k + 4, &h2);
+    h2 |= 1;
+    for (i = 0; i < ANTI_REPLAY_BLOOM_K; i++)
+        bit[i] = (h1 + (word32)i * h2) & store->bloomMask;
+    shard = &store->shard[k[8] % WOLFSSL_ANTI_REPLAY_SHARDS];
+
+    if (wc_LockMutex(&shard->lock) != 0)
+        return 1;
+
+    AntiReplayShard_Rotate(store, shard, LowResTimer());
+    for (g = 0; g < 2 && !seen; g++) {
+        gen = &shard->gen[g];
+        seen = 1;
+        for (i = 0; i < ANTI_REPLAY_BLOOM_K; i++) {
+            if ((gen->bloom[bit[i] >> 3] & (1 << (bit[i] & 7))) == 0) {
+                seen = 0;
+                break;
+            }
+        }
+        if (seen && !gen->full)
+            seen = (AntiReplayGen_Slot(store, gen, k)[0] != 0);
+    }
+    if (!seen) {
+        gen = &shard->gen[shard->cur];
+        for (i = 0; i < ANTI_REPLAY_BLOOM_K; i++)
+            gen->bloom[bit[i] >> 3] |= (byte)(1 << (bit[i] & 7));
+        if (gen->count < store->maxCount) {
+            slot = AntiReplayGen_Slot(store, gen, k);
+            slot[0] = 1;
+            XMEMCPY(slot + 1, k, ANTI_REPLAY_KEY_SZ);
+            gen->count++;
+        }
+        else {
+            gen->full = 1;
+        }
+    }
+
+    wc_UnLockMutex(&shard->lock);
+
+    return seen;
+}
+
+/* Check whether early data of a ClientHello is a replay.
+ * The CTX's store is checked first and then the callback, if set.
+ *
+ * ssl    The SSL/TLS object.
+ * key    Binder of the first PSK in the ClientHello.
+ * keySz  Size of binder in bytes.
+ * returns 1 when early data must be rejected and 0 otherwise.
+ */
+int AntiReplayCheck(WOLFSSL* ssl, const byte* key, word32 keySz)
+{
+    WOLFSSL_CTX* ctx = ssl->ctx;
+    word32 window = WOLFSSL_ANTI_REPLAY_WINDOW;
+    int ret = 0;
+
+    if (ctx->antiReplay != NULL) {
+        ret = AntiReplayStore_Check(ctx->antiReplay, key, keySz);
+        window = ctx->antiReplay->window;
+    }
+    if (ret == 0 && ctx->antiReplayCb != NULL) {
+        ret = ctx->antiReplayCb(ssl, key, keySz, window, ctx->antiReplayCtx);
+        if (ret < 0)
+            WOLFSSL_MSG("Anti-replay callback failed");
+    }
+    if (ret != 0) {
+        WOLFSSL_MSG("Early data replayed or not checked, rejecting");
+        return 1;
+    }
+
+    return 0;
+}
+
+/* Free the CTX's anti-replay store. */
+void AntiReplayFree(WOLFSSL_CTX* ctx)
+{
+    AntiReplayStore_Free(ctx->antiReplay);
+    ctx->antiReplay = NULL;
+}
+
+/* Sets up a store of ClientHellos that early data was accepted with so that
+ * early data in a replayed ClientHello is rejected. Not to be called while
+ * connections of the CTX are handshaking.
+ *
+ * ctx         The SSL/TLS CTX object.
+ * window      Seconds to remember a ClientHello for. 0 uses the default.
+ *             Must be at least MAX_TICKET_AGE_DIFF + 2.
+ * maxEntries  Number of ClientHellos that can be remembered per window.
+ *             0 removes the store.
+ * returns BAD_FUNC_ARG when ctx is NULL, window is too short or maxEntries is
+ * too large,
+ * SIDE_ERROR when not a server, MEMORY_E when dynamic memory allocation fails
+ * and WOLFSSL_SUCCESS on success.
+ */
+int wolfSSL_CTX_set_early_data_antireplay(WOLFSSL_CTX* ctx,
+    unsigned int window, unsigned int maxEntries)
+{
+    AntiReplayStore* store = NULL;
+
+    if (ctx == NULL || !IsAtLeastTLSv1_3(ctx->method->version) ||
+            maxEntries > ANTI_REPLAY_MAX_ENTRIES) {
+        return BAD_FUNC_ARG;
+    }
+    if (ctx->method->side == WOLFSSL_CLIENT_END)
+        return SIDE_ERROR;
+
+    if (maxEntries != 0) {
+        if (window == 0)
+            window = WOLFSSL_ANTI_REPLAY_WINDOW;
+        /* A replay could be accepted once the original is forgotten. */
+        if (window < ANTI_REPLAY_MIN_WINDOW)
+            return BAD_FUNC_ARG;
+        store = AntiReplayStore_New(window, maxEntries, ctx->heap);
+        if (store == NULL)
+            return MEMORY_E;
+    }
+
+    AntiReplayFree(ctx);
+    ctx->antiReplay = store;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Sets a callback that checks for replayed early data against a store shared
+ * with other servers or processes. Called when the CTX's own store, if any,
+ * has not seen the ClientHello.
+ *
+ * ctx    The SSL/TLS CTX object.
+ * cb     Callback to check and record the binder of a ClientHello.
+ *        NULL removes the callback.
+ * cbCtx  Context passed to the callback.
+ * returns BAD_FUNC_ARG when ctx is NULL, SIDE_ERROR when not a server and
+ * WOLFSSL_SUCCESS on success.
+ */
+int wolfSSL_CTX_set_early_data_antireplay_cb(WOLFSSL_CTX* ctx,
+    CallbackAntiReplay cb, void* cbCtx)
+{
+    if (ctx == NULL || !IsAtLeastTLSv1_3(ctx->method->version))
+        return BAD_FUNC_ARG;
+    if (ctx->method->side == WOLFSSL_CLIENT_END)
+        return SIDE_ERROR;
+
+    ctx->antiReplayCb = cb;
+    ctx->antiReplayCtx = cbCtx;
+
+    return WOLFSSL_SUCCESS;
+}
+#endif /* WOLFSSL_EARLY_DATA_ANTI_REPLAY */
+
 /* Gets the maximum amount of early data that can be seen by server when using
  * session tickets for resumption.
  * A value of zero indicates no early data is to be sent by client using session
@@ -41,6 +41,15 @@
 #include <wolfssl/error-ssl.h>
 #include <wolfssl/wolfio.h>
 #include <wolfssl/wolfcrypt/logging.h>
+#ifdef WOLFSSL_KTLS
+    /* ForceZero() of kernel key material */
+    #ifdef NO_INLINE
+        #include <wolfssl/wolfcrypt/misc.h>
+    #else
+        #define WOLFSSL_MISC_INCLUDED
+        #include <wolfcrypt/src/misc.c>
+    #endif
+#endif
 
 #ifdef NUCLEUS_PLUS_2_3
 /* Holds last Nucleus networking error number */
@@ -107,6 +116,25 @@ int Nucleus_Net_Errno;
     #include <stdlib.h>   /* strtol() */
 #endif
 
+#if defined(WOLFSSL_KTLS) && defined(USE_WOLFSSL_IO)
+    #include <netinet/tcp.h>
+    #include <sys/sendfile.h>
+    #include <linux/tls.h>
+    #ifndef SOL_TLS
+        #define SOL_TLS 282
+    #endif
+    #ifndef TCP_ULP
+        #define TCP_ULP 31
+    #endif
+#endif
+
+#if defined(WOLFSSL_IO_URING) && defined(USE_WOLFSSL_IO)
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+#endif
+
 /*
 Possible IO enable options:
  * WOLFSSL_USER_IO:     Disables default Embed* callbacks and     default: off
@@ -116,6 +144,9 @@ Possible IO enable options:
  * HAVE_HTTP_CLIENT:    Enables HTTP client API's                 default: off
                                      (unless HAVE_OCSP or HAVE_CRL_IO defined)
  * HAVE_IO_TIMEOUT:     Enables support for connect timeout       default: off
+ * WOLFSSL_KTLS:        Enables Linux kernel TLS offload          default: off
+ * WOLFSSL_IO_URING:    Enables Linux io_uring I/O for many       default: off
+                        connections (wolfSSL_IoUring_*)
  *
  * DTLS_RECEIVEFROM_NO_TIMEOUT_ON_INVALID_PEER: This flag has effect only if
  * ASN_NO_TIME is enabled. If enabled invalid peers messages are ignored
@@ -1221,6 +1252,1256 @@ int wolfIO_SendTo(SOCKET_T sd, WOLFSSL_BIO_ADDR *addr, char *buf, int sz, int wr
 
 #endif /* WOLFSSL_HAVE_BIO_ADDR && WOLFSSL_DTLS && OPENSSL_EXTRA */
 
+#ifdef WOLFSSL_KTLS
+
+/* Attach the kernel TLS upper layer protocol to a connected TCP socket.
+ *
+ * @param [in] sd  Socket.
+ * @return  0 on success.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel does not support kTLS.
+ */
+int wolfIO_KtlsAttach(SOCKET_T sd)
+{
+    if (setsockopt(sd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+        WOLFSSL_MSG_EX("\tkTLS not available: %d", errno);
+        return WOLFSSL_FATAL_ERROR;
+    }
+    return 0;
+}
+
+/* Result of probing kernel for TLS 1.3 rekey: 0 when not probed yet, 1 when
+ * supported and -1 when not. */
+static int ktlsRekey = 0;
+
+/* Set TLS 1.3 keys in both directions of a socket and then set them again.
+ *
+ * Kernels that can't rekey fail the second setsockopt() with EBUSY or EINVAL.
+ * Keys are all zero - no data is sent.
+ *
+ * @param [in] sd  Connected TCP socket.
+ * @return  1 when the kernel took the keys a second time.
+ * @return  0 otherwise.
+ */
+static int KtlsRekeyProbeSocket(SOCKET_T sd)
+{
+    byte key[TLS_CIPHER_AES_GCM_128_KEY_SIZE];
+    byte iv[TLS_CIPHER_AES_GCM_128_SALT_SIZE + TLS_CIPHER_AES_GCM_128_IV_SIZE];
+    byte seq[TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE];
+    int i;
+    int rx;
+
+    XMEMSET(key, 0, sizeof(key));
+    XMEMSET(iv, 0, sizeof(iv));
+    XMEMSET(seq, 0, sizeof(seq));
+
+    if (wolfIO_KtlsAttach(sd) != 0)
+        return 0;
+    for (i = 0; i < 2; i++) {
+        for (rx = 0; rx < 2; rx++) {
+            if (wolfIO_KtlsSetKey(sd, rx, 1, wolfssl_aes_gcm, key,
+                    (word16)sizeof(key), iv, seq) != 0) {
+                if (i == 1 && (errno == EBUSY || errno == EINVAL))
+                    WOLFSSL_MSG("\tkTLS can't rekey");
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+/* Probe whether the kernel accepts new keys on a socket with kTLS attached.
+ *
+ * TLS 1.3 KeyUpdate needs the kernel to take the next traffic keys. Keys are
+ * set twice on a connection over loopback made for the probe, rather than on
+ * the connection being offloaded, as kTLS can't be removed from a socket.
+ *
+ * @return  1 when the kernel can rekey.
+ * @return  0 otherwise.
+ */
+static int KtlsRekeyProbe(void)
+{
+    SOCKADDR_IN addr;
+    XSOCKLENT len = (XSOCKLENT)sizeof(addr);
+    SOCKET_T lsd;
+    SOCKET_T sd = SOCKET_INVALID;
+    int ret = 0;
+
+    XMEMSET(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    lsd = socket(AF_INET, SOCK_STREAM, 0);
+    if (lsd == SOCKET_INVALID)
+        return 0;
+    /* Connection completes in the listen backlog - no accept needed. */
+    if (bind(lsd, (SOCKADDR*)&addr, len) == 0 && listen(lsd, 1) == 0 &&
+            getsockname(lsd, (SOCKADDR*)&addr, &len) == 0) {
+        sd = socket(AF_INET, SOCK_STREAM, 0);
+    }
+    if (sd != SOCKET_INVALID) {
+        if (connect(sd, (SOCKADDR*)&addr, len) == 0)
+            ret = KtlsRekeyProbeSocket(sd);
+        CloseSocket(sd);
+    }
+    CloseSocket(lsd);
+
+    return ret;
+}
+
+/* Check whether the kernel accepts new keys on a socket with kTLS attached.
+ *
+ * The kernel is probed on first use and the result kept.
+ *
+ * @return  1 when the kernel can rekey.
+ * @return  0 otherwise.
+ */
+int wolfIO_KtlsRekeySupported(void)
+{
+    int supported = __atomic_load_n(&ktlsRekey, __ATOMIC_RELAXED);
+
+    if (supported == 0) {
+        supported = KtlsRekeyProbe() ? 1 : -1;
+        __atomic_store_n(&ktlsRekey, supported, __ATOMIC_RELAXED);
+    }
+
+    return supported == 1;
+}
+
+/* Install traffic keys for one direction of a socket with kTLS attached.
+ *
+ * @param [in] sd       Socket.
+ * @param [in] rx       1 to set the receive keys, 0 for the send keys.
+ * @param [in] tls13    1 when the connection is TLS 1.3.
+ * @param [in] bulkAlg  Bulk cipher algorithm of the cipher suite.
+ * @param [in] key      Traffic key.
+ * @param [in] keySz    Size of key in bytes.
+ * @param [in] iv       Write IV - implicit 4 bytes for TLS 1.2 AES-GCM,
+ *                      otherwise 12 bytes.
+ * @param [in] seq      Big-endian record sequence number of next record.
+ * @return  0 on success.
+ * @return  NOT_COMPILED_IN when the cipher can not be offloaded.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel rejects the keys.
+ */
+int wolfIO_KtlsSetKey(SOCKET_T sd, int rx, int tls13, byte bulkAlg,
+    const byte* key, word16 keySz, const byte* iv, const byte* seq)
+{
+    union {
+        struct tls_crypto_info base;
+        struct tls12_crypto_info_aes_gcm_128 gcm128;
+        struct tls12_crypto_info_aes_gcm_256 gcm256;
+        struct tls12_crypto_info_chacha20_poly1305 chacha;
+    } info;
+    socklen_t infoSz;
+    int ret = 0;
+
+    XMEMSET(&info, 0, sizeof(info));
+    info.base.version = tls13 ? TLS_1_3_VERSION : TLS_1_2_VERSION;
+
+    if (bulkAlg == wolfssl_aes_gcm && keySz == 16) {
+        info.base.cipher_type = TLS_CIPHER_AES_GCM_128;
+        XMEMCPY(info.gcm128.key, key, keySz);
+        XMEMCPY(info.gcm128.salt, iv, TLS_CIPHER_AES_GCM_128_SALT_SIZE);
+        XMEMCPY(info.gcm128.iv, tls13 ? iv + TLS_CIPHER_AES_GCM_128_SALT_SIZE :
+            seq, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+        XMEMCPY(info.gcm128.rec_seq, seq, TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE);
+        infoSz = (socklen_t)sizeof(info.gcm128);
+    }
+    else if (bulkAlg == wolfssl_aes_gcm && keySz == 32) {
+        info.base.cipher_type = TLS_CIPHER_AES_GCM_256;
+        XMEMCPY(info.gcm256.key, key, keySz);
+        XMEMCPY(info.gcm256.salt, iv, TLS_CIPHER_AES_GCM_256_SALT_SIZE);
+        XMEMCPY(info.gcm256.iv, tls13 ? iv + TLS_CIPHER_AES_GCM_256_SALT_SIZE :
+            seq, TLS_CIPHER_AES_GCM_256_IV_SIZE);
+        XMEMCPY(info.gcm256.rec_seq, seq, TLS_CIPHER_AES_GCM_256_REC_SEQ_SIZE);
+        infoSz = (socklen_t)sizeof(info.gcm256);
+    }
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    else if (bulkAlg == wolfssl_chacha &&
+             keySz == TLS_CIPHER_CHACHA20_POLY1305_KEY_SIZE) {
+        info.base.cipher_type = TLS_CIPHER_CHACHA20_POLY1305;
+        XMEMCPY(info.chacha.key, key, keySz);
+        XMEMCPY(info.chacha.iv, iv, TLS_CIPHER_CHACHA20_POLY1305_IV_SIZE);
+        XMEMCPY(info.chacha.rec_seq, seq,
+            TLS_CIPHER_CHACHA20_POLY1305_REC_SEQ_SIZE);
+        infoSz = (socklen_t)sizeof(info.chacha);
+    }
+#endif
+    else {
+        WOLFSSL_MSG("\tCipher not supported by kTLS");
+        ret = NOT_COMPILED_IN;
+    }
+
+    if (ret == 0 && setsockopt(sd, SOL_TLS, rx ? TLS_RX : TLS_TX, &info,
+            infoSz) != 0) {
+        WOLFSSL_MSG_EX("\tkTLS key install failed: %d", errno);
+        ret = WOLFSSL_FATAL_ERROR;
+    }
+
+    ForceZero(&info, sizeof(info));
+    return ret;
+}
+
+/* Send plaintext as the content of records of the given type over a kTLS
+ * socket.
+ *
+ * @param [in] sd       Socket.
+ * @param [in] type     Record content type.
+ * @param [in] buf      Data to send.
+ * @param [in] sz       Size of data in bytes.
+ * @param [in] wrFlags  Flags to pass to sendmsg().
+ * @param [in] more     1 when more data of this record type follows.
+ * @return  Number of bytes sent on success.
+ * @return  WOLFSSL_CBIO_ERR_* on failure.
+ */
+int wolfIO_KtlsSend(SOCKET_T sd, byte type, const byte* buf, int sz,
+    int wrFlags, int more)
+{
+    struct msghdr msg;
+    struct iovec iov;
+    union {
+        struct cmsghdr hdr;
+        byte buf[CMSG_SPACE(sizeof(byte))];
+    } cmsg;
+    int sent;
+
+    XMEMSET(&msg, 0, sizeof(msg));
+    iov.iov_base = (void*)buf;
+    iov.iov_len = (size_t)sz;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    if (type != application_data) {
+        /* kernel frames records as application data unless told */
+        XMEMSET(&cmsg, 0, sizeof(cmsg));
+        msg.msg_control = cmsg.buf;
+        msg.msg_controllen = sizeof(cmsg.buf);
+        cmsg.hdr.cmsg_level = SOL_TLS;
+        cmsg.hdr.cmsg_type = TLS_SET_RECORD_TYPE;
+        cmsg.hdr.cmsg_len = CMSG_LEN(sizeof(byte));
+        *CMSG_DATA(&cmsg.hdr) = type;
+    }
+    if (more)
+        wrFlags |= MSG_MORE;
+
+    sent = (int)sendmsg(sd, &msg, wrFlags);
+    sent = TranslateIoReturnCode(sent, sd, SOCKET_SENDING);
+
+    return sent;
+}
+
+/* Receive the decrypted content of one record from a kTLS socket.
+ *
+ * @param [in]  sd       Socket.
+ * @param [out] type     Record content type.
+ * @param [out] buf      Buffer to hold content.
+ * @param [in]  sz       Size of buffer in bytes - at least a full record.
+ * @param [in]  rdFlags  Flags to pass to recvmsg().
+ * @return  Number of bytes received on success.
+ * @return  0 when the peer closed the connection.
+ * @return  WOLFSSL_CBIO_ERR_* on failure.
+ */
+int wolfIO_KtlsRecv(SOCKET_T sd, byte* type, byte* buf, int sz, int rdFlags)
+{
+    struct msghdr msg;
+    struct iovec iov;
+    struct cmsghdr* hdr;
+    union {
+        struct cmsghdr hdr;
+        byte buf[CMSG_SPACE(sizeof(byte))];
+    } cmsg;
+    int recvd;
+
+    XMEMSET(&msg, 0, sizeof(msg));
+    XMEMSET(&cmsg, 0, sizeof(cmsg));
+    iov.iov_base = buf;
+    iov.iov_len = (size_t)sz;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cmsg.buf;
+    msg.msg_controllen = sizeof(cmsg.buf);
+
+    recvd = (int)recvmsg(sd, &msg, rdFlags);
+    recvd = TranslateIoReturnCode(recvd, sd, SOCKET_RECEIVING);
+    if (recvd > 0) {
+        *type = application_data;
+        hdr = CMSG_FIRSTHDR(&msg);
+        if (hdr != NULL && hdr->cmsg_level == SOL_TLS &&
+                hdr->cmsg_type == TLS_GET_RECORD_TYPE) {
+            *type = *CMSG_DATA(hdr);
+        }
+    }
+
+    return recvd;
+}
+
+/* Send part of a file over a socket with kTLS send offload.
+ *
+ * @param [in]      sd      Socket.
+ * @param [in]      fd      Descriptor of file to send.
+ * @param [in, out] offset  Offset into file. Advanced past data sent.
+ * @param [in]      count   Number of bytes to send.
+ * @return  Number of bytes sent on success.
+ * @return  WOLFSSL_CBIO_ERR_* on failure.
+ */
+int wolfIO_KtlsSendfile(SOCKET_T sd, int fd, off_t* offset, size_t count)
+{
+    int sent;
+
+    /* largest single transfer Linux performs */
+    if (count > 0x7FFFF000)
+        count = 0x7FFFF000;
+    sent = (int)sendfile(sd, fd, offset, count);
+    sent = TranslateIoReturnCode(sent, sd, SOCKET_SENDING);
+
+    return sent;
+}
+
+#endif /* WOLFSSL_KTLS */
+
+#ifdef WOLFSSL_IO_URING
+
+#ifndef WOLFSSL_IO_URING_BUF_SZ
+    /* default size of each connection's receive and send buffers */
+    #define WOLFSSL_IO_URING_BUF_SZ     16384
+#endif
+#ifndef WOLFSSL_IO_URING_SQ_ENTRIES
+    /* most submission queue entries - more are submitted as the queue fills */
+    #define WOLFSSL_IO_URING_SQ_ENTRIES 4096
+#endif
+/* most connections served by one ring */
+#define WOLFSSL_IO_URING_MAX_CONNS      (1U << 20)
+/* most buffers and largest buffer the kernel will register */
+#define WOLFSSL_IO_URING_MAX_REG        1024
+#define WOLFSSL_IO_URING_MAX_REG_SZ     (1UL << 30)
+
+/* Operation in low bits of user_data, connection slot in the rest. */
+#define IO_URING_OP_RECV                0
+#define IO_URING_OP_SEND                1
+#define IO_URING_OP_CANCEL              2
+#define IO_URING_OP_MASK                3
+#define IO_URING_OP_BITS                2
+/* milliseconds to wait for completions before cancelling again when freeing */
+#define IO_URING_DRAIN_MS               100
+
+/* State of one connection attached to a ring. */
+typedef struct IoUringConn {
+    WOLFSSL*          ssl;    /* NULL when detached */
+    WOLFSSL_URING* ring;
+    SOCKET_T          sd;
+    byte*             rxBuf;
+    byte*             txBuf;
+    word32            rxLen;  /* bytes received into rxBuf */
+    word32            rxOff;  /* bytes of rxBuf handed to wolfSSL */
+    word32            txLen;  /* bytes in txBuf */
+    word32            txOff;  /* bytes of txBuf sent */
+    int               rxErr;  /* receive error, kept once seen */
+    int               txErr;  /* send error, kept once seen */
+    CallbackIORecv    ioRecv; /* I/O of ssl before it was attached */
+    CallbackIOSend    ioSend;
+    void*             ioReadCtx;
+    void*             ioWriteCtx;
+    word16            bufIdx; /* index of registered buffer holding rxBuf */
+    byte              rxBusy; /* receive submitted and not complete */
+    byte              txBusy; /* send submitted and not complete */
+    byte              ready;  /* on ready list */
+} IoUringConn;
+
+struct WOLFSSL_URING {
+    void*                heap;
+    int                  fd;
+    /* submission queue */
+    void*                sqRing;
+    size_t               sqRingSz;
+    struct io_uring_sqe* sqes;
+    size_t               sqesSz;
+    unsigned*            sqHead;
+    unsigned*            sqTail;
+    unsigned*            sqFlags;
+    unsigned             sqMask;
+    unsigned             sqEntries;
+    unsigned             sqLocalTail;
+    /* completion queue */
+    void*                cqRing;
+    size_t               cqRingSz;
+    struct io_uring_cqe* cqes;
+    unsigned*            cqHead;
+    unsigned*            cqTail;
+    unsigned             cqMask;
+    /* connection slots and their buffers */
+    IoUringConn*         conns;
+    word32*              freeList;
+    word32*              readyList;
+    byte*                bufs;
+    word32               maxConns;
+    word32               bufSz;
+    word32               freeCnt;
+    word32               readyHead;
+    word32               readyCnt;
+    word32               slotsPerReg;
+    byte                 fixed;   /* buffers registered with kernel */
+};
+
+/* Map a negated errno of a completion to an I/O callback error. */
+static int IoUringError(int res)
+{
+    if (res == -ECONNRESET) {
+        WOLFSSL_MSG("\tConnection reset");
+        return WOLFSSL_CBIO_ERR_CONN_RST;
+    }
+    if ((res == -EPIPE) || (res == -ECONNABORTED)) {
+        WOLFSSL_MSG("\tConnection closed");
+        return WOLFSSL_CBIO_ERR_CONN_CLOSE;
+    }
+    WOLFSSL_MSG_EX("\tGeneral error: %d", -res);
+    return WOLFSSL_CBIO_ERR_GENERAL;
+}
+
+/* Submit queued entries and optionally wait for a completion.
+ *
+ * @param [in] ring       io_uring.
+ * @param [in] wait       1 to wait for at least one completion.
+ * @param [in] timeoutMs  Most milliseconds to wait. Negative waits forever.
+ * @return  0 on success.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel fails the call.
+ */
+static int IoUringEnter(WOLFSSL_URING* ring, int wait, int timeoutMs)
+{
+    struct io_uring_getevents_arg arg;
+    struct __kernel_timespec ts;
+    unsigned toSubmit;
+    unsigned flags = IORING_ENTER_EXT_ARG;
+    long ret;
+
+    XMEMSET(&arg, 0, sizeof(arg));
+    if (wait) {
+        flags |= IORING_ENTER_GETEVENTS;
+        if (timeoutMs >= 0) {
+            ts.tv_sec = timeoutMs / 1000;
+            ts.tv_nsec = (long long)(timeoutMs % 1000) * 1000000;
+            arg.ts = (__u64)(wc_ptr_t)&ts;
+        }
+    }
+    /* Kernel consumes entries from the head as it takes them. */
+    toSubmit = ring->sqLocalTail -
+        __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    /* Completions held back by the kernel are moved into the queue when
+     * getting events. */
+    if (__atomic_load_n(ring->sqFlags, __ATOMIC_RELAXED) &
+            IORING_SQ_CQ_OVERFLOW) {
+        flags |= IORING_ENTER_GETEVENTS;
+    }
+    else if ((toSubmit == 0) && !wait) {
+        return 0;
+    }
+
+    do {
+        ret = syscall(__NR_io_uring_enter, ring->fd, toSubmit, wait ? 1 : 0,
+            flags, &arg, sizeof(arg));
+    } while ((ret < 0) && (errno == EINTR));
+    if ((ret < 0) && (errno != ETIME) && (errno != EBUSY) &&
+            (errno != EAGAIN)) {
+        WOLFSSL_MSG_EX("io_uring_enter failed: %d", errno);
+        return WOLFSSL_FATAL_ERROR;
+    }
+    return 0;
+}
+
+/* Get a cleared submission queue entry, submitting when the queue is full.
+ *
+ * @param [in] ring  io_uring.
+ * @return  Submission queue entry on success.
+ * @return  NULL when the queue stays full.
+ */
+static struct io_uring_sqe* IoUringGetSqe(WOLFSSL_URING* ring)
+{
+    struct io_uring_sqe* sqe;
+
+    if (ring->sqLocalTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) >=
+            ring->sqEntries) {
+        if ((IoUringEnter(ring, 0, 0) != 0) ||
+                (ring->sqLocalTail - __atomic_load_n(ring->sqHead,
+                    __ATOMIC_ACQUIRE) >= ring->sqEntries)) {
+            WOLFSSL_MSG("io_uring submission queue full");
+            return NULL;
+        }
+    }
+    sqe = &ring->sqes[ring->sqLocalTail & ring->sqMask];
+    XMEMSET(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+/* Make the last entry from IoUringGetSqe() visible to the kernel. */
+static void IoUringQueueSqe(WOLFSSL_URING* ring)
+{
+    ring->sqLocalTail++;
+    __atomic_store_n(ring->sqTail, ring->sqLocalTail, __ATOMIC_RELEASE);
+}
+
+/* Slot index of a connection. */
+static word32 IoUringSlot(const IoUringConn* c)
+{
+    return (word32)(c - c->ring->conns);
+}
+
+/* Queue a receive into the empty receive buffer of a connection.
+ *
+ * @param [in] c  Connection.
+ * @return  0 on success.
+ * @return  WOLFSSL_CBIO_ERR_GENERAL when no entry is available.
+ */
+static int IoUringQueueRecv(IoUringConn* c)
+{
+    WOLFSSL_URING* ring = c->ring;
+    struct io_uring_sqe* sqe = IoUringGetSqe(ring);
+
+    if (sqe == NULL)
+        return WOLFSSL_CBIO_ERR_GENERAL;
+
+    sqe->fd = c->sd;
+    sqe->addr = (__u64)(wc_ptr_t)c->rxBuf;
+    sqe->len = ring->bufSz;
+    if (ring->fixed) {
+        sqe->opcode = IORING_OP_READ_FIXED;
+        sqe->buf_index = c->bufIdx;
+    }
+    else {
+        sqe->opcode = IORING_OP_RECV;
+    }
+    sqe->user_data = ((__u64)IoUringSlot(c) << IO_URING_OP_BITS) |
+        IO_URING_OP_RECV;
+    IoUringQueueSqe(ring);
+    c->rxLen = c->rxOff = 0;
+    c->rxBusy = 1;
+    return 0;
+}
+
+/* Queue a send of the unsent data in the send buffer of a connection.
+ *
+ * Sent with send() and MSG_NOSIGNAL, rather than as a write to the registered
+ * buffer, so that a peer closing does not raise SIGPIPE.
+ *
+ * @param [in] c  Connection.
+ * @return  0 on success.
+ * @return  WOLFSSL_CBIO_ERR_GENERAL when no entry is available.
+ */
+static int IoUringQueueSend(IoUringConn* c)
+{
+    WOLFSSL_URING* ring = c->ring;
+    struct io_uring_sqe* sqe = IoUringGetSqe(ring);
+
+    if (sqe == NULL)
+        return WOLFSSL_CBIO_ERR_GENERAL;
+
+    if (c->txOff > 0) {
+        XMEMMOVE(c->txBuf, c->txBuf + c->txOff, c->txLen - c->txOff);
+        c->txLen -= c->txOff;
+        c->txOff = 0;
+    }
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = c->sd;
+    sqe->addr = (__u64)(wc_ptr_t)c->txBuf;
+    sqe->len = c->txLen;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = ((__u64)IoUringSlot(c) << IO_URING_OP_BITS) |
+        IO_URING_OP_SEND;
+    IoUringQueueSqe(ring);
+    c->txBusy = 1;
+    return 0;
+}
+
+/* Put a detached connection with nothing in flight back on the free list. */
+static void IoUringRelease(IoUringConn* c)
+{
+    if ((c->ssl == NULL) && !c->rxBusy && !c->txBusy)
+        c->ring->freeList[c->ring->freeCnt++] = IoUringSlot(c);
+}
+
+/* Update a connection with a completion and mark it ready.
+ *
+ * @param [in] ring  io_uring.
+ * @param [in] data  user_data of the completed entry.
+ * @param [in] res   Result of the operation.
+ */
+static void IoUringComplete(WOLFSSL_URING* ring, __u64 data, int res)
+{
+    word32 slot = (word32)(data >> IO_URING_OP_BITS);
+    IoUringConn* c;
+
+    if (((data & IO_URING_OP_MASK) == IO_URING_OP_CANCEL) ||
+            (slot >= ring->maxConns)) {
+        return;
+    }
+    c = &ring->conns[slot];
+
+    if ((data & IO_URING_OP_MASK) == IO_URING_OP_RECV) {
+        c->rxBusy = 0;
+        if (res > 0)
+            c->rxLen = (word32)res;
+        else if (res == 0)
+            c->rxErr = WOLFSSL_CBIO_ERR_CONN_CLOSE;
+        else if ((res != -EAGAIN) && (res != -EINTR) && (res != -ECANCELED))
+            c->rxErr = IoUringError(res);
+    }
+    else {
+        c->txBusy = 0;
+        if (res > 0)
+            c->txOff += (word32)res;
+        else if ((res < 0) && (res != -EAGAIN) && (res != -EINTR))
+            c->txErr = IoUringError(res);
+
+        if (c->txOff == c->txLen) {
+            c->txLen = c->txOff = 0;
+        }
+        else if ((c->ssl != NULL) && (c->txErr == 0) &&
+                 (IoUringQueueSend(c) != 0)) {
+            c->txErr = WOLFSSL_CBIO_ERR_GENERAL;
+        }
+    }
+
+    if (c->ssl == NULL) {
+        IoUringRelease(c);
+    }
+    else if (!c->ready) {
+        c->ready = 1;
+        ring->readyList[(ring->readyHead + ring->readyCnt) % ring->maxConns] =
+            slot;
+        ring->readyCnt++;
+    }
+}
+
+/* Process all completions, moving any the kernel held back into the queue.
+ *
+ * @param [in] ring  io_uring.
+ * @return  0 on success.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel fails the call.
+ */
+static int IoUringReap(WOLFSSL_URING* ring)
+{
+    int ret = 0;
+
+    do {
+        unsigned head = *ring->cqHead;
+        unsigned tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+
+        while (head != tail) {
+            struct io_uring_cqe* cqe = &ring->cqes[head & ring->cqMask];
+            IoUringComplete(ring, cqe->user_data, cqe->res);
+            head++;
+        }
+        __atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+
+        if (!(__atomic_load_n(ring->sqFlags, __ATOMIC_RELAXED) &
+                IORING_SQ_CQ_OVERFLOW)) {
+            break;
+        }
+        ret = IoUringEnter(ring, 0, 0);
+    } while (ret == 0);
+
+    return ret;
+}
+
+/* The io_uring receive callback.
+ *
+ * Hands over data already received. Otherwise queues a receive into the
+ * connection's buffer and asks wolfSSL to try again once it completes.
+ *
+ * @param [in]  ssl  SSL/TLS object.
+ * @param [out] buf  Buffer to fill.
+ * @param [in]  sz   Size of buf in bytes.
+ * @param [in]  ctx  Connection of ssl.
+ * @return  Number of bytes placed in buf.
+ * @return  WOLFSSL_CBIO_ERR_WANT_READ when waiting on the ring.
+ * @return  Other WOLFSSL_CBIO_ERR_* on error.
+ */
+static int IoUringReceive(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    IoUringConn* c = (IoUringConn*)ctx;
+
+    (void)ssl;
+
+    if (c->rxOff < c->rxLen) {
+        word32 n = c->rxLen - c->rxOff;
+
+        if (n > (word32)sz)
+            n = (word32)sz;
+        XMEMCPY(buf, c->rxBuf + c->rxOff, n);
+        c->rxOff += n;
+        return (int)n;
+    }
+    if (c->rxErr != 0)
+        return c->rxErr;
+    if (!c->rxBusy && (IoUringQueueRecv(c) != 0))
+        return WOLFSSL_CBIO_ERR_GENERAL;
+
+    return WOLFSSL_CBIO_ERR_WANT_READ;
+}
+
+/* The io_uring send callback.
+ *
+ * Copies as much data as fits into the connection's send buffer and queues a
+ * send when none is in flight.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ * @param [in] buf  Data to send.
+ * @param [in] sz   Size of data in bytes.
+ * @param [in] ctx  Connection of ssl.
+ * @return  Number of bytes taken.
+ * @return  WOLFSSL_CBIO_ERR_WANT_WRITE when the send buffer is full.
+ * @return  Other WOLFSSL_CBIO_ERR_* on error.
+ */
+static int IoUringSend(WOLFSSL* ssl, char* buf, int sz, void* ctx)
+{
+    IoUringConn* c = (IoUringConn*)ctx;
+    word32 n;
+
+    (void)ssl;
+
+    if (c->txErr != 0)
+        return c->txErr;
+    n = c->ring->bufSz - c->txLen;
+    if (n == 0)
+        return WOLFSSL_CBIO_ERR_WANT_WRITE;
+    if (n > (word32)sz)
+        n = (word32)sz;
+    XMEMCPY(c->txBuf + c->txLen, buf, n);
+    c->txLen += n;
+    if (!c->txBusy && (IoUringQueueSend(c) != 0)) {
+        c->txLen -= n;
+        return WOLFSSL_CBIO_ERR_GENERAL;
+    }
+
+    return (int)n;
+}
+
+/* Register the connection buffers with the kernel.
+ *
+ * Receives then read straight into pinned pages with no per-operation
+ * mapping. Failure is not fatal: plain receives are used instead.
+ *
+ * @param [in] ring  io_uring.
+ */
+static void IoUringRegister(WOLFSSL_URING* ring)
+{
+    struct iovec* iov;
+    size_t slotSz = (size_t)ring->bufSz * 2;
+    word32 cnt;
+    word32 i;
+
+    ring->slotsPerReg = (ring->maxConns + WOLFSSL_IO_URING_MAX_REG - 1) /
+        WOLFSSL_IO_URING_MAX_REG;
+    if (slotSz * ring->slotsPerReg > WOLFSSL_IO_URING_MAX_REG_SZ)
+        return;
+    cnt = (ring->maxConns + ring->slotsPerReg - 1) / ring->slotsPerReg;
+
+    iov = (struct iovec*)XMALLOC(sizeof(struct iovec) * cnt, ring->heap,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (iov == NULL)
+        return;
+    for (i = 0; i < cnt; i++) {
+        word32 slots = ring->maxConns - i * ring->slotsPerReg;
+
+        if (slots > ring->slotsPerReg)
+            slots = ring->slotsPerReg;
+        iov[i].iov_base = ring->bufs + slotSz * i * ring->slotsPerReg;
+        iov[i].iov_len = slotSz * slots;
+    }
+    if (syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_BUFFERS,
+            iov, cnt) == 0) {
+        ring->fixed = 1;
+    }
+    else {
+        WOLFSSL_MSG_EX("io_uring buffers not registered: %d", errno);
+    }
+    XFREE(iov, ring->heap, DYNAMIC_TYPE_TMP_BUFFER);
+}
+
+/* Map the rings shared with the kernel.
+ *
+ * @param [in] ring  io_uring.
+ * @param [in] p     Parameters returned by io_uring_setup.
+ * @return  0 on success.
+ * @return  WOLFSSL_FATAL_ERROR when mapping fails.
+ */
+static int IoUringMap(WOLFSSL_URING* ring, struct io_uring_params* p)
+{
+    byte* sq;
+    byte* cq;
+
+    ring->sqRingSz = p->sq_off.array + p->sq_entries * sizeof(unsigned);
+    ring->cqRingSz = p->cq_off.cqes +
+        p->cq_entries * sizeof(struct io_uring_cqe);
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cqRingSz > ring->sqRingSz)
+            ring->sqRingSz = ring->cqRingSz;
+        ring->cqRingSz = 0;
+    }
+
+    ring->sqRing = mmap(NULL, ring->sqRingSz, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED) {
+        ring->sqRing = NULL;
+        return WOLFSSL_FATAL_ERROR;
+    }
+    if (ring->cqRingSz == 0) {
+        ring->cqRing = ring->sqRing;
+    }
+    else {
+        ring->cqRing = mmap(NULL, ring->cqRingSz, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cqRing == MAP_FAILED) {
+            ring->cqRing = NULL;
+            return WOLFSSL_FATAL_ERROR;
+        }
+    }
+    ring->sqesSz = p->sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqesSz,
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+        IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        return WOLFSSL_FATAL_ERROR;
+    }
+
+    sq = (byte*)ring->sqRing;
+    cq = (byte*)ring->cqRing;
+    ring->sqHead = (unsigned*)(sq + p->sq_off.head);
+    ring->sqTail = (unsigned*)(sq + p->sq_off.tail);
+    ring->sqFlags = (unsigned*)(sq + p->sq_off.flags);
+    ring->sqMask = *(unsigned*)(sq + p->sq_off.ring_mask);
+    ring->sqEntries = *(unsigned*)(sq + p->sq_off.ring_entries);
+    ring->sqLocalTail = *ring->sqTail;
+    ring->cqHead = (unsigned*)(cq + p->cq_off.head);
+    ring->cqTail = (unsigned*)(cq + p->cq_off.tail);
+    ring->cqMask = *(unsigned*)(cq + p->cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(cq + p->cq_off.cqes);
+    /* Entry i of the queue is always slot i of the entry array. */
+    {
+        unsigned* array = (unsigned*)(sq + p->sq_off.array);
+        unsigned i;
+
+        for (i = 0; i < ring->sqEntries; i++)
+            array[i] = i;
+    }
+
+    return 0;
+}
+
+/* Create an io_uring to serve the I/O of many SSL/TLS connections.
+ *
+ * Each connection gets a receive and a send buffer of bufSz bytes, carved out
+ * of one allocation that is registered with the kernel where allowed.
+ * Requires Linux 5.11 or later.
+ *
+ * @param [in] heap      Heap hint for allocations.
+ * @param [in] maxConns  Most connections attached at once.
+ * @param [in] bufSz     Size of each buffer. 0 for the default.
+ * @return  io_uring object on success.
+ * @return  NULL on bad arguments, out of memory or when the kernel has no
+ *          usable io_uring.
+ */
+WOLFSSL_URING* wolfSSL_IoUring_new(void* heap, unsigned int maxConns,
+    unsigned int bufSz)
+{
+    WOLFSSL_URING* ring;
+    struct io_uring_params p;
+    unsigned entries;
+    word32 i;
+    int ret = 0;
+
+    WOLFSSL_ENTER("wolfSSL_IoUring_new");
+
+    if (bufSz == 0)
+        bufSz = WOLFSSL_IO_URING_BUF_SZ;
+    if ((maxConns == 0) || (maxConns > WOLFSSL_IO_URING_MAX_CONNS) ||
+            (bufSz > WOLFSSL_IO_URING_MAX_REG_SZ / 2)) {
+        return NULL;
+    }
+
+    ring = (WOLFSSL_URING*)XMALLOC(sizeof(WOLFSSL_URING), heap,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (ring == NULL)
+        return NULL;
+    XMEMSET(ring, 0, sizeof(*ring));
+    ring->heap = heap;
+    ring->fd = -1;
+    ring->maxConns = maxConns;
+    ring->bufSz = bufSz;
+
+    ring->conns = (IoUringConn*)XMALLOC(sizeof(IoUringConn) * maxConns, heap,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    ring->freeList = (word32*)XMALLOC(sizeof(word32) * maxConns, heap,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    ring->readyList = (word32*)XMALLOC(sizeof(word32) * maxConns, heap,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    ring->bufs = (byte*)XMALLOC((size_t)bufSz * 2 * maxConns, heap,
+        DYNAMIC_TYPE_IN_BUFFER);
+    if ((ring->conns == NULL) || (ring->freeList == NULL) ||
+            (ring->readyList == NULL) || (ring->bufs == NULL)) {
+        ret = MEMORY_E;
+    }
+    if (ring->conns != NULL)
+        XMEMSET(ring->conns, 0, sizeof(IoUringConn) * maxConns);
+
+    if (ret == 0) {
+        /* A connection has at most a receive, a send and a cancel queued. */
+        entries = maxConns * 3;
+        if (entries > WOLFSSL_IO_URING_SQ_ENTRIES)
+            entries = WOLFSSL_IO_URING_SQ_ENTRIES;
+        XMEMSET(&p, 0, sizeof(p));
+        p.flags = IORING_SETUP_CQSIZE | IORING_SETUP_CLAMP;
+        p.cq_entries = maxConns * 3;
+        ring->fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+        if (ring->fd < 0) {
+            WOLFSSL_MSG_EX("io_uring_setup failed: %d", errno);
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+        else if ((p.features & (IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG)) !=
+                 (IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG)) {
+            WOLFSSL_MSG("io_uring of kernel too old");
+            ret = WOLFSSL_FATAL_ERROR;
+        }
+    }
+    if (ret == 0)
+        ret = IoUringMap(ring, &p);
+
+    if (ret == 0) {
+        IoUringRegister(ring);
+        for (i = 0; i < maxConns; i++) {
+            IoUringConn* c = &ring->conns[i];
+
+            c->ring = ring;
+            c->rxBuf = ring->bufs + (size_t)bufSz * 2 * i;
+            c->txBuf = c->rxBuf + bufSz;
+            if (ring->fixed)
+                c->bufIdx = (word16)(i / ring->slotsPerReg);
+            /* Hand out the lowest slots first. */
+            ring->freeList[i] = maxConns - 1 - i;
+        }
+        ring->freeCnt = maxConns;
+    }
+
+    if (ret != 0) {
+        wolfSSL_IoUring_free(ring);
+        ring = NULL;
+    }
+
+    WOLFSSL_LEAVE("wolfSSL_IoUring_new", ret);
+
+    return ring;
+}
+
+/* Give the SSL/TLS object of a connection back the I/O callbacks and contexts
+ * it had before it was attached. */
+static void IoUringRestoreIO(IoUringConn* c)
+{
+    c->ssl->CBIORecv = c->ioRecv;
+    c->ssl->CBIOSend = c->ioSend;
+    c->ssl->IOCB_ReadCtx = c->ioReadCtx;
+    c->ssl->IOCB_WriteCtx = c->ioWriteCtx;
+}
+
+/* Queue the cancelling of an operation of a connection.
+ *
+ * @param [in] c   Connection.
+ * @param [in] op  IO_URING_OP_RECV or IO_URING_OP_SEND.
+ * @return  0 on success.
+ * @return  WOLFSSL_CBIO_ERR_GENERAL when no entry is available.
+ */
+static int IoUringCancel(IoUringConn* c, __u64 op)
+{
+    WOLFSSL_URING* ring = c->ring;
+    struct io_uring_sqe* sqe = IoUringGetSqe(ring);
+
+    if (sqe == NULL)
+        return WOLFSSL_CBIO_ERR_GENERAL;
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = ((__u64)IoUringSlot(c) << IO_URING_OP_BITS) | op;
+    sqe->user_data = ((__u64)IoUringSlot(c) << IO_URING_OP_BITS) |
+        IO_URING_OP_CANCEL;
+    IoUringQueueSqe(ring);
+    return 0;
+}
+
+/* Cancel all operations in flight and wait for their completions.
+ *
+ * The kernel tears a ring down asynchronously once its fd is closed, so the
+ * buffers of an operation still in flight must not be freed before it has
+ * completed.
+ *
+ * @param [in] ring  io_uring.
+ * @return  0 when no operation is in flight.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel fails the call.
+ */
+static int IoUringDrain(WOLFSSL_URING* ring)
+{
+    word32 i;
+    int busy;
+    int ret = 0;
+
+    for (;;) {
+        busy = 0;
+        for (i = 0; i < ring->maxConns; i++) {
+            IoUringConn* c = &ring->conns[i];
+
+            if (c->ssl != NULL) {
+                IoUringRestoreIO(c);
+                c->ssl = NULL;
+            }
+            /* Cancelling again is harmless - the kernel reports the
+             * operation as not found or already running. */
+            if (c->rxBusy && (IoUringCancel(c, IO_URING_OP_RECV) != 0))
+                ret = IoUringEnter(ring, 0, 0);
+            if (c->txBusy && (IoUringCancel(c, IO_URING_OP_SEND) != 0))
+                ret = IoUringEnter(ring, 0, 0);
+            busy |= c->rxBusy | c->txBusy;
+        }
+        if ((ret != 0) || !busy)
+            break;
+        ret = IoUringEnter(ring, 1, IO_URING_DRAIN_MS);
+        if (ret == 0)
+            ret = IoUringReap(ring);
+    }
+
+    return ret;
+}
+
+/* Free an io_uring.
+ *
+ * Operations still in flight are cancelled and their completions waited for.
+ * Connections still attached are given back the I/O callbacks they had before
+ * being attached.
+ *
+ * @param [in] ring  io_uring. May be NULL.
+ */
+void wolfSSL_IoUring_free(WOLFSSL_URING* ring)
+{
+    byte* bufs;
+
+    if (ring == NULL)
+        return;
+
+    bufs = ring->bufs;
+    if ((ring->conns != NULL) && (IoUringDrain(ring) != 0)) {
+        /* Kernel may still write into the buffers - leak them. */
+        WOLFSSL_MSG("io_uring operations not drained");
+        bufs = NULL;
+    }
+    if (ring->sqes != NULL)
+        munmap(ring->sqes, ring->sqesSz);
+    if ((ring->cqRing != NULL) && (ring->cqRing != ring->sqRing))
+        munmap(ring->cqRing, ring->cqRingSz);
+    if (ring->sqRing != NULL)
+        munmap(ring->sqRing, ring->sqRingSz);
+    if (ring->fd >= 0)
+        close(ring->fd);
+    XFREE(bufs, ring->heap, DYNAMIC_TYPE_IN_BUFFER);
+    XFREE(ring->readyList, ring->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(ring->freeList, ring->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(ring->conns, ring->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(ring, ring->heap, DYNAMIC_TYPE_TMP_BUFFER);
+}
+
+/* Connection of ssl when it is attached to ring.
+ *
+ * @param [in] ring  io_uring.
+ * @param [in] ssl   SSL/TLS object.
+ * @return  Connection on success.
+ * @return  NULL when ssl is not attached to ring.
+ */
+static IoUringConn* IoUringGetConn(WOLFSSL_URING* ring, WOLFSSL* ssl)
+{
+    IoUringConn* c;
+
+    if ((ring == NULL) || (ssl == NULL) || (ssl->CBIORecv != IoUringReceive))
+        return NULL;
+    c = (IoUringConn*)ssl->IOCB_ReadCtx;
+    if ((c < ring->conns) || (c >= ring->conns + ring->maxConns) ||
+            (c->ssl != ssl)) {
+        return NULL;
+    }
+    return c;
+}
+
+/* Attach a connected stream socket to ssl and do its I/O through ring.
+ *
+ * Reads and writes of ssl then queue operations on the ring and return
+ * WANT_READ or WANT_WRITE until wolfSSL_IoUring_Wait() reports ssl ready.
+ *
+ * @param [in] ring  io_uring.
+ * @param [in] ssl   SSL/TLS object.
+ * @param [in] sd    Connected socket.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ring or ssl is NULL, sd is invalid, ssl is
+ *          DTLS or ssl is already attached.
+ * @return  MEMORY_E when all connection slots are in use.
+ */
+int wolfSSL_IoUring_Attach(WOLFSSL_URING* ring, WOLFSSL* ssl, SOCKET_T sd)
+{
+    IoUringConn* c;
+    int ret;
+
+    WOLFSSL_ENTER("wolfSSL_IoUring_Attach");
+
+    if ((ring == NULL) || (ssl == NULL) || (sd < 0) ||
+            ssl->options.dtls || (ssl->CBIORecv == IoUringReceive)) {
+        return BAD_FUNC_ARG;
+    }
+    if (ring->freeCnt == 0)
+        return MEMORY_E;
+
+    c = &ring->conns[ring->freeList[ring->freeCnt - 1]];
+    c->ioRecv = ssl->CBIORecv;
+    c->ioSend = ssl->CBIOSend;
+    c->ioReadCtx = ssl->IOCB_ReadCtx;
+    c->ioWriteCtx = ssl->IOCB_WriteCtx;
+
+    ret = wolfSSL_set_fd(ssl, sd);
+    if (ret != WOLFSSL_SUCCESS)
+        return ret;
+
+    ring->freeCnt--;
+    c->ssl = ssl;
+    c->sd = sd;
+    c->rxLen = c->rxOff = 0;
+    c->txLen = c->txOff = 0;
+    c->rxErr = c->txErr = 0;
+    ssl->CBIORecv = IoUringReceive;
+    ssl->CBIOSend = IoUringSend;
+    ssl->IOCB_ReadCtx = c;
+    ssl->IOCB_WriteCtx = c;
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Stop doing the I/O of a connection's SSL/TLS object through its ring.
+ *
+ * @param [in] c  Connection attached to a ring.
+ */
+static void IoUringDetach(IoUringConn* c)
+{
+    /* Without a free entry the receive completes when the peer sends or
+     * closes. */
+    if (c->rxBusy)
+        (void)IoUringCancel(c, IO_URING_OP_RECV);
+    IoUringRestoreIO(c);
+    c->ssl = NULL;
+    IoUringRelease(c);
+}
+
+/* Stop doing the I/O of ssl through ring.
+ *
+ * Data not yet sent is dropped - wait for wolfSSL_IoUring_Pending() to reach
+ * 0 first. A receive in flight is cancelled. ssl is given back the I/O
+ * callbacks and contexts it had before being attached.
+ *
+ * @param [in] ring  io_uring.
+ * @param [in] ssl   SSL/TLS object.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ssl is not attached to ring.
+ */
+int wolfSSL_IoUring_Detach(WOLFSSL_URING* ring, WOLFSSL* ssl)
+{
+    IoUringConn* c = IoUringGetConn(ring, ssl);
+
+    WOLFSSL_ENTER("wolfSSL_IoUring_Detach");
+
+    if (c == NULL)
+        return BAD_FUNC_ARG;
+
+    IoUringDetach(c);
+
+    return WOLFSSL_SUCCESS;
+}
+
+/* Detach ssl from the io_uring doing its I/O, if any, as it is freed.
+ *
+ * @param [in] ssl  SSL/TLS object.
+ */
+void wolfIO_IoUringFree(WOLFSSL* ssl)
+{
+    if (ssl->CBIORecv == IoUringReceive)
+        IoUringDetach((IoUringConn*)ssl->IOCB_ReadCtx);
+}
+
+/* Number of bytes written by ssl that the kernel has not yet taken.
+ *
+ * @param [in] ring  io_uring.
+ * @param [in] ssl   SSL/TLS object.
+ * @return  Number of bytes on success.
+ * @return  BAD_FUNC_ARG when ssl is not attached to ring.
+ */
+int wolfSSL_IoUring_Pending(WOLFSSL_URING* ring, WOLFSSL* ssl)
+{
+    IoUringConn* c = IoUringGetConn(ring, ssl);
+
+    if (c == NULL)
+        return BAD_FUNC_ARG;
+    return (int)(c->txLen - c->txOff);
+}
+
+/* Submit all queued operations to the kernel in one system call.
+ *
+ * @param [in] ring  io_uring.
+ * @return  WOLFSSL_SUCCESS on success.
+ * @return  BAD_FUNC_ARG when ring is NULL.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel fails the call.
+ */
+int wolfSSL_IoUring_Submit(WOLFSSL_URING* ring)
+{
+    if (ring == NULL)
+        return BAD_FUNC_ARG;
+    if (IoUringEnter(ring, 0, 0) != 0)
+        return WOLFSSL_FATAL_ERROR;
+    return WOLFSSL_SUCCESS;
+}
+
+/* Submit queued operations, wait for completions and get the SSL/TLS objects
+ * that can make progress.
+ *
+ * Call wolfSSL_accept(), wolfSSL_connect(), wolfSSL_read() or wolfSSL_write()
+ * again on each object returned. Objects that did not fit in ready are
+ * returned by the next call.
+ *
+ * @param [in]  ring       io_uring.
+ * @param [out] ready      Array to fill with SSL/TLS objects.
+ * @param [in]  maxReady   Number of entries in ready.
+ * @param [in]  timeoutMs  Most milliseconds to wait when none is ready. 0
+ *                         does not wait and negative waits forever.
+ * @return  Number of objects placed in ready on success.
+ * @return  BAD_FUNC_ARG when ring or ready is NULL or maxReady is not
+ *          positive.
+ * @return  WOLFSSL_FATAL_ERROR when the kernel fails the call.
+ */
+int wolfSSL_IoUring_Wait(WOLFSSL_URING* ring, WOLFSSL** ready,
+    int maxReady, int timeoutMs)
+{
+    int n = 0;
+
+    if ((ring == NULL) || (ready == NULL) || (maxReady <= 0))
+        return BAD_FUNC_ARG;
+
+    if ((IoUringEnter(ring, (ring->readyCnt == 0) && (timeoutMs != 0),
+            timeoutMs) != 0) || (IoUringReap(ring) != 0)) {
+        return WOLFSSL_FATAL_ERROR;
+    }
+
+    while ((n < maxReady) && (ring->readyCnt > 0)) {
+        IoUringConn* c = &ring->conns[ring->readyList[ring->readyHead]];
+
+        ring->readyHead = (ring->readyHead + 1) % ring->maxConns;
+        ring->readyCnt--;
+        c->ready = 0;
+        if (c->ssl != NULL)
+            ready[n++] = c->ssl;
+    }
+
+    return n;
+}
+
+#endif /* WOLFSSL_IO_URING */
+
 #endif /* USE_WOLFSSL_IO */
 
 
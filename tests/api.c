@@ -51382,6 +51382,20 @@ TEST_DECL(test_wc_RsaPSS_DigitalSignVerify),
     TEST_DECL(test_tls13_unexpected_ccs),
     TEST_DECL(test_tls12_curve_intersection),
     TEST_DECL(test_tls13_curve_intersection),
+    TEST_DECL(test_tls_writev),
+    TEST_DECL(test_tls_read_zc),
+    TEST_DECL(test_tls_ktls),
+    TEST_DECL(test_tls_read_ahead),
+    TEST_DECL(test_tls_send_batch),
+    TEST_DECL(test_tls_dyn_record),
+    TEST_DECL(test_tls_io_pool),
+    TEST_DECL(test_tls_io_uring),
+    TEST_DECL(test_tls_crypt_pool),
+    TEST_DECL(test_tls_session_cache_seqlock),
+    TEST_DECL(test_tls_ctx_decoded_key),
+    TEST_DECL(test_tls_ctx_parent_rng),
+    TEST_DECL(test_tls_early_data_antireplay),
+    TEST_DECL(test_tls_ticket_key_ring),
     TEST_DECL(test_wc_DhSetNamedKey),
     /* This test needs to stay at the end to clean up any caches allocated. */
     TEST_DECL(test_wolfSSL_Cleanup)
@@ -178,9 +178,330 @@ int test_ascon_aead128(void)
             }
             wc_AsconAEAD128_Clear(asconAEAD);
         }
+
+        /* One-shot encryption test - separate and in-place */
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(key, nonce, ad, adSz, pt, ptSz,
+                    buf, tag), 0);
+        ExpectBufEQ(buf, ct, ptSz);
+        ExpectBufEQ(tag, ct + ptSz, ASCON_AEAD128_TAG_SZ);
+        XMEMCPY(buf, pt, ptSz);
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(key, nonce, ad, adSz, buf, ptSz,
+                    buf, tag), 0);
+        ExpectBufEQ(buf, ct, ptSz);
+        ExpectBufEQ(tag, ct + ptSz, ASCON_AEAD128_TAG_SZ);
+        /* One-shot decryption test - in-place */
+        ExpectIntEQ(wc_AsconAEAD128_Decrypt(key, nonce, ad, adSz, buf, ctSz,
+                    buf, ct + ctSz), 0);
+        ExpectBufEQ(buf, pt, ctSz);
+        /* One-shot decryption with bad tag fails and clears output */
+        tag[0] ^= 0x01;
+        ExpectIntEQ(wc_AsconAEAD128_Decrypt(key, nonce, ad, adSz, ct, ctSz,
+                    buf, tag), WC_NO_ERR_TRACE(ASCON_AUTH_E));
+        if (ctSz > 0) {
+            XMEMSET(pt, 0, ctSz);
+            ExpectBufEQ(buf, pt, ctSz);
+        }
+    }
+
+    /* One-shot API bad arguments */
+    {
+        byte key[ASCON_AEAD128_KEY_SZ];
+        byte nonce[ASCON_AEAD128_NONCE_SZ];
+        byte buf[ASCON_AEAD128_TAG_SZ];
+        byte tag[ASCON_AEAD128_TAG_SZ];
+
+        XMEMSET(key, 0, sizeof(key));
+        XMEMSET(nonce, 0, sizeof(nonce));
+        XMEMSET(buf, 0, sizeof(buf));
+        XMEMSET(tag, 0, sizeof(tag));
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(NULL, nonce, NULL, 0, buf,
+                    sizeof(buf), buf, tag), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(key, NULL, NULL, 0, buf,
+                    sizeof(buf), buf, tag), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(key, nonce, NULL, 0, buf,
+                    sizeof(buf), buf, NULL), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(key, nonce, NULL, 1, buf,
+                    sizeof(buf), buf, tag), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Encrypt(key, nonce, NULL, 0, NULL,
+                    sizeof(buf), buf, tag), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Decrypt(key, nonce, NULL, 0, buf,
+                    sizeof(buf), NULL, tag), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Decrypt(key, nonce, NULL, 0, buf,
+                    sizeof(buf), buf, NULL), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
     }
 
     wc_AsconAEAD128_Free(asconAEAD);
 #endif
     return EXPECT_RESULT();
 }
+
+int test_ascon_aead128_keyed(void)
+{
+    EXPECT_DECLS;
+#ifdef HAVE_ASCON
+    word32 i;
+    wc_AsconAEAD128 asconAEAD;
+
+    XMEMSET(&asconAEAD, 0, sizeof(asconAEAD));
+
+    for (i = 0; i < XELEM_CNT(ascon_aead128_kat); i++) {
+        byte key[ASCON_AEAD128_KEY_SZ];
+        byte nonce[ASCON_AEAD128_NONCE_SZ];
+        byte pt[32]; /* longest plaintext we test is 32 bytes */
+        word32 ptSz;
+        byte ad[32]; /* longest AD we test is 32 bytes */
+        word32 adSz;
+        byte ct[48]; /* longest ciphertext we test is 32 bytes + 16 bytes tag */
+        word32 ctSz;
+        word32 j;
+        byte tag[2][ASCON_AEAD128_TAG_SZ];
+        byte buf[2][32]; /* longest buffer we test is 32 bytes */
+        wc_AsconAEAD128_Msg msgs[2];
+
+        XMEMSET(key, 0, sizeof(key));
+        XMEMSET(nonce, 0, sizeof(nonce));
+        XMEMSET(pt, 0, sizeof(pt));
+        XMEMSET(ad, 0, sizeof(ad));
+        XMEMSET(ct, 0, sizeof(ct));
+        XMEMSET(tag, 0, sizeof(tag));
+        XMEMSET(buf, 0, sizeof(buf));
+
+        /* Convert HEX strings to byte stream */
+        for (j = 0; ascon_aead128_kat[i][0][j] != '\0'; j += 2) {
+            key[j/2] = HexCharToByte(ascon_aead128_kat[i][0][j]) << 4 |
+                       HexCharToByte(ascon_aead128_kat[i][0][j+1]);
+        }
+        for (j = 0; ascon_aead128_kat[i][1][j] != '\0'; j += 2) {
+            nonce[j/2] = HexCharToByte(ascon_aead128_kat[i][1][j]) << 4 |
+                         HexCharToByte(ascon_aead128_kat[i][1][j+1]);
+        }
+        for (j = 0; ascon_aead128_kat[i][2][j] != '\0'; j += 2) {
+            pt[j/2] = HexCharToByte(ascon_aead128_kat[i][2][j]) << 4 |
+                      HexCharToByte(ascon_aead128_kat[i][2][j+1]);
+        }
+        ptSz = j/2;
+        for (j = 0; ascon_aead128_kat[i][3][j] != '\0'; j += 2) {
+            ad[j/2] = HexCharToByte(ascon_aead128_kat[i][3][j]) << 4 |
+                      HexCharToByte(ascon_aead128_kat[i][3][j+1]);
+        }
+        adSz = j/2;
+        for (j = 0; ascon_aead128_kat[i][4][j] != '\0'; j += 2) {
+            ct[j/2] = HexCharToByte(ascon_aead128_kat[i][4][j]) << 4 |
+                      HexCharToByte(ascon_aead128_kat[i][4][j+1]);
+        }
+        ctSz = j/2 - ASCON_AEAD128_TAG_SZ;
+
+        ExpectIntEQ(wc_AsconAEAD128_InitKey(&asconAEAD, key), 0);
+        /* Key survives the final call - encrypt, then decrypt twice using
+         * both ways of starting a message. */
+        ExpectIntEQ(wc_AsconAEAD128_Reset(&asconAEAD, nonce), 0);
+        ExpectIntEQ(wc_AsconAEAD128_SetAD(&asconAEAD, ad, adSz), 0);
+        ExpectIntEQ(wc_AsconAEAD128_EncryptUpdate(&asconAEAD, buf[0], pt,
+                    ptSz), 0);
+        ExpectIntEQ(wc_AsconAEAD128_EncryptFinal(&asconAEAD, tag[0]), 0);
+        ExpectBufEQ(buf[0], ct, ptSz);
+        ExpectBufEQ(tag[0], ct + ptSz, ASCON_AEAD128_TAG_SZ);
+        for (j = 0; j < 2; j++) {
+            if (j == 0) {
+                ExpectIntEQ(wc_AsconAEAD128_Reset(&asconAEAD, nonce), 0);
+            }
+            else {
+                ExpectIntEQ(wc_AsconAEAD128_SetNonce(&asconAEAD, nonce), 0);
+            }
+            ExpectIntEQ(wc_AsconAEAD128_SetAD(&asconAEAD, ad, adSz), 0);
+            ExpectIntEQ(wc_AsconAEAD128_DecryptUpdate(&asconAEAD, buf[1], ct,
+                        ctSz), 0);
+            ExpectIntEQ(wc_AsconAEAD128_DecryptFinal(&asconAEAD, ct + ctSz), 0);
+            ExpectBufEQ(buf[1], pt, ctSz);
+        }
+        /* Reset discards a message in progress */
+        ExpectIntEQ(wc_AsconAEAD128_Reset(&asconAEAD, nonce), 0);
+        ExpectIntEQ(wc_AsconAEAD128_SetAD(&asconAEAD, ad, adSz), 0);
+        ExpectIntEQ(wc_AsconAEAD128_EncryptUpdate(&asconAEAD, buf[1], pt,
+                    ptSz), 0);
+        ExpectIntEQ(wc_AsconAEAD128_Reset(&asconAEAD, nonce), 0);
+        ExpectIntEQ(wc_AsconAEAD128_SetAD(&asconAEAD, ad, adSz), 0);
+        ExpectIntEQ(wc_AsconAEAD128_EncryptUpdate(&asconAEAD, buf[1], pt,
+                    ptSz), 0);
+        ExpectIntEQ(wc_AsconAEAD128_EncryptFinal(&asconAEAD, tag[1]), 0);
+        ExpectBufEQ(buf[1], ct, ptSz);
+        ExpectBufEQ(tag[1], ct + ptSz, ASCON_AEAD128_TAG_SZ);
+
+        /* Batch encryption - separate output and in-place */
+        XMEMSET(msgs, 0, sizeof(msgs));
+        XMEMSET(buf, 0, sizeof(buf));
+        XMEMCPY(buf[1], pt, ptSz);
+        for (j = 0; j < 2; j++) {
+            msgs[j].nonce = nonce;
+            msgs[j].ad = ad;
+            msgs[j].adSz = adSz;
+            msgs[j].in = (j == 0) ? pt : buf[1];
+            msgs[j].inSz = ptSz;
+            msgs[j].out = buf[j];
+            msgs[j].tag = tag[j];
+        }
+        ExpectIntEQ(wc_AsconAEAD128_EncryptBatch(&asconAEAD, msgs, 2), 0);
+        for (j = 0; j < 2; j++) {
+            ExpectIntEQ(msgs[j].ret, 0);
+            ExpectBufEQ(buf[j], ct, ptSz);
+            ExpectBufEQ(tag[j], ct + ptSz, ASCON_AEAD128_TAG_SZ);
+        }
+
+        /* Batch decryption in-place - second message has a bad tag */
+        tag[1][0] ^= 0x80;
+        for (j = 0; j < 2; j++) {
+            msgs[j].in = buf[j];
+            msgs[j].ret = -1;
+        }
+        ExpectIntEQ(wc_AsconAEAD128_DecryptBatch(&asconAEAD, msgs, 2),
+                    WC_NO_ERR_TRACE(ASCON_AUTH_E));
+        ExpectIntEQ(msgs[0].ret, 0);
+        ExpectIntEQ(msgs[1].ret, WC_NO_ERR_TRACE(ASCON_AUTH_E));
+        ExpectBufEQ(buf[0], pt, ptSz);
+        if (ptSz > 0) {
+            XMEMSET(pt, 0, ptSz);
+            ExpectBufEQ(buf[1], pt, ptSz);
+        }
+
+        wc_AsconAEAD128_Clear(&asconAEAD);
+    }
+
+    /* Bad arguments and state */
+    {
+        byte key[ASCON_AEAD128_KEY_SZ];
+        byte tag[ASCON_AEAD128_TAG_SZ];
+        wc_AsconAEAD128_Msg msg;
+
+        XMEMSET(key, 0, sizeof(key));
+        XMEMSET(&msg, 0, sizeof(msg));
+        ExpectIntEQ(wc_AsconAEAD128_InitKey(NULL, key),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_InitKey(&asconAEAD, NULL),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Init(&asconAEAD), 0);
+        ExpectIntEQ(wc_AsconAEAD128_Reset(&asconAEAD, key),
+                    WC_NO_ERR_TRACE(BAD_STATE_E));
+        ExpectIntEQ(wc_AsconAEAD128_EncryptBatch(&asconAEAD, &msg, 1),
+                    WC_NO_ERR_TRACE(BAD_STATE_E));
+        ExpectIntEQ(wc_AsconAEAD128_InitKey(&asconAEAD, key), 0);
+        ExpectIntEQ(wc_AsconAEAD128_Reset(&asconAEAD, NULL),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_Reset(NULL, key),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_EncryptBatch(&asconAEAD, NULL, 1),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_EncryptBatch(&asconAEAD, NULL, 0), 0);
+        /* Missing nonce */
+        msg.tag = tag;
+        ExpectIntEQ(wc_AsconAEAD128_EncryptBatch(&asconAEAD, &msg, 1),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_DecryptBatch(&asconAEAD, &msg, 1),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_AsconAEAD128_DecryptBatch(NULL, &msg, 1),
+                    WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        wc_AsconAEAD128_Clear(&asconAEAD);
+    }
+#endif
+    return EXPECT_RESULT();
+}
+
+int test_ascon_xof128_lanes(void)
+{
+    EXPECT_DECLS;
+#ifdef HAVE_ASCON
+    static const word32 inSz[] = { 0, 7, 8, 33, 34, 100 };
+    static const word32 outSz[] = { 1, 16, 37, 480 };
+    byte msg[ASCON_XOF128_MAX_LANES][100];
+    byte out[ASCON_XOF128_MAX_LANES][480];
+    byte exp[480];
+    wc_AsconXof128 xof[ASCON_XOF128_MAX_LANES];
+    wc_AsconXof128 serial;
+    wc_AsconXof128* lane[ASCON_XOF128_MAX_LANES];
+    const byte* in[ASCON_XOF128_MAX_LANES];
+    byte* outp[ASCON_XOF128_MAX_LANES];
+    int lanes;
+    int l;
+    word32 i;
+    word32 o;
+
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++) {
+        for (i = 0; i < sizeof(msg[l]); i++)
+            msg[l][i] = (byte)(l * 31 + i);
+        lane[l] = &xof[l];
+        in[l] = msg[l];
+        outp[l] = out[l];
+    }
+
+    /* Bad parameters. */
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(NULL, 1, in, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, 0, in, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, ASCON_XOF128_MAX_LANES + 1, in,
+        1), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, 1, NULL, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_AsconXof128_SqueezeX(NULL, 1, outp, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_AsconXof128_SqueezeX(lane, 0, outp, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_AsconXof128_SqueezeX(lane, 1, NULL, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    /* Each lane must match a serial object - including repeated squeezes. */
+    for (lanes = 1; lanes <= ASCON_XOF128_MAX_LANES; lanes++) {
+        for (i = 0; i < XELEM_CNT(inSz) && EXPECT_SUCCESS(); i++) {
+            for (l = 0; l < lanes; l++)
+                ExpectIntEQ(wc_AsconXof128_Init(lane[l]), 0);
+            ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, lanes, in, inSz[i]), 0);
+            ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, lanes, in, 3), 0);
+            for (o = 0; o < XELEM_CNT(outSz); o++) {
+                ExpectIntEQ(wc_AsconXof128_SqueezeX(lane, lanes, outp,
+                    outSz[o]), 0);
+            }
+            for (l = 0; l < lanes; l++) {
+                ExpectIntEQ(wc_AsconXof128_Init(&serial), 0);
+                ExpectIntEQ(wc_AsconXof128_Absorb(&serial, msg[l], inSz[i]),
+                    0);
+                ExpectIntEQ(wc_AsconXof128_Absorb(&serial, msg[l], 3), 0);
+                for (o = 0; o < XELEM_CNT(outSz); o++) {
+                    ExpectIntEQ(wc_AsconXof128_Squeeze(&serial, exp,
+                        outSz[o]), 0);
+                }
+                ExpectBufEQ(out[l], exp, outSz[XELEM_CNT(outSz) - 1]);
+            }
+            /* Absorbing after squeezing is not allowed. */
+            ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, lanes, in, 1),
+                WC_NO_ERR_TRACE(BAD_STATE_E));
+        }
+    }
+
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++)
+        ExpectIntEQ(wc_AsconXof128_Init(lane[l]), 0);
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, 4, in, 34), 0);
+    ExpectIntEQ(wc_AsconXof128_SqueezeX4(lane, outp, 480), 0);
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(lane + 4, 4, in + 4, 34), 0);
+    ExpectIntEQ(wc_AsconXof128_SqueezeX4(lane + 4, outp + 4, 480), 0);
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++) {
+        ExpectIntEQ(wc_AsconXof128_Init(&serial), 0);
+        ExpectIntEQ(wc_AsconXof128_Absorb(&serial, msg[l], 34), 0);
+        ExpectIntEQ(wc_AsconXof128_Squeeze(&serial, exp, 480), 0);
+        ExpectBufEQ(out[l], exp, 480);
+    }
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++)
+        ExpectIntEQ(wc_AsconXof128_Init(lane[l]), 0);
+    ExpectIntEQ(wc_AsconXof128_AbsorbX(lane, 8, in, 33), 0);
+    ExpectIntEQ(wc_AsconXof128_SqueezeX8(lane, outp, 192), 0);
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++) {
+        ExpectIntEQ(wc_AsconXof128_Init(&serial), 0);
+        ExpectIntEQ(wc_AsconXof128_Absorb(&serial, msg[l], 33), 0);
+        ExpectIntEQ(wc_AsconXof128_Squeeze(&serial, exp, 192), 0);
+        ExpectBufEQ(out[l], exp, 192);
+    }
+
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++)
+        wc_AsconXof128_Clear(lane[l]);
+    wc_AsconXof128_Clear(&serial);
+#endif
+    return EXPECT_RESULT();
+}
@@ -26,9 +26,13 @@
 
 int test_ascon_hash256(void);
 int test_ascon_aead128(void);
+int test_ascon_aead128_keyed(void);
+int test_ascon_xof128_lanes(void);
 
-#define TEST_ASCON_DECLS                            \
-    TEST_DECL_GROUP("ascon", test_ascon_hash256),   \
-    TEST_DECL_GROUP("ascon", test_ascon_aead128)
+#define TEST_ASCON_DECLS                                \
+    TEST_DECL_GROUP("ascon", test_ascon_hash256),       \
+    TEST_DECL_GROUP("ascon", test_ascon_aead128),       \
+    TEST_DECL_GROUP("ascon", test_ascon_aead128_keyed), \
+    TEST_DECL_GROUP("ascon", test_ascon_xof128_lanes)
 
 #endif /* TESTS_API_TEST_ASCON_H */
@@ -3872,3 +3872,599 @@ int test_wc_mlkem_decapsulate_kats(void)
     return EXPECT_RESULT();
 }
 
+
+int test_wc_mlkem_batch(void)
+{
+    EXPECT_DECLS;
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    !defined(WOLFSSL_NO_ML_KEM) && !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+    /* More than one group of operations. */
+    #define MLKEM_BATCH_TEST_CNT    10
+    static const int types[] = {
+    #ifndef WOLFSSL_NO_ML_KEM_512
+        WC_ML_KEM_512,
+    #endif
+    #ifndef WOLFSSL_NO_ML_KEM_768
+        WC_ML_KEM_768,
+    #endif
+    #ifndef WOLFSSL_NO_ML_KEM_1024
+        WC_ML_KEM_1024,
+    #endif
+    };
+    WC_RNG rng;
+    MlKemKey* key = NULL;
+    MlKemKey* keys[MLKEM_BATCH_TEST_CNT];
+    byte* ct = NULL;
+    byte* ctp[MLKEM_BATCH_TEST_CNT];
+    const byte* cctp[MLKEM_BATCH_TEST_CNT];
+    byte ss[MLKEM_BATCH_TEST_CNT][WC_ML_KEM_SS_SZ];
+    byte ss2[MLKEM_BATCH_TEST_CNT][WC_ML_KEM_SS_SZ];
+    byte* ssp[MLKEM_BATCH_TEST_CNT];
+    byte* ss2p[MLKEM_BATCH_TEST_CNT];
+    byte ssOne[WC_ML_KEM_SS_SZ];
+    word32 ctSz = 0;
+    int i;
+    int t;
+
+    XMEMSET(&rng, 0, sizeof(WC_RNG));
+    ExpectIntEQ(wc_InitRng(&rng), 0);
+    key = (MlKemKey*)XMALLOC(MLKEM_BATCH_TEST_CNT * sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    ExpectNotNull(key);
+    ct = (byte*)XMALLOC(MLKEM_BATCH_TEST_CNT * WC_ML_KEM_MAX_CIPHER_TEXT_SIZE,
+        NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    ExpectNotNull(ct);
+    for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+        keys[i] = (key != NULL) ? &key[i] : NULL;
+        ctp[i] = (ct != NULL) ? ct + i * WC_ML_KEM_MAX_CIPHER_TEXT_SIZE : NULL;
+        cctp[i] = ctp[i];
+        ssp[i] = ss[i];
+        ss2p[i] = ss2[i];
+    }
+
+    for (t = 0; (t < (int)(sizeof(types) / sizeof(*types))) && EXPECT_SUCCESS();
+            t++) {
+        for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+            ExpectIntEQ(wc_MlKemKey_Init(keys[i], types[t], NULL,
+                INVALID_DEVID), 0);
+        }
+        ExpectIntEQ(wc_MlKemKey_CipherTextSize(keys[0], &ctSz), 0);
+
+        /* Bad parameters. */
+        ExpectIntEQ(wc_MlKemKey_MakeKeyBatch(NULL, MLKEM_BATCH_TEST_CNT, &rng),
+            WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_MlKemKey_MakeKeyBatch(keys, 0, &rng),
+            WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_MlKemKey_MakeKeyBatch(keys, MLKEM_BATCH_TEST_CNT, NULL),
+            WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_MlKemKey_EncapsulateBatch(keys, NULL, ssp,
+            MLKEM_BATCH_TEST_CNT, &rng), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_MlKemKey_EncapsulateBatch(keys, ctp, NULL,
+            MLKEM_BATCH_TEST_CNT, &rng), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        /* Keys not set. */
+        ExpectIntEQ(wc_MlKemKey_EncapsulateBatch(keys, ctp, ssp,
+            MLKEM_BATCH_TEST_CNT, &rng), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+        ExpectIntEQ(wc_MlKemKey_DecapsulateBatch(keys, ss2p, cctp, ctSz,
+            MLKEM_BATCH_TEST_CNT), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    #ifdef WOLFSSL_MLKEM_CACHE_AT
+        /* Some keys expand their transposed matrix into their cache. */
+        for (i = 1; i < MLKEM_BATCH_TEST_CNT; i += 2) {
+            ExpectIntEQ(wc_MlKemKey_SetMatrixCache(keys[i], 1), 0);
+        }
+    #endif
+
+        /* Batch of key generations. */
+        ExpectIntEQ(wc_MlKemKey_MakeKeyBatch(keys, MLKEM_BATCH_TEST_CNT, &rng),
+            0);
+        ExpectIntEQ(wc_MlKemKey_DecapsulateBatch(keys, ss2p, cctp, ctSz - 1,
+            MLKEM_BATCH_TEST_CNT), WC_NO_ERR_TRACE(BUFFER_E));
+
+        /* Batch encapsulate, then decapsulate one at a time and as a batch. */
+        ExpectIntEQ(wc_MlKemKey_EncapsulateBatch(keys, ctp, ssp,
+            MLKEM_BATCH_TEST_CNT, &rng), 0);
+        for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+            ExpectIntEQ(wc_MlKemKey_Decapsulate(keys[i], ssOne, ctp[i], ctSz),
+                0);
+            ExpectBufEQ(ssOne, ss[i], WC_ML_KEM_SS_SZ);
+        }
+        ExpectIntEQ(wc_MlKemKey_DecapsulateBatch(keys, ss2p, cctp, ctSz,
+            MLKEM_BATCH_TEST_CNT), 0);
+        for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+            ExpectBufEQ(ss2[i], ss[i], WC_ML_KEM_SS_SZ);
+        }
+
+        /* Encapsulate one at a time and decapsulate as a batch. */
+        for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+            ExpectIntEQ(wc_MlKemKey_Encapsulate(keys[i], ctp[i], ss[i], &rng),
+                0);
+        }
+        ExpectIntEQ(wc_MlKemKey_DecapsulateBatch(keys, ss2p, cctp, ctSz,
+            MLKEM_BATCH_TEST_CNT), 0);
+        for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+            ExpectBufEQ(ss2[i], ss[i], WC_ML_KEM_SS_SZ);
+        }
+
+        /* Modified cipher text is implicitly rejected. */
+        if (ctp[0] != NULL) {
+            ctp[0][0] ^= 0x01;
+        }
+        ExpectIntEQ(wc_MlKemKey_DecapsulateBatch(keys, ss2p, cctp, ctSz,
+            MLKEM_BATCH_TEST_CNT), 0);
+        ExpectBufNE(ss2[0], ss[0], WC_ML_KEM_SS_SZ);
+        ExpectBufEQ(ss2[1], ss[1], WC_ML_KEM_SS_SZ);
+
+        for (i = 0; i < MLKEM_BATCH_TEST_CNT; i++) {
+            wc_MlKemKey_Free(keys[i]);
+        }
+    }
+
+    XFREE(ct, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    wc_FreeRng(&rng);
+    #undef MLKEM_BATCH_TEST_CNT
+#endif
+    return EXPECT_RESULT();
+}
+
+int test_wc_mlkem_matrix_cache(void)
+{
+    EXPECT_DECLS;
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    !defined(WOLFSSL_NO_ML_KEM) && !defined(WOLFSSL_NO_ML_KEM_768) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+    WC_RNG rng;
+    MlKemKey* priv = NULL;
+    MlKemKey* priv2 = NULL;
+    MlKemKey* pub = NULL;
+    byte* pubKey = NULL;
+    byte ct[WC_ML_KEM_768_CIPHER_TEXT_SIZE];
+    byte ss[WC_ML_KEM_SS_SZ];
+    byte ss2[WC_ML_KEM_SS_SZ];
+    int i;
+
+    XMEMSET(&rng, 0, sizeof(WC_RNG));
+    ExpectIntEQ(wc_InitRng(&rng), 0);
+    ExpectNotNull(priv = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(priv2 = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(pub = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(pubKey = (byte*)XMALLOC(WC_ML_KEM_768_PUBLIC_KEY_SIZE, NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+
+    ExpectIntEQ(wc_MlKemKey_Init(priv, WC_ML_KEM_768, NULL, INVALID_DEVID), 0);
+    ExpectIntEQ(wc_MlKemKey_Init(priv2, WC_ML_KEM_768, NULL, INVALID_DEVID),
+        0);
+    ExpectIntEQ(wc_MlKemKey_Init(pub, WC_ML_KEM_768, NULL, INVALID_DEVID), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKey(priv, &rng), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKey(priv2, &rng), 0);
+
+    ExpectIntEQ(wc_MlKemKey_SetMatrixCache(NULL, 1),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+#ifdef WOLFSSL_MLKEM_CACHE_AT
+    /* Matrix expanded when public key decoded and used for each
+     * encapsulation. */
+    ExpectIntEQ(wc_MlKemKey_SetMatrixCache(pub, 1), 0);
+    ExpectIntEQ(wc_MlKemKey_EncodePublicKey(priv, pubKey,
+        WC_ML_KEM_768_PUBLIC_KEY_SIZE), 0);
+    ExpectIntEQ(wc_MlKemKey_DecodePublicKey(pub, pubKey,
+        WC_ML_KEM_768_PUBLIC_KEY_SIZE), 0);
+    ExpectIntNE(pub->flags & MLKEM_FLAG_AT_SET, 0);
+    for (i = 0; i < 3; i++) {
+        ExpectIntEQ(wc_MlKemKey_Encapsulate(pub, ct, ss, &rng), 0);
+        ExpectIntEQ(wc_MlKemKey_Decapsulate(priv, ss2, ct, sizeof(ct)), 0);
+        ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+    }
+
+    /* New public key replaces cached matrix. */
+    ExpectIntEQ(wc_MlKemKey_EncodePublicKey(priv2, pubKey,
+        WC_ML_KEM_768_PUBLIC_KEY_SIZE), 0);
+    ExpectIntEQ(wc_MlKemKey_DecodePublicKey(pub, pubKey,
+        WC_ML_KEM_768_PUBLIC_KEY_SIZE), 0);
+    ExpectIntEQ(wc_MlKemKey_Encapsulate(pub, ct, ss, &rng), 0);
+    ExpectIntEQ(wc_MlKemKey_Decapsulate(priv2, ss2, ct, sizeof(ct)), 0);
+    ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+
+    /* Matrix expanded on first use with key generated. */
+    ExpectIntEQ(wc_MlKemKey_SetMatrixCache(priv, 1), 0);
+    ExpectIntEQ(wc_MlKemKey_Encapsulate(priv, ct, ss, &rng), 0);
+    ExpectIntNE(priv->flags & MLKEM_FLAG_AT_SET, 0);
+    ExpectIntEQ(wc_MlKemKey_Decapsulate(priv, ss2, ct, sizeof(ct)), 0);
+    ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+
+    /* Turning off frees matrix. */
+    ExpectIntEQ(wc_MlKemKey_SetMatrixCache(pub, 0), 0);
+    ExpectNull(pub->at);
+    ExpectIntEQ(wc_MlKemKey_Encapsulate(pub, ct, ss, &rng), 0);
+    ExpectIntEQ(wc_MlKemKey_Decapsulate(priv2, ss2, ct, sizeof(ct)), 0);
+    ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+#else
+    ExpectIntEQ(wc_MlKemKey_SetMatrixCache(pub, 1),
+        WC_NO_ERR_TRACE(NOT_COMPILED_IN));
+    (void)i;
+    (void)ct;
+    (void)ss;
+    (void)ss2;
+#endif
+
+    wc_MlKemKey_Free(pub);
+    wc_MlKemKey_Free(priv2);
+    wc_MlKemKey_Free(priv);
+    XFREE(pubKey, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(pub, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(priv2, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(priv, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    wc_FreeRng(&rng);
+#endif
+    return EXPECT_RESULT();
+}
+
+#ifdef WOLFSSL_MLKEM_PROFILE
+/* Clock for profiling test - counts the number of times read. */
+static word64 test_mlkem_profile_ticks = 0;
+static word64 test_mlkem_profile_clock(void)
+{
+    return ++test_mlkem_profile_ticks;
+}
+#endif
+
+int test_wc_mlkem_profile(void)
+{
+    EXPECT_DECLS;
+#if defined(WOLFSSL_MLKEM_PROFILE) && !defined(WOLFSSL_NO_ML_KEM) && \
+    !defined(WOLFSSL_NO_ML_KEM_768) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+    WC_RNG rng;
+    MlKemKey* key = NULL;
+    wc_MlKemProfile prof;
+    byte ct[WC_ML_KEM_768_CIPHER_TEXT_SIZE];
+    byte ss[WC_ML_KEM_SS_SZ];
+    byte ss2[WC_ML_KEM_SS_SZ];
+    word64 perms;
+    int i;
+
+    XMEMSET(&rng, 0, sizeof(WC_RNG));
+    ExpectIntEQ(wc_InitRng(&rng), 0);
+    ExpectNotNull(key = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectIntEQ(wc_MlKemKey_Init(key, WC_ML_KEM_768, NULL, INVALID_DEVID), 0);
+
+    ExpectIntEQ(wc_MlKemProfile_Get(NULL), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    /* No clock - only permutations counted. */
+    wc_MlKemProfile_SetClock(NULL);
+    wc_MlKemProfile_Reset();
+    ExpectIntEQ(wc_MlKemKey_MakeKey(key, &rng), 0);
+    ExpectIntEQ(wc_MlKemProfile_Get(&prof), 0);
+    ExpectTrue(prof.perms > 0);
+    for (i = 0; i < WC_MLKEM_PHASE_CNT; i++) {
+        ExpectTrue(prof.ticks[i] == 0);
+    }
+    perms = prof.perms;
+
+    /* Key generation doesn't compress. */
+    wc_MlKemProfile_SetClock(test_mlkem_profile_clock);
+    wc_MlKemProfile_Reset();
+    ExpectIntEQ(wc_MlKemKey_MakeKey(key, &rng), 0);
+    ExpectIntEQ(wc_MlKemProfile_Get(&prof), 0);
+    ExpectTrue(prof.perms > 0);
+    ExpectTrue(prof.ticks[WC_MLKEM_PHASE_MATRIX] > 0);
+    ExpectTrue(prof.ticks[WC_MLKEM_PHASE_NOISE] > 0);
+    ExpectTrue(prof.ticks[WC_MLKEM_PHASE_NTT] > 0);
+    ExpectTrue(prof.ticks[WC_MLKEM_PHASE_COMPRESS] == 0);
+
+    /* Totals accumulate until reset. */
+    ExpectIntEQ(wc_MlKemKey_Encapsulate(key, ct, ss, &rng), 0);
+    ExpectIntEQ(wc_MlKemKey_Decapsulate(key, ss2, ct, sizeof(ct)), 0);
+    ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+    ExpectIntEQ(wc_MlKemProfile_Get(&prof), 0);
+    ExpectTrue(prof.perms > perms);
+    ExpectTrue(prof.ticks[WC_MLKEM_PHASE_COMPRESS] > 0);
+
+    wc_MlKemProfile_Reset();
+    ExpectIntEQ(wc_MlKemProfile_Get(&prof), 0);
+    ExpectTrue(prof.perms == 0);
+    for (i = 0; i < WC_MLKEM_PHASE_CNT; i++) {
+        ExpectTrue(prof.ticks[i] == 0);
+    }
+    wc_MlKemProfile_SetClock(NULL);
+
+    wc_MlKemKey_Free(key);
+    XFREE(key, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    wc_FreeRng(&rng);
+#endif
+    return EXPECT_RESULT();
+}
+
+#ifdef WOLFSSL_MLKEM_PARALLEL
+/* Parallel callback for testing - runs the tasks in reverse order. */
+static int test_mlkem_parallel_cb(void* ctx, wc_MlKemTask task, void* arg,
+    int cnt)
+{
+    int* calls = (int*)ctx;
+    int i;
+
+    (*calls)++;
+    for (i = cnt - 1; i >= 0; i--) {
+        task(arg, i);
+    }
+    return 0;
+}
+
+/* Parallel callback for testing - doesn't run the last task. */
+static int test_mlkem_parallel_skip_cb(void* ctx, wc_MlKemTask task,
+    void* arg, int cnt)
+{
+    int i;
+
+    (void)ctx;
+    for (i = 0; i < cnt - 1; i++) {
+        task(arg, i);
+    }
+    return 0;
+}
+
+/* Parallel callback for testing - fails without running tasks. */
+static int test_mlkem_parallel_fail_cb(void* ctx, wc_MlKemTask task,
+    void* arg, int cnt)
+{
+    (void)ctx;
+    (void)task;
+    (void)arg;
+    (void)cnt;
+    return WC_NO_ERR_TRACE(BAD_STATE_E);
+}
+#endif
+
+int test_wc_mlkem_parallel(void)
+{
+    EXPECT_DECLS;
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    !defined(WOLFSSL_NO_ML_KEM) && !defined(WOLFSSL_NO_ML_KEM_1024) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+    MlKemKey* key = NULL;
+    MlKemKey* key2 = NULL;
+    byte* buf = NULL;
+    byte* buf2 = NULL;
+    byte rand[WC_ML_KEM_MAKEKEY_RAND_SZ];
+    byte ss[WC_ML_KEM_SS_SZ];
+    byte ss2[WC_ML_KEM_SS_SZ];
+#ifdef WOLFSSL_MLKEM_PARALLEL
+    int calls = 0;
+#endif
+
+    XMEMSET(rand, 0x5a, sizeof(rand));
+    ExpectNotNull(key = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(key2 = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(buf = (byte*)XMALLOC(WC_ML_KEM_1024_CIPHER_TEXT_SIZE, NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(buf2 = (byte*)XMALLOC(WC_ML_KEM_1024_CIPHER_TEXT_SIZE, NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectIntEQ(wc_MlKemKey_Init(key, WC_ML_KEM_1024, NULL, INVALID_DEVID), 0);
+    ExpectIntEQ(wc_MlKemKey_Init(key2, WC_ML_KEM_1024, NULL, INVALID_DEVID),
+        0);
+
+    ExpectIntEQ(wc_MlKemKey_SetParallelCb(NULL, NULL, NULL),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+#ifdef WOLFSSL_MLKEM_PARALLEL
+    ExpectIntEQ(wc_MlKemKey_SetParallelCb(key, test_mlkem_parallel_cb,
+        &calls), 0);
+
+    /* Same key and ciphertext as generating serially. */
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom(key, rand, sizeof(rand)), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom(key2, rand, sizeof(rand)), 0);
+    ExpectIntGT(calls, 0);
+    ExpectIntEQ(wc_MlKemKey_EncodePublicKey(key, buf,
+        WC_ML_KEM_1024_PUBLIC_KEY_SIZE), 0);
+    ExpectIntEQ(wc_MlKemKey_EncodePublicKey(key2, buf2,
+        WC_ML_KEM_1024_PUBLIC_KEY_SIZE), 0);
+    ExpectBufEQ(buf, buf2, WC_ML_KEM_1024_PUBLIC_KEY_SIZE);
+
+    calls = 0;
+    ExpectIntEQ(wc_MlKemKey_EncapsulateWithRandom(key, buf, ss, rand,
+        WC_ML_KEM_ENC_RAND_SZ), 0);
+    ExpectIntEQ(wc_MlKemKey_EncapsulateWithRandom(key2, buf2, ss2, rand,
+        WC_ML_KEM_ENC_RAND_SZ), 0);
+    ExpectIntGT(calls, 0);
+    ExpectBufEQ(buf, buf2, WC_ML_KEM_1024_CIPHER_TEXT_SIZE);
+    ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+    ExpectIntEQ(wc_MlKemKey_Decapsulate(key, ss2, buf,
+        WC_ML_KEM_1024_CIPHER_TEXT_SIZE), 0);
+    ExpectBufEQ(ss, ss2, WC_ML_KEM_SS_SZ);
+
+    /* Errors from callback and tasks not run are reported. */
+    ExpectIntEQ(wc_MlKemKey_SetParallelCb(key, test_mlkem_parallel_fail_cb,
+        NULL), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom(key, rand, sizeof(rand)),
+        WC_NO_ERR_TRACE(BAD_STATE_E));
+    ExpectIntEQ(wc_MlKemKey_SetParallelCb(key, test_mlkem_parallel_skip_cb,
+        NULL), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom(key, rand, sizeof(rand)),
+        WC_NO_ERR_TRACE(BAD_STATE_E));
+
+    /* Clearing callback generates serially again. */
+    ExpectIntEQ(wc_MlKemKey_SetParallelCb(key, NULL, NULL), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom(key, rand, sizeof(rand)), 0);
+#else
+    ExpectIntEQ(wc_MlKemKey_SetParallelCb(key, NULL, NULL),
+        WC_NO_ERR_TRACE(NOT_COMPILED_IN));
+#endif
+
+    wc_MlKemKey_Free(key2);
+    wc_MlKemKey_Free(key);
+    XFREE(buf2, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(buf, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key2, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    defined(USE_WOLFSSL_MEMORY) && !defined(WOLFSSL_STATIC_MEMORY) && \
+    !defined(WOLFSSL_DEBUG_MEMORY) && !defined(WOLFSSL_SMALL_STACK) && \
+    !defined(WOLFSSL_NO_MALLOC)
+    #define TEST_MLKEM_COUNT_ALLOCS
+/* Allocators in place before counting. */
+static wolfSSL_Malloc_cb test_mlkem_malloc_cb = NULL;
+static wolfSSL_Free_cb test_mlkem_free_cb = NULL;
+static wolfSSL_Realloc_cb test_mlkem_realloc_cb = NULL;
+/* Number of allocations made while counting. */
+static int test_mlkem_alloc_cnt = 0;
+
+static void* test_mlkem_count_malloc(size_t size)
+{
+    test_mlkem_alloc_cnt++;
+    return test_mlkem_malloc_cb(size);
+}
+
+static void* test_mlkem_count_realloc(void* ptr, size_t size)
+{
+    test_mlkem_alloc_cnt++;
+    return test_mlkem_realloc_cb(ptr, size);
+}
+#endif
+
+int test_wc_mlkem_scratch(void)
+{
+    EXPECT_DECLS;
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    !defined(WOLFSSL_NO_ML_KEM) && !defined(WOLFSSL_NO_ML_KEM_768) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+    WC_RNG rng;
+    MlKemKey* key = NULL;
+    MlKemKey* key2 = NULL;
+    byte* scratch = NULL;
+    byte* mem = NULL;
+    byte ct[WC_ML_KEM_768_CIPHER_TEXT_SIZE];
+    byte ct2[WC_ML_KEM_768_CIPHER_TEXT_SIZE];
+    byte rand[WC_ML_KEM_MAKEKEY_RAND_SZ];
+    byte ss[WC_ML_KEM_SS_SZ];
+    byte ss2[WC_ML_KEM_SS_SZ];
+    word32 sz = 0;
+    word32 sz1024 = 0;
+
+    XMEMSET(&rng, 0, sizeof(WC_RNG));
+    XMEMSET(rand, 0xa5, sizeof(rand));
+    ExpectIntEQ(wc_InitRng(&rng), 0);
+    ExpectNotNull(key = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectNotNull(key2 = (MlKemKey*)XMALLOC(sizeof(MlKemKey), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    ExpectIntEQ(wc_MlKemKey_Init(key, WC_ML_KEM_768, NULL, INVALID_DEVID), 0);
+    ExpectIntEQ(wc_MlKemKey_Init(key2, WC_ML_KEM_768, NULL, INVALID_DEVID), 0);
+
+    ExpectIntEQ(wc_MlKemKey_ScratchSize(NULL, &sz),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_ScratchSize(key, NULL),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_ScratchSize(key, &sz), 0);
+    ExpectIntGT(sz, 0);
+    ExpectIntEQ(sz % WC_ML_KEM_SCRATCH_ALIGN, 0);
+#ifndef WOLFSSL_NO_ML_KEM_1024
+    {
+        MlKemKey key1024;
+
+        ExpectIntEQ(wc_MlKemKey_Init(&key1024, WC_ML_KEM_1024, NULL,
+            INVALID_DEVID), 0);
+        ExpectIntEQ(wc_MlKemKey_ScratchSize(&key1024, &sz1024), 0);
+        ExpectIntGT(sz1024, sz);
+        wc_MlKemKey_Free(&key1024);
+    }
+#endif
+    (void)sz1024;
+
+    /* Allocate one extra byte and an alignment for testing. */
+    ExpectNotNull(mem = (byte*)XMALLOC(sz + 1 + WC_ML_KEM_SCRATCH_ALIGN, NULL,
+        DYNAMIC_TYPE_TMP_BUFFER));
+    if (mem != NULL) {
+        scratch = mem + WC_ML_KEM_SCRATCH_ALIGN - ((wc_ptr_t)mem %
+            WC_ML_KEM_SCRATCH_ALIGN);
+    }
+
+    /* Bad parameters. */
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom_ex(NULL, rand, sizeof(rand),
+        scratch, sz), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom_ex(key, rand, sizeof(rand),
+        scratch + 1, sz), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom_ex(key, rand, sizeof(rand),
+        scratch, sz - 1), WC_NO_ERR_TRACE(BUFFER_E));
+    ExpectIntEQ(wc_MlKemKey_MakeKey_ex(key, NULL, scratch, sz),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_Encapsulate_ex(NULL, ct, ss, &rng, scratch, sz),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_EncapsulateWithRandom_ex(key, ct, ss, rand,
+        WC_ML_KEM_ENC_RAND_SZ, scratch, sz - 1), WC_NO_ERR_TRACE(BUFFER_E));
+    ExpectIntEQ(wc_MlKemKey_Decapsulate_ex(NULL, ss, ct, sizeof(ct), scratch,
+        sz), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_MlKemKey_Decapsulate_ex(key, ss, ct, sizeof(ct),
+        scratch + 1, sz), WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    /* Same results as using dynamic memory. */
+    ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom(key2, rand, sizeof(rand)), 0);
+    ExpectIntEQ(wc_MlKemKey_EncapsulateWithRandom(key2, ct2, ss2, rand,
+        WC_ML_KEM_ENC_RAND_SZ), 0);
+    {
+    #ifdef TEST_MLKEM_COUNT_ALLOCS
+        ExpectIntEQ(wolfSSL_GetAllocators(&test_mlkem_malloc_cb,
+            &test_mlkem_free_cb, &test_mlkem_realloc_cb), 0);
+        test_mlkem_alloc_cnt = 0;
+        ExpectIntEQ(wolfSSL_SetAllocators(test_mlkem_count_malloc,
+            test_mlkem_free_cb, test_mlkem_count_realloc), 0);
+    #endif
+
+        ExpectIntEQ(wc_MlKemKey_MakeKeyWithRandom_ex(key, rand, sizeof(rand),
+            scratch, sz), 0);
+        ExpectIntEQ(wc_MlKemKey_EncapsulateWithRandom_ex(key, ct, ss, rand,
+            WC_ML_KEM_ENC_RAND_SZ, scratch, sz), 0);
+        ExpectBufEQ(ct, ct2, sizeof(ct));
+        ExpectBufEQ(ss, ss2, sizeof(ss));
+        ExpectIntEQ(wc_MlKemKey_Decapsulate_ex(key, ss2, ct, sizeof(ct),
+            scratch, sz), 0);
+        ExpectBufEQ(ss, ss2, sizeof(ss));
+        /* Implicit rejection the same as using dynamic memory. */
+        ct[0] ^= 0x01;
+        ExpectIntEQ(wc_MlKemKey_Decapsulate_ex(key, ss2, ct, sizeof(ct),
+            scratch, sz), 0);
+
+    #ifdef TEST_MLKEM_COUNT_ALLOCS
+        /* No dynamic memory used by operations with scratch memory. */
+        ExpectIntEQ(wolfSSL_SetAllocators(test_mlkem_malloc_cb,
+            test_mlkem_free_cb, test_mlkem_realloc_cb), 0);
+        ExpectIntEQ(test_mlkem_alloc_cnt, 0);
+    #endif
+    }
+    ExpectIntEQ(wc_MlKemKey_Decapsulate(key2, ss, ct, sizeof(ct)), 0);
+    ExpectBufEQ(ss, ss2, sizeof(ss));
+
+    /* Random number generator variants. */
+    ExpectIntEQ(wc_MlKemKey_Encapsulate_ex(key, ct, ss, &rng, scratch, sz), 0);
+    ExpectIntEQ(wc_MlKemKey_Decapsulate_ex(key, ss2, ct, sizeof(ct), scratch,
+        sz), 0);
+    ExpectBufEQ(ss, ss2, sizeof(ss));
+    ExpectIntEQ(wc_MlKemKey_MakeKey_ex(key, &rng, scratch, sz), 0);
+    ExpectIntEQ(wc_MlKemKey_MakeKey_ex(key, &rng, NULL, 0), 0);
+
+    XFREE(mem, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    wc_MlKemKey_Free(key2);
+    wc_MlKemKey_Free(key);
+    XFREE(key2, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(key, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    wc_FreeRng(&rng);
+#endif
+    return EXPECT_RESULT();
+}
@@ -27,10 +27,20 @@
 int test_wc_mlkem_make_key_kats(void);
 int test_wc_mlkem_encapsulate_kats(void);
 int test_wc_mlkem_decapsulate_kats(void);
+int test_wc_mlkem_batch(void);
+int test_wc_mlkem_matrix_cache(void);
+int test_wc_mlkem_profile(void);
+int test_wc_mlkem_parallel(void);
+int test_wc_mlkem_scratch(void);
 
 #define TEST_MLKEM_DECLS                                      \
     TEST_DECL_GROUP("mlkem", test_wc_mlkem_make_key_kats),    \
     TEST_DECL_GROUP("mlkem", test_wc_mlkem_encapsulate_kats), \
-    TEST_DECL_GROUP("mlkem", test_wc_mlkem_decapsulate_kats)
+    TEST_DECL_GROUP("mlkem", test_wc_mlkem_decapsulate_kats), \
+    TEST_DECL_GROUP("mlkem", test_wc_mlkem_batch),            \
+    TEST_DECL_GROUP("mlkem", test_wc_mlkem_matrix_cache),     \
+    TEST_DECL_GROUP("mlkem", test_wc_mlkem_profile),          \
+    TEST_DECL_GROUP("mlkem", test_wc_mlkem_parallel),         \
+    TEST_DECL_GROUP("mlkem", test_wc_mlkem_scratch)
 
 #endif /* WOLFCRYPT_TEST_MLKEM_H */
@@ -209,6 +209,108 @@ int test_wc_InitRngNonce_ex(void)
     return EXPECT_RESULT();
 }
 
+int test_wc_InitRngChild_ex(void)
+{
+    EXPECT_DECLS;
+#if !defined(WC_NO_RNG) && defined(HAVE_HASHDRBG) && !defined(HAVE_FIPS) && \
+    !defined(HAVE_SELFTEST) && !defined(CUSTOM_RAND_GENERATE_BLOCK)
+    WC_RNG parent;
+    WC_RNG child1;
+    WC_RNG child2;
+    byte   out1[32];
+    byte   out2[32];
+
+    XMEMSET(&parent, 0, sizeof(WC_RNG));
+    XMEMSET(&child1, 0, sizeof(WC_RNG));
+    XMEMSET(&child2, 0, sizeof(WC_RNG));
+
+    ExpectIntEQ(wc_InitRng_ex(&parent, HEAP_HINT, testDevId), 0);
+
+    /* Bad parameters. */
+    ExpectIntEQ(wc_InitRngChild_ex(NULL, &parent, HEAP_HINT, testDevId),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wc_InitRngChild_ex(&child1, NULL, HEAP_HINT, testDevId),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    /* Children of the same parent produce different streams. */
+    ExpectIntEQ(wc_InitRngChild_ex(&child1, &parent, HEAP_HINT, testDevId),
+        0);
+    ExpectIntEQ(wc_InitRngChild_ex(&child2, &parent, HEAP_HINT, testDevId),
+        0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(&child1, out1, sizeof(out1)), 0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(&child2, out2, sizeof(out2)), 0);
+    ExpectBufNE(out1, out2, sizeof(out1));
+
+    /* Child lives on after the parent is freed. */
+    ExpectIntEQ(wc_FreeRng(&parent), 0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(&child1, out2, sizeof(out2)), 0);
+    ExpectBufNE(out1, out2, sizeof(out1));
+
+    ExpectIntEQ(wc_FreeRng(&child2), 0);
+    ExpectIntEQ(wc_FreeRng(&child1), 0);
+#endif
+    return EXPECT_RESULT();
+}
+
+int test_wc_InitRngCtrDrbg_ex(void)
+{
+    EXPECT_DECLS;
+#if defined(WC_RNG_CTR_DRBG) && !defined(CUSTOM_RAND_GENERATE_BLOCK)
+    WC_RNG rng1;
+    WC_RNG rng2;
+    WC_RNG child;
+    byte   out1[32];
+    byte   out2[32];
+    byte   big[1024];
+    byte   entropy[16];
+    int    i;
+
+    XMEMSET(&rng1, 0, sizeof(WC_RNG));
+    XMEMSET(&rng2, 0, sizeof(WC_RNG));
+    XMEMSET(&child, 0, sizeof(WC_RNG));
+
+    /* Bad parameters. */
+    ExpectIntEQ(wc_InitRngCtrDrbg_ex(NULL, HEAP_HINT, testDevId),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    ExpectIntEQ(wc_InitRngCtrDrbg_ex(&rng1, HEAP_HINT, testDevId), 0);
+    ExpectIntEQ(wc_InitRngCtrDrbg_ex(&rng2, HEAP_HINT, testDevId), 0);
+
+    /* Separate instances produce different streams. */
+    ExpectIntEQ(wc_RNG_GenerateBlock(&rng1, out1, sizeof(out1)), 0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(&rng2, out2, sizeof(out2)), 0);
+    ExpectBufNE(out1, out2, sizeof(out1));
+
+    /* Small requests served from the buffer do not repeat across refills. */
+    for (i = 0; i < 64; i++) {
+        XMEMCPY(out2, out1, sizeof(out1));
+        ExpectIntEQ(wc_RNG_GenerateBlock(&rng1, out1, sizeof(out1)), 0);
+        ExpectBufNE(out1, out2, sizeof(out1));
+    }
+    /* Sizes that are not a multiple of the block size and large requests. */
+    for (i = 1; i <= 200; i += 7) {
+        ExpectIntEQ(wc_RNG_GenerateBlock(&rng1, big, (word32)i), 0);
+    }
+    ExpectIntEQ(wc_RNG_GenerateBlock(&rng1, big, sizeof(big)), 0);
+    ExpectIntEQ(wc_RNG_GenerateByte(&rng1, big), 0);
+
+    /* Reseed with caller entropy. */
+    XMEMSET(entropy, 0xa5, sizeof(entropy));
+    ExpectIntEQ(wc_RNG_DRBG_Reseed(&rng1, entropy, sizeof(entropy)), 0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(&rng1, out1, sizeof(out1)), 0);
+
+    /* A child of a CTR_DRBG parent works independently of it. */
+    ExpectIntEQ(wc_InitRngChild_ex(&child, &rng1, HEAP_HINT, testDevId), 0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(&child, out2, sizeof(out2)), 0);
+    ExpectBufNE(out1, out2, sizeof(out1));
+
+    ExpectIntEQ(wc_FreeRng(&child), 0);
+    ExpectIntEQ(wc_FreeRng(&rng2), 0);
+    ExpectIntEQ(wc_FreeRng(&rng1), 0);
+#endif
+    return EXPECT_RESULT();
+}
+
 int test_wc_GenerateSeed(void)
 {
     EXPECT_DECLS;
@@ -30,6 +30,8 @@ int test_wc_RNG_GenerateBlock(void);
 int test_wc_RNG_GenerateByte(void);
 int test_wc_InitRngNonce(void);
 int test_wc_InitRngNonce_ex(void);
+int test_wc_InitRngChild_ex(void);
+int test_wc_InitRngCtrDrbg_ex(void);
 int test_wc_GenerateSeed(void);
 int test_wc_rng_new(void);
 int test_wc_RNG_DRBG_Reseed(void);
@@ -43,6 +45,8 @@ int test_wc_RNG_HealthTest(void);
     TEST_DECL_GROUP("random", test_wc_RNG_GenerateByte),            \
     TEST_DECL_GROUP("random", test_wc_InitRngNonce),                \
     TEST_DECL_GROUP("random", test_wc_InitRngNonce_ex),             \
+    TEST_DECL_GROUP("random", test_wc_InitRngChild_ex),             \
+    TEST_DECL_GROUP("random", test_wc_InitRngCtrDrbg_ex),           \
     TEST_DECL_GROUP("random", test_wc_GenerateSeed),                \
     TEST_DECL_GROUP("random", test_wc_rng_new),                     \
     TEST_DECL_GROUP("random", test_wc_RNG_DRBG_Reseed),             \
@@ -28,6 +28,7 @@
     #include <wolfcrypt/src/misc.c>
 #endif
 
+#include <wolfssl/internal.h>
 #include <tests/utils.h>
 #include <tests/api/test_tls.h>
 
@@ -254,3 +255,1762 @@ int test_tls13_curve_intersection(void) {
 #endif
     return EXPECT_RESULT();
 }
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && !defined(NO_WRITEV) && \
+    !defined(USE_WINDOWS_API)
+/* Write header and body iovecs spanning several records and read back. */
+static int test_tls_writev_conn(method_provider method_c,
+    method_provider method_s, const char* cipher)
+{
+    EXPECT_DECLS;
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    static byte body[40000];
+    static byte readBuf[sizeof(body) + 64];
+    byte hdr[37];
+    byte tail[1] = { 0x5a };
+    struct iovec iov[4];
+    int total = (int)(sizeof(hdr) + sizeof(body) + sizeof(tail));
+    int readSz = 0;
+    int i;
+
+    for (i = 0; i < (int)sizeof(hdr); i++)
+        hdr[i] = (byte)('A' + i);
+    for (i = 0; i < (int)sizeof(body); i++)
+        body[i] = (byte)i;
+
+    iov[0].iov_base = hdr;
+    iov[0].iov_len = sizeof(hdr);
+    iov[1].iov_base = NULL;
+    iov[1].iov_len = 0;
+    iov[2].iov_base = body;
+    iov[2].iov_len = sizeof(body);
+    iov[3].iov_base = tail;
+    iov[3].iov_len = sizeof(tail);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    test_ctx.c_ciphers = test_ctx.s_ciphers = cipher;
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    method_c, method_s), 0);
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    /* All records go out with a single send. */
+    test_memio_clear_buffer(&test_ctx, 0);
+    ExpectIntEQ(wolfSSL_writev(ssl_c, iov, 4), total);
+#ifdef WOLFSSL_NATIVE_WRITEV
+    ExpectIntEQ(test_ctx.s_msg_count, 1);
+#endif
+    while (EXPECT_SUCCESS() && readSz < total) {
+        int ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        ExpectIntGT(ret, 0);
+        if (ret > 0)
+            readSz += ret;
+    }
+    ExpectIntEQ(readSz, total);
+    ExpectBufEQ(readBuf, hdr, sizeof(hdr));
+    ExpectBufEQ(readBuf + sizeof(hdr), body, sizeof(body));
+    ExpectIntEQ(readBuf[total - 1], tail[0]);
+
+    /* Retry after the transport would block sends the same data. */
+    test_ctx.s_len = TEST_MEMIO_BUF_SZ - 16;
+    ExpectIntEQ(wolfSSL_writev(ssl_c, iov, 4), WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_c, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_WRITE);
+    test_memio_clear_buffer(&test_ctx, 0);
+    ExpectIntEQ(wolfSSL_writev(ssl_c, iov, 4), total);
+    readSz = 0;
+    XMEMSET(readBuf, 0, sizeof(readBuf));
+    while (EXPECT_SUCCESS() && readSz < total) {
+        int ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        ExpectIntGT(ret, 0);
+        if (ret > 0)
+            readSz += ret;
+    }
+    ExpectIntEQ(readSz, total);
+    ExpectBufEQ(readBuf, hdr, sizeof(hdr));
+    ExpectBufEQ(readBuf + sizeof(hdr), body, sizeof(body));
+    ExpectIntEQ(readBuf[total - 1], tail[0]);
+
+    /* Nothing to write. */
+    ExpectIntEQ(wolfSSL_writev(ssl_c, iov, 0), 0);
+    ExpectIntEQ(wolfSSL_writev(NULL, iov, 4), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_writev(ssl_c, NULL, 1), BAD_FUNC_ARG);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+
+    return EXPECT_RESULT();
+}
+#endif
+
+int test_tls_writev(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && !defined(NO_WRITEV) && \
+    !defined(USE_WINDOWS_API)
+#ifdef WOLFSSL_TLS13
+    ExpectIntEQ(test_tls_writev_conn(wolfTLSv1_3_client_method,
+        wolfTLSv1_3_server_method, NULL), TEST_SUCCESS);
+#endif
+#if !defined(WOLFSSL_NO_TLS12) && defined(HAVE_ECC) && !defined(NO_RSA)
+#if defined(HAVE_AESGCM) && defined(WOLFSSL_AES_128)
+    ExpectIntEQ(test_tls_writev_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-AES128-GCM-SHA256"),
+        TEST_SUCCESS);
+#endif
+#if defined(HAVE_CHACHA) && defined(HAVE_POLY1305)
+    ExpectIntEQ(test_tls_writev_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-CHACHA20-POLY1305"),
+        TEST_SUCCESS);
+#endif
+#if defined(HAVE_AES_CBC) && defined(WOLFSSL_AES_128) && \
+    !defined(WOLFSSL_AEAD_ONLY) && !defined(NO_SHA256)
+    ExpectIntEQ(test_tls_writev_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-AES128-SHA256"),
+        TEST_SUCCESS);
+#endif
+#endif
+#endif
+    return EXPECT_RESULT();
+}
+
+int test_tls_read_zc(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    static byte msg[20000];
+    byte readBuf[64];
+    const unsigned char* data = NULL;
+    const unsigned char* first = NULL;
+    int len = 0;
+    int readSz = 0;
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 7);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    ExpectIntEQ(wolfSSL_read_zc(NULL, &data), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_read_zc(ssl_s, NULL), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_read_release(NULL, 0), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_read_release(ssl_s, -1), BAD_FUNC_ARG);
+
+    /* Nothing received yet. */
+    ExpectIntEQ(wolfSSL_read_zc(ssl_s, &data), WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_READ);
+    ExpectIntEQ(wolfSSL_read_release(ssl_s, 1), BAD_FUNC_ARG);
+
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+
+    /* Data returned in place and not consumed until released. */
+    ExpectIntGT(len = wolfSSL_read_zc(ssl_s, &first), 0);
+    ExpectIntLT(len, (int)sizeof(msg));
+    ExpectBufEQ(first, msg, len);
+    ExpectIntEQ(wolfSSL_read_zc(ssl_s, &data), len);
+    ExpectPtrEq(data, first);
+    ExpectIntEQ(wolfSSL_read_release(ssl_s, len + 1), BAD_FUNC_ARG);
+
+    /* Partial release leaves the remainder for any read call. */
+    ExpectIntEQ(wolfSSL_read_release(ssl_s, 100), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_read_zc(ssl_s, &data), len - 100);
+    ExpectPtrEq(data, first + 100);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        (int)sizeof(readBuf));
+    ExpectBufEQ(readBuf, msg + 100, sizeof(readBuf));
+    readSz = 100 + (int)sizeof(readBuf);
+    ExpectIntEQ(wolfSSL_read_zc(ssl_s, &data), len - readSz);
+    ExpectIntEQ(wolfSSL_read_release(ssl_s, len - readSz), WOLFSSL_SUCCESS);
+    readSz = len;
+
+    /* Next record. */
+    while (EXPECT_SUCCESS() && readSz < (int)sizeof(msg)) {
+        ExpectIntGT(len = wolfSSL_read_zc(ssl_s, &data), 0);
+        if (EXPECT_SUCCESS()) {
+            ExpectIntLE(len, (int)sizeof(msg) - readSz);
+            ExpectBufEQ(data, msg + readSz, len);
+            ExpectIntEQ(wolfSSL_read_release(ssl_s, len), WOLFSSL_SUCCESS);
+            readSz += len;
+        }
+    }
+    ExpectIntEQ(readSz, (int)sizeof(msg));
+    ExpectIntEQ(wolfSSL_read_release(ssl_s, 1), BAD_FUNC_ARG);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && defined(WOLFSSL_KTLS)
+#include <fcntl.h>
+#include <poll.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+/* Connected pair of non-blocking TCP sockets over loopback. */
+static int test_tls_ktls_sockets(int* sc, int* ss)
+{
+    EXPECT_DECLS;
+    struct sockaddr_in addr;
+    socklen_t len = (socklen_t)sizeof(addr);
+    int lfd = -1;
+
+    *sc = *ss = -1;
+    XMEMSET(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    ExpectIntGE(lfd = socket(AF_INET, SOCK_STREAM, 0), 0);
+    ExpectIntEQ(bind(lfd, (struct sockaddr*)&addr, len), 0);
+    ExpectIntEQ(listen(lfd, 1), 0);
+    ExpectIntEQ(getsockname(lfd, (struct sockaddr*)&addr, &len), 0);
+    ExpectIntGE(*sc = socket(AF_INET, SOCK_STREAM, 0), 0);
+    ExpectIntEQ(connect(*sc, (struct sockaddr*)&addr, len), 0);
+    ExpectIntGE(*ss = accept(lfd, NULL, NULL), 0);
+    ExpectIntEQ(fcntl(*sc, F_SETFL, O_NONBLOCK), 0);
+    ExpectIntEQ(fcntl(*ss, F_SETFL, O_NONBLOCK), 0);
+    if (lfd >= 0)
+        close(lfd);
+
+    return EXPECT_RESULT();
+}
+
+/* Wait a little for data to arrive on the socket of ssl. */
+static void test_tls_ktls_wait(WOLFSSL* ssl)
+{
+    struct pollfd pfd;
+
+    pfd.fd = wolfSSL_get_fd(ssl);
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    (void)poll(&pfd, 1, 10);
+}
+
+/* Write all of msg with one object and read it all with the other. */
+static int test_tls_ktls_xfer(WOLFSSL* ssl_w, WOLFSSL* ssl_r, const byte* msg,
+    int sz)
+{
+    EXPECT_DECLS;
+    static byte readBuf[40000];
+    int written = 0;
+    int readSz = 0;
+    int i;
+
+    for (i = 0; EXPECT_SUCCESS() && readSz < sz && i < 1000; i++) {
+        int ret;
+
+        if (written < sz) {
+            ret = wolfSSL_write(ssl_w, msg + written, sz - written);
+            if (ret > 0)
+                written += ret;
+            else
+                ExpectIntEQ(wolfSSL_get_error(ssl_w, ret),
+                    WOLFSSL_ERROR_WANT_WRITE);
+        }
+        ret = wolfSSL_read(ssl_r, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        if (ret > 0) {
+            readSz += ret;
+        }
+        else {
+            ExpectIntEQ(wolfSSL_get_error(ssl_r, ret),
+                WOLFSSL_ERROR_WANT_READ);
+            test_tls_ktls_wait(ssl_r);
+        }
+    }
+    ExpectIntEQ(readSz, sz);
+    ExpectBufEQ(readBuf, msg, sz);
+
+    return EXPECT_RESULT();
+}
+
+/* Handshake in software over real sockets, then offload to the kernel where
+ * it supports the "tls" ULP and check the traffic still flows. */
+static int test_tls_ktls_conn(method_provider method_c,
+    method_provider method_s, const char* cipher, int offload)
+{
+    EXPECT_DECLS;
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    static byte msg[30000];
+    byte readBuf[16];
+    int sc = -1, ss = -1;
+    int retC = 0, retS = 0;
+    int dirs = 0;
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 13);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    test_ctx.c_ciphers = test_ctx.s_ciphers = cipher;
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    method_c, method_s), 0);
+    ExpectIntEQ(test_tls_ktls_sockets(&sc, &ss), TEST_SUCCESS);
+    wolfSSL_SSLSetIORecv(ssl_c, EmbedReceive);
+    wolfSSL_SSLSetIOSend(ssl_c, EmbedSend);
+    wolfSSL_SSLSetIORecv(ssl_s, EmbedReceive);
+    wolfSSL_SSLSetIOSend(ssl_s, EmbedSend);
+    ExpectIntEQ(wolfSSL_set_fd(ssl_c, sc), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_set_fd(ssl_s, ss), WOLFSSL_SUCCESS);
+
+    ExpectIntEQ(wolfSSL_CTX_UseKTLS(ctx_c, 0x4), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_UseKTLS(NULL, WOLFSSL_KTLS_TX), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_GetKTLS(NULL), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_UseKTLS(ssl_c, WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX),
+        WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_UseKTLS(ssl_s, WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX),
+        WOLFSSL_SUCCESS);
+
+    for (i = 0; EXPECT_SUCCESS() && (retC != 1 || retS != 1) && i < 1000;
+            i++) {
+        if (retC != 1 && (retC = wolfSSL_connect(ssl_c)) != 1) {
+            int err = wolfSSL_get_error(ssl_c, retC);
+            ExpectTrue(err == WOLFSSL_ERROR_WANT_READ ||
+                       err == WOLFSSL_ERROR_WANT_WRITE);
+            if (retS == 1)
+                test_tls_ktls_wait(ssl_c);
+        }
+        if (retS != 1 && (retS = wolfSSL_accept(ssl_s)) != 1) {
+            int err = wolfSSL_get_error(ssl_s, retS);
+            ExpectTrue(err == WOLFSSL_ERROR_WANT_READ ||
+                       err == WOLFSSL_ERROR_WANT_WRITE);
+            test_tls_ktls_wait(ssl_s);
+        }
+    }
+    ExpectIntEQ(retC, 1);
+    ExpectIntEQ(retS, 1);
+    /* Nothing handed over until the first read or write. */
+    ExpectIntEQ(wolfSSL_GetKTLS(ssl_c), 0);
+
+    ExpectIntEQ(test_tls_ktls_xfer(ssl_c, ssl_s, msg, (int)sizeof(msg)),
+        TEST_SUCCESS);
+    ExpectIntEQ(test_tls_ktls_xfer(ssl_s, ssl_c, msg, (int)sizeof(msg)),
+        TEST_SUCCESS);
+
+    /* Both directions of both ends, or none when the kernel lacks kTLS. */
+    dirs = wolfSSL_GetKTLS(ssl_c);
+    if (!offload)
+        ExpectIntEQ(dirs, 0);
+    else
+        ExpectTrue(dirs == 0 || dirs == (WOLFSSL_KTLS_TX | WOLFSSL_KTLS_RX));
+    ExpectIntEQ(wolfSSL_GetKTLS(ssl_s), dirs);
+
+#ifdef WOLFSSL_TLS13
+    /* New keys in both directions reach the kernel. */
+    if (EXPECT_SUCCESS() && wolfSSL_version(ssl_c) == TLS1_3_VERSION) {
+        ExpectIntEQ(wolfSSL_update_keys(ssl_c), WOLFSSL_SUCCESS);
+        ExpectIntEQ(test_tls_ktls_xfer(ssl_c, ssl_s, msg, 1000),
+            TEST_SUCCESS);
+        ExpectIntEQ(test_tls_ktls_xfer(ssl_s, ssl_c, msg, 1000),
+            TEST_SUCCESS);
+        ExpectIntEQ(test_tls_ktls_xfer(ssl_c, ssl_s, msg, 1000),
+            TEST_SUCCESS);
+    }
+#endif
+
+    if (dirs == 0) {
+        ExpectIntEQ(wolfSSL_sendfile(ssl_c, 0, 0, 1), BAD_STATE_E);
+    }
+    else {
+        FILE* f = NULL;
+        off_t off = 0;
+        int readSz = 0;
+
+        ExpectNotNull(f = tmpfile());
+        ExpectIntEQ(fwrite(msg, 1, sizeof(msg), f), sizeof(msg));
+        ExpectIntEQ(fflush(f), 0);
+        ExpectIntEQ(wolfSSL_sendfile(ssl_c, -1, 0, 1), BAD_FUNC_ARG);
+        while (EXPECT_SUCCESS() && off < (off_t)sizeof(msg)) {
+            int ret = wolfSSL_sendfile(ssl_c, fileno(f), off,
+                sizeof(msg) - (size_t)off);
+            if (ret > 0)
+                off += ret;
+            else
+                ExpectIntEQ(wolfSSL_get_error(ssl_c, ret),
+                    WOLFSSL_ERROR_WANT_WRITE);
+            for (i = 0; EXPECT_SUCCESS() && readSz < (int)off && i < 1000;
+                    i++) {
+                ret = wolfSSL_read(ssl_s, readBuf, sizeof(readBuf));
+                if (ret > 0) {
+                    ExpectBufEQ(readBuf, msg + readSz, ret);
+                    readSz += ret;
+                }
+                else {
+                    test_tls_ktls_wait(ssl_s);
+                }
+            }
+        }
+        ExpectIntEQ(readSz, (int)sizeof(msg));
+        if (f != NULL)
+            fclose(f);
+    }
+
+    /* close_notify is an alert record through the kernel. */
+    ExpectIntEQ(wolfSSL_shutdown(ssl_c), WOLFSSL_SHUTDOWN_NOT_DONE);
+    for (i = 0; EXPECT_SUCCESS() && i < 1000; i++) {
+        if (wolfSSL_read(ssl_s, readBuf, sizeof(readBuf)) == 0)
+            break;
+        test_tls_ktls_wait(ssl_s);
+    }
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, 0), WOLFSSL_ERROR_ZERO_RETURN);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+    if (sc >= 0)
+        close(sc);
+    if (ss >= 0)
+        close(ss);
+
+    return EXPECT_RESULT();
+}
+#endif
+
+int test_tls_ktls(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && defined(WOLFSSL_KTLS)
+#if defined(WOLFSSL_TLS13) && defined(HAVE_AESGCM)
+    ExpectIntEQ(test_tls_ktls_conn(wolfTLSv1_3_client_method,
+        wolfTLSv1_3_server_method, "TLS13-AES128-GCM-SHA256", 1),
+        TEST_SUCCESS);
+#endif
+#if !defined(WOLFSSL_NO_TLS12) && defined(HAVE_ECC) && !defined(NO_RSA)
+#if defined(HAVE_AESGCM) && defined(WOLFSSL_AES_256)
+    ExpectIntEQ(test_tls_ktls_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-AES256-GCM-SHA384", 1),
+        TEST_SUCCESS);
+#endif
+#if defined(HAVE_CHACHA) && defined(HAVE_POLY1305)
+    ExpectIntEQ(test_tls_ktls_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-CHACHA20-POLY1305", 1),
+        TEST_SUCCESS);
+#endif
+#if defined(HAVE_AES_CBC) && defined(WOLFSSL_AES_128) && \
+    !defined(WOLFSSL_AEAD_ONLY) && !defined(NO_SHA256)
+    /* CBC stays in software. */
+    ExpectIntEQ(test_tls_ktls_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-AES128-SHA256", 0),
+        TEST_SUCCESS);
+#endif
+#endif
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES)
+static int test_tls_read_ahead_recvs = 0;
+
+/* Count the reads from the transport. */
+static int test_tls_read_ahead_recv_cb(WOLFSSL* ssl, char* buf, int sz,
+    void* ctx)
+{
+    test_tls_read_ahead_recvs++;
+    return test_memio_read_cb(ssl, buf, sz, ctx);
+}
+
+/* Join the records written to the server into one message, as a TCP stream
+ * would deliver them. */
+static void test_tls_read_ahead_stream(struct test_memio_ctx* test_ctx)
+{
+    test_ctx->s_msg_sizes[0] = test_ctx->s_len;
+    test_ctx->s_msg_count = (test_ctx->s_len > 0) ? 1 : 0;
+    test_ctx->s_msg_pos = 0;
+}
+#endif
+
+int test_tls_read_ahead(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    byte msg[1000];
+    byte readBuf[8000];
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 3);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+
+    ExpectIntEQ(wolfSSL_CTX_SetReadAheadSz(NULL, 0), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_CTX_SetReadAheadSz(ctx_s,
+        WOLFSSL_READ_AHEAD_MAX_SZ + 1), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_CTX_SetReadAheadSz(ctx_s, 0), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_SetReadAheadSz(NULL, 0), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_SetReadAheadSz(ssl_s, WOLFSSL_READ_AHEAD_MAX_SZ + 1),
+        BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_SetReadAheadSz(ssl_s, WOLFSSL_READ_AHEAD_SZ),
+        WOLFSSL_SUCCESS);
+
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+    wolfSSL_SSLSetIORecv(ssl_s, test_tls_read_ahead_recv_cb);
+
+    /* One read from the transport for all the records. */
+    for (i = 0; i < 4; i++)
+        ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)),
+            (int)sizeof(msg));
+    test_tls_read_ahead_stream(&test_ctx);
+    test_tls_read_ahead_recvs = 0;
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        4 * (int)sizeof(msg));
+    ExpectIntEQ(test_tls_read_ahead_recvs, 1);
+    for (i = 0; i < 4; i++)
+        ExpectBufEQ(readBuf + i * (int)sizeof(msg), msg, sizeof(msg));
+    /* The drained input buffer is freed. */
+    if (ssl_s != NULL)
+        ExpectIntEQ(ssl_s->buffers.inputBuffer.dynamicFlag, 0);
+
+    /* Records left in the input buffer serve later reads. */
+    for (i = 0; i < 3; i++)
+        ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)),
+            (int)sizeof(msg));
+    test_tls_read_ahead_stream(&test_ctx);
+    test_tls_read_ahead_recvs = 0;
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, 1500), 1500);
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+    ExpectBufEQ(readBuf + sizeof(msg), msg, 500);
+    ExpectIntEQ(wolfSSL_pending(ssl_s), 500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1500);
+    ExpectBufEQ(readBuf, msg + 500, 500);
+    ExpectBufEQ(readBuf + 500, msg, sizeof(msg));
+    ExpectIntEQ(test_tls_read_ahead_recvs, 1);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_READ);
+
+    /* Without read ahead, header and body are read separately. */
+    ExpectIntEQ(wolfSSL_SetReadAheadSz(ssl_s, 0), WOLFSSL_SUCCESS);
+    for (i = 0; i < 2; i++)
+        ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)),
+            (int)sizeof(msg));
+    test_tls_read_ahead_stream(&test_ctx);
+    test_tls_read_ahead_recvs = 0;
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        (int)sizeof(msg));
+    ExpectIntEQ(test_tls_read_ahead_recvs, 2);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        (int)sizeof(msg));
+    ExpectIntEQ(test_tls_read_ahead_recvs, 4);
+
+    /* close_notify read ahead is reported after the data before it. */
+    ExpectIntEQ(wolfSSL_SetReadAheadSz(ssl_s, WOLFSSL_READ_AHEAD_SZ),
+        WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+    ExpectIntEQ(wolfSSL_shutdown(ssl_c), WOLFSSL_SHUTDOWN_NOT_DONE);
+    test_tls_read_ahead_stream(&test_ctx);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        (int)sizeof(msg));
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 0);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, 0), WOLFSSL_ERROR_ZERO_RETURN);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES)
+/* Write data spanning several records and read it back.
+ * When paired, records are encrypted and sent two at a time. */
+static int test_tls_send_batch_conn(method_provider method_c,
+    method_provider method_s, const char* cipher, int paired)
+{
+    EXPECT_DECLS;
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    static byte msg[40000];
+    static byte readBuf[sizeof(msg)];
+    int recCnt = (int)((sizeof(msg) + MAX_RECORD_SIZE - 1) / MAX_RECORD_SIZE);
+    int readSz = 0;
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 5);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    test_ctx.c_ciphers = test_ctx.s_ciphers = cipher;
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    method_c, method_s), 0);
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    /* All records go out with a single send when batching every write. */
+    test_memio_clear_buffer(&test_ctx, 0);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+#ifdef WOLFSSL_SEND_BATCH_ALL
+    ExpectIntEQ(test_ctx.s_msg_count, 1);
+    (void)recCnt;
+    (void)paired;
+#else
+    ExpectIntEQ(test_ctx.s_msg_count, paired ? (recCnt + 1) / 2 : recCnt);
+#endif
+    while (EXPECT_SUCCESS() && readSz < (int)sizeof(msg)) {
+        int ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        ExpectIntGT(ret, 0);
+        if (ret > 0)
+            readSz += ret;
+    }
+    ExpectIntEQ(readSz, (int)sizeof(msg));
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+
+    /* Retry after the transport would block sends the same data. */
+    test_ctx.s_len = TEST_MEMIO_BUF_SZ - 16;
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)),
+        WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_c, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_WRITE);
+    test_memio_clear_buffer(&test_ctx, 0);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+    readSz = 0;
+    XMEMSET(readBuf, 0, sizeof(readBuf));
+    while (EXPECT_SUCCESS() && readSz < (int)sizeof(msg)) {
+        int ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        ExpectIntGT(ret, 0);
+        if (ret > 0)
+            readSz += ret;
+    }
+    ExpectIntEQ(readSz, (int)sizeof(msg));
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+
+    return EXPECT_RESULT();
+}
+#endif
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_NATIVE_WRITEV) && defined(HAVE_PK_CALLBACKS) && \
+    defined(WOLFSSL_TLS13) && defined(HAVE_AESGCM) && defined(WOLFSSL_AES_128)
+#define TEST_TLS_SEND_BATCH_FAIL
+static int test_tls_send_batch_encrypts;
+
+/* Encrypt the first record in software and fail the next one. */
+static int test_tls_send_batch_fail_cb(WOLFSSL* ssl, int is_encrypt,
+    byte* out, const byte* in, word32 sz, const byte* iv, word32 ivSz,
+    byte* authTag, word32 authTagSz, const byte* authIn, word32 authInSz)
+{
+    (void)ssl;
+    (void)out;
+    (void)in;
+    (void)sz;
+    (void)iv;
+    (void)ivSz;
+    (void)authTag;
+    (void)authTagSz;
+    (void)authIn;
+    (void)authInSz;
+
+    if (is_encrypt && (test_tls_send_batch_encrypts++ > 0))
+        return WC_FAILURE;
+    return WC_NO_ERR_TRACE(NOT_COMPILED_IN);
+}
+
+/* Encryption failing part way through a batch ends the connection. */
+static int test_tls_send_batch_fail(void)
+{
+    EXPECT_DECLS;
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    static byte msg[40000];
+    struct iovec iov[1];
+    byte readBuf[16];
+
+    XMEMSET(msg, 0x3c, sizeof(msg));
+    iov[0].iov_base = msg;
+    iov[0].iov_len = sizeof(msg);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    test_ctx.c_ciphers = test_ctx.s_ciphers = "TLS13-AES128-GCM-SHA256";
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfTLSv1_3_client_method, wolfTLSv1_3_server_method), 0);
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    /* Second record of the batch fails to encrypt. */
+    test_tls_send_batch_encrypts = 0;
+    wolfSSL_CTX_SetPerformTlsRecordProcessingCb(ctx_c,
+        test_tls_send_batch_fail_cb);
+    test_memio_clear_buffer(&test_ctx, 0);
+    ExpectIntLT(wolfSSL_writev(ssl_c, iov, 1), 0);
+    ExpectIntEQ(test_tls_send_batch_encrypts, 2);
+    ExpectIntEQ(test_ctx.s_msg_count, 0);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_READ);
+
+    /* No records are sent after the gap in sequence numbers. */
+    wolfSSL_CTX_SetPerformTlsRecordProcessingCb(ctx_c, NULL);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 100), WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_c, WOLFSSL_FATAL_ERROR),
+        WC_NO_ERR_TRACE(BUILD_MSG_ERROR));
+    ExpectIntEQ(test_ctx.s_msg_count, 0);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+
+    return EXPECT_RESULT();
+}
+#endif
+
+int test_tls_send_batch(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES)
+#if defined(WOLFSSL_TLS13) && defined(HAVE_AESGCM) && \
+    defined(WOLFSSL_AES_128)
+    ExpectIntEQ(test_tls_send_batch_conn(wolfTLSv1_3_client_method,
+        wolfTLSv1_3_server_method, "TLS13-AES128-GCM-SHA256",
+    #ifdef WOLFSSL_SEND_GCM_RECORDS
+        1
+    #else
+        0
+    #endif
+        ), TEST_SUCCESS);
+#endif
+#if !defined(WOLFSSL_NO_TLS12) && defined(HAVE_ECC) && !defined(NO_RSA)
+#if defined(HAVE_AESGCM) && defined(WOLFSSL_AES_256) && defined(WOLFSSL_SHA384)
+    ExpectIntEQ(test_tls_send_batch_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-AES256-GCM-SHA384", 0),
+        TEST_SUCCESS);
+#endif
+#if defined(HAVE_AES_CBC) && defined(WOLFSSL_AES_128) && \
+    !defined(WOLFSSL_AEAD_ONLY) && !defined(NO_SHA256)
+    ExpectIntEQ(test_tls_send_batch_conn(wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method, "ECDHE-RSA-AES128-SHA256", 0),
+        TEST_SUCCESS);
+#endif
+#endif
+#endif
+#ifdef TEST_TLS_SEND_BATCH_FAIL
+    ExpectIntEQ(test_tls_send_batch_fail(), TEST_SUCCESS);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    !defined(NO_ASN_TIME) && !defined(NO_ASN) && !defined(USER_TICKS)
+#define TEST_TLS_DYN_RECORD_CLOCK
+static time_t test_tls_dyn_record_now;
+
+static time_t test_tls_dyn_record_time_cb(time_t* t)
+{
+    if (t != NULL)
+        *t = test_tls_dyn_record_now;
+    return test_tls_dyn_record_now;
+}
+#endif
+
+int test_tls_dyn_record(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    static byte msg[5000];
+    static byte readBuf[sizeof(msg)];
+    const int recSz[] = { 1000, 1000, 1000, 2000 };
+    int readSz = 0;
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 11);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+
+    ExpectIntEQ(wolfSSL_CTX_SetDynamicRecordSize(NULL, 1000, 3000, 0),
+        BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_CTX_SetDynamicRecordSize(ctx_c, MAX_RECORD_SIZE + 1,
+        3000, 0), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_CTX_SetDynamicRecordSize(ctx_c,
+        WOLFSSL_DYN_REC_SMALL_SZ, WOLFSSL_DYN_REC_RAMP_SZ,
+        WOLFSSL_DYN_REC_IDLE_SEC), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_SetDynamicRecordSize(NULL, 1000, 3000, 0),
+        BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_SetDynamicRecordSize(ssl_c, 1000, WOLFSSL_MAX_32BIT,
+        0), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_SetDynamicRecordSize(ssl_c, 1000, 3000, 0),
+        WOLFSSL_SUCCESS);
+
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    /* Small records until the ramp up is done, then full sized ones. */
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+    for (i = 0; i < (int)(sizeof(recSz) / sizeof(*recSz)); i++) {
+        ExpectIntEQ(wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz), recSz[i]);
+        readSz += recSz[i];
+    }
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+
+    /* Idle connection starts with small records again. */
+    ExpectIntEQ(wolfSSL_SetDynamicRecordSize(ssl_c, 1000, 3000, 3600),
+        WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 1500), 1500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1000);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 500);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 2500), 2500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1000);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1000);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 500);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 1500), 1500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1500);
+#ifdef TEST_TLS_DYN_RECORD_CLOCK
+    /* An hour later. */
+    test_tls_dyn_record_now = wc_Time(NULL) + 3600;
+    ExpectIntEQ(wc_SetTimeCb(test_tls_dyn_record_time_cb), 0);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 1500), 1500);
+    ExpectIntEQ(wc_SetTimeCb(NULL), 0);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1000);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 500);
+#endif
+
+    /* Turned off. */
+    ExpectIntEQ(wolfSSL_SetDynamicRecordSize(ssl_c, 0, 0, 0),
+        WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 1500), 1500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1500);
+
+    wolfSSL_free(ssl_c);
+    ssl_c = NULL;
+    wolfSSL_free(ssl_s);
+    ssl_s = NULL;
+    wolfSSL_CTX_free(ctx_c);
+    ctx_c = NULL;
+    wolfSSL_CTX_free(ctx_s);
+    ctx_s = NULL;
+
+#if defined(HAVE_SECURE_RENEGOTIATION) && !defined(WOLFSSL_NO_TLS12)
+    /* Small records again after a renegotiation. */
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+        wolfTLSv1_2_client_method, wolfTLSv1_2_server_method), 0);
+    ExpectIntEQ(wolfSSL_UseSecureRenegotiation(ssl_c), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_UseSecureRenegotiation(ssl_s), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_SetDynamicRecordSize(ssl_c, 1000, 3000, 0),
+        WOLFSSL_SUCCESS);
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 3000), 3000);
+    for (i = 0; i < 3; i++) {
+        ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+            1000);
+    }
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 1500), 1500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1500);
+    ExpectIntEQ(wolfSSL_Rehandshake(ssl_s),
+        WC_NO_ERR_TRACE(WOLFSSL_FATAL_ERROR));
+    ExpectIntEQ(wolfSSL_read(ssl_c, readBuf, (int)sizeof(readBuf)),
+        WC_NO_ERR_TRACE(WOLFSSL_FATAL_ERROR));
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, 1500), 1500);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 1000);
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)), 500);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+#endif
+    return EXPECT_RESULT();
+}
+
+int test_tls_io_pool(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && defined(WOLFSSL_IO_POOL)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL, *ctx_x = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    WOLFSSL_IO_POOL_STATS stats;
+    static byte msg[20000];
+    static byte readBuf[sizeof(msg)];
+    unsigned long gets = 0;
+    int readSz = 0;
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 13);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+
+    ExpectIntEQ(wolfSSL_CTX_UseIOPool(NULL, 16), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(NULL, &stats), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, NULL), BAD_FUNC_ARG);
+    /* No pool yet. */
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntEQ(stats.gets, 0);
+    ExpectIntEQ(wolfSSL_CTX_UseIOPool(ctx_s, 16), WOLFSSL_SUCCESS);
+
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    /* Buffers are borrowed for the handshake and all given back. */
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntGT(stats.gets, 0);
+    ExpectIntEQ(stats.inUse, 0);
+    ExpectIntEQ(stats.inUseBytes, 0);
+    ExpectIntGT(stats.free, 0);
+    ExpectIntGT(stats.freeBytes, 0);
+    gets = stats.gets;
+
+    /* Data both ways reuses the pooled buffers. */
+    ExpectIntEQ(wolfSSL_SetReadAheadSz(ssl_s, WOLFSSL_READ_AHEAD_SZ),
+        WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+    while (EXPECT_SUCCESS() && readSz < (int)sizeof(msg)) {
+        int ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        ExpectIntGT(ret, 0);
+        if (ret > 0)
+            readSz += ret;
+    }
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+    ExpectIntEQ(wolfSSL_write(ssl_s, msg, (int)sizeof(msg)), (int)sizeof(msg));
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntGT(stats.gets, gets);
+    ExpectIntGT(stats.hits, 0);
+    ExpectIntEQ(stats.inUse, 0);
+
+    /* An idle connection waiting for data holds no buffer. */
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf)),
+        WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_READ);
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntEQ(stats.inUse, 0);
+    ExpectIntEQ(stats.inUseBytes, 0);
+
+    /* Turning the pool off frees the buffers in it. */
+    ExpectIntEQ(wolfSSL_CTX_UseIOPool(ctx_s, 0), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntEQ(stats.free, 0);
+    ExpectIntEQ(stats.freeBytes, 0);
+    ExpectIntEQ(wolfSSL_CTX_UseIOPool(ctx_s, 16), WOLFSSL_SUCCESS);
+
+#if defined(OPENSSL_ALL) || defined(OPENSSL_EXTRA)
+    /* Buffers held when moving to another CTX are not given back to either
+     * pool - the old CTX may be freed first. */
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, (int)sizeof(msg)), (int)sizeof(msg));
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, 100), 100);
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntGT(stats.inUse, 0);
+    ExpectNotNull(ctx_x = wolfSSL_CTX_new(wolfSSLv23_server_method()));
+    ExpectIntEQ(wolfSSL_CTX_UseIOPool(ctx_x, 16), WOLFSSL_SUCCESS);
+    ExpectTrue(wolfSSL_set_SSL_CTX(ssl_s, ctx_x) == ctx_x);
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_s, &stats), WOLFSSL_SUCCESS);
+    ExpectIntEQ(stats.inUse, 0);
+    wolfSSL_CTX_free(ctx_s);
+    ctx_s = NULL;
+    readSz = 100;
+    while (EXPECT_SUCCESS() && readSz < (int)sizeof(msg)) {
+        int ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        ExpectIntGT(ret, 0);
+        if (ret > 0)
+            readSz += ret;
+    }
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+    ExpectIntEQ(wolfSSL_CTX_GetIOPoolStats(ctx_x, &stats), WOLFSSL_SUCCESS);
+    ExpectIntEQ(stats.inUse, 0);
+    ExpectIntLE(stats.free, stats.gets);
+#endif
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+    wolfSSL_CTX_free(ctx_x);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && defined(WOLFSSL_IO_URING)
+#include <sys/socket.h>
+
+/* Drive the objects the ring reports ready until both handshakes finish. */
+static int test_tls_io_uring_handshake(WOLFSSL_URING* ring, WOLFSSL* ssl_c,
+    WOLFSSL* ssl_s)
+{
+    EXPECT_DECLS;
+    WOLFSSL* ready[2];
+    int retC, retS;
+    int i;
+    int n;
+
+    /* Each side starts and queues its first read. */
+    ExpectIntEQ(retC = wolfSSL_connect(ssl_c), WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_c, retC), WOLFSSL_ERROR_WANT_READ);
+    ExpectIntEQ(retS = wolfSSL_accept(ssl_s), WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, retS), WOLFSSL_ERROR_WANT_READ);
+
+    for (i = 0; EXPECT_SUCCESS() && (retC != 1 || retS != 1) && i < 100;
+            i++) {
+        ExpectIntGE(n = wolfSSL_IoUring_Wait(ring, ready, 2, 1000), 1);
+        while (EXPECT_SUCCESS() && n-- > 0) {
+            int ret;
+            int err;
+
+            if (ready[n] == ssl_c)
+                ret = retC = wolfSSL_connect(ssl_c);
+            else
+                ret = retS = wolfSSL_accept(ssl_s);
+            if (ret != 1) {
+                err = wolfSSL_get_error(ready[n], ret);
+                ExpectTrue(err == WOLFSSL_ERROR_WANT_READ ||
+                           err == WOLFSSL_ERROR_WANT_WRITE);
+            }
+        }
+    }
+    ExpectIntEQ(retC, 1);
+    ExpectIntEQ(retS, 1);
+
+    return EXPECT_RESULT();
+}
+#endif
+
+/* TLS over socket I/O batched through an io_uring. */
+int test_tls_io_uring(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && defined(WOLFSSL_IO_URING)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL, *ssl_x = NULL;
+    WOLFSSL_URING* ring = NULL;
+    CallbackIORecv ioRecv = NULL;
+    void* ioCtx = NULL;
+    struct test_memio_ctx test_ctx;
+    WOLFSSL* ready[2];
+    static byte msg[50000];
+    static byte readBuf[sizeof(msg)];
+    int sv[2] = { -1, -1 };
+    int written = 0;
+    int readSz = 0;
+    int ret;
+    int i;
+
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (byte)(i * 13);
+
+    ExpectNull(wolfSSL_IoUring_new(NULL, 0, 0));
+    ExpectIntEQ(wolfSSL_IoUring_Submit(NULL), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Wait(NULL, ready, 2, 0), BAD_FUNC_ARG);
+    /* Kernel may not allow io_uring. */
+    ring = wolfSSL_IoUring_new(NULL, 2, 4096);
+    if (ring == NULL)
+        return TEST_SKIPPED;
+    ExpectIntEQ(wolfSSL_IoUring_Wait(ring, NULL, 2, 0), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Wait(ring, ready, 0, 0), BAD_FUNC_ARG);
+    /* Nothing queued - nothing ready. */
+    ExpectIntEQ(wolfSSL_IoUring_Submit(ring), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_IoUring_Wait(ring, ready, 2, 0), 0);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+    ExpectIntEQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+
+    ExpectIntEQ(wolfSSL_IoUring_Attach(NULL, ssl_c, sv[0]), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, NULL, sv[0]), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, ssl_c, -1), BAD_FUNC_ARG);
+    if (ssl_c != NULL)
+        ioRecv = ssl_c->CBIORecv;
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, ssl_c, sv[0]), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, ssl_c, sv[0]), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, ssl_s, sv[1]), WOLFSSL_SUCCESS);
+    /* Both slots in use. */
+    ExpectNotNull(ssl_x = wolfSSL_new(ctx_c));
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, ssl_x, sv[0]), MEMORY_E);
+    ExpectIntEQ(wolfSSL_IoUring_Pending(ring, ssl_x), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Detach(ring, ssl_x), BAD_FUNC_ARG);
+
+    ExpectIntEQ(test_tls_io_uring_handshake(ring, ssl_c, ssl_s), TEST_SUCCESS);
+
+    /* Many times the send buffer: writes wait for sends to complete. */
+    for (i = 0; EXPECT_SUCCESS() && readSz < (int)sizeof(msg) && i < 1000;
+            i++) {
+        if (written < (int)sizeof(msg)) {
+            ret = wolfSSL_write(ssl_c, msg + written,
+                (int)sizeof(msg) - written);
+            if (ret > 0)
+                written += ret;
+            else
+                ExpectIntEQ(wolfSSL_get_error(ssl_c, ret),
+                    WOLFSSL_ERROR_WANT_WRITE);
+        }
+        ret = wolfSSL_read(ssl_s, readBuf + readSz,
+            (int)sizeof(readBuf) - readSz);
+        if (ret > 0) {
+            readSz += ret;
+        }
+        else {
+            ExpectIntEQ(wolfSSL_get_error(ssl_s, ret),
+                WOLFSSL_ERROR_WANT_READ);
+            ExpectIntGE(wolfSSL_IoUring_Wait(ring, ready, 2, 1000), 1);
+        }
+    }
+    ExpectIntEQ(readSz, (int)sizeof(msg));
+    ExpectBufEQ(readBuf, msg, sizeof(msg));
+
+    /* close_notify is sent before detaching. */
+    ExpectIntEQ(wolfSSL_shutdown(ssl_c), WOLFSSL_SHUTDOWN_NOT_DONE);
+    for (i = 0; EXPECT_SUCCESS() && wolfSSL_IoUring_Pending(ring, ssl_c) > 0 &&
+            i < 100; i++) {
+        ExpectIntGE(wolfSSL_IoUring_Wait(ring, ready, 2, 1000), 0);
+    }
+    ExpectIntEQ(wolfSSL_IoUring_Pending(ring, ssl_c), 0);
+    ExpectIntEQ(wolfSSL_IoUring_Detach(ring, ssl_c), WOLFSSL_SUCCESS);
+    /* I/O callback and context from before attaching are back. */
+    ExpectTrue((ssl_c != NULL) && (ssl_c->CBIORecv == ioRecv));
+    ExpectPtrEq(wolfSSL_GetIOReadCtx(ssl_c), &test_ctx);
+    ExpectIntEQ(wolfSSL_IoUring_Detach(ring, ssl_c), BAD_FUNC_ARG);
+    ExpectIntEQ(wolfSSL_IoUring_Pending(ring, ssl_c), BAD_FUNC_ARG);
+    for (i = 0; EXPECT_SUCCESS() && i < 100; i++) {
+        ret = wolfSSL_read(ssl_s, readBuf, (int)sizeof(readBuf));
+        if (wolfSSL_get_error(ssl_s, ret) != WOLFSSL_ERROR_WANT_READ)
+            break;
+        ExpectIntGE(wolfSSL_IoUring_Wait(ring, ready, 2, 1000), 1);
+    }
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, ret), WOLFSSL_ERROR_ZERO_RETURN);
+
+    /* Slot of the detached object is free again. */
+    ioCtx = wolfSSL_GetIOReadCtx(ssl_x);
+    ExpectIntEQ(wolfSSL_IoUring_Attach(ring, ssl_x, sv[0]), WOLFSSL_SUCCESS);
+    /* Freeing an attached object detaches it. */
+    wolfSSL_free(ssl_s);
+    ssl_s = NULL;
+    /* Queue a receive that stays in flight. */
+    ExpectIntEQ(wolfSSL_read(ssl_x, readBuf, (int)sizeof(readBuf)),
+        WOLFSSL_FATAL_ERROR);
+    ExpectIntEQ(wolfSSL_get_error(ssl_x, WOLFSSL_FATAL_ERROR),
+        WOLFSSL_ERROR_WANT_READ);
+    ExpectIntEQ(wolfSSL_IoUring_Submit(ring), WOLFSSL_SUCCESS);
+    /* Attached objects get their own I/O back when the ring is freed. */
+    wolfSSL_IoUring_free(ring);
+    ExpectPtrEq(wolfSSL_GetIOReadCtx(ssl_x), ioCtx);
+    /* Receive was cancelled before freeing - data sent later is left on the
+     * socket rather than written into the freed buffer. */
+    ExpectIntEQ((int)send(sv[1], "x", 1, 0), 1);
+    ExpectIntEQ((int)recv(sv[0], readBuf, sizeof(readBuf), 0), 1);
+
+    wolfSSL_free(ssl_x);
+    wolfSSL_free(ssl_c);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+    if (sv[0] >= 0)
+        close(sv[0]);
+    if (sv[1] >= 0)
+        close(sv[1]);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_CRYPT_POOL)
+static int test_tls_crypt_pool_signals = 0;
+
+/* Called on the worker threads. */
+static void test_tls_crypt_pool_signal(void* ctx)
+{
+    wolfSSL_Mutex* lock = (wolfSSL_Mutex*)ctx;
+
+    if (wc_LockMutex(lock) == 0) {
+        test_tls_crypt_pool_signals++;
+        wc_UnLockMutex(lock);
+    }
+}
+
+/* Run one handshake step of ssl on the pool and wait for it to be done.
+ * The memio buffers are shared, so only one side is submitted at a time. */
+static int test_tls_crypt_pool_step(WOLFSSL_CRYPTPOOL* pool, WOLFSSL* ssl,
+    int* done)
+{
+    EXPECT_DECLS;
+    WOLF_EVENT* events[2];
+    int count = 0;
+    int i;
+
+    ExpectIntEQ(wolfSSL_CryptPool_Submit(pool, ssl), 0);
+    /* Busy until its event is polled. */
+    ExpectIntEQ(wolfSSL_CryptPool_Submit(pool, ssl), WC_NO_ERR_TRACE(
+        BAD_STATE_E));
+    for (i = 0; EXPECT_SUCCESS() && count == 0 && i < 10000; i++) {
+        ExpectIntEQ(wolfSSL_CryptPool_Poll(pool, events, 2, &count), 0);
+        if (count == 0)
+            XSLEEP_MS(1);
+    }
+    ExpectIntEQ(count, 1);
+    if (EXPECT_SUCCESS()) {
+        ExpectPtrEq(events[0]->context, ssl);
+        if (events[0]->ret == WOLFSSL_SUCCESS) {
+            *done = 1;
+        }
+        else {
+            ExpectIntEQ(wolfSSL_get_error(ssl, events[0]->ret),
+                WOLFSSL_ERROR_WANT_READ);
+        }
+    }
+
+    return EXPECT_RESULT();
+}
+#endif
+
+int test_tls_crypt_pool(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_CRYPT_POOL)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    WOLFSSL_CRYPTPOOL* pool = NULL;
+    wolfSSL_Mutex signalLock;
+    WOLF_EVENT* events[1];
+    int count = 0;
+    int doneC = 0;
+    int doneS = 0;
+    int steps = 0;
+    int submits = 0;
+    const char msg[] = "crypt pool";
+    char readBuf[sizeof(msg)];
+
+    ExpectIntEQ(wc_InitMutex(&signalLock), 0);
+    ExpectNull(wolfSSL_CryptPool_new(NULL, 0));
+    ExpectNull(wolfSSL_CryptPool_new(NULL, WOLFSSL_CRYPT_POOL_MAX_THREADS + 1));
+    ExpectNotNull(pool = wolfSSL_CryptPool_new(NULL, 2));
+    ExpectIntEQ(wolfSSL_CryptPool_SetSignal(NULL, NULL, NULL),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CryptPool_SetSignal(pool, test_tls_crypt_pool_signal,
+        &signalLock), 0);
+    ExpectIntEQ(wolfSSL_CryptPool_Poll(NULL, events, 1, &count),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CryptPool_Poll(pool, events, 0, &count),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CryptPool_Poll(pool, events, 1, &count), 0);
+    ExpectIntEQ(count, 0);
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+    ExpectIntEQ(wolfSSL_CryptPool_Submit(NULL, ssl_c),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CryptPool_Submit(pool, NULL),
+        WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+
+    /* Each side's handshake steps, and their private key operations, run on
+     * the workers. */
+    while (EXPECT_SUCCESS() && (!doneC || !doneS) && steps < 20) {
+        if (!doneC) {
+            ExpectIntEQ(test_tls_crypt_pool_step(pool, ssl_c, &doneC),
+                TEST_SUCCESS);
+            submits++;
+        }
+        if (!doneS) {
+            ExpectIntEQ(test_tls_crypt_pool_step(pool, ssl_s, &doneS),
+                TEST_SUCCESS);
+            submits++;
+        }
+        steps++;
+    }
+    ExpectIntEQ(doneC, 1);
+    ExpectIntEQ(doneS, 1);
+
+    ExpectIntEQ(wolfSSL_write(ssl_c, msg, sizeof(msg)), sizeof(msg));
+    ExpectIntEQ(wolfSSL_read(ssl_s, readBuf, sizeof(readBuf)), sizeof(msg));
+    ExpectStrEQ(readBuf, msg);
+
+    wolfSSL_CryptPool_free(pool);
+    /* One signal per step run. */
+    ExpectIntEQ(test_tls_crypt_pool_signals, submits);
+    wc_FreeMutex(&signalLock);
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_SESSION_CACHE_SEQLOCK) && !defined(WOLFSSL_NO_TLS12)
+#define TEST_SESSION_SEQLOCK_LOOPS 20000
+
+typedef struct test_session_seqlock_writer {
+    WOLFSSL_CTX*     ctx;
+    WOLFSSL_SESSION* sess;
+    int              ret;
+} test_session_seqlock_writer;
+
+/* Keep overwriting the cached session with a new master secret. */
+static THREAD_RETURN WOLFSSL_THREAD test_tls_session_seqlock_writer(void* arg)
+{
+    test_session_seqlock_writer* w = (test_session_seqlock_writer*)arg;
+    int i;
+
+    for (i = 0; i < TEST_SESSION_SEQLOCK_LOOPS && w->ret == 0; i++) {
+        XMEMSET(w->sess->masterSecret, (byte)i, SECRET_LEN);
+        w->ret = AddSessionToCache(w->ctx, w->sess, w->sess->sessionID,
+            ID_LEN, NULL, WOLFSSL_SERVER_END, 0, NULL);
+    }
+
+    WOLFSSL_RETURN_FROM_THREAD(0);
+}
+#endif
+
+int test_tls_session_cache_seqlock(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_SESSION_CACHE_SEQLOCK) && !defined(WOLFSSL_NO_TLS12)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    test_session_seqlock_writer writer;
+    THREAD_TYPE thread;
+    WOLFSSL_SESSION* out = NULL;
+    int torn = 0;
+    int i;
+    int j;
+
+    XMEMSET(&writer, 0, sizeof(writer));
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfTLSv1_2_client_method, wolfTLSv1_2_server_method), 0);
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    /* Server's session is found without locking its row. */
+    ExpectNotNull(out = wolfSSL_SESSION_new());
+    ExpectIntEQ(wolfSSL_GetSessionFromCache(ssl_s, out), WOLFSSL_SUCCESS);
+    ExpectBufEQ(out->masterSecret, ssl_s->session->masterSecret, SECRET_LEN);
+
+    /* Copies made while a writer changes the session are never torn. */
+    ExpectNotNull(writer.sess = wolfSSL_SESSION_dup(ssl_s->session));
+    writer.ctx = ctx_s;
+    if (EXPECT_SUCCESS()) {
+        /* Start from a uniform secret so every valid copy is uniform. */
+        XMEMSET(writer.sess->masterSecret, 0xff, SECRET_LEN);
+        ExpectIntEQ(AddSessionToCache(ctx_s, writer.sess,
+            writer.sess->sessionID, ID_LEN, NULL, WOLFSSL_SERVER_END, 0,
+            NULL), 0);
+    }
+    ExpectIntEQ(wolfSSL_NewThread(&thread, test_tls_session_seqlock_writer,
+        &writer), 0);
+    if (EXPECT_SUCCESS()) {
+        for (i = 0; i < TEST_SESSION_SEQLOCK_LOOPS && !torn; i++) {
+            if (wolfSSL_GetSessionFromCache(ssl_s, out) != WOLFSSL_SUCCESS) {
+                torn = 1;
+                break;
+            }
+            for (j = 1; j < SECRET_LEN; j++) {
+                if (out->masterSecret[j] != out->masterSecret[0]) {
+                    torn = 1;
+                    break;
+                }
+            }
+        }
+        ExpectIntEQ(wolfSSL_JoinThread(thread), 0);
+    }
+    ExpectIntEQ(writer.ret, 0);
+    ExpectIntEQ(torn, 0);
+
+    wolfSSL_SESSION_free(writer.sess);
+    wolfSSL_SESSION_free(out);
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_CTX_DECODED_KEY) && !defined(NO_FILESYSTEM)
+/* Handshake twice with a server CTX that has the key decoded. */
+static int test_tls_ctx_decoded_key_run(const char* keyFile,
+    const char* certFile, word32 keyType, method_provider method_c,
+    method_provider method_s)
+{
+    EXPECT_DECLS;
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    int i;
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, NULL, NULL,
+                    method_c, method_s), 0);
+    ExpectIntEQ(wolfSSL_CTX_use_PrivateKey_file(ctx_s, keyFile,
+        CERT_FILETYPE), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_CTX_use_certificate_file(ctx_s, certFile,
+        CERT_FILETYPE), WOLFSSL_SUCCESS);
+    if (ctx_c != NULL) {
+        wolfSSL_CTX_set_verify(ctx_c, WOLFSSL_VERIFY_NONE, NULL);
+    }
+    ExpectNotNull(ctx_s == NULL ? NULL : ctx_s->decodedKey);
+    ExpectIntEQ(ctx_s == NULL ? 0 : ctx_s->decodedKeyType, keyType);
+
+    /* Key object outlives each connection that signs with it. */
+    for (i = 0; i < 2; i++) {
+        XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+        ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c,
+                        &ssl_s, method_c, method_s), 0);
+        ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+        ExpectNull(ssl_s == NULL ? NULL : ssl_s->hsKey);
+        wolfSSL_free(ssl_c);
+        ssl_c = NULL;
+        wolfSSL_free(ssl_s);
+        ssl_s = NULL;
+    }
+    ExpectNotNull(ctx_s == NULL ? NULL : ctx_s->decodedKey);
+
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+    return EXPECT_RESULT();
+}
+#endif
+
+int test_tls_ctx_decoded_key(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_CTX_DECODED_KEY) && !defined(NO_FILESYSTEM)
+#if !defined(NO_RSA) && !defined(WOLFSSL_RSA_PUBLIC_ONLY) && \
+    !defined(WOLFSSL_NO_TLS12)
+    ExpectIntEQ(test_tls_ctx_decoded_key_run(svrKeyFile, svrCertFile,
+        DYNAMIC_TYPE_RSA, wolfTLSv1_2_client_method,
+        wolfTLSv1_2_server_method), TEST_SUCCESS);
+#endif
+#if defined(HAVE_ECC) && !defined(WOLFSSL_ECC_BLIND_K) && \
+    !defined(WOLFSSL_CUSTOM_CURVES) && defined(WOLFSSL_TLS13)
+    ExpectIntEQ(test_tls_ctx_decoded_key_run(eccKeyFile, eccCertFile,
+        DYNAMIC_TYPE_ECC, wolfTLSv1_3_client_method,
+        wolfTLSv1_3_server_method), TEST_SUCCESS);
+#endif
+#if defined(HAVE_ED25519) && defined(HAVE_ED25519_KEY_IMPORT) && \
+    !defined(WOLFSSL_ED25519_PERSISTENT_SHA) && defined(WOLFSSL_TLS13)
+    ExpectIntEQ(test_tls_ctx_decoded_key_run(edKeyFile, edCertFile,
+        DYNAMIC_TYPE_ED25519, wolfTLSv1_3_client_method,
+        wolfTLSv1_3_server_method), TEST_SUCCESS);
+#endif
+#endif
+    return EXPECT_RESULT();
+}
+
+int test_tls_ctx_parent_rng(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_CTX_PARENT_RNG)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL, *ssl_s2 = NULL;
+    struct test_memio_ctx test_ctx;
+    byte out1[32];
+    byte out2[32];
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfSSLv23_client_method, wolfSSLv23_server_method), 0);
+    ExpectNotNull(ctx_s == NULL ? NULL : ctx_s->parentRng);
+    ExpectNotNull(ssl_s2 = wolfSSL_new(ctx_s));
+
+    /* Each connection has its own generator seeded from the context's. */
+    ExpectTrue((ssl_s != NULL) && (ssl_s->rng != ctx_s->parentRng));
+    ExpectTrue((ssl_s2 != NULL) && (ssl_s2->rng != ssl_s->rng));
+    ExpectIntEQ(wc_RNG_GenerateBlock(ssl_s->rng, out1, sizeof(out1)), 0);
+    ExpectIntEQ(wc_RNG_GenerateBlock(ssl_s2->rng, out2, sizeof(out2)), 0);
+    ExpectBufNE(out1, out2, sizeof(out1));
+
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+
+    wolfSSL_free(ssl_s2);
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_EARLY_DATA) && defined(WOLFSSL_EARLY_DATA_ANTI_REPLAY) && \
+    defined(HAVE_SESSION_TICKET) && defined(WOLFSSL_TLS13)
+static int test_tls_antireplay_cb(WOLFSSL* ssl, const unsigned char* key,
+    unsigned int keySz, unsigned int window, void* ctx)
+{
+    (void)ssl;
+    (void)key;
+    (void)keySz;
+    (void)window;
+    (*(int*)ctx)++;
+    return 0;
+}
+#endif
+
+int test_tls_early_data_antireplay(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_EARLY_DATA) && defined(WOLFSSL_EARLY_DATA_ANTI_REPLAY) && \
+    defined(HAVE_SESSION_TICKET) && defined(WOLFSSL_TLS13)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    WOLFSSL_SESSION *sess = NULL;
+    struct test_memio_ctx test_ctx;
+    char msg[] = "This is early data";
+    char msgBuf[50];
+    static byte replay[TEST_MEMIO_BUF_SZ];
+    int replaySz = 0;
+    int written = 0;
+    int read = 0;
+    int cbCalls = 0;
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfTLSv1_3_client_method, wolfTLSv1_3_server_method), 0);
+    ExpectIntEQ(wolfSSL_CTX_set_early_data_antireplay(NULL, 0, 64),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_set_early_data_antireplay(ctx_c, 0, 64),
+                WC_NO_ERR_TRACE(SIDE_ERROR));
+    /* Window shorter than the ticket age check. */
+    ExpectIntEQ(wolfSSL_CTX_set_early_data_antireplay(ctx_s, 1, 64),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_set_early_data_antireplay(ctx_s, 0, 64),
+                WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_CTX_set_early_data_antireplay_cb(ctx_s,
+                test_tls_antireplay_cb, &cbCalls), WOLFSSL_SUCCESS);
+
+    /* Get a ticket so that we can do 0-RTT on the next connection. */
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+    ExpectIntEQ(wolfSSL_read(ssl_c, msgBuf, sizeof(msgBuf)), -1);
+    ExpectIntEQ(wolfSSL_get_error(ssl_c, -1), WOLFSSL_ERROR_WANT_READ);
+    ExpectNotNull(sess = wolfSSL_get1_session(ssl_c));
+    wolfSSL_free(ssl_c);
+    ssl_c = NULL;
+    wolfSSL_free(ssl_s);
+    ssl_s = NULL;
+
+    /* First use of ClientHello with early data is accepted. */
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfTLSv1_3_client_method, wolfTLSv1_3_server_method), 0);
+    ExpectIntEQ(wolfSSL_set_session(ssl_c, sess), WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_write_early_data(ssl_c, msg, sizeof(msg), &written),
+                sizeof(msg));
+    if (EXPECT_SUCCESS()) {
+        replaySz = test_ctx.s_len;
+        XMEMCPY(replay, test_ctx.s_buff, (size_t)replaySz);
+    }
+    ExpectIntEQ(wolfSSL_read_early_data(ssl_s, msgBuf, sizeof(msgBuf), &read),
+                sizeof(msg));
+    ExpectIntEQ(read, sizeof(msg));
+    ExpectIntEQ(cbCalls, 1);
+    wolfSSL_free(ssl_s);
+    ssl_s = NULL;
+
+    /* Replaying it has the early data rejected without asking callback. */
+    ExpectNotNull(ssl_s = wolfSSL_new(ctx_s));
+    wolfSSL_SetIOReadCtx(ssl_s, &test_ctx);
+    wolfSSL_SetIOWriteCtx(ssl_s, &test_ctx);
+    test_memio_clear_buffer(&test_ctx, 0);
+    test_memio_clear_buffer(&test_ctx, 1);
+    ExpectIntEQ(test_memio_inject_message(&test_ctx, 0, (const char*)replay,
+                replaySz), 0);
+    read = 0;
+    ExpectIntLE(wolfSSL_read_early_data(ssl_s, msgBuf, sizeof(msgBuf), &read),
+                0);
+    ExpectIntEQ(read, 0);
+    ExpectIntEQ(wolfSSL_get_error(ssl_s, -1), WOLFSSL_ERROR_WANT_READ);
+    ExpectIntEQ(cbCalls, 1);
+    ExpectIntGT(test_ctx.c_len, 0);
+
+    /* Removing the store leaves it to the callback. */
+    ExpectIntEQ(wolfSSL_CTX_set_early_data_antireplay(ctx_s, 0, 0),
+                WOLFSSL_SUCCESS);
+    ExpectTrue((ctx_s != NULL) && (ctx_s->antiReplay == NULL));
+
+    wolfSSL_SESSION_free(sess);
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+#endif
+    return EXPECT_RESULT();
+}
+
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(HAVE_SESSION_TICKET) && defined(WOLFSSL_TICKET_KEY_RING) && \
+    !defined(WOLFSSL_NO_DEF_TICKET_ENC_CB) && defined(WOLFSSL_TLS13)
+/* Connect, resuming sess when not NULL, and get the new session. */
+static int test_tls_ticket_key_ring_connect(WOLFSSL_CTX* ctx_c,
+    WOLFSSL_CTX* ctx_s, WOLFSSL_SESSION* sess, WOLFSSL_SESSION** newSess,
+    int* reused)
+{
+    EXPECT_DECLS;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    struct test_memio_ctx test_ctx;
+    char msgBuf[1];
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    NULL, NULL), 0);
+    if (sess != NULL) {
+        ExpectIntEQ(wolfSSL_set_session(ssl_c, sess), WOLFSSL_SUCCESS);
+    }
+    ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+    /* Process the NewSessionTicket. */
+    ExpectIntEQ(wolfSSL_read(ssl_c, msgBuf, sizeof(msgBuf)), -1);
+    ExpectIntEQ(wolfSSL_get_error(ssl_c, -1), WOLFSSL_ERROR_WANT_READ);
+    *reused = wolfSSL_session_reused(ssl_c);
+    if (newSess != NULL) {
+        ExpectNotNull(*newSess = wolfSSL_get1_session(ssl_c));
+    }
+
+    wolfSSL_free(ssl_c);
+    wolfSSL_free(ssl_s);
+    return EXPECT_RESULT();
+}
+#endif
+
+int test_tls_ticket_key_ring(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(HAVE_SESSION_TICKET) && defined(WOLFSSL_TICKET_KEY_RING) && \
+    !defined(WOLFSSL_NO_DEF_TICKET_ENC_CB) && defined(WOLFSSL_TLS13)
+    WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL, *ctx_s2 = NULL;
+    WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+    WOLFSSL_SESSION *sess = NULL, *sess2 = NULL;
+    struct test_memio_ctx test_ctx;
+    unsigned char name[WOLFSSL_TICKET_NAME_SZ];
+    unsigned char key[WOLFSSL_TICKET_KEY_SZ];
+    int reused = 0;
+    int i;
+
+    XMEMSET(name, 0x5a, sizeof(name));
+    XMEMSET(key, 0xa5, sizeof(key));
+
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                    wolfTLSv1_3_client_method, wolfTLSv1_3_server_method), 0);
+    wolfSSL_free(ssl_c);
+    ssl_c = NULL;
+    wolfSSL_free(ssl_s);
+    ssl_s = NULL;
+    XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+    ExpectIntEQ(test_memio_setup(&test_ctx, NULL, &ctx_s2, NULL, NULL,
+                    NULL, wolfTLSv1_3_server_method), 0);
+
+    ExpectIntEQ(wolfSSL_CTX_rotate_ticket_key(NULL),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_rotate_ticket_key(ctx_c),
+                WC_NO_ERR_TRACE(SIDE_ERROR));
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(NULL, name, key, sizeof(key)),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(ctx_s, NULL, key, sizeof(key)),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(ctx_s, name, NULL, sizeof(key)),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(ctx_s, name, key, sizeof(key) - 1),
+                WC_NO_ERR_TRACE(BAD_FUNC_ARG));
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(ctx_c, name, key, sizeof(key)),
+                WC_NO_ERR_TRACE(SIDE_ERROR));
+
+    /* Ticket resumes with the key it was encrypted with. */
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, NULL, &sess,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 0);
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, sess, NULL,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 1);
+
+    /* Ticket still resumes after a new key is in use. */
+    ExpectIntEQ(wolfSSL_CTX_rotate_ticket_key(ctx_s), WOLFSSL_SUCCESS);
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, sess, NULL,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 1);
+
+    /* Ticket no longer resumes once its key has left the ring. */
+    for (i = 0; i < WOLFSSL_TICKET_KEY_RING_SZ; i++) {
+        ExpectIntEQ(wolfSSL_CTX_rotate_ticket_key(ctx_s), WOLFSSL_SUCCESS);
+    }
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, sess, NULL,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 0);
+    wolfSSL_SESSION_free(sess);
+    sess = NULL;
+
+    /* Servers with the same named key resume each other's tickets. */
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(ctx_s, name, key, sizeof(key)),
+                WOLFSSL_SUCCESS);
+    ExpectIntEQ(wolfSSL_CTX_add_ticket_key(ctx_s2, name, key, sizeof(key)),
+                WOLFSSL_SUCCESS);
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, NULL, &sess,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s2, sess, &sess2,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 1);
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, sess2, NULL,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 1);
+    wolfSSL_SESSION_free(sess2);
+    sess2 = NULL;
+    wolfSSL_SESSION_free(sess);
+    sess = NULL;
+
+    /* Added key still encrypts once a generated key would be replaced. */
+    if (ctx_s != NULL) {
+        ctx_s->ticketKeyCtx.ring[ctx_s->ticketKeyCtx.cur].encEnd = 0;
+    }
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s, NULL, &sess,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(test_tls_ticket_key_ring_connect(ctx_c, ctx_s2, sess, NULL,
+                &reused), TEST_SUCCESS);
+    ExpectIntEQ(reused, 1);
+
+    wolfSSL_SESSION_free(sess2);
+    wolfSSL_SESSION_free(sess);
+    wolfSSL_CTX_free(ctx_c);
+    wolfSSL_CTX_free(ctx_s);
+    wolfSSL_CTX_free(ctx_s2);
+#endif
+    return EXPECT_RESULT();
+}
@@ -26,5 +26,19 @@ int test_tls12_unexpected_ccs(void);
 int test_tls13_unexpected_ccs(void);
 int test_tls12_curve_intersection(void);
 int test_tls13_curve_intersection(void);
+int test_tls_writev(void);
+int test_tls_read_zc(void);
+int test_tls_ktls(void);
+int test_tls_read_ahead(void);
+int test_tls_send_batch(void);
+int test_tls_dyn_record(void);
+int test_tls_io_pool(void);
+int test_tls_io_uring(void);
+int test_tls_crypt_pool(void);
+int test_tls_session_cache_seqlock(void);
+int test_tls_ctx_decoded_key(void);
+int test_tls_ctx_parent_rng(void);
+int test_tls_early_data_antireplay(void);
+int test_tls_ticket_key_ring(void);
 
 #endif /* TESTS_API_TEST_TLS_EMS_H */
@@ -2191,3 +2191,79 @@ int test_tls13_same_ch(void)
 #endif
     return EXPECT_RESULT();
 }
+
+/* Handshake and exchange application data with the private-use Ascon-AEAD128
+ * cipher suite over TLS 1.3 and DTLS 1.3. */
+int test_tls13_ascon_aead128(void)
+{
+    EXPECT_DECLS;
+#if defined(HAVE_MANUAL_MEMIO_TESTS_DEPENDENCIES) && \
+    defined(WOLFSSL_TLS13) && defined(HAVE_ASCON) && !defined(NO_SHA256)
+    size_t i;
+    char msg[] = "Ascon-AEAD128 protected data";
+    char msgBuf[50];
+    struct {
+        method_provider client_meth;
+        method_provider server_meth;
+        const char* tls_version;
+    } params[] = {
+        { wolfTLSv1_3_client_method, wolfTLSv1_3_server_method, "TLS 1.3" },
+#ifdef WOLFSSL_DTLS13
+        { wolfDTLSv1_3_client_method, wolfDTLSv1_3_server_method, "DTLS 1.3" },
+#endif
+    };
+    WOLFSSL_CTX *ctx = NULL;
+    WOLFSSL *ssl = NULL;
+    const Suites* suites = NULL;
+    int hasAscon = 0;
+
+    /* Private use cipher suite is not offered unless named. */
+    ExpectNotNull(ctx = wolfSSL_CTX_new(wolfTLSv1_3_client_method()));
+    ExpectNotNull(ssl = wolfSSL_new(ctx));
+    ExpectNotNull(suites = WOLFSSL_SUITES(ssl));
+    for (i = 0; (suites != NULL) && (i + 1 < suites->suiteSz); i += 2) {
+        if (suites->suites[i] == ASCON_BYTE)
+            hasAscon = 1;
+    }
+    ExpectIntEQ(hasAscon, 0);
+    wolfSSL_free(ssl);
+    wolfSSL_CTX_free(ctx);
+
+    for (i = 0; i < sizeof(params)/sizeof(*params) && !EXPECT_FAIL(); i++) {
+        struct test_memio_ctx test_ctx;
+        WOLFSSL_CTX *ctx_c = NULL, *ctx_s = NULL;
+        WOLFSSL *ssl_c = NULL, *ssl_s = NULL;
+
+        XMEMSET(&test_ctx, 0, sizeof(test_ctx));
+
+        fprintf(stderr, "\tAscon-AEAD128 with %s\n", params[i].tls_version);
+
+        test_ctx.c_ciphers = test_ctx.s_ciphers = "TLS13-ASCON-AEAD128-SHA256";
+        ExpectIntEQ(test_memio_setup(&test_ctx, &ctx_c, &ctx_s, &ssl_c, &ssl_s,
+                params[i].client_meth, params[i].server_meth), 0);
+        ExpectIntEQ(test_memio_do_handshake(ssl_c, ssl_s, 10, NULL), 0);
+        ExpectStrEQ(wolfSSL_get_cipher(ssl_c), "TLS_ASCON_AEAD128_SHA256");
+        ExpectStrEQ(wolfSSL_get_cipher(ssl_s), "TLS_ASCON_AEAD128_SHA256");
+
+        ExpectIntEQ(wolfSSL_write(ssl_c, msg, sizeof(msg)), sizeof(msg));
+        ExpectIntEQ(wolfSSL_read(ssl_s, msgBuf, sizeof(msgBuf)), sizeof(msg));
+        ExpectStrEQ(msg, msgBuf);
+        ExpectIntEQ(wolfSSL_write(ssl_s, msg, sizeof(msg)), sizeof(msg));
+        XMEMSET(msgBuf, 0, sizeof(msgBuf));
+        ExpectIntEQ(wolfSSL_read(ssl_c, msgBuf, sizeof(msgBuf)), sizeof(msg));
+        ExpectStrEQ(msg, msgBuf);
+
+        /* Tampered record must fail authentication. */
+        ExpectIntEQ(wolfSSL_write(ssl_c, msg, sizeof(msg)), sizeof(msg));
+        if (EXPECT_SUCCESS() && test_ctx.s_len > 0)
+            test_ctx.s_buff[test_ctx.s_len - 1] ^= 0x01;
+        ExpectIntLT(wolfSSL_read(ssl_s, msgBuf, sizeof(msgBuf)), 0);
+
+        wolfSSL_free(ssl_c);
+        wolfSSL_free(ssl_s);
+        wolfSSL_CTX_free(ctx_c);
+        wolfSSL_CTX_free(ctx_s);
+    }
+#endif
+    return EXPECT_RESULT();
+}
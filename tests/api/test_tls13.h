@@ -31,6 +31,7 @@ int test_tls13_rpk_handshake(void);
 int test_tls13_pq_groups(void);
 int test_tls13_early_data(void);
 int test_tls13_same_ch(void);
+int test_tls13_ascon_aead128(void);
 
 #define TEST_TLS13_DECLS                                   \
     TEST_DECL_GROUP("tls13", test_tls13_apis),             \
@@ -39,6 +40,7 @@ int test_tls13_same_ch(void);
     TEST_DECL_GROUP("tls13", test_tls13_rpk_handshake),    \
     TEST_DECL_GROUP("tls13", test_tls13_pq_groups),        \
     TEST_DECL_GROUP("tls13", test_tls13_early_data),       \
-    TEST_DECL_GROUP("tls13", test_tls13_same_ch)
+    TEST_DECL_GROUP("tls13", test_tls13_same_ch),          \
+    TEST_DECL_GROUP("tls13", test_tls13_ascon_aead128)
 
 #endif /* WOLFCRYPT_TEST_TLS13_H */
@@ -734,6 +734,12 @@
 #define BENCH_ML_KEM_1024               0x00000080
 #define BENCH_ML_KEM                    (BENCH_ML_KEM_512 | BENCH_ML_KEM_768 | \
                                          BENCH_ML_KEM_1024)
+#define BENCH_ASCON_ML_KEM_512          0x00000100
+#define BENCH_ASCON_ML_KEM_768          0x00000200
+#define BENCH_ASCON_ML_KEM_1024         0x00000400
+#define BENCH_ASCON_ML_KEM              (BENCH_ASCON_ML_KEM_512 | \
+                                         BENCH_ASCON_ML_KEM_768 | \
+                                         BENCH_ASCON_ML_KEM_1024)
 #define BENCH_FALCON_LEVEL1_SIGN        0x00000001
 #define BENCH_FALCON_LEVEL5_SIGN        0x00000002
 #define BENCH_DILITHIUM_LEVEL2_SIGN     0x04000000
@@ -797,6 +803,15 @@
     #define BENCH_PQ_STATEFUL_HBS
 #endif
 
+#if defined(WOLFSSL_HAVE_MLKEM) && defined(WOLFSSL_WC_MLKEM) && \
+    defined(HAVE_ASCON) && !defined(WOLFSSL_NO_ML_KEM) && \
+    !defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+    !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) && \
+    !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
+    /* Detailed benchmark of ML-KEM built on Ascon: -ascon-mlkem<n> */
+    #define BENCH_ASCON_MLKEM
+#endif
+
 /* Benchmark all compiled in algorithms.
  * When 1, ignore other benchmark algorithm values.
  *      0, only benchmark algorithm values set.
@@ -1149,6 +1164,18 @@ static const bench_pq_alg bench_pq_asym_opt[] = {
     { "-ml-kem-768",        BENCH_ML_KEM_768        },
     { "-ml-kem-1024",       BENCH_ML_KEM_1024       },
 #endif
+#ifdef BENCH_ASCON_MLKEM
+    { "-ascon-mlkem",       BENCH_ASCON_ML_KEM      },
+#ifdef WOLFSSL_WC_ML_KEM_512
+    { "-ascon-mlkem512",    BENCH_ASCON_ML_KEM_512  },
+#endif
+#ifdef WOLFSSL_WC_ML_KEM_768
+    { "-ascon-mlkem768",    BENCH_ASCON_ML_KEM_768  },
+#endif
+#ifdef WOLFSSL_WC_ML_KEM_1024
+    { "-ascon-mlkem1024",   BENCH_ASCON_ML_KEM_1024 },
+#endif
+#endif
 #if defined(HAVE_FALCON)
     { "-falcon_level1",     BENCH_FALCON_LEVEL1_SIGN },
     { "-falcon_level5",     BENCH_FALCON_LEVEL5_SIGN },
@@ -1196,11 +1223,12 @@ static int lng_index = 0;
 
 #ifndef NO_MAIN_DRIVER
 #ifndef MAIN_NO_ARGS
-static const char* bench_Usage_msg1[][27] = {
+static const char* bench_Usage_msg1[][28] = {
     /* 0 English  */
     {   "-? <num>    Help, print this usage\n",
         "            0: English, 1: Japanese\n",
         "-csv        Print terminal output in csv format\n",
+        "-json       Print Ascon ML-KEM results as JSON, one object per line\n",
         "-base10     Display bytes as power of 10 (eg 1 kB = 1000 Bytes)\n",
         "-no_aad     No additional authentication data passed.\n",
         "-aad_size <num>   With <num> bytes of AAD.\n",
@@ -1240,6 +1268,7 @@ static const char* bench_Usage_msg1[][27] = {
     {   "-? <num>    ヘルプ, 使い方を表示します。\n",
         "            0: 英語、 1: 日本語\n",
         "-csv        csv 形式で端末に出力します。\n",
+        "-json       Ascon ML-KEM の結果を 1 行 1 オブジェクトの JSON 形式で出力します。\n",
         "-base10     バイトを10のべき乗で表示します。(例 1 kB = 1000 Bytes)\n",
         "-no_aad     追加の認証データを使用しません.\n",
         "-aad_size <num>  TBD.\n",
@@ -2063,6 +2092,8 @@ static const char* bench_result_words2[][5] = {
 
 static int    numBlocks  = NUM_BLOCKS;
 static word32 bench_size = BENCH_SIZE;
+/* block size given on the command line or by the size of an input file */
+static int bench_size_set = 0;
 static int base2 = 1;
 static int digest_stream = 1;
 static int mac_stream = 1;
@@ -2090,6 +2121,10 @@ static int minimum_runs = 0;
 
 /* Don't print out in CSV format by default */
 static int csv_format = 0;
+#ifdef BENCH_ASCON_MLKEM
+/* Don't print out Ascon ML-KEM results in JSON format by default */
+static int json_format = 0;
+#endif
 
 #ifdef WOLFSSL_XILINX_CRYPT_VERSAL
     /* Versal PLM maybe prints an error message to the same console.
@@ -2155,6 +2190,7 @@ static void benchmark_static_init(int force)
         /* Init static variables */
         numBlocks  = NUM_BLOCKS;
         bench_size = BENCH_SIZE;
+        bench_size_set = 0;
     #if defined(HAVE_AESGCM) || defined(HAVE_AESCCM)
         aesAuthAddSz    = AES_AUTH_ADD_SZ;
         aes_aad_options = AES_AAD_OPTIONS_DEFAULT;
@@ -2176,6 +2212,9 @@ static void benchmark_static_init(int force)
         bench_other_algs = 0;
         bench_pq_hash_sig_algs = 0;
         csv_format = 0;
+    #ifdef BENCH_ASCON_MLKEM
+        json_format = 0;
+    #endif
     }
 }
 
@@ -3159,6 +3198,7 @@ static void* benchmarks_do(void* args)
             bench_buf_size += 16 - (bench_buf_size % 16);
 
         bench_size = (word32)bench_buf_size;
+        bench_size_set = 1;
 
         bench_plain = (byte*)XMALLOC((size_t)bench_buf_size + 16*2,
                                  HEAP_HINT, DYNAMIC_TYPE_WOLF_BIGINT);
@@ -3748,6 +3788,24 @@ static void* benchmarks_do(void* args)
 #endif
     }
 #endif
+#ifdef BENCH_ASCON_MLKEM
+    /* Only run when asked for - adds detail to the ML-KEM results. */
+    #ifdef WOLFSSL_WC_ML_KEM_512
+    if (bench_pq_asym_algs & BENCH_ASCON_ML_KEM_512) {
+        bench_ascon_mlkem(WC_ML_KEM_512);
+    }
+    #endif
+    #ifdef WOLFSSL_WC_ML_KEM_768
+    if (bench_pq_asym_algs & BENCH_ASCON_ML_KEM_768) {
+        bench_ascon_mlkem(WC_ML_KEM_768);
+    }
+    #endif
+    #ifdef WOLFSSL_WC_ML_KEM_1024
+    if (bench_pq_asym_algs & BENCH_ASCON_ML_KEM_1024) {
+        bench_ascon_mlkem(WC_ML_KEM_1024);
+    }
+    #endif
+#endif
 
 #if defined(WOLFSSL_HAVE_LMS) && !defined(WOLFSSL_LMS_VERIFY_ONLY)
     if (bench_all || (bench_pq_hash_sig_algs & BENCH_LMS_HSS)) {
@@ -4019,6 +4077,8 @@ static void print_cpu_features(void)
     if (IS_INTEL_MOVBE(cpuid_flags))  printf(" movbe");
     if (IS_INTEL_BMI1(cpuid_flags))   printf(" bmi1");
     if (IS_INTEL_SHA(cpuid_flags))    printf(" sha");
+    if (IS_INTEL_AVX512(cpuid_flags)) printf(" avx512");
+    if (IS_INTEL_VAES(cpuid_flags))   printf(" vaes");
 #endif
 #ifdef __aarch64__
     printf("Aarch64 -");
@@ -4852,6 +4912,101 @@ exit:
 }
 #endif
 
+#if !defined(WOLFSSL_ASYNC_CRYPT) && !defined(HAVE_FIPS) && \
+    !defined(HAVE_SELFTEST)
+#define BENCH_AESGCM_RECORDS
+/* Encrypt two records of bench_size bytes with each call, as when sending
+ * full TLS 1.3 records. */
+static void bench_aesgcm_records_internal(int useDeviceID,
+    const byte* key, word32 keySz, const byte* iv, word32 ivSz,
+    const char* encLabel)
+{
+    int    ret = 0, count = 0, times, aesInit = 0;
+    double start;
+    byte*  cipher2 = NULL;
+    wc_AesGcmRecord rec[2];
+    DECLARE_MULTI_VALUE_STATS_VARS()
+    WC_DECLARE_VAR(enc, Aes, 1, HEAP_HINT);
+    WC_DECLARE_VAR(bench_additional, byte, AES_AUTH_ADD_SZ, HEAP_HINT);
+    WC_DECLARE_VAR(bench_tag, byte, 2 * AES_AUTH_TAG_SZ, HEAP_HINT);
+
+    WC_ALLOC_VAR(enc, Aes, 1, HEAP_HINT);
+    WC_ALLOC_VAR(bench_additional, byte, AES_AUTH_ADD_SZ, HEAP_HINT);
+    WC_ALLOC_VAR(bench_tag, byte, 2 * AES_AUTH_TAG_SZ, HEAP_HINT);
+
+    XMEMSET(bench_additional, 0, AES_AUTH_ADD_SZ);
+    XMEMSET(bench_tag, 0, 2 * AES_AUTH_TAG_SZ);
+
+    cipher2 = (byte*)XMALLOC((size_t)bench_size + 16, HEAP_HINT,
+                             DYNAMIC_TYPE_WOLF_BIGINT);
+    if (cipher2 == NULL) {
+        ret = MEMORY_E;
+        goto exit;
+    }
+
+    if ((ret = wc_AesInit(enc, HEAP_HINT,
+                    useDeviceID ? devId: INVALID_DEVID)) != 0) {
+        printf("AesInit failed at L%d, ret = %d\n", __LINE__, ret);
+        goto exit;
+    }
+    aesInit = 1;
+    ret = wc_AesGcmSetKey(enc, key, keySz);
+    if (ret != 0) {
+        printf("AesGcmSetKey failed, ret = %d\n", ret);
+        goto exit;
+    }
+
+    XMEMSET(rec, 0, sizeof(rec));
+    rec[0].out = bench_cipher;
+    rec[1].out = cipher2;
+    for (times = 0; times < 2; times++) {
+        rec[times].in = bench_plain;
+        rec[times].sz = bench_size;
+        rec[times].iv = iv;
+        rec[times].ivSz = ivSz;
+        rec[times].authTag = bench_tag + times * AES_AUTH_TAG_SZ;
+        rec[times].authTagSz = AES_AUTH_TAG_SZ;
+        rec[times].authIn = bench_additional;
+        rec[times].authInSz = aesAuthAddSz;
+    }
+
+    bench_stats_start(&count, &start);
+    do {
+        for (times = 0; times < numBlocks; times += 2) {
+            ret = wc_AesGcmEncryptRecords(enc, rec, 2);
+            if (ret != 0)
+                goto exit_aes_gcm_rec;
+        }
+        count += times;
+        RECORD_MULTI_VALUE_STATS();
+    } while (bench_stats_check(start)
+#ifdef MULTI_VALUE_STATISTICS
+           || runs < minimum_runs
+#endif
+           );
+
+exit_aes_gcm_rec:
+    bench_stats_sym_finish(encLabel, useDeviceID, count, bench_size,
+                           start, ret);
+#ifdef MULTI_VALUE_STATISTICS
+    bench_multi_value_stats(max, min, sum, squareSum, runs);
+#endif
+
+exit:
+
+    if (ret < 0) {
+        printf("bench_aesgcm failed: %d\n", ret);
+    }
+    if (aesInit) {
+        wc_AesFree(enc);
+    }
+    XFREE(cipher2, HEAP_HINT, DYNAMIC_TYPE_WOLF_BIGINT);
+    WC_FREE_VAR(enc, HEAP_HINT);
+    WC_FREE_VAR(bench_additional, HEAP_HINT);
+    WC_FREE_VAR(bench_tag, HEAP_HINT);
+}
+#endif
+
 void bench_aesgcm(int useDeviceID)
 {
 #define AES_GCM_STRING(n, dir)  AES_AAD_STRING("AES-" #n "-GCM-" #dir)
@@ -4899,6 +5054,19 @@ void bench_aesgcm(int useDeviceID)
         AES_GCM_STRING(256, enc), AES_GCM_STRING(256, dec));
 #endif
 #endif /* WOLFSSL_AESGCM_STREAM */
+#ifdef BENCH_AESGCM_RECORDS
+#undef AES_GCM_STRING
+#define AES_GCM_STRING(n, dir)  AES_AAD_STRING("AES-" #n "-GCM-REC-" #dir)
+#if defined(WOLFSSL_AES_128) && !defined(WOLFSSL_AFALG_XILINX_AES) \
+        && !defined(WOLFSSL_XILINX_CRYPT)
+    bench_aesgcm_records_internal(useDeviceID, bench_key, 16, bench_iv, 12,
+        AES_GCM_STRING(128, enc));
+#endif
+#ifdef WOLFSSL_AES_256
+    bench_aesgcm_records_internal(useDeviceID, bench_key, 32, bench_iv, 12,
+        AES_GCM_STRING(256, enc));
+#endif
+#endif /* BENCH_AESGCM_RECORDS */
 #undef AES_GCM_STRING
 }
 
@@ -8138,7 +8306,8 @@ void bench_blake2s(void)
 #endif
 
 #ifdef HAVE_ASCON
-void bench_ascon_hash(void)
+static void bench_ascon_hash_helper(const byte* msg, word32 sz,
+    const char* desc)
 {
     wc_AsconHash256 ascon;
     byte    digest[ASCON_HASH256_SZ];
@@ -8155,7 +8324,7 @@ void bench_ascon_hash(void)
         bench_stats_start(&count, &start);
         do {
             for (i = 0; i < numBlocks; i++) {
-                ret = wc_AsconHash256_Update(&ascon, bench_plain, bench_size);
+                ret = wc_AsconHash256_Update(&ascon, msg, sz);
                 if (ret != 0) {
                     printf("wc_AsconHash256_Update failed, ret = %d\n", ret);
                     return;
@@ -8178,7 +8347,7 @@ void bench_ascon_hash(void)
                     printf("wc_AsconHash256_Init failed, ret = %d\n", ret);
                     return;
                 }
-                ret = wc_AsconHash256_Update(&ascon, bench_plain, bench_size);
+                ret = wc_AsconHash256_Update(&ascon, msg, sz);
                 if (ret != 0) {
                     printf("wc_AsconHash256_Update failed, ret = %d\n", ret);
                     return;
@@ -8192,7 +8361,46 @@ void bench_ascon_hash(void)
             count += i;
         } while (bench_stats_check(start));
     }
-    bench_stats_sym_finish("ASCON hash", 0, count, bench_size, start, ret);
+    bench_stats_sym_finish(desc, 0, count, sz, start, ret);
+}
+
+/* Message sizes for the Ascon-Hash256 benchmark when no block size is given.
+ * Small sizes show the per-call overhead, large ones the bulk absorb rate. */
+static const struct {
+    word32 sz;
+    const char* desc;
+} bench_ascon_hash_sizes[] = {
+    { 16,          "ASCON hash 16B"   },
+    { 256,         "ASCON hash 256B"  },
+    { 16 * 1024,   "ASCON hash 16KiB" },
+    { 1024 * 1024, "ASCON hash 1MiB"  },
+};
+#define BENCH_ASCON_HASH_MAX_SZ (1024 * 1024)
+
+void bench_ascon_hash(void)
+{
+    byte*  msg;
+    word32 j;
+
+    if (bench_size_set) {
+        bench_ascon_hash_helper(bench_plain, bench_size, "ASCON hash");
+        return;
+    }
+
+    msg = (byte*)XMALLOC(BENCH_ASCON_HASH_MAX_SZ, HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (msg == NULL) {
+        printf("ASCON hash message allocation failed\n");
+        return;
+    }
+    XMEMSET(msg, 0x5a, BENCH_ASCON_HASH_MAX_SZ);
+
+    for (j = 0; j < XELEM_CNT(bench_ascon_hash_sizes); j++) {
+        bench_ascon_hash_helper(msg, bench_ascon_hash_sizes[j].sz,
+            bench_ascon_hash_sizes[j].desc);
+    }
+
+    XFREE(msg, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
 }
 #endif
 
@@ -9919,6 +10127,376 @@ void bench_mlkem(int type)
 }
 #endif
 
+#ifdef BENCH_ASCON_MLKEM
+/* Operations measured by the Ascon ML-KEM benchmark. */
+enum {
+    BENCH_ASCON_MLKEM_KEYGEN = 0,
+    BENCH_ASCON_MLKEM_ENCAP  = 1,
+    BENCH_ASCON_MLKEM_DECAP  = 2,
+    BENCH_ASCON_MLKEM_OPS    = 3
+};
+
+/* Names of operations in results. */
+static const char* bench_ascon_mlkem_op_str[BENCH_ASCON_MLKEM_OPS] = {
+    "keygen", "encap", "decap"
+};
+
+#ifdef WOLFSSL_MLKEM_PROFILE
+/* Names of phases in results - order of WC_MLKEM_PHASE_*. */
+static const char* bench_ascon_mlkem_phase_str[WC_MLKEM_PHASE_CNT] = {
+    "matrix", "noise", "ntt", "compress"
+};
+#endif
+
+#if defined(HAVE_GET_CYCLES) && defined(__x86_64__)
+    #define BENCH_ASCON_MLKEM_TICK  "cycles"
+#else
+    #define BENCH_ASCON_MLKEM_TICK  "ns"
+#endif
+
+/* Clock for timing operations and phases: CPU cycles when available,
+ * otherwise nanoseconds. */
+static word64 bench_ascon_mlkem_ticks(void)
+{
+#if defined(HAVE_GET_CYCLES) && defined(__x86_64__)
+    /* Phases are short - cpuid, as used by get_intel_cycles(), costs too much
+     * when virtualized. lfence stops rdtsc being executed early. */
+    unsigned int lo_c, hi_c;
+    __asm__ __volatile__ (
+        "lfence\n\t"
+        "rdtsc"
+            : "=a"(lo_c), "=d"(hi_c)   /* out */
+            :                          /* in */
+            : "memory");               /* clobber */
+    return ((word64)lo_c) | (((word64)hi_c) << 32);
+#elif defined(BENCH_MICROSECOND)
+    return (word64)(current_time(0) * 1000);
+#else
+    return (word64)(current_time(0) * 1000000000);
+#endif
+}
+
+/* Print the results of one operation as text, CSV (-csv) or JSON (-json).
+ *
+ * Values not available in the build are left empty in CSV and null in JSON.
+ *
+ * @param [in] name   Name of algorithm.
+ * @param [in] op     Operation performed.
+ * @param [in] count  Number of operations performed.
+ * @param [in] total  Time taken for all operations.
+ * @param [in] ticks  Clock ticks taken for all operations.
+ * @param [in] perms  Ascon permutations computed for all operations.
+ * @param [in] phase  Clock ticks spent in each phase. NULL when not profiled.
+ */
+static void bench_ascon_mlkem_report(const char* name, int op, int count,
+    double total, word64 ticks, word64 perms, const word64* phase)
+{
+    static int csv_header_printed = 0;
+    double opsSec = (total > 0) ? count / total : 0;
+    double ticksOp = (double)ticks / count;
+#ifdef WOLFSSL_ASCON_PERM_COUNT
+    double permsOp = (double)perms / count;
+#endif
+#ifdef WOLFSSL_MLKEM_PROFILE
+    double phaseOp[WC_MLKEM_PHASE_CNT + 1];
+    int i;
+
+    /* Time outside of the phases: hashing, encoding and overhead. */
+    phaseOp[WC_MLKEM_PHASE_CNT] = ticksOp;
+    for (i = 0; i < WC_MLKEM_PHASE_CNT; i++) {
+        phaseOp[i] = (double)phase[i] / count;
+        phaseOp[WC_MLKEM_PHASE_CNT] -= phaseOp[i];
+    }
+    if (phaseOp[WC_MLKEM_PHASE_CNT] < 0) {
+        phaseOp[WC_MLKEM_PHASE_CNT] = 0;
+    }
+#endif
+
+    (void)perms;
+    (void)phase;
+
+    if (json_format) {
+        printf("{\"algorithm\":\"%s\",\"xof\":\"Ascon\",\"operation\":\"%s\","
+               "\"ops\":%d,\"ops_per_sec\":" FLT_FMT_PREC ","
+               "\"tick_unit\":\"" BENCH_ASCON_MLKEM_TICK "\","
+               "\"ticks_per_op\":" FLT_FMT_PREC ",",
+               name, bench_ascon_mlkem_op_str[op], count,
+               FLT_FMT_PREC_ARGS(3, opsSec), FLT_FMT_PREC_ARGS(1, ticksOp));
+    #ifdef WOLFSSL_ASCON_PERM_COUNT
+        printf("\"perms_per_op\":" FLT_FMT_PREC ",",
+               FLT_FMT_PREC_ARGS(1, permsOp));
+    #else
+        printf("\"perms_per_op\":null,");
+    #endif
+    #ifdef WOLFSSL_MLKEM_PROFILE
+        printf("\"phases\":{");
+        for (i = 0; i < WC_MLKEM_PHASE_CNT; i++) {
+            printf("\"%s\":" FLT_FMT_PREC ",", bench_ascon_mlkem_phase_str[i],
+                   FLT_FMT_PREC_ARGS(1, phaseOp[i]));
+        }
+        printf("\"other\":" FLT_FMT_PREC "}}\n",
+               FLT_FMT_PREC_ARGS(1, phaseOp[WC_MLKEM_PHASE_CNT]));
+    #else
+        printf("\"phases\":null}\n");
+    #endif
+    }
+    else if (csv_format == 1) {
+        if (!csv_header_printed) {
+            printf("%sAlgorithm,operation,ops,ops/" WOLFSSL_FIXED_TIME_UNIT
+                   "ec," BENCH_ASCON_MLKEM_TICK "/op,perms/op,matrix,noise,"
+                   "ntt,compress,other\n", info_prefix);
+            csv_header_printed = 1;
+        }
+        printf("%s,%s,%d," FLT_FMT_PREC "," FLT_FMT_PREC ",", name,
+               bench_ascon_mlkem_op_str[op], count,
+               FLT_FMT_PREC_ARGS(3, opsSec), FLT_FMT_PREC_ARGS(1, ticksOp));
+    #ifdef WOLFSSL_ASCON_PERM_COUNT
+        printf(FLT_FMT_PREC ",", FLT_FMT_PREC_ARGS(1, permsOp));
+    #else
+        printf(",");
+    #endif
+    #ifdef WOLFSSL_MLKEM_PROFILE
+        for (i = 0; i < WC_MLKEM_PHASE_CNT; i++) {
+            printf(FLT_FMT_PREC ",", FLT_FMT_PREC_ARGS(1, phaseOp[i]));
+        }
+        printf(FLT_FMT_PREC "\n",
+               FLT_FMT_PREC_ARGS(1, phaseOp[WC_MLKEM_PHASE_CNT]));
+    #else
+        printf(",,,,\n");
+    #endif
+    }
+    else {
+        printf("%-11s Ascon %-6s %6d ops took " FLT_FMT_PREC " "
+               WOLFSSL_FIXED_TIME_UNIT "ec, " FLT_FMT_PREC2 " ops/"
+               WOLFSSL_FIXED_TIME_UNIT "ec, " FLT_FMT_PREC2 " "
+               BENCH_ASCON_MLKEM_TICK "/op", name,
+               bench_ascon_mlkem_op_str[op], count,
+               FLT_FMT_PREC_ARGS(3, total), FLT_FMT_PREC2_ARGS(10, 3, opsSec),
+               FLT_FMT_PREC2_ARGS(10, 1, ticksOp));
+    #ifdef WOLFSSL_ASCON_PERM_COUNT
+        printf(", " FLT_FMT_PREC " perms/op", FLT_FMT_PREC_ARGS(1, permsOp));
+    #endif
+        printf("\n");
+    #ifdef WOLFSSL_MLKEM_PROFILE
+        printf("    " BENCH_ASCON_MLKEM_TICK "/op by phase:");
+        for (i = 0; i < WC_MLKEM_PHASE_CNT; i++) {
+            printf(" %s " FLT_FMT_PREC ",", bench_ascon_mlkem_phase_str[i],
+                   FLT_FMT_PREC_ARGS(1, phaseOp[i]));
+        }
+        printf(" other " FLT_FMT_PREC "\n",
+               FLT_FMT_PREC_ARGS(1, phaseOp[WC_MLKEM_PHASE_CNT]));
+    #endif
+    }
+}
+
+/* Perform one operation of the Ascon ML-KEM benchmark.
+ *
+ * @param [in]      type    Type of ML-KEM key.
+ * @param [in]      op      Operation to perform.
+ * @param [in, out] key     Key pair. Generated when op is key generation.
+ * @param [in]      pubKey  Public key of key pair for encapsulation.
+ * @param [in, out] ct      Cipher text. Output of encapsulation.
+ * @param [in]      ctSz    Size of cipher text in bytes.
+ * @return  0 on success.
+ */
+static int bench_ascon_mlkem_do(int type, int op, MlKemKey* key,
+    MlKemKey* pubKey, byte* ct, word32 ctSz)
+{
+    int ret = 0;
+    byte ss[WC_ML_KEM_SS_SZ];
+
+    switch (op) {
+    case BENCH_ASCON_MLKEM_KEYGEN:
+        wc_MlKemKey_Free(key);
+        ret = wc_MlKemKey_Init(key, type, HEAP_HINT, INVALID_DEVID);
+        if (ret == 0) {
+        #ifdef MLKEM_NONDETERMINISTIC
+            ret = wc_MlKemKey_MakeKey(key, &gRng);
+        #else
+            unsigned char rand[WC_ML_KEM_MAKEKEY_RAND_SZ] = {0,};
+            ret = wc_MlKemKey_MakeKeyWithRandom(key, rand, sizeof(rand));
+        #endif
+        }
+        break;
+    case BENCH_ASCON_MLKEM_ENCAP:
+    {
+    #ifdef MLKEM_NONDETERMINISTIC
+        ret = wc_MlKemKey_Encapsulate(pubKey, ct, ss, &gRng);
+    #else
+        unsigned char rand[WC_ML_KEM_ENC_RAND_SZ] = {0,};
+        ret = wc_MlKemKey_EncapsulateWithRandom(pubKey, ct, ss, rand,
+            sizeof(rand));
+    #endif
+        break;
+    }
+    case BENCH_ASCON_MLKEM_DECAP:
+        ret = wc_MlKemKey_Decapsulate(key, ss, ct, ctSz);
+        break;
+    default:
+        ret = BAD_FUNC_ARG;
+        break;
+    }
+
+    return ret;
+}
+
+/* Measure one operation of ML-KEM with Ascon and report the results.
+ *
+ * @param [in]      type    Type of ML-KEM key.
+ * @param [in]      name    Name of algorithm.
+ * @param [in]      op      Operation to measure.
+ * @param [in, out] key     Key pair.
+ * @param [in]      pubKey  Public key of key pair.
+ * @param [in, out] ct      Cipher text.
+ * @param [in]      ctSz    Size of cipher text in bytes.
+ * @return  0 on success.
+ */
+static int bench_ascon_mlkem_op(int type, const char* name, int op,
+    MlKemKey* key, MlKemKey* pubKey, byte* ct, word32 ctSz)
+{
+    int ret = 0, times, count;
+    double start;
+    word64 ticks;
+    word64 perms = 0;
+    word64* phase = NULL;
+#ifdef WOLFSSL_MLKEM_PROFILE
+    wc_MlKemProfile prof;
+
+    wc_MlKemProfile_Reset();
+#elif defined(WOLFSSL_ASCON_PERM_COUNT)
+    perms = wc_Ascon_PermutationCount();
+#endif
+
+    bench_stats_start(&count, &start);
+    ticks = bench_ascon_mlkem_ticks();
+    do {
+        for (times = 0; (ret == 0) && (times < agreeTimes); times++) {
+            ret = bench_ascon_mlkem_do(type, op, key, pubKey, ct, ctSz);
+        }
+        count += times;
+    } while ((ret == 0) && bench_stats_check(start));
+    ticks = bench_ascon_mlkem_ticks() - ticks;
+
+    if (ret != 0) {
+        printf("%sBenchmark %s Ascon %s failed: %d\n", err_prefix, name,
+               bench_ascon_mlkem_op_str[op], ret);
+        return ret;
+    }
+
+#ifdef WOLFSSL_MLKEM_PROFILE
+    ret = wc_MlKemProfile_Get(&prof);
+    if (ret != 0) {
+        return ret;
+    }
+    perms = prof.perms;
+    phase = prof.ticks;
+#elif defined(WOLFSSL_ASCON_PERM_COUNT)
+    perms = wc_Ascon_PermutationCount() - perms;
+#endif
+
+    bench_ascon_mlkem_report(name, op, count, current_time(0) - start, ticks,
+        perms, phase);
+
+    return 0;
+}
+
+/* Benchmark ML-KEM built on Ascon with per-operation detail.
+ *
+ * Reports operations per second, clock ticks and Ascon permutations per
+ * operation and, when built with WOLFSSL_MLKEM_PROFILE, the ticks spent in
+ * each phase of the operation.
+ *
+ * @param [in] type  Type of ML-KEM key.
+ */
+void bench_ascon_mlkem(int type)
+{
+#ifdef WOLFSSL_SMALL_STACK
+    MlKemKey *key = NULL;
+    MlKemKey *pubKey = NULL;
+#else
+    MlKemKey key[1];
+    MlKemKey pubKey[1];
+#endif
+    int ret = 0;
+    const char* name = NULL;
+    byte pub[WC_ML_KEM_MAX_PUBLIC_KEY_SIZE];
+    byte ct[WC_ML_KEM_MAX_CIPHER_TEXT_SIZE];
+    word32 pubLen = 0;
+    word32 ctSz = 0;
+    int op;
+
+    switch (type) {
+#ifdef WOLFSSL_WC_ML_KEM_512
+    case WC_ML_KEM_512:
+        name = "ML-KEM-512";
+        break;
+#endif
+#ifdef WOLFSSL_WC_ML_KEM_768
+    case WC_ML_KEM_768:
+        name = "ML-KEM-768";
+        break;
+#endif
+#ifdef WOLFSSL_WC_ML_KEM_1024
+    case WC_ML_KEM_1024:
+        name = "ML-KEM-1024";
+        break;
+#endif
+    default:
+        return;
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    key = (MlKemKey *)XMALLOC(sizeof(*key), HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    if (key == NULL)
+        return;
+    pubKey = (MlKemKey *)XMALLOC(sizeof(*pubKey), HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if (pubKey == NULL) {
+        XFREE(key, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+        return;
+    }
+#endif
+
+#ifdef WOLFSSL_MLKEM_PROFILE
+    wc_MlKemProfile_SetClock(bench_ascon_mlkem_ticks);
+#endif
+
+    ret = wc_MlKemKey_Init(key, type, HEAP_HINT, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_MlKemKey_Init(pubKey, type, HEAP_HINT, INVALID_DEVID);
+    }
+
+    for (op = 0; (ret == 0) && (op < BENCH_ASCON_MLKEM_OPS); op++) {
+        ret = bench_ascon_mlkem_op(type, name, op, key, pubKey, ct, ctSz);
+        if ((ret == 0) && (op == BENCH_ASCON_MLKEM_KEYGEN)) {
+            /* Encapsulate with the public key of the last key generated. */
+            ret = wc_MlKemKey_PublicKeySize(key, &pubLen);
+            if (ret == 0) {
+                ret = wc_MlKemKey_EncodePublicKey(key, pub, pubLen);
+            }
+            if (ret == 0) {
+                ret = wc_MlKemKey_DecodePublicKey(pubKey, pub, pubLen);
+            }
+            if (ret == 0) {
+                ret = wc_MlKemKey_CipherTextSize(pubKey, &ctSz);
+            }
+        }
+    }
+
+#ifdef WOLFSSL_MLKEM_PROFILE
+    wc_MlKemProfile_SetClock(NULL);
+#endif
+
+    wc_MlKemKey_Free(pubKey);
+    wc_MlKemKey_Free(key);
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(key, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(pubKey, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+}
+#endif /* BENCH_ASCON_MLKEM */
+
 #if defined(WOLFSSL_HAVE_LMS) && !defined(WOLFSSL_LMS_VERIFY_ONLY)
 #ifndef WOLFSSL_WC_LMS_SERIALIZE_STATE
 #ifndef WOLFSSL_NO_LMS_SHA256_256
@@ -15196,6 +15774,7 @@ void benchmark_configure(word32 block_size)
     if (block_size > 0) {
         numBlocks = (int)((word32)numBlocks * bench_size / block_size);
         bench_size = block_size;
+        bench_size_set = 1;
     }
 }
 
@@ -15241,6 +15820,10 @@ static void Usage(void)
     printf("%s", bench_Usage_msg1[lng_index][e++]);    /* option -? */
     printf("%s", bench_Usage_msg1[lng_index][e++]);    /* English / Japanese */
     printf("%s", bench_Usage_msg1[lng_index][e++]);    /* option -csv */
+#ifdef BENCH_ASCON_MLKEM
+    printf("%s", bench_Usage_msg1[lng_index][e]);      /* option -json */
+#endif
+    e++;
     printf("%s", bench_Usage_msg1[lng_index][e++]);    /* option -base10 */
 #if defined(HAVE_AESGCM) || defined(HAVE_AESCCM)
     printf("%s", bench_Usage_msg1[lng_index][e++]);    /* option -no_aad */
@@ -15490,6 +16073,11 @@ int wolfcrypt_benchmark_main(int argc, char** argv)
             csv_format = 1;
         }
 #endif
+#ifdef BENCH_ASCON_MLKEM
+        else if (string_matches(argv[1], "-json")) {
+            json_format = 1;
+        }
+#endif
 
 #ifdef WC_ENABLE_BENCH_THREADING
         else if (string_matches(argv[1], "-threads")) {
@@ -7072,6 +7072,16 @@ void AES_GCM_encrypt_avx2(const unsigned char *in, unsigned char *out,
                           word32 tbytes, const unsigned char* key,
                           int nr)
                           XASM_LINK("AES_GCM_encrypt_avx2");
+#if defined(WOLFSSL_X86_64_BUILD) && !defined(_MSC_VER)
+/* Two records of the same length, encrypted in the lanes of YMM registers. */
+#define WC_AES_GCM_ENCRYPT_X2
+void AES_GCM_encrypt_x2_vaes(const unsigned char** in, unsigned char** out,
+                             const unsigned char** addt,
+                             const unsigned char** ivec, unsigned char** tag,
+                             word32 nbytes, word32 abytes,
+                             const unsigned char* key, int nr)
+                             XASM_LINK("AES_GCM_encrypt_x2_vaes");
+#endif
 #endif /* HAVE_INTEL_AVX2 */
 #endif /* HAVE_INTEL_AVX1 */
 
@@ -9022,6 +9032,145 @@ int wc_AesGcmEncrypt(Aes* aes, byte* out, const byte* in, word32 sz,
 }
 #endif
 
+#ifdef WC_AES_GCM_ENCRYPT_X2
+/* Check whether two records can be encrypted together.
+ *
+ * The records must have the same plaintext and AAD lengths and 12 byte IVs.
+ *
+ * @param [in]  aes  AES object.
+ * @param [in]  a    First record.
+ * @param [in]  b    Second record.
+ * @return  1 when the records can be encrypted together.
+ * @return  0 otherwise.
+ */
+static int AesGcmRecordsX2(const Aes* aes, const wc_AesGcmRecord* a,
+    const wc_AesGcmRecord* b)
+{
+    const wc_AesGcmRecord* r[2];
+    int i;
+
+    if (!aes->use_aesni || !IS_INTEL_AVX2(intel_flags) ||
+            !IS_INTEL_VAES(intel_flags)) {
+        return 0;
+    }
+#ifdef WOLF_CRYPTO_CB
+    if (aes->devId != INVALID_DEVID) {
+        return 0;
+    }
+#endif
+#if defined(WOLFSSL_ASYNC_CRYPT) && defined(WC_ASYNC_ENABLE_AES)
+    if (aes->asyncDev.marker == WOLFSSL_ASYNC_MARKER_AES) {
+        return 0;
+    }
+#endif
+    if ((a->sz != b->sz) || (a->authInSz != b->authInSz)) {
+        return 0;
+    }
+
+    r[0] = a;
+    r[1] = b;
+    for (i = 0; i < 2; i++) {
+        if ((r[i]->ivSz != GCM_NONCE_MID_SZ) || (r[i]->iv == NULL) ||
+                (r[i]->authTag == NULL) ||
+                (r[i]->authTagSz < WOLFSSL_MIN_AUTH_TAG_SZ) ||
+                (r[i]->authTagSz > WC_AES_BLOCK_SIZE) ||
+                ((r[i]->sz > 0) && ((r[i]->in == NULL) ||
+                                    (r[i]->out == NULL))) ||
+                ((r[i]->authInSz > 0) && (r[i]->authIn == NULL))) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Encrypt two records with one pass over the key schedule and powers of H.
+ *
+ * The counter blocks and GHASH of the records are processed in the two
+ * 128-bit lanes of each YMM register.
+ *
+ * @param [in]  aes   AES object.
+ * @param [in]  recs  Two records checked with AesGcmRecordsX2().
+ * @return  0 on success.
+ * @return  Other value when the vector registers can't be used - records are
+ *          not encrypted.
+ */
+static int AesGcmEncryptX2(Aes* aes, const wc_AesGcmRecord* recs)
+{
+    int ret;
+    const byte* in[2];
+    byte* out[2];
+    const byte* addt[2];
+    const byte* iv[2];
+    byte* tag[2];
+    byte tags[2][WC_AES_BLOCK_SIZE];
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        in[i] = recs[i].in;
+        out[i] = recs[i].out;
+        addt[i] = recs[i].authIn;
+        iv[i] = recs[i].iv;
+        tag[i] = tags[i];
+    }
+
+    ret = SAVE_VECTOR_REGISTERS2();
+    if (ret != 0) {
+        return ret;
+    }
+    AES_GCM_encrypt_x2_vaes(in, out, addt, iv, tag, recs[0].sz,
+        recs[0].authInSz, (const byte*)aes->key, (int)aes->rounds);
+    RESTORE_VECTOR_REGISTERS();
+
+    for (i = 0; i < 2; i++) {
+        XMEMCPY(recs[i].authTag, tags[i], recs[i].authTagSz);
+    }
+
+    return 0;
+}
+#endif /* WC_AES_GCM_ENCRYPT_X2 */
+
+/* AES-GCM encrypt a run of records with the same key.
+ *
+ * Consecutive records of the same length with 12 byte IVs are encrypted in
+ * pairs when the CPU has VAES and VPCLMULQDQ: the key and powers of H are set
+ * up once and the CTR and GHASH streams of both records are interleaved.
+ * Other records are encrypted with wc_AesGcmEncrypt().
+ *
+ * @param [in]  aes   AES object with key set by wc_AesGcmSetKey().
+ * @param [in]  recs  Records to encrypt.
+ * @param [in]  cnt   Number of records.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when aes is NULL, recs is NULL and cnt is not zero or
+ *          a record's arguments are invalid.
+ */
+int wc_AesGcmEncryptRecords(Aes* aes, const wc_AesGcmRecord* recs, word32 cnt)
+{
+    int ret = 0;
+    word32 i = 0;
+
+    if ((aes == NULL) || ((recs == NULL) && (cnt != 0))) {
+        return BAD_FUNC_ARG;
+    }
+
+    while ((ret == 0) && (i < cnt)) {
+    #ifdef WC_AES_GCM_ENCRYPT_X2
+        /* When the pair can't be done, encrypt the records one at a time. */
+        if ((i + 1 < cnt) && AesGcmRecordsX2(aes, &recs[i], &recs[i + 1]) &&
+                (AesGcmEncryptX2(aes, &recs[i]) == 0)) {
+            i += 2;
+            continue;
+        }
+    #endif
+        ret = wc_AesGcmEncrypt(aes, recs[i].out, recs[i].in, recs[i].sz,
+            recs[i].iv, recs[i].ivSz, recs[i].authTag, recs[i].authTagSz,
+            recs[i].authIn, recs[i].authInSz);
+        i++;
+    }
+
+    return ret;
+}
+
 
 /* AES GCM Decrypt */
 #if defined(HAVE_AES_DECRYPT) || defined(HAVE_AESGCM_DECRYPT)
@@ -30,6 +30,11 @@
     #define WOLFSSL_MISC_INCLUDED
     #include <wolfcrypt/src/misc.c>
 #endif
+#ifdef WOLFSSL_ASCON_X86_64_ASM
+    #include <wolfssl/wolfcrypt/cpuid.h>
+
+    static cpuid_flags_t cpuid_flags = WC_CPUID_INITIALIZER;
+#endif
 
 /*
  * Implementation of the ASCON AEAD and HASH algorithms. Based on the NIST
@@ -111,7 +116,7 @@ static WC_INLINE void ascon_round(AsconState* a, byte round)
     a->s64[2] = tmp2 ^ rotrFixed64(tmp2,  1) ^ rotrFixed64(tmp2,  6);
 }
 
-static void permutation(AsconState* a, byte rounds)
+static void permutation_c(AsconState* a, byte rounds)
 {
     byte i = start_index(rounds);
     for (; i < MAX_ROUNDS; i++) {
@@ -167,11 +172,98 @@ static void permutation(AsconState* a, byte rounds)
 #define _permutation(a, rounds) \
     p ## rounds(a)
 
-#define permutation(a, rounds) \
+#define permutation_c(a, rounds) \
     _permutation(a, rounds)
 
 #endif
 
+#ifdef WOLFSSL_ASCON_PERM_COUNT
+/* Permutations computed by this thread. */
+static THREAD_LS_T word64 ascon_perm_cnt = 0;
+
+/* Count permutations - lanes of a vector permutation are counted separately. */
+#define ASCON_PERM_COUNT(n) ascon_perm_cnt += (word64)(n)
+
+/* Get the number of permutations computed by the calling thread.
+ *
+ * Used when profiling - take the difference of two calls to count the
+ * permutations performed by an operation.
+ *
+ * @return  Number of permutations computed.
+ */
+word64 wc_Ascon_PermutationCount(void)
+{
+    return ascon_perm_cnt;
+}
+#else
+#define ASCON_PERM_COUNT(n) WC_DO_NOTHING
+#endif
+
+#ifdef WOLFSSL_ASCON_X86_64_ASM
+
+/* Load the CPU features once - called by each Init function. */
+#define ASCON_SET_CPUID()   cpuid_get_flags_ex(&cpuid_flags)
+
+/* Use the BMI1/BMI2 assembly code when available, otherwise the C code. */
+#define permutation(a, rounds) do {                                            \
+    ASCON_PERM_COUNT(1);                                                       \
+    if (IS_INTEL_BMI1(cpuid_flags) && IS_INTEL_BMI2(cpuid_flags)) {            \
+        ascon_permute_bmi2((a)->s64, MAX_ROUNDS - (rounds));                   \
+    }                                                                          \
+    else {                                                                     \
+        permutation_c(a, rounds);                                              \
+    }                                                                          \
+} while (0)
+
+#else
+
+#define ASCON_SET_CPUID()   WC_DO_NOTHING
+
+#define permutation(a, rounds) do {                                            \
+    ASCON_PERM_COUNT(1);                                                       \
+    permutation_c(a, rounds);                                                  \
+} while (0)
+
+#endif
+
+#if (ASCON_HASH256_RATE != 8) || (ASCON_XOF128_RATE != 8) || \
+    (ASCON_HASH256_ROUNDS != ASCON_XOF128_ROUNDS)
+    #error Ascon-Hash256 and Ascon-XOF128 absorb with the same parameters
+#endif
+
+/* Absorb whole rate blocks straight from the caller's buffer with word loads.
+ * Ascon-Hash256 and Ascon-XOF128 both have a rate of one word and use p12.
+ *
+ * @param [in, out] s       Ascon state.
+ * @param [in]      data    Data to absorb.
+ * @param [in]      dataSz  Size of data in bytes.
+ * @return  Number of bytes absorbed - a multiple of the rate.
+ */
+static word32 ascon_absorb_blocks(AsconState* s, const byte* data,
+    word32 dataSz)
+{
+    word32 i = 0;
+
+#ifdef WOLFSSL_ASCON_X86_64_ASM
+    /* Check CPU features once for all blocks. */
+    if (IS_INTEL_BMI1(cpuid_flags) && IS_INTEL_BMI2(cpuid_flags)) {
+        for (; i + sizeof(word64) <= dataSz; i += sizeof(word64)) {
+            s->s64[0] ^= readUnalignedWord64(data + i);
+            ascon_permute_bmi2(s->s64, MAX_ROUNDS - ASCON_HASH256_ROUNDS);
+        }
+        ASCON_PERM_COUNT(i / sizeof(word64));
+        return i;
+    }
+#endif
+    for (; i + sizeof(word64) <= dataSz; i += sizeof(word64)) {
+        s->s64[0] ^= readUnalignedWord64(data + i);
+        permutation_c(s, ASCON_HASH256_ROUNDS);
+    }
+    ASCON_PERM_COUNT(i / sizeof(word64));
+
+    return i;
+}
+
 /* AsconHash API */
 
 wc_AsconHash256* wc_AsconHash256_New(void)
@@ -201,6 +293,7 @@ int wc_AsconHash256_Init(wc_AsconHash256* a)
         return BAD_FUNC_ARG;
 
     XMEMSET(a, 0, sizeof(*a));
+    ASCON_SET_CPUID();
 
     a->state.s64[0] = ASCON_HASH256_IV;
     permutation(&a->state, ASCON_HASH256_ROUNDS);
@@ -239,12 +332,10 @@ int wc_AsconHash256_Update(wc_AsconHash256* a, const byte* data, word32 dataSz)
         a->lastBlkSz = 0;
     }
 
-    while (dataSz >= ASCON_HASH256_RATE) {
-        /* Read in input as little endian numbers */
-        xorbuf(a->state.s64, data, ASCON_HASH256_RATE);
-        permutation(&a->state, ASCON_HASH256_ROUNDS);
-        data += ASCON_HASH256_RATE;
-        dataSz -= ASCON_HASH256_RATE;
+    if (dataSz >= ASCON_HASH256_RATE) {
+        word32 done = ascon_absorb_blocks(&a->state, data, dataSz);
+        data += done;
+        dataSz -= done;
     }
 
     xorbuf(a->state.s64, data, dataSz);
@@ -301,6 +392,7 @@ int wc_AsconXof128_Init(wc_AsconXof128* a)
         return BAD_FUNC_ARG;
 
     XMEMSET(a, 0, sizeof(*a));
+    ASCON_SET_CPUID();
 
     /* Algorithm 6: Initialization phase */
     a->state.s64[0] = ASCON_XOF128_IV;
@@ -347,11 +439,10 @@ int wc_AsconXof128_Absorb(wc_AsconXof128* a, const byte* data, word32 dataSz)
     }
 
     /* Algorithm 6: Absorbing phase */
-    while (dataSz >= ASCON_XOF128_RATE) {
-        xorbuf(a->state.s64, data, ASCON_XOF128_RATE);
-        permutation(&a->state, ASCON_XOF128_ROUNDS);
-        data += ASCON_XOF128_RATE;
-        dataSz -= ASCON_XOF128_RATE;
+    if (dataSz >= ASCON_XOF128_RATE) {
+        word32 done = ascon_absorb_blocks(&a->state, data, dataSz);
+        data += done;
+        dataSz -= done;
     }
 
     /* Store partial block */
@@ -396,8 +487,406 @@ int wc_AsconXof128_Squeeze(wc_AsconXof128* a, byte* out, word32 outSz)
     return 0;
 }
 
+/* Multi-lane AsconXOF API
+ *
+ * The objects are independent - only the permutations are computed together.
+ * Output is identical to calling the single object API on each object.
+ */
+
+#ifdef WOLFSSL_ASCON_X86_64_ASM
+/* Permute the interleaved states of a group of lanes.
+ *
+ * @param [in, out] s       Interleaved state of the lanes.
+ * @param [in]      width   Number of lanes in the group: 4 or 8.
+ * @param [in]      rounds  Number of rounds to perform.
+ */
+static void permutation_lanes(word64* s, int width, byte rounds)
+{
+    if (width == 8) {
+        ascon_permute_x8_avx512(s, MAX_ROUNDS - rounds);
+    }
+    else {
+        ascon_permute_x4_avx2(s, MAX_ROUNDS - rounds);
+    }
+}
+
+/* Number of lanes the vector permutation processes at once.
+ *
+ * @param [in] lanes  Number of lanes remaining to be processed.
+ * @return  8 when AVX-512 is available and more than 4 lanes remain.
+ * @return  4 when AVX2 is available.
+ * @return  1 when no vector implementation can be used.
+ */
+static int ascon_lanes_width(int lanes)
+{
+    ASCON_SET_CPUID();
+
+    if (lanes == 1) {
+        return 1;
+    }
+#ifndef NO_AVX512_SUPPORT
+    if ((lanes > 4) && IS_INTEL_AVX512(cpuid_flags)) {
+        return 8;
+    }
+#endif
+#ifndef NO_AVX2_SUPPORT
+    if (IS_INTEL_AVX2(cpuid_flags)) {
+        return 4;
+    }
+#endif
+    return 1;
+}
+
+/* Copy lane states into interleaved form. Unused lanes are zeroed. */
+static void ascon_lanes_load(word64* s, int width, wc_AsconXof128** a,
+    int lanes)
+{
+    int i;
+    int j;
+
+    for (i = 0; i < 5; i++) {
+        for (j = 0; j < width; j++) {
+            s[i * width + j] = (j < lanes) ? a[j]->state.s64[i] : 0;
+        }
+    }
+}
+
+/* Copy interleaved state back into lane states. */
+static void ascon_lanes_store(const word64* s, int width, wc_AsconXof128** a,
+    int lanes)
+{
+    int i;
+    int j;
+
+    for (i = 0; i < 5; i++) {
+        for (j = 0; j < lanes; j++) {
+            a[j]->state.s64[i] = s[i * width + j];
+        }
+    }
+}
+
+/* Absorb whole blocks into a group of lanes with no buffered data.
+ *
+ * @param [in, out] a       Array of XOF objects.
+ * @param [in]      lanes   Number of objects in group.
+ * @param [in]      width   Number of lanes vector permutation processes.
+ * @param [in]      data    Array of data to absorb - one per object.
+ * @param [in]      dataSz  Number of bytes to absorb from each.
+ * @return  0 on success.
+ */
+static int ascon_xof128_absorb_lanes(wc_AsconXof128** a, int lanes, int width,
+    const byte* const* data, word32 dataSz)
+{
+    word64 s[5 * ASCON_XOF128_MAX_LANES];
+    word32 off = 0;
+    int j;
+
+    if ((width == 1) || (SAVE_VECTOR_REGISTERS2() != 0)) {
+        int ret = 0;
+        for (j = 0; (ret == 0) && (j < lanes); j++) {
+            ret = wc_AsconXof128_Absorb(a[j], data[j], dataSz);
+        }
+        return ret;
+    }
+
+    ascon_lanes_load(s, width, a, lanes);
+    /* Algorithm 6: Absorbing phase */
+    for (; off + ASCON_XOF128_RATE <= dataSz; off += ASCON_XOF128_RATE) {
+        for (j = 0; j < lanes; j++) {
+            s[j] ^= readUnalignedWord64(data[j] + off);
+        }
+        permutation_lanes(s, width, ASCON_XOF128_ROUNDS);
+        ASCON_PERM_COUNT(lanes);
+    }
+    ascon_lanes_store(s, width, a, lanes);
+    RESTORE_VECTOR_REGISTERS();
+    ForceZero(s, sizeof(s));
+
+    /* Store partial block */
+    for (j = 0; j < lanes; j++) {
+        xorbuf(a[j]->state.s64, data[j] + off, dataSz - off);
+        a[j]->lastBlkSz = (byte)(dataSz - off);
+    }
+
+    return 0;
+}
+
+/* Squeeze out data from a group of lanes in the same phase.
+ *
+ * @param [in, out] a      Array of XOF objects.
+ * @param [in]      lanes  Number of objects in group.
+ * @param [in]      width  Number of lanes vector permutation processes.
+ * @param [out]     out    Array of buffers to write to - one per object.
+ * @param [in]      outSz  Number of bytes to write to each buffer.
+ * @return  0 on success.
+ */
+static int ascon_xof128_squeeze_lanes(wc_AsconXof128** a, int lanes, int width,
+    byte* const* out, word32 outSz)
+{
+    word64 s[5 * ASCON_XOF128_MAX_LANES];
+    word32 off = 0;
+    int absorbing = a[0]->absorbing;
+    int j;
+
+    if ((width == 1) || (SAVE_VECTOR_REGISTERS2() != 0)) {
+        int ret = 0;
+        for (j = 0; (ret == 0) && (j < lanes); j++) {
+            ret = wc_AsconXof128_Squeeze(a[j], out[j], outSz);
+        }
+        return ret;
+    }
+
+    if (absorbing) {
+        /* Algorithm 6: Pad final message block */
+        for (j = 0; j < lanes; j++) {
+            a[j]->state.s8[a[j]->lastBlkSz] ^= 1;
+        }
+    }
+    ascon_lanes_load(s, width, a, lanes);
+    if (absorbing) {
+        permutation_lanes(s, width, ASCON_XOF128_ROUNDS);
+        ASCON_PERM_COUNT(lanes);
+    }
+
+    /* Algorithm 6: Squeezing phase */
+    while (outSz > 0) {
+        word32 toExtract = min(ASCON_XOF128_RATE, outSz);
+        for (j = 0; j < lanes; j++) {
+            XMEMCPY(out[j] + off, &s[j], toExtract);
+        }
+        off += toExtract;
+        outSz -= toExtract;
+
+        if (outSz > 0) {
+            permutation_lanes(s, width, ASCON_XOF128_ROUNDS);
+            ASCON_PERM_COUNT(lanes);
+        }
+    }
+    ascon_lanes_store(s, width, a, lanes);
+    RESTORE_VECTOR_REGISTERS();
+    ForceZero(s, sizeof(s));
+
+    for (j = 0; j < lanes; j++) {
+        a[j]->absorbing = 0;
+        a[j]->squeezing = 1;
+        a[j]->lastBlkSz = 0;
+    }
+
+    return 0;
+}
+#endif /* WOLFSSL_ASCON_X86_64_ASM */
+
+/* Absorb the same amount of data into each of a number of XOF objects.
+ *
+ * Permutations are computed for 4 (AVX2) or 8 (AVX-512) objects at once when
+ * available.
+ *
+ * @param [in, out] a       Array of XOF objects.
+ * @param [in]      lanes   Number of objects in array.
+ * @param [in]      data    Array of data to absorb - one per object.
+ * @param [in]      dataSz  Number of bytes to absorb from each.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a, data or an element is NULL or lanes is
+ *          invalid.
+ * @return  BAD_STATE_E when an object has started squeezing.
+ */
+int wc_AsconXof128_AbsorbX(wc_AsconXof128** a, int lanes,
+    const byte* const* data, word32 dataSz)
+{
+    int ret = 0;
+    int j;
+
+    if (a == NULL || data == NULL || lanes <= 0 ||
+            lanes > ASCON_XOF128_MAX_LANES)
+        return BAD_FUNC_ARG;
+    for (j = 0; j < lanes; j++) {
+        if (a[j] == NULL || (data[j] == NULL && dataSz != 0))
+            return BAD_FUNC_ARG;
+        if (a[j]->squeezing)
+            return BAD_STATE_E;
+    }
+
+#ifdef WOLFSSL_ASCON_X86_64_ASM
+    for (j = 0; j < lanes; j++) {
+        if (a[j]->lastBlkSz != 0)
+            break;
+    }
+    /* Only whole blocks are absorbed together. */
+    if (j == lanes && dataSz >= ASCON_XOF128_RATE) {
+        while ((ret == 0) && (lanes > 0)) {
+            int width = ascon_lanes_width(lanes);
+            int cnt = (lanes < width) ? lanes : width;
+
+            ret = ascon_xof128_absorb_lanes(a, cnt, width, data, dataSz);
+            a += cnt;
+            data += cnt;
+            lanes -= cnt;
+        }
+        return ret;
+    }
+#endif
+
+    for (j = 0; (ret == 0) && (j < lanes); j++) {
+        ret = wc_AsconXof128_Absorb(a[j], data[j], dataSz);
+    }
+
+    return ret;
+}
+
+/* Squeeze the same amount of data out of each of a number of XOF objects.
+ *
+ * Permutations are computed for 4 (AVX2) or 8 (AVX-512) objects at once when
+ * available and all objects are in the same phase.
+ *
+ * @param [in, out] a      Array of XOF objects.
+ * @param [in]      lanes  Number of objects in array.
+ * @param [out]     out    Array of buffers to write to - one per object.
+ * @param [in]      outSz  Number of bytes to write to each buffer.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a, out or an element is NULL or lanes is
+ *          invalid.
+ */
+int wc_AsconXof128_SqueezeX(wc_AsconXof128** a, int lanes, byte* const* out,
+    word32 outSz)
+{
+    int ret = 0;
+    int j;
+
+    if (a == NULL || out == NULL || lanes <= 0 ||
+            lanes > ASCON_XOF128_MAX_LANES)
+        return BAD_FUNC_ARG;
+    for (j = 0; j < lanes; j++) {
+        if (a[j] == NULL || (out[j] == NULL && outSz != 0))
+            return BAD_FUNC_ARG;
+    }
+
+    if (outSz == 0)
+        return 0;
+
+#ifdef WOLFSSL_ASCON_X86_64_ASM
+    for (j = 1; j < lanes; j++) {
+        if (a[j]->absorbing != a[0]->absorbing)
+            break;
+    }
+    if (j == lanes) {
+        while ((ret == 0) && (lanes > 0)) {
+            int width = ascon_lanes_width(lanes);
+            int cnt = (lanes < width) ? lanes : width;
+
+            ret = ascon_xof128_squeeze_lanes(a, cnt, width, out, outSz);
+            a += cnt;
+            out += cnt;
+            lanes -= cnt;
+        }
+        return ret;
+    }
+#endif
+
+    for (j = 0; (ret == 0) && (j < lanes); j++) {
+        ret = wc_AsconXof128_Squeeze(a[j], out[j], outSz);
+    }
+
+    return ret;
+}
+
+/* Squeeze the same amount of data out of each of 4 XOF objects.
+ *
+ * @param [in, out] a      Array of 4 XOF objects.
+ * @param [out]     out    Array of 4 buffers to write to.
+ * @param [in]      outSz  Number of bytes to write to each buffer.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a, out or an element is NULL.
+ */
+int wc_AsconXof128_SqueezeX4(wc_AsconXof128** a, byte* const* out,
+    word32 outSz)
+{
+    return wc_AsconXof128_SqueezeX(a, 4, out, outSz);
+}
+
+/* Squeeze the same amount of data out of each of 8 XOF objects.
+ *
+ * @param [in, out] a      Array of 8 XOF objects.
+ * @param [out]     out    Array of 8 buffers to write to.
+ * @param [in]      outSz  Number of bytes to write to each buffer.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a, out or an element is NULL.
+ */
+int wc_AsconXof128_SqueezeX8(wc_AsconXof128** a, byte* const* out,
+    word32 outSz)
+{
+    return wc_AsconXof128_SqueezeX(a, 8, out, outSz);
+}
+
 /* AsconAEAD API */
 
+/* Initialization and associated data phases - Algorithm 3, Steps 1-10.
+ * Key and nonce have already been loaded into the state. */
+static void ascon_aead128_absorb_ad(AsconState* s, const word64* key,
+    const byte* ad, word32 adSz)
+{
+    permutation(s, ASCON_AEAD128_ROUNDS_PA);
+    s->s64[3] ^= key[0];
+    s->s64[4] ^= key[1];
+
+    if (adSz > 0) {
+        while (adSz >= ASCON_AEAD128_RATE) {
+            xorbuf(s->s64, ad, ASCON_AEAD128_RATE);
+            permutation(s, ASCON_AEAD128_ROUNDS_PB);
+            ad += ASCON_AEAD128_RATE;
+            adSz -= ASCON_AEAD128_RATE;
+        }
+        xorbuf(s->s64, ad, adSz);
+        /* Pad the last block */
+        s->s8[adSz] ^= 1;
+        permutation(s, ASCON_AEAD128_ROUNDS_PB);
+    }
+    s->s64[4] ^= 1ULL << 63;
+}
+
+/* Pad the last block and run the finalization phase. Tag is in s64[3..4]. */
+static void ascon_aead128_finalize(AsconState* s, const word64* key,
+    word32 lastBlkSz)
+{
+    s->s8[lastBlkSz] ^= 1;
+
+    s->s64[2] ^= key[0];
+    s->s64[3] ^= key[1];
+    permutation(s, ASCON_AEAD128_ROUNDS_PA);
+    s->s64[3] ^= key[0];
+    s->s64[4] ^= key[1];
+}
+
+/* Decrypt up to a rate of data. The ciphertext is copied first so that out
+ * may be the same buffer as in. */
+static WC_INLINE void ascon_aead128_decrypt_block(byte* s, byte* out,
+    const byte* in, word32 sz)
+{
+    byte c[ASCON_AEAD128_RATE];
+
+    XMEMCPY(c, in, sz);
+    xorbufout(out, s, c, sz);
+    XMEMCPY(s, c, sz);
+}
+
+/* Message complete - clear all of a one-time object but keep the key of a
+ * keyed object so that only a new nonce is needed. */
+static void ascon_aead128_done(wc_AsconAEAD128* a)
+{
+    if (a->keyKeep) {
+        ForceZero(&a->state, sizeof(a->state));
+        a->state.s64[0] = ASCON_AEAD128_IV;
+        a->state.s64[1] = a->key[0];
+        a->state.s64[2] = a->key[1];
+        a->lastBlkSz = 0;
+        a->nonceSet = 0;
+        a->adSet = 0;
+        a->op = ASCON_AEAD128_NOTSET;
+    }
+    else {
+        wc_AsconAEAD128_Clear(a);
+    }
+}
+
 wc_AsconAEAD128* wc_AsconAEAD128_New(void)
 {
     wc_AsconAEAD128 *ret = (wc_AsconAEAD128*) XMALLOC(sizeof(wc_AsconAEAD128),
@@ -425,6 +914,7 @@ int wc_AsconAEAD128_Init(wc_AsconAEAD128 *a)
         return BAD_FUNC_ARG;
 
     XMEMSET(a, 0, sizeof(*a));
+    ASCON_SET_CPUID();
     a->state.s64[0] = ASCON_AEAD128_IV;
 
     return 0;
@@ -473,23 +963,7 @@ int wc_AsconAEAD128_SetAD(wc_AsconAEAD128* a, const byte* ad,
     if (!a->keySet || !a->nonceSet) /* key and nonce must be set before */
         return BAD_STATE_E;
 
-    permutation(&a->state, ASCON_AEAD128_ROUNDS_PA);
-    a->state.s64[3] ^= a->key[0];
-    a->state.s64[4] ^= a->key[1];
-
-    if (adSz > 0) {
-        while (adSz >= ASCON_AEAD128_RATE) {
-            xorbuf(a->state.s64, ad, ASCON_AEAD128_RATE);
-            permutation(&a->state, ASCON_AEAD128_ROUNDS_PB);
-            ad += ASCON_AEAD128_RATE;
-            adSz -= ASCON_AEAD128_RATE;
-        }
-        xorbuf(a->state.s64, ad, adSz);
-        /* Pad the last block */
-        a->state.s8[adSz] ^= 1;
-        permutation(&a->state, ASCON_AEAD128_ROUNDS_PB);
-    }
-    a->state.s64[4] ^= 1ULL << 63;
+    ascon_aead128_absorb_ad(&a->state, a->key, ad, adSz);
 
     a->adSet = 1;
     return 0;
@@ -553,18 +1027,12 @@ int wc_AsconAEAD128_EncryptFinal(wc_AsconAEAD128* a, byte* tag)
         return BAD_STATE_E;
 
     /* Process leftover from last block */
-    a->state.s8[a->lastBlkSz] ^= 1;
-
-    a->state.s64[2] ^= a->key[0];
-    a->state.s64[3] ^= a->key[1];
-    permutation(&a->state, ASCON_AEAD128_ROUNDS_PA);
-    a->state.s64[3] ^= a->key[0];
-    a->state.s64[4] ^= a->key[1];
+    ascon_aead128_finalize(&a->state, a->key, a->lastBlkSz);
 
     XMEMCPY(tag, &a->state.s64[3], ASCON_AEAD128_TAG_SZ);
 
     /* Clear state as soon as possible */
-    wc_AsconAEAD128_Clear(a);
+    ascon_aead128_done(a);
 
     return 0;
 
@@ -587,8 +1055,8 @@ int wc_AsconAEAD128_DecryptUpdate(wc_AsconAEAD128* a, byte* out,
     /* Process leftover block */
     if (a->lastBlkSz != 0) {
         word32 toProcess = min(ASCON_AEAD128_RATE - a->lastBlkSz, inSz);
-        xorbufout(out, a->state.s8 + a->lastBlkSz, in, toProcess);
-        XMEMCPY(a->state.s8 + a->lastBlkSz, in, toProcess);
+        ascon_aead128_decrypt_block(a->state.s8 + a->lastBlkSz, out, in,
+            toProcess);
         in += toProcess;
         out += toProcess;
         inSz -= toProcess;
@@ -602,16 +1070,14 @@ int wc_AsconAEAD128_DecryptUpdate(wc_AsconAEAD128* a, byte* out,
     }
 
     while (inSz >= ASCON_AEAD128_RATE) {
-        xorbufout(out, a->state.s64, in, ASCON_AEAD128_RATE);
-        XMEMCPY(a->state.s64, in, ASCON_AEAD128_RATE);
+        ascon_aead128_decrypt_block(a->state.s8, out, in, ASCON_AEAD128_RATE);
         permutation(&a->state, ASCON_AEAD128_ROUNDS_PB);
         in += ASCON_AEAD128_RATE;
         out += ASCON_AEAD128_RATE;
         inSz -= ASCON_AEAD128_RATE;
     }
     /* Store leftover */
-    xorbufout(out, a->state.s64, in, inSz);
-    XMEMCPY(a->state.s64, in, inSz);
+    ascon_aead128_decrypt_block(a->state.s8, out, in, inSz);
     a->lastBlkSz = inSz;
 
     return 0;
@@ -628,22 +1094,312 @@ int wc_AsconAEAD128_DecryptFinal(wc_AsconAEAD128* a, const byte* tag)
         return BAD_STATE_E;
 
     /* Pad last block */
-    a->state.s8[a->lastBlkSz] ^= 1;
-
-    a->state.s64[2] ^= a->key[0];
-    a->state.s64[3] ^= a->key[1];
-    permutation(&a->state, ASCON_AEAD128_ROUNDS_PA);
-    a->state.s64[3] ^= a->key[0];
-    a->state.s64[4] ^= a->key[1];
+    ascon_aead128_finalize(&a->state, a->key, a->lastBlkSz);
 
     if (ConstantCompare(tag, (const byte*)&a->state.s64[3],
                         ASCON_AEAD128_TAG_SZ) != 0)
         return ASCON_AUTH_E;
 
     /* Clear state as soon as possible */
-    wc_AsconAEAD128_Clear(a);
+    ascon_aead128_done(a);
 
     return 0;
 }
 
+/* One-shot AsconAEAD API */
+
+/* Load the key and nonce, absorb the associated data. */
+static void ascon_aead128_start(AsconState* s, const word64* k,
+    const byte* nonce, const byte* ad, word32 adSz)
+{
+    s->s64[0] = ASCON_AEAD128_IV;
+    s->s64[1] = k[0];
+    s->s64[2] = k[1];
+    XMEMCPY(&s->s64[3], nonce, ASCON_AEAD128_NONCE_SZ);
+    ascon_aead128_absorb_ad(s, k, ad, adSz);
+}
+
+/* Encrypt a whole message with an already loaded key. */
+static void ascon_aead128_seal(const word64* k, const byte* nonce,
+    const byte* ad, word32 adSz, const byte* in, word32 inSz, byte* out,
+    byte* tag)
+{
+    AsconState s;
+
+    ascon_aead128_start(&s, k, nonce, ad, adSz);
+
+    /* Algorithm 3, Steps 11-19 */
+    while (inSz >= ASCON_AEAD128_RATE) {
+        xorbuf(s.s64, in, ASCON_AEAD128_RATE);
+        XMEMCPY(out, s.s64, ASCON_AEAD128_RATE);
+        permutation(&s, ASCON_AEAD128_ROUNDS_PB);
+        in += ASCON_AEAD128_RATE;
+        out += ASCON_AEAD128_RATE;
+        inSz -= ASCON_AEAD128_RATE;
+    }
+    if (inSz > 0) {
+        xorbuf(s.s64, in, inSz);
+        XMEMCPY(out, s.s64, inSz);
+    }
+
+    ascon_aead128_finalize(&s, k, inSz);
+    XMEMCPY(tag, &s.s64[3], ASCON_AEAD128_TAG_SZ);
+
+    ForceZero(&s, sizeof(s));
+}
+
+/* Decrypt and verify a whole message with an already loaded key. Output is
+ * zeroized when the tag does not match. */
+static int ascon_aead128_open(const word64* k, const byte* nonce,
+    const byte* ad, word32 adSz, const byte* in, word32 inSz, byte* out,
+    const byte* tag)
+{
+    AsconState s;
+    byte* o = out;
+    word32 sz = inSz;
+    int ret = 0;
+
+    ascon_aead128_start(&s, k, nonce, ad, adSz);
+
+    /* Algorithm 4, Steps 11-19 */
+    while (inSz >= ASCON_AEAD128_RATE) {
+        ascon_aead128_decrypt_block(s.s8, out, in, ASCON_AEAD128_RATE);
+        permutation(&s, ASCON_AEAD128_ROUNDS_PB);
+        in += ASCON_AEAD128_RATE;
+        out += ASCON_AEAD128_RATE;
+        inSz -= ASCON_AEAD128_RATE;
+    }
+    if (inSz > 0) {
+        ascon_aead128_decrypt_block(s.s8, out, in, inSz);
+    }
+
+    ascon_aead128_finalize(&s, k, inSz);
+    if (ConstantCompare(tag, (const byte*)&s.s64[3],
+                        ASCON_AEAD128_TAG_SZ) != 0) {
+        if (sz > 0)
+            ForceZero(o, sz);
+        ret = ASCON_AUTH_E;
+    }
+
+    ForceZero(&s, sizeof(s));
+
+    return ret;
+}
+
+/* Encrypt in one call.
+ *
+ * @param [in]  key    Key of ASCON_AEAD128_KEY_SZ bytes.
+ * @param [in]  nonce  Nonce of ASCON_AEAD128_NONCE_SZ bytes.
+ * @param [in]  ad     Associated data. May be NULL when adSz is 0.
+ * @param [in]  adSz   Size of associated data in bytes.
+ * @param [in]  in     Plaintext. May be NULL when inSz is 0.
+ * @param [in]  inSz   Size of plaintext in bytes.
+ * @param [out] out    Ciphertext of inSz bytes. May be the same as in.
+ * @param [out] tag    Buffer to hold ASCON_AEAD128_TAG_SZ bytes of tag.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL.
+ */
+int wc_AsconAEAD128_Encrypt(const byte* key, const byte* nonce,
+    const byte* ad, word32 adSz, const byte* in, word32 inSz, byte* out,
+    byte* tag)
+{
+    word64 k[2];
+
+    if (key == NULL || nonce == NULL || tag == NULL ||
+            (ad == NULL && adSz > 0) ||
+            ((in == NULL || out == NULL) && inSz > 0))
+        return BAD_FUNC_ARG;
+
+    ASCON_SET_CPUID();
+    XMEMCPY(k, key, ASCON_AEAD128_KEY_SZ);
+    ascon_aead128_seal(k, nonce, ad, adSz, in, inSz, out, tag);
+    ForceZero(k, sizeof(k));
+
+    return 0;
+}
+
+/* Decrypt and verify in one call. Output is zeroized when the tag does not
+ * match.
+ *
+ * @param [in]  key    Key of ASCON_AEAD128_KEY_SZ bytes.
+ * @param [in]  nonce  Nonce of ASCON_AEAD128_NONCE_SZ bytes.
+ * @param [in]  ad     Associated data. May be NULL when adSz is 0.
+ * @param [in]  adSz   Size of associated data in bytes.
+ * @param [in]  in     Ciphertext. May be NULL when inSz is 0.
+ * @param [in]  inSz   Size of ciphertext in bytes.
+ * @param [out] out    Plaintext of inSz bytes. May be the same as in.
+ * @param [in]  tag    Tag of ASCON_AEAD128_TAG_SZ bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter is NULL.
+ * @return  ASCON_AUTH_E when the tag does not match.
+ */
+int wc_AsconAEAD128_Decrypt(const byte* key, const byte* nonce,
+    const byte* ad, word32 adSz, const byte* in, word32 inSz, byte* out,
+    const byte* tag)
+{
+    word64 k[2];
+    int ret;
+
+    if (key == NULL || nonce == NULL || tag == NULL ||
+            (ad == NULL && adSz > 0) ||
+            ((in == NULL || out == NULL) && inSz > 0))
+        return BAD_FUNC_ARG;
+
+    ASCON_SET_CPUID();
+    XMEMCPY(k, key, ASCON_AEAD128_KEY_SZ);
+    ret = ascon_aead128_open(k, nonce, ad, adSz, in, inSz, out, tag);
+    ForceZero(k, sizeof(k));
+
+    return ret;
+}
+
+/* Keyed AsconAEAD API */
+
+/* Initialize an object and load a key that is kept across messages.
+ *
+ * EncryptFinal and DecryptFinal only clear the per-message state of an object
+ * initialized this way. Start each message with wc_AsconAEAD128_Reset().
+ * wc_AsconAEAD128_Clear() or wc_AsconAEAD128_Free() erases the key.
+ *
+ * @param [in, out] a    AsconAEAD object.
+ * @param [in]      key  Key of ASCON_AEAD128_KEY_SZ bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a or key is NULL.
+ */
+int wc_AsconAEAD128_InitKey(wc_AsconAEAD128* a, const byte* key)
+{
+    int ret = wc_AsconAEAD128_Init(a);
+
+    if (ret == 0)
+        ret = wc_AsconAEAD128_SetKey(a, key);
+    if (ret == 0)
+        a->keyKeep = 1;
+
+    return ret;
+}
+
+/* Start a new message on a keyed object.
+ *
+ * Reloads the state from the stored key and the new nonce. Any message in
+ * progress is discarded.
+ *
+ * @param [in, out] a      AsconAEAD object with key set.
+ * @param [in]      nonce  Nonce of ASCON_AEAD128_NONCE_SZ bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a or nonce is NULL.
+ * @return  BAD_STATE_E when no key has been set.
+ */
+int wc_AsconAEAD128_Reset(wc_AsconAEAD128* a, const byte* nonce)
+{
+    if (a == NULL || nonce == NULL)
+        return BAD_FUNC_ARG;
+    if (!a->keySet)
+        return BAD_STATE_E;
+
+    a->state.s64[0] = ASCON_AEAD128_IV;
+    a->state.s64[1] = a->key[0];
+    a->state.s64[2] = a->key[1];
+    XMEMCPY(&a->state.s64[3], nonce, ASCON_AEAD128_NONCE_SZ);
+    a->lastBlkSz = 0;
+    a->nonceSet = 1;
+    a->adSet = 0;
+    a->op = ASCON_AEAD128_NOTSET;
+
+    return 0;
+}
+
+/* Check the fields of a batch of messages. */
+static int ascon_aead128_batch_check(const wc_AsconAEAD128_Msg* msgs,
+    word32 cnt)
+{
+    word32 i;
+
+    for (i = 0; i < cnt; i++) {
+        if (msgs[i].nonce == NULL || msgs[i].tag == NULL ||
+                (msgs[i].ad == NULL && msgs[i].adSz > 0) ||
+                ((msgs[i].in == NULL || msgs[i].out == NULL) &&
+                 msgs[i].inSz > 0)) {
+            return BAD_FUNC_ARG;
+        }
+    }
+
+    return 0;
+}
+
+/* Encrypt a batch of independent messages with the key of the object.
+ *
+ * The object's message state is not used or changed.
+ *
+ * @param [in]      a     AsconAEAD object with key set.
+ * @param [in, out] msgs  Messages. Ciphertext written to out and the tag
+ *                        to tag of each entry. out may be the same as in.
+ * @param [in]      cnt   Number of messages.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when a parameter or a message field is NULL.
+ * @return  BAD_STATE_E when no key has been set.
+ */
+int wc_AsconAEAD128_EncryptBatch(wc_AsconAEAD128* a,
+    wc_AsconAEAD128_Msg* msgs, word32 cnt)
+{
+    word32 i;
+    int ret;
+
+    if (a == NULL || (msgs == NULL && cnt > 0))
+        return BAD_FUNC_ARG;
+    if (!a->keySet)
+        return BAD_STATE_E;
+    ret = ascon_aead128_batch_check(msgs, cnt);
+    if (ret != 0)
+        return ret;
+
+    for (i = 0; i < cnt; i++) {
+        ascon_aead128_seal(a->key, msgs[i].nonce, msgs[i].ad, msgs[i].adSz,
+            msgs[i].in, msgs[i].inSz, msgs[i].out, msgs[i].tag);
+        msgs[i].ret = 0;
+    }
+
+    return 0;
+}
+
+/* Decrypt and verify a batch of independent messages with the key of the
+ * object.
+ *
+ * All messages are processed. The result of each is stored in ret of the
+ * entry and the output of a message that fails authentication is zeroized.
+ * The object's message state is not used or changed.
+ *
+ * @param [in]      a     AsconAEAD object with key set.
+ * @param [in, out] msgs  Messages. Plaintext written to out of each entry.
+ *                        out may be the same as in.
+ * @param [in]      cnt   Number of messages.
+ * @return  0 when all messages were authenticated.
+ * @return  BAD_FUNC_ARG when a parameter or a message field is NULL.
+ * @return  BAD_STATE_E when no key has been set.
+ * @return  ASCON_AUTH_E when any message fails authentication.
+ */
+int wc_AsconAEAD128_DecryptBatch(wc_AsconAEAD128* a,
+    wc_AsconAEAD128_Msg* msgs, word32 cnt)
+{
+    word32 i;
+    int ret;
+
+    if (a == NULL || (msgs == NULL && cnt > 0))
+        return BAD_FUNC_ARG;
+    if (!a->keySet)
+        return BAD_STATE_E;
+    ret = ascon_aead128_batch_check(msgs, cnt);
+    if (ret != 0)
+        return ret;
+
+    for (i = 0; i < cnt; i++) {
+        msgs[i].ret = ascon_aead128_open(a->key, msgs[i].nonce, msgs[i].ad,
+            msgs[i].adSz, msgs[i].in, msgs[i].inSz, msgs[i].out,
+            msgs[i].tag);
+        if (msgs[i].ret != 0)
+            ret = msgs[i].ret;
+    }
+
+    return ret;
+}
+
 #endif /* HAVE_ASCON */
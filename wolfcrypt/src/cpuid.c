@@ -69,10 +69,15 @@
             __asm__ __volatile__ ("cpuid":\
                 "=a" ((reg)[0]), "=b" ((reg)[1]), "=c" ((reg)[2]), "=d" ((reg)[3]) :\
                 "a" (leaf), "c"(sub));
+        #define xgetbv(lo, hi)\
+            __asm__ __volatile__ ("xgetbv": "=a" (lo), "=d" (hi) : "c" (0));
     #else
         #include <intrin.h>
 
         #define cpuid(a,b,c) __cpuidex((int*)a,b,c)
+        #define xgetbv(lo, hi)\
+            do { unsigned __int64 xcr0 = _xgetbv(0);\
+                 (lo) = (word32)xcr0; (hi) = (word32)(xcr0 >> 32); } while (0)
     #endif /* _MSC_VER */
 
     #define EAX 0
@@ -110,6 +115,31 @@
         return 0;
     }
 
+    /* XCR0 bits: SSE, AVX (YMM), opmask, ZMM_Hi256 and Hi16_ZMM state. */
+    #define XCR0_AVX512_STATE   0xe6
+
+    /* Check the OS saves the AVX-512 register state on context switch.
+     *
+     * CPUID only reports what the processor supports. Using ZMM or opmask
+     * registers faults when the OS hasn't enabled saving their state in XCR0.
+     *
+     * @return  1 when AVX-512 state is saved by the OS.
+     * @return  0 otherwise.
+     */
+    static int cpuid_os_avx512(void)
+    {
+        word32 lo = 0;
+        word32 hi = 0;
+
+        /* XGETBV is only available when the OS has set OSXSAVE. */
+        if (!cpuid_flag(1, 0, ECX, 27)) {
+            return 0;
+        }
+        xgetbv(lo, hi);
+        (void)hi;
+        return (lo & XCR0_AVX512_STATE) == XCR0_AVX512_STATE;
+    }
+
 
     static WC_INLINE void cpuid_set_flags(void)
     {
@@ -126,6 +156,12 @@
             if (cpuid_flag(1, 0, ECX, 22)) { new_cpuid_flags |= CPUID_MOVBE ; }
             if (cpuid_flag(7, 0, EBX,  3)) { new_cpuid_flags |= CPUID_BMI1  ; }
             if (cpuid_flag(7, 0, EBX, 29)) { new_cpuid_flags |= CPUID_SHA   ; }
+            if (cpuid_flag(7, 0, ECX,  9) && cpuid_flag(7, 0, ECX, 10)) {
+                new_cpuid_flags |= CPUID_VAES;
+            }
+            if (cpuid_flag(7, 0, EBX, 16) && cpuid_os_avx512()) {
+                new_cpuid_flags |= CPUID_AVX512;
+            }
             (void)wolfSSL_Atomic_Uint_CompareExchange
                 (&cpuid_flags, &old_cpuid_flags, new_cpuid_flags);
         }
@@ -81,6 +81,23 @@ This library contains implementation for the random number generator.
 
 #include <wolfssl/wolfcrypt/sha256.h>
 
+#ifdef WC_RNG_CTR_DRBG
+    #if !defined(HAVE_HASHDRBG)
+        #error WC_RNG_CTR_DRBG requires HAVE_HASHDRBG
+    #endif
+    #if defined(HAVE_FIPS) || defined(HAVE_SELFTEST)
+        #error WC_RNG_CTR_DRBG is not available in FIPS builds
+    #endif
+    #if defined(NO_AES) || !defined(WOLFSSL_AES_COUNTER) || \
+        !defined(HAVE_AES_CBC) || !defined(WOLFSSL_AES_256)
+        #error WC_RNG_CTR_DRBG requires AES-256 with CBC and CTR modes
+    #endif
+    #if defined(WOLFSSL_NO_MALLOC) && !defined(WOLFSSL_STATIC_MEMORY)
+        #error WC_RNG_CTR_DRBG requires dynamic memory
+    #endif
+    #include <wolfssl/wolfcrypt/aes.h>
+#endif
+
 #ifdef WOLF_CRYPTO_CB
     #include <wolfssl/wolfcrypt/cryptocb.h>
 #endif
@@ -338,6 +355,10 @@ int wc_SetSeed_Cb(wc_RngSeed_Cb cb)
 #define DRBG_FAILED       2
 #define DRBG_CONT_FAILED  3
 
+/* DRBG mechanisms */
+#define DRBG_TYPE_HASH    0
+#define DRBG_TYPE_CTR     1
+
 #define RNG_HEALTH_TEST_CHECK_SIZE (WC_SHA256_DIGEST_SIZE * 4)
 
 /* Verify max gen block len */
@@ -357,6 +378,12 @@ typedef struct DRBG_internal DRBG_internal;
 
 static int wc_RNG_HealthTestLocal(int reseed, void* heap, int devId);
 
+#ifdef WC_RNG_CTR_DRBG
+typedef struct DRBG_ctr DRBG_ctr;
+
+static int CTR_DRBG_Reseed(DRBG_ctr* drbg, const byte* seed, word32 seedSz);
+#endif
+
 /* Hash Derivation Function */
 /* Returns: DRBG_SUCCESS or DRBG_FAILURE */
 static int Hash_df(DRBG_internal* drbg, byte* out, word32 outSz, byte type,
@@ -509,6 +536,10 @@ int wc_RNG_DRBG_Reseed(WC_RNG* rng, const byte* seed, word32 seedSz)
     #endif
     }
 
+#ifdef WC_RNG_CTR_DRBG
+    if (rng->drbgType == DRBG_TYPE_CTR)
+        return CTR_DRBG_Reseed((DRBG_ctr*)rng->drbg, seed, seedSz);
+#endif
     return Hash_DRBG_Reseed((DRBG_internal *)rng->drbg, seed, seedSz);
 }
 
@@ -774,6 +805,406 @@ static int Hash_DRBG_Uninstantiate(DRBG_internal* drbg)
     return (compareSum == 0) ? DRBG_SUCCESS : DRBG_FAILURE;
 }
 
+#ifdef WC_RNG_CTR_DRBG
+
+#ifndef WC_RNG_CTR_DRBG_BUF_SZ
+    /* Size of the buffer of pre-generated output that serves small
+     * requests. Set to 0 to generate every request separately. */
+    #define WC_RNG_CTR_DRBG_BUF_SZ 256
+#endif
+#if WC_RNG_CTR_DRBG_BUF_SZ > RNG_MAX_BLOCK_LEN
+    #error WC_RNG_CTR_DRBG_BUF_SZ is larger than RNG_MAX_BLOCK_LEN
+#endif
+
+#define CTR_DRBG_KEY_SZ   AES_256_KEY_SIZE
+#define CTR_DRBG_SEED_LEN (CTR_DRBG_KEY_SZ + WC_AES_BLOCK_SIZE)
+
+#define CTR_DRBG_HEALTH_TEST_CHECK_SIZE (WC_AES_BLOCK_SIZE * 4)
+
+/* CTR_DRBG state with AES-256 and a derivation function. */
+struct DRBG_ctr {
+#ifdef WORD64_AVAILABLE
+    word64 reseedCtr;
+#else
+    word32 reseedCtr;
+#endif
+    byte V[WC_AES_BLOCK_SIZE];
+    Aes aes;                /* Keyed with the current Key. */
+    void* heap;
+#if WC_RNG_CTR_DRBG_BUF_SZ > 0
+    word32 bufIdx;          /* Index of first unused byte in buf. */
+    byte buf[WC_RNG_CTR_DRBG_BUF_SZ];
+#endif
+};
+
+/* Add n to the big-endian counter V. */
+static void CTR_DRBG_AddV(byte* V, word32 n)
+{
+    int i;
+
+    for (i = WC_AES_BLOCK_SIZE - 1; (i >= 0) && (n != 0); i--) {
+        n += V[i];
+        V[i] = (byte)n;
+        n >>= 8;
+    }
+}
+
+/* Block cipher derivation function (Block_Cipher_df) with AES-256.
+ * Output is CTR_DRBG_SEED_LEN bytes.
+ * Returns: DRBG_SUCCESS or DRBG_FAILURE */
+static int CTR_DRBG_df(DRBG_ctr* drbg, byte* out, const byte* inA,
+    word32 inASz, const byte* inB, word32 inBSz)
+{
+    static const byte dfKey[CTR_DRBG_KEY_SZ] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+    };
+    int ret;
+    word32 inSz = inASz + inBSz;
+    word32 sSz;
+    word32 bufSz;
+    word32 i;
+    word32 j;
+#ifdef WOLFSSL_SMALL_STACK
+    Aes* aes;
+#else
+    Aes aes[1];
+#endif
+    byte* s;
+
+    /* IV block || L || N || input string || 0x80 || zero padding */
+    bufSz = (WC_AES_BLOCK_SIZE + 8 + inSz + WC_AES_BLOCK_SIZE) &
+        ~((word32)WC_AES_BLOCK_SIZE - 1);
+    s = (byte*)XMALLOC(bufSz, drbg->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (s == NULL)
+        return DRBG_FAILURE;
+#ifdef WOLFSSL_SMALL_STACK
+    aes = (Aes*)XMALLOC(sizeof(Aes), drbg->heap, DYNAMIC_TYPE_AES);
+    if (aes == NULL) {
+        XFREE(s, drbg->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        return DRBG_FAILURE;
+    }
+#endif
+
+    XMEMSET(s, 0, bufSz);
+    c32toa(inSz, s + WC_AES_BLOCK_SIZE);
+    c32toa(CTR_DRBG_SEED_LEN, s + WC_AES_BLOCK_SIZE + 4);
+    sSz = WC_AES_BLOCK_SIZE + 8;
+    if (inASz > 0) {
+        XMEMCPY(s + sSz, inA, inASz);
+        sSz += inASz;
+    }
+    if (inBSz > 0) {
+        XMEMCPY(s + sSz, inB, inBSz);
+        sSz += inBSz;
+    }
+    s[sSz++] = 0x80;
+    sSz = (sSz + WC_AES_BLOCK_SIZE - 1) & ~((word32)WC_AES_BLOCK_SIZE - 1);
+
+    ret = wc_AesInit(aes, drbg->heap, INVALID_DEVID);
+    if (ret == 0) {
+        ret = wc_AesSetKey(aes, dfKey, sizeof(dfKey), NULL, AES_ENCRYPTION);
+        /* BCC: CBC-MAC of the counter block and S, one output block each. */
+        for (i = 0; (ret == 0) && (i < CTR_DRBG_SEED_LEN / WC_AES_BLOCK_SIZE);
+                i++) {
+            c32toa(i, s);
+            ret = wc_AesSetIV(aes, NULL);
+            for (j = 0; (ret == 0) && (j < sSz); j += WC_AES_BLOCK_SIZE) {
+                ret = wc_AesCbcEncrypt(aes, out + i * WC_AES_BLOCK_SIZE, s + j,
+                    WC_AES_BLOCK_SIZE);
+            }
+        }
+        /* Repeatedly encrypting X under K is CBC of zeros with X as IV. */
+        if (ret == 0) {
+            ret = wc_AesSetKey(aes, out, CTR_DRBG_KEY_SZ,
+                out + CTR_DRBG_KEY_SZ, AES_ENCRYPTION);
+        }
+        if (ret == 0) {
+            XMEMSET(s, 0, CTR_DRBG_SEED_LEN);
+            ret = wc_AesCbcEncrypt(aes, out, s, CTR_DRBG_SEED_LEN);
+        }
+        wc_AesFree(aes);
+    }
+
+    ForceZero(s, bufSz);
+    XFREE(s, drbg->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    ForceZero(aes, sizeof(Aes));
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(aes, drbg->heap, DYNAMIC_TYPE_AES);
+#endif
+
+    return (ret == 0) ? DRBG_SUCCESS : DRBG_FAILURE;
+}
+
+/* Update Key and V, mixing in provided data when not NULL.
+ * Returns: DRBG_SUCCESS or DRBG_FAILURE */
+static int CTR_DRBG_Update(DRBG_ctr* drbg, const byte* provided)
+{
+    int ret;
+    byte temp[CTR_DRBG_SEED_LEN];
+
+    XMEMSET(temp, 0, sizeof(temp));
+    CTR_DRBG_AddV(drbg->V, 1);
+    ret = wc_AesSetIV(&drbg->aes, drbg->V);
+    if (ret == 0)
+        ret = wc_AesCtrEncrypt(&drbg->aes, temp, temp, sizeof(temp));
+    if (ret == 0) {
+        if (provided != NULL)
+            xorbuf(temp, provided, sizeof(temp));
+        ret = wc_AesSetKey(&drbg->aes, temp, CTR_DRBG_KEY_SZ, NULL,
+            AES_ENCRYPTION);
+    }
+    if (ret == 0)
+        XMEMCPY(drbg->V, temp + CTR_DRBG_KEY_SZ, WC_AES_BLOCK_SIZE);
+
+    ForceZero(temp, sizeof(temp));
+
+    return (ret == 0) ? DRBG_SUCCESS : DRBG_FAILURE;
+}
+
+/* Returns: DRBG_SUCCESS or DRBG_FAILURE */
+static int CTR_DRBG_Reseed(DRBG_ctr* drbg, const byte* seed, word32 seedSz)
+{
+    int ret;
+    byte seedMaterial[CTR_DRBG_SEED_LEN];
+
+    ret = CTR_DRBG_df(drbg, seedMaterial, seed, seedSz, NULL, 0);
+    if (ret == DRBG_SUCCESS)
+        ret = CTR_DRBG_Update(drbg, seedMaterial);
+    if (ret == DRBG_SUCCESS)
+        drbg->reseedCtr = 1;
+
+#if WC_RNG_CTR_DRBG_BUF_SZ > 0
+    /* Output generated before the reseed, or before a fork, is dropped. */
+    ForceZero(drbg->buf, sizeof(drbg->buf));
+    drbg->bufIdx = WC_RNG_CTR_DRBG_BUF_SZ;
+#endif
+    ForceZero(seedMaterial, sizeof(seedMaterial));
+
+    return ret;
+}
+
+/* Returns: DRBG_SUCCESS, DRBG_NEED_RESEED, or DRBG_FAILURE */
+static int CTR_DRBG_Generate(DRBG_ctr* drbg, byte* out, word32 outSz)
+{
+    int ret;
+
+    if (drbg == NULL) {
+        return DRBG_FAILURE;
+    }
+
+    if (drbg->reseedCtr >= WC_RESEED_INTERVAL) {
+    #if defined(DEBUG_WOLFSSL) || defined(DEBUG_DRBG_RESEEDS)
+        printf("DRBG reseed triggered, reseedCtr == %lu",
+               (unsigned long)drbg->reseedCtr);
+    #endif
+        return DRBG_NEED_RESEED;
+    }
+
+    /* Output is the AES-CTR key stream starting at V + 1. */
+    CTR_DRBG_AddV(drbg->V, 1);
+    ret = wc_AesSetIV(&drbg->aes, drbg->V);
+    if (ret == 0) {
+        XMEMSET(out, 0, outSz);
+        ret = wc_AesCtrEncrypt(&drbg->aes, out, out, outSz);
+    }
+    if (ret == 0) {
+        /* Leave V at the last counter block used. */
+        CTR_DRBG_AddV(drbg->V, (outSz - 1) / WC_AES_BLOCK_SIZE);
+        ret = CTR_DRBG_Update(drbg, NULL);
+    }
+    drbg->reseedCtr++;
+
+    return (ret == 0) ? DRBG_SUCCESS : DRBG_FAILURE;
+}
+
+#if WC_RNG_CTR_DRBG_BUF_SZ > 0
+/* Serve small requests from a buffer filled by one generate call so that the
+ * update of Key and V is paid once per buffer rather than once per request.
+ * Returns: DRBG_SUCCESS, DRBG_NEED_RESEED, or DRBG_FAILURE */
+static int CTR_DRBG_GenerateBuffered(DRBG_ctr* drbg, byte* out, word32 outSz)
+{
+    int ret = DRBG_SUCCESS;
+
+    if (drbg == NULL) {
+        return DRBG_FAILURE;
+    }
+    if (outSz > WC_RNG_CTR_DRBG_BUF_SZ / 2) {
+        return CTR_DRBG_Generate(drbg, out, outSz);
+    }
+
+    if (outSz > WC_RNG_CTR_DRBG_BUF_SZ - drbg->bufIdx) {
+        /* Too little left - discard it and refill. */
+        ret = CTR_DRBG_Generate(drbg, drbg->buf, WC_RNG_CTR_DRBG_BUF_SZ);
+        if (ret != DRBG_SUCCESS) {
+            ForceZero(drbg->buf, sizeof(drbg->buf));
+            drbg->bufIdx = WC_RNG_CTR_DRBG_BUF_SZ;
+            return ret;
+        }
+        drbg->bufIdx = 0;
+    }
+
+    /* Bytes are handed out once and wiped. */
+    XMEMCPY(out, drbg->buf + drbg->bufIdx, outSz);
+    ForceZero(drbg->buf + drbg->bufIdx, outSz);
+    drbg->bufIdx += outSz;
+
+    return ret;
+}
+#else
+    #define CTR_DRBG_GenerateBuffered CTR_DRBG_Generate
+#endif
+
+/* Returns: DRBG_SUCCESS or DRBG_FAILURE */
+static int CTR_DRBG_Instantiate(DRBG_ctr* drbg, const byte* seed, word32 seedSz,
+                                             const byte* nonce, word32 nonceSz,
+                                             void* heap, int devId)
+{
+    int ret;
+    byte seedMaterial[CTR_DRBG_SEED_LEN];
+
+    XMEMSET(drbg, 0, sizeof(DRBG_ctr));
+    drbg->heap = heap;
+#if WC_RNG_CTR_DRBG_BUF_SZ > 0
+    drbg->bufIdx = WC_RNG_CTR_DRBG_BUF_SZ;
+#endif
+
+    ret = wc_AesInit(&drbg->aes, heap, devId);
+    if (ret != 0)
+        return DRBG_FAILURE;
+
+    /* Key and V start as zero. */
+    XMEMSET(seedMaterial, 0, sizeof(seedMaterial));
+    ret = wc_AesSetKey(&drbg->aes, seedMaterial, CTR_DRBG_KEY_SZ, NULL,
+        AES_ENCRYPTION);
+    if (ret == 0)
+        ret = CTR_DRBG_df(drbg, seedMaterial, seed, seedSz, nonce, nonceSz);
+    if (ret == DRBG_SUCCESS)
+        ret = CTR_DRBG_Update(drbg, seedMaterial);
+    if (ret == DRBG_SUCCESS) {
+        drbg->reseedCtr = 1;
+    }
+    else {
+        wc_AesFree(&drbg->aes);
+        ForceZero(drbg, sizeof(DRBG_ctr));
+        ret = DRBG_FAILURE;
+    }
+
+    ForceZero(seedMaterial, sizeof(seedMaterial));
+
+    return ret;
+}
+
+/* Returns: DRBG_SUCCESS or DRBG_FAILURE */
+static int CTR_DRBG_Uninstantiate(DRBG_ctr* drbg)
+{
+    word32 i;
+    int    compareSum = 0;
+    byte*  compareDrbg = (byte*)drbg;
+
+    wc_AesFree(&drbg->aes);
+    ForceZero(drbg, sizeof(DRBG_ctr));
+
+    for (i = 0; i < sizeof(DRBG_ctr); i++) {
+        compareSum |= compareDrbg[i] ^ 0;
+    }
+
+    return (compareSum == 0) ? DRBG_SUCCESS : DRBG_FAILURE;
+}
+
+/* Known answers for CTR_DRBG with AES-256 and a derivation function:
+ * entropy input || nonce, reseed entropy input and the second 64 bytes
+ * generated without and with the reseed. */
+static const byte ctrSeed_data[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, /* nonce next */
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f
+};
+
+static const byte ctrReseedSeed_data[] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+
+static const byte ctrOutput_data[] = {
+    0xc5, 0xb1, 0xae, 0x8d, 0xbc, 0x23, 0x05, 0x6b,
+    0x19, 0xcf, 0x88, 0xb1, 0x99, 0x7e, 0x84, 0x98,
+    0xb4, 0xb3, 0x94, 0xc0, 0xdb, 0x97, 0x60, 0xa3,
+    0x70, 0x4b, 0x0c, 0x1d, 0x6a, 0x4c, 0x92, 0x6e,
+    0x5b, 0xfe, 0x23, 0x4a, 0xfb, 0x31, 0xb4, 0x98,
+    0xa3, 0x08, 0x10, 0xbd, 0xb8, 0xd3, 0x54, 0x2b,
+    0x55, 0x30, 0x84, 0x9f, 0x8b, 0x9b, 0x8b, 0xea,
+    0x8c, 0xad, 0x70, 0xe6, 0x33, 0xf3, 0x2a, 0x24
+};
+
+static const byte ctrReseedOutput_data[] = {
+    0xf1, 0xe5, 0xcb, 0x5c, 0x39, 0x25, 0x43, 0xf9,
+    0x63, 0xb7, 0x97, 0xc4, 0x10, 0xc9, 0xd9, 0xa2,
+    0x16, 0x14, 0x98, 0x3b, 0x57, 0x2d, 0xcf, 0x94,
+    0x78, 0xeb, 0xe6, 0x5d, 0xc4, 0x7f, 0x0e, 0xfe,
+    0x0b, 0x2f, 0x30, 0x38, 0x9c, 0xa7, 0x9d, 0xcb,
+    0x0a, 0x82, 0x1f, 0x06, 0x54, 0xe5, 0xb6, 0x63,
+    0xd5, 0xc4, 0x67, 0xac, 0x0e, 0xa2, 0x4f, 0x6d,
+    0x1e, 0x83, 0xb0, 0xc1, 0x46, 0x77, 0x37, 0x66
+};
+
+/* Known answer test of CTR_DRBG run before instantiating and reseeding.
+ * Returns 0 on success. */
+static int CTR_DRBG_HealthTestLocal(int reseed, void* heap, int devId)
+{
+    int ret;
+#ifdef WOLFSSL_SMALL_STACK
+    DRBG_ctr* drbg;
+#else
+    DRBG_ctr  drbg[1];
+#endif
+    byte check[CTR_DRBG_HEALTH_TEST_CHECK_SIZE];
+    const byte* output = reseed ? ctrReseedOutput_data : ctrOutput_data;
+
+#ifdef WOLFSSL_SMALL_STACK
+    drbg = (DRBG_ctr*)XMALLOC(sizeof(DRBG_ctr), heap, DYNAMIC_TYPE_RNG);
+    if (drbg == NULL)
+        return MEMORY_E;
+#endif
+
+    ret = CTR_DRBG_Instantiate(drbg, ctrSeed_data, sizeof(ctrSeed_data),
+        NULL, 0, heap, devId);
+    if (ret == DRBG_SUCCESS) {
+        if (reseed) {
+            ret = CTR_DRBG_Reseed(drbg, ctrReseedSeed_data,
+                sizeof(ctrReseedSeed_data));
+        }
+        /* The second block of output is the one checked. */
+        if (ret == DRBG_SUCCESS)
+            ret = CTR_DRBG_Generate(drbg, check, sizeof(check));
+        if (ret == DRBG_SUCCESS)
+            ret = CTR_DRBG_Generate(drbg, check, sizeof(check));
+        if ((ret == DRBG_SUCCESS) &&
+                (ConstantCompare(check, output, sizeof(check)) != 0)) {
+            ret = -1;
+        }
+
+        if (CTR_DRBG_Uninstantiate(drbg) != DRBG_SUCCESS)
+            ret = DRBG_FAILURE;
+    }
+
+    ForceZero(check, sizeof(check));
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(drbg, heap, DYNAMIC_TYPE_RNG);
+#endif
+
+    return ret;
+}
+
+#endif /* WC_RNG_CTR_DRBG */
+
 
 int wc_RNG_TestSeed(const byte* seed, word32 seedSz)
 {
@@ -1673,15 +2104,20 @@ static void Entropy_HealthTest_Reset(void)
 #endif /* HAVE_ENTROPY_MEMUSE */
 
 static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
-                    void* heap, int devId)
+                    void* heap, int devId, WC_RNG* parent, byte drbgType)
 {
     int ret = 0;
 #ifdef HAVE_HASHDRBG
     word32 seedSz = SEED_SZ + SEED_BLOCK_SZ;
+#if !defined(WOLFSSL_NO_MALLOC) || defined(WOLFSSL_STATIC_MEMORY)
+    word32 drbgSz = (word32)sizeof(DRBG_internal);
+#endif
 #endif
 
     (void)nonce;
     (void)nonceSz;
+    (void)parent;
+    (void)drbgType;
 
     if (rng == NULL)
         return BAD_FUNC_ARG;
@@ -1710,6 +2146,10 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
     /* init the DBRG to known values */
     rng->drbg = NULL;
     rng->status = DRBG_NOT_INIT;
+#ifdef WC_RNG_CTR_DRBG
+    /* A child uses the same mechanism as its parent. */
+    rng->drbgType = (parent != NULL) ? parent->drbgType : drbgType;
+#endif
 #endif
 
 #if defined(HAVE_INTEL_RDSEED) || defined(HAVE_INTEL_RDRAND) || \
@@ -1760,7 +2200,15 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
         seedSz = MAX_SEED_SZ;
     }
 
-    ret = wc_RNG_HealthTestLocal(0, rng->heap, devId);
+    /* A parent DRBG was health tested when it was instantiated. */
+    if (parent != NULL)
+        ret = 0;
+#ifdef WC_RNG_CTR_DRBG
+    else if (rng->drbgType == DRBG_TYPE_CTR)
+        ret = CTR_DRBG_HealthTestLocal(0, rng->heap, devId);
+#endif
+    else
+        ret = wc_RNG_HealthTestLocal(0, rng->heap, devId);
     if (ret != 0) {
         #if defined(DEBUG_WOLFSSL)
         WOLFSSL_MSG_EX("wc_RNG_HealthTestLocal failed err = %d", ret);
@@ -1778,13 +2226,15 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
     #endif
 
 #if !defined(WOLFSSL_NO_MALLOC) || defined(WOLFSSL_STATIC_MEMORY)
-        rng->drbg =
-                (struct DRBG*)XMALLOC(sizeof(DRBG_internal), rng->heap,
-                                                          DYNAMIC_TYPE_RNG);
+    #ifdef WC_RNG_CTR_DRBG
+        if (rng->drbgType == DRBG_TYPE_CTR)
+            drbgSz = (word32)sizeof(DRBG_ctr);
+    #endif
+        rng->drbg = (struct DRBG*)XMALLOC(drbgSz, rng->heap, DYNAMIC_TYPE_RNG);
         if (rng->drbg == NULL) {
     #if defined(DEBUG_WOLFSSL)
             WOLFSSL_MSG_EX("_InitRng XMALLOC failed to allocate %d bytes",
-                           sizeof(DRBG_internal));
+                           drbgSz);
     #endif
             ret = MEMORY_E;
             rng->status = DRBG_FAILED;
@@ -1799,8 +2249,12 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
 #endif
         }
         else {
+            if (parent != NULL) {
+                /* Seed from the parent DRBG instead of the entropy source. */
+                ret = wc_RNG_GenerateBlock(parent, seed, seedSz);
+            }
 #ifdef WC_RNG_SEED_CB
-            if (seedCb == NULL) {
+            else if (seedCb == NULL) {
                 ret = DRBG_NO_SEED_CB;
             }
             else {
@@ -1810,7 +2264,9 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
                 }
             }
 #else
-            ret = wc_GenerateSeed(&rng->seed, seed, seedSz);
+            else {
+                ret = wc_GenerateSeed(&rng->seed, seed, seedSz);
+            }
 #endif /* WC_RNG_SEED_CB */
             if (ret != 0) {
     #if defined(DEBUG_WOLFSSL)
@@ -1827,10 +2283,19 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
                 WOLFSSL_MSG_EX("wc_RNG_TestSeed failed... %d", ret);
             }
     #endif
-            if (ret == DRBG_SUCCESS)
+        #ifdef WC_RNG_CTR_DRBG
+            if ((ret == DRBG_SUCCESS) && (rng->drbgType == DRBG_TYPE_CTR)) {
+                ret = CTR_DRBG_Instantiate((DRBG_ctr*)rng->drbg,
+                            seed + SEED_BLOCK_SZ, seedSz - SEED_BLOCK_SZ,
+                            nonce, nonceSz, rng->heap, devId);
+            }
+            else
+        #endif
+            if (ret == DRBG_SUCCESS) {
                 ret = Hash_DRBG_Instantiate((DRBG_internal *)rng->drbg,
                             seed + SEED_BLOCK_SZ, seedSz - SEED_BLOCK_SZ,
                             nonce, nonceSz, rng->heap, devId);
+            }
 
             if (ret != DRBG_SUCCESS) {
             #if !defined(WOLFSSL_NO_MALLOC) || defined(WOLFSSL_STATIC_MEMORY)
@@ -1848,10 +2313,19 @@ static int _InitRng(WC_RNG* rng, byte* nonce, word32 nonceSz,
 
     if (ret == DRBG_SUCCESS) {
 #ifdef WOLFSSL_CHECK_MEM_ZERO
+    #ifdef WC_RNG_CTR_DRBG
+        if (rng->drbgType == DRBG_TYPE_CTR) {
+            DRBG_ctr* drbg = (DRBG_ctr*)rng->drbg;
+            wc_MemZero_Add("DRBG V", &drbg->V, sizeof(drbg->V));
+        }
+        else
+    #endif
     #ifdef HAVE_HASHDRBG
+        {
         struct DRBG_internal* drbg = (struct DRBG_internal*)rng->drbg;
         wc_MemZero_Add("DRBG V", &drbg->V, sizeof(drbg->V));
         wc_MemZero_Add("DRBG C", &drbg->C, sizeof(drbg->C));
+        }
     #endif
 #endif
 
@@ -1883,7 +2357,8 @@ WC_RNG* wc_rng_new(byte* nonce, word32 nonceSz, void* heap)
 
     rng = (WC_RNG*)XMALLOC(sizeof(WC_RNG), heap, DYNAMIC_TYPE_RNG);
     if (rng) {
-        int error = _InitRng(rng, nonce, nonceSz, heap, INVALID_DEVID) != 0;
+        int error = _InitRng(rng, nonce, nonceSz, heap, INVALID_DEVID,
+                             NULL, DRBG_TYPE_HASH) != 0;
         if (error) {
             XFREE(rng, heap, DYNAMIC_TYPE_RNG);
             rng = NULL;
@@ -1904,7 +2379,7 @@ int wc_rng_new_ex(WC_RNG **rng, byte* nonce, word32 nonceSz,
         return MEMORY_E;
     }
 
-    ret = _InitRng(*rng, nonce, nonceSz, heap, devId);
+    ret = _InitRng(*rng, nonce, nonceSz, heap, devId, NULL, DRBG_TYPE_HASH);
     if (ret != 0) {
         XFREE(*rng, heap, DYNAMIC_TYPE_RNG);
         *rng = NULL;
@@ -1930,28 +2405,74 @@ void wc_rng_free(WC_RNG* rng)
 WOLFSSL_ABI
 int wc_InitRng(WC_RNG* rng)
 {
-    return _InitRng(rng, NULL, 0, NULL, INVALID_DEVID);
+    return _InitRng(rng, NULL, 0, NULL, INVALID_DEVID, NULL, DRBG_TYPE_HASH);
 }
 
 
 int wc_InitRng_ex(WC_RNG* rng, void* heap, int devId)
 {
-    return _InitRng(rng, NULL, 0, heap, devId);
+    return _InitRng(rng, NULL, 0, heap, devId, NULL, DRBG_TYPE_HASH);
 }
 
 
 int wc_InitRngNonce(WC_RNG* rng, byte* nonce, word32 nonceSz)
 {
-    return _InitRng(rng, nonce, nonceSz, NULL, INVALID_DEVID);
+    return _InitRng(rng, nonce, nonceSz, NULL, INVALID_DEVID, NULL,
+                    DRBG_TYPE_HASH);
 }
 
 
 int wc_InitRngNonce_ex(WC_RNG* rng, byte* nonce, word32 nonceSz,
                        void* heap, int devId)
 {
-    return _InitRng(rng, nonce, nonceSz, heap, devId);
+    return _InitRng(rng, nonce, nonceSz, heap, devId, NULL, DRBG_TYPE_HASH);
 }
 
+#ifdef HAVE_HASHDRBG
+/* Instantiate a DRBG seeded from the output of a parent DRBG.
+ *
+ * The entropy source is not read and the health test is not run again as the
+ * parent has done both. The child reseeds from the entropy source as normal.
+ * Caller must serialize use of the parent.
+ *
+ * @param [out] rng     Random number generator object to instantiate.
+ * @param [in]  parent  Instantiated random number generator to seed from.
+ * @param [in]  heap    Dynamic memory allocation hint.
+ * @param [in]  devId   Device identifier.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when rng or parent is NULL.
+ * @return  RNG_FAILURE_E when the parent fails to generate a seed.
+ */
+int wc_InitRngChild_ex(WC_RNG* rng, WC_RNG* parent, void* heap, int devId)
+{
+    if (parent == NULL)
+        return BAD_FUNC_ARG;
+
+    return _InitRng(rng, NULL, 0, heap, devId, parent, DRBG_TYPE_HASH);
+}
+#endif /* HAVE_HASHDRBG */
+
+#ifdef WC_RNG_CTR_DRBG
+/* Instantiate a CTR_DRBG using AES-256 instead of the SHA-256 Hash_DRBG.
+ *
+ * Output is generated with AES-CTR and so uses AES-NI/VAES when available.
+ * Small requests are served from a buffer of pre-generated output of
+ * WC_RNG_CTR_DRBG_BUF_SZ bytes.
+ *
+ * @param [out] rng    Random number generator object to instantiate.
+ * @param [in]  heap   Dynamic memory allocation hint.
+ * @param [in]  devId  Device identifier.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when rng is NULL.
+ * @return  DRBG_CONT_FIPS_E when the known answer test fails.
+ * @return  RNG_FAILURE_E when seeding or instantiating fails.
+ */
+int wc_InitRngCtrDrbg_ex(WC_RNG* rng, void* heap, int devId)
+{
+    return _InitRng(rng, NULL, 0, heap, devId, NULL, DRBG_TYPE_CTR);
+}
+#endif /* WC_RNG_CTR_DRBG */
+
 #ifdef HAVE_HASHDRBG
 static int PollAndReSeed(WC_RNG* rng)
 {
@@ -1960,7 +2481,13 @@ static int PollAndReSeed(WC_RNG* rng)
 #if defined(WOLFSSL_ASYNC_CRYPT) || defined(WOLF_CRYPTO_CB)
     devId = rng->devId;
 #endif
-    if (wc_RNG_HealthTestLocal(1, rng->heap, devId) == 0) {
+#ifdef WC_RNG_CTR_DRBG
+    if (rng->drbgType == DRBG_TYPE_CTR)
+        ret = CTR_DRBG_HealthTestLocal(1, rng->heap, devId);
+    else
+#endif
+        ret = wc_RNG_HealthTestLocal(1, rng->heap, devId);
+    if (ret == 0) {
     #ifndef WOLFSSL_SMALL_STACK
         byte newSeed[SEED_SZ + SEED_BLOCK_SZ];
         ret = DRBG_SUCCESS;
@@ -1990,9 +2517,17 @@ static int PollAndReSeed(WC_RNG* rng)
         if (ret == DRBG_SUCCESS)
             ret = wc_RNG_TestSeed(newSeed, SEED_SZ + SEED_BLOCK_SZ);
 
-        if (ret == DRBG_SUCCESS)
+    #ifdef WC_RNG_CTR_DRBG
+        if ((ret == DRBG_SUCCESS) && (rng->drbgType == DRBG_TYPE_CTR)) {
+            ret = CTR_DRBG_Reseed((DRBG_ctr*)rng->drbg,
+                                  newSeed + SEED_BLOCK_SZ, SEED_SZ);
+        }
+        else
+    #endif
+        if (ret == DRBG_SUCCESS) {
             ret = Hash_DRBG_Reseed((DRBG_internal *)rng->drbg,
                                    newSeed + SEED_BLOCK_SZ, SEED_SZ);
+        }
     #ifdef WOLFSSL_SMALL_STACK
         if (newSeed != NULL) {
             ForceZero(newSeed, SEED_SZ + SEED_BLOCK_SZ);
@@ -2079,11 +2614,26 @@ int wc_RNG_GenerateBlock(WC_RNG* rng, byte* output, word32 sz)
     }
 #endif
 
-    ret = Hash_DRBG_Generate((DRBG_internal *)rng->drbg, output, sz);
-    if (ret == DRBG_NEED_RESEED) {
-        ret = PollAndReSeed(rng);
-        if (ret == DRBG_SUCCESS)
-            ret = Hash_DRBG_Generate((DRBG_internal *)rng->drbg, output, sz);
+#ifdef WC_RNG_CTR_DRBG
+    if (rng->drbgType == DRBG_TYPE_CTR) {
+        ret = CTR_DRBG_GenerateBuffered((DRBG_ctr*)rng->drbg, output, sz);
+        if (ret == DRBG_NEED_RESEED) {
+            ret = PollAndReSeed(rng);
+            if (ret == DRBG_SUCCESS)
+                ret = CTR_DRBG_GenerateBuffered((DRBG_ctr*)rng->drbg, output,
+                    sz);
+        }
+    }
+    else
+#endif
+    {
+        ret = Hash_DRBG_Generate((DRBG_internal *)rng->drbg, output, sz);
+        if (ret == DRBG_NEED_RESEED) {
+            ret = PollAndReSeed(rng);
+            if (ret == DRBG_SUCCESS)
+                ret = Hash_DRBG_Generate((DRBG_internal *)rng->drbg, output,
+                    sz);
+        }
     }
 
     if (ret == DRBG_SUCCESS) {
@@ -2128,6 +2678,13 @@ int wc_FreeRng(WC_RNG* rng)
 
 #ifdef HAVE_HASHDRBG
     if (rng->drbg != NULL) {
+    #ifdef WC_RNG_CTR_DRBG
+      if (rng->drbgType == DRBG_TYPE_CTR) {
+          if (CTR_DRBG_Uninstantiate((DRBG_ctr*)rng->drbg) != DRBG_SUCCESS)
+              ret = RNG_FAILURE_E;
+      }
+      else
+    #endif
       if (Hash_DRBG_Uninstantiate((DRBG_internal *)rng->drbg) != DRBG_SUCCESS)
             ret = RNG_FAILURE_E;
 
@@ -61,6 +61,21 @@
  *   performing decapsulation.
  *   KyberKey is 8KB larger but decapsulation is significantly faster.
  *   Turn on when performing make key and decapsualtion with same object.
+ *
+ * WOLFSSL_MLKEM_BATCH_SZ                                           Default: 8
+ *   Maximum number of operations that the batch APIs perform together.
+ *   Each operation in a group uses a k x k matrix of dynamic memory.
+ *
+ * WOLFSSL_MLKEM_PROFILE                                    Default: OFF
+ *   Accumulates, per thread, the time spent in each phase of the operations
+ *   and the number of Ascon permutations computed.
+ *   Time is measured with a clock set by the application.
+ *   For benchmarking only - adds overhead to every operation.
+ *
+ * WOLFSSL_MLKEM_NO_PARALLEL                                 Default: OFF
+ *   Removes the application callback, wc_MlKemKey_SetParallelCb(), that
+ *   generates the rows of matrix A on worker threads.
+ *   Parallel generation is not available with both small memory options.
  */
 
 #include <wolfssl/wolfcrypt/libwolfssl_sources.h>
@@ -103,6 +118,49 @@
     #error "No ML-KEM operations to be built."
 #endif
 
+#ifndef WOLFSSL_MLKEM_BATCH_SZ
+    #define WOLFSSL_MLKEM_BATCH_SZ      8
+#endif
+#if WOLFSSL_MLKEM_BATCH_SZ < 1
+    #error "WOLFSSL_MLKEM_BATCH_SZ must be at least 1"
+#endif
+
+#if !defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) && !defined(WOLFSSL_NO_MALLOC)
+    /* Generate the matrices for a group of key generations together. */
+    #define MLKEM_BATCH_MATRIX_A
+#endif
+#if !defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM) && \
+    !defined(WOLFSSL_NO_MALLOC)
+    /* Generate the matrices for a group of encapsulations together. */
+    #define MLKEM_BATCH_MATRIX_AT
+#endif
+
+/* Round size up to keep scratch memory aligned. */
+#define MLKEM_SCRATCH_ROUND(sz)                                     \
+    (((sz) + WC_ML_KEM_SCRATCH_ALIGN - 1) &                         \
+     ~((word32)WC_ML_KEM_SCRATCH_ALIGN - 1))
+/* Size of temporary memory used by key generation - e (v) | a (m). */
+#if !defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) && \
+    !defined(WOLFSSL_MLKEM_CACHE_A)
+    #define MLKEM_MAKEKEY_TMP_SZ(k)                                 \
+        (((k) + 1) * (k) * MLKEM_N * (word32)sizeof(sword16))
+#else
+    #define MLKEM_MAKEKEY_TMP_SZ(k)                                 \
+        ((k) * MLKEM_N * (word32)sizeof(sword16))
+#endif
+/* Size of temporary memory used by encapsulation.
+ * y (v) | a (m) | mu (p) | e1 (p) | e2 (v) | u (v) | v (p) */
+#ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
+    #define MLKEM_ENCAPSULATE_TMP_SZ(k)                             \
+        ((((k) + 3) * (k) + 3) * MLKEM_N * (word32)sizeof(sword16))
+#else
+    #define MLKEM_ENCAPSULATE_TMP_SZ(k)                             \
+        (3 * (k) * MLKEM_N * (word32)sizeof(sword16))
+#endif
+/* Size of temporary memory used by decapsulation - u (v) | v (p). */
+#define MLKEM_DECAPSULATE_TMP_SZ(k)                                 \
+    (((k) + 1) * MLKEM_N * (word32)sizeof(sword16))
+
 #ifdef WOLFSSL_WC_MLKEM
 
 /******************************************************************************/
@@ -126,6 +184,131 @@ volatile sword16 mlkem_opt_blocker = 0;
 
 /******************************************************************************/
 
+#ifdef WOLFSSL_MLKEM_PROFILE
+/* Clock used to time the phases of operations. */
+static wc_MlKemProfileClock mlkem_prof_clock = NULL;
+/* Clock ticks spent in each phase by this thread. */
+static THREAD_LS_T word64 mlkem_prof_ticks[WC_MLKEM_PHASE_CNT];
+/* Ascon permutation count of this thread when profile last reset. */
+static THREAD_LS_T word64 mlkem_prof_perms = 0;
+
+/* Get the current time from the profiling clock.
+ *
+ * @return  Clock ticks or 0 when no clock set.
+ */
+static word64 mlkem_prof_now(void)
+{
+    return (mlkem_prof_clock != NULL) ? mlkem_prof_clock() : 0;
+}
+
+/* Start timing a phase. */
+#define MLKEM_PROF_START(t)         (t) = mlkem_prof_now()
+/* Add the time since start to a phase. */
+#define MLKEM_PROF_END(phase, t)    \
+    mlkem_prof_ticks[phase] += mlkem_prof_now() - (t)
+
+/**
+ * Set the clock used to time the phases of ML-KEM operations.
+ *
+ * Not thread-safe - set before performing operations.
+ *
+ * @param  [in]  clk  Function returning the current time in ticks.
+ *                    NULL stops timing.
+ */
+void wc_MlKemProfile_SetClock(wc_MlKemProfileClock clk)
+{
+    mlkem_prof_clock = clk;
+}
+
+/**
+ * Reset the profile totals of the calling thread.
+ */
+void wc_MlKemProfile_Reset(void)
+{
+    XMEMSET(mlkem_prof_ticks, 0, sizeof(mlkem_prof_ticks));
+    mlkem_prof_perms = wc_Ascon_PermutationCount();
+}
+
+/**
+ * Get the profile totals of the calling thread since the last reset.
+ *
+ * @param  [out]  prof  Profile totals.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when prof is NULL.
+ */
+int wc_MlKemProfile_Get(wc_MlKemProfile* prof)
+{
+    if (prof == NULL) {
+        return BAD_FUNC_ARG;
+    }
+
+    XMEMCPY(prof->ticks, mlkem_prof_ticks, sizeof(prof->ticks));
+    prof->perms = wc_Ascon_PermutationCount() - mlkem_prof_perms;
+
+    return 0;
+}
+#else
+#define MLKEM_PROF_START(t)         WC_DO_NOTHING
+#define MLKEM_PROF_END(phase, t)    WC_DO_NOTHING
+#endif
+
+/******************************************************************************/
+
+/* Get the number of dimensions, k, for the key type.
+ *
+ * @param  [in]  type  Type of key.
+ * @return  Number of dimensions on success.
+ * @return  0 when key type is not supported.
+ */
+static int mlkemkey_get_k(int type)
+{
+    int k;
+
+    switch (type) {
+#ifndef WOLFSSL_NO_ML_KEM
+    #ifdef WOLFSSL_WC_ML_KEM_512
+        case WC_ML_KEM_512:
+            k = WC_ML_KEM_512_K;
+            break;
+    #endif
+    #ifdef WOLFSSL_WC_ML_KEM_768
+        case WC_ML_KEM_768:
+            k = WC_ML_KEM_768_K;
+            break;
+    #endif
+    #ifdef WOLFSSL_WC_ML_KEM_1024
+        case WC_ML_KEM_1024:
+            k = WC_ML_KEM_1024_K;
+            break;
+    #endif
+#endif
+#ifdef WOLFSSL_MLKEM_KYBER
+    #ifdef WOLFSSL_KYBER512
+        case KYBER512:
+            k = KYBER512_K;
+            break;
+    #endif
+    #ifdef WOLFSSL_KYBER768
+        case KYBER768:
+            k = KYBER768_K;
+            break;
+    #endif
+    #ifdef WOLFSSL_KYBER1024
+        case KYBER1024:
+            k = KYBER1024_K;
+            break;
+    #endif
+#endif
+        default:
+            k = 0;
+            break;
+    }
+
+    return k;
+}
+
+/******************************************************************************/
+
 #ifndef WC_NO_CONSTRUCTORS
 /**
  * Create a new ML-KEM key object.
@@ -260,6 +443,16 @@ int wc_MlKemKey_Init(MlKemKey* key, int type, void* heap, int devId)
         key->devId = devId;
     #endif
         key->flags = 0;
+    #ifdef WOLFSSL_MLKEM_CACHE_AT
+        /* No transposed matrix cached by default. */
+        key->at = NULL;
+        key->cacheAt = 0;
+    #endif
+    #ifdef WOLFSSL_MLKEM_PARALLEL
+        /* Generate serially by default. */
+        key->parallelCb = NULL;
+        key->parallelCtx = NULL;
+    #endif
 
         /* Zero out all data. */
         XMEMSET(&key->prf, 0, sizeof(key->prf));
@@ -298,6 +491,12 @@ int wc_MlKemKey_Free(MlKemKey* key)
         ForceZero(&key->prf, sizeof(key->prf));
         ForceZero(key->priv, sizeof(key->priv));
         ForceZero(key->z, sizeof(key->z));
+    #ifdef WOLFSSL_MLKEM_CACHE_AT
+        /* Dispose of cached transposed matrix. */
+        XFREE(key->at, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        key->at = NULL;
+        key->flags &= ~MLKEM_FLAG_AT_SET;
+    #endif
     }
 
     return 0;
@@ -305,7 +504,571 @@ int wc_MlKemKey_Free(MlKemKey* key)
 
 /******************************************************************************/
 
+#ifdef WOLFSSL_MLKEM_PARALLEL
+/* Matrix generation work handed to application worker threads. */
+typedef struct MlKemMatrixTask {
+    /* Matrix of uniform integers being generated. */
+    sword16* a;
+    /* Bytes to seed XOF generation. */
+    byte* seed;
+    /* Number of dimensions. */
+    int k;
+    /* Whether A or A^T is generated. */
+    int transposed;
+    /* Result of generating each row. */
+    int ret[WC_ML_KEM_MAX_K];
+} MlKemMatrixTask;
+
+/* Generate one row of the matrix - run by application worker thread.
+ *
+ * @param  [in]  arg  Matrix generation task.
+ * @param  [in]  idx  Index of row to generate.
+ */
+static void mlkem_gen_matrix_task(void* arg, int idx)
+{
+    MlKemMatrixTask* task = (MlKemMatrixTask*)arg;
+
+    if ((idx >= 0) && (idx < task->k)) {
+        task->ret[idx] = mlkem_gen_matrix_row(task->a, task->k, task->seed,
+            idx, task->transposed);
+    }
+}
+#endif
+
+#if (!defined(WOLFSSL_MLKEM_NO_MAKE_KEY) && \
+     !defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM)) || \
+    ((!defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
+      !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)) && \
+     !defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM))
+/* Deterministically generate a matrix (or transpose) of uniform integers mod q.
+ *
+ * When the application has set a parallel callback against the key, each row
+ * of the matrix is generated as a separate task. Rows are independent XOF
+ * streams so the output is the same as generating serially.
+ *
+ * FIPS 203, Algorithm 13: K-PKE.KeyGen(d), Steps 3-7
+ * FIPS 203, Algorithm 14: K-PKE.Encrypt(ek_PKE,m,r), Steps 4-8
+ *
+ * @param  [in]   key         Kyber key object.
+ * @param  [out]  a           Matrix of uniform integers.
+ * @param  [in]   k           Number of dimensions. k x k polynomials.
+ * @param  [in]   seed        Bytes to seed XOF generation.
+ * @param  [in]   transposed  Whether A or A^T is generated.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails.
+ * @return  Other negative when parallel callback fails.
+ */
+static int mlkemkey_gen_matrix(MlKemKey* key, sword16* a, int k, byte* seed,
+    int transposed)
+{
+    int ret;
+
+#ifdef WOLFSSL_MLKEM_PARALLEL
+    if (key->parallelCb != NULL) {
+        MlKemMatrixTask task;
+        int i;
+
+        task.a = a;
+        task.seed = seed;
+        task.k = k;
+        task.transposed = transposed;
+        for (i = 0; i < k; i++) {
+            /* Row not generated unless task run. */
+            task.ret[i] = BAD_STATE_E;
+        }
+
+        ret = key->parallelCb(key->parallelCtx, mlkem_gen_matrix_task, &task,
+            k);
+        for (i = 0; (ret == 0) && (i < k); i++) {
+            ret = task.ret[i];
+        }
+    }
+    else
+#endif
+    {
+        ret = mlkem_gen_matrix(&key->prf, a, k, seed, transposed);
+    }
+
+    return ret;
+}
+#endif
+
+/**
+ * Set the callback used to generate the rows of matrix A in parallel.
+ *
+ * Key generation and encapsulation expand the k x k matrix A from independent
+ * XOF streams - k rows of k polynomials. With a callback set, the rows are
+ * handed to the application as k tasks that it can run on a pool of worker
+ * threads to reduce the latency of a single operation on many-core machines.
+ * The callback must call task(arg, idx) once for each idx from 0 to cnt - 1,
+ * and return only when all calls have completed. Tasks only use the memory
+ * passed to them.
+ *
+ * Not used by the small memory implementations or the batch APIs.
+ * Ascon permutations computed on other threads are not counted when profiling.
+ *
+ * @param  [in, out]  key  Kyber key object.
+ * @param  [in]       cb   Parallel callback. NULL to generate serially.
+ * @param  [in]       ctx  Context passed to callback.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  NOT_COMPILED_IN when parallel generation is not compiled in.
+ */
+int wc_MlKemKey_SetParallelCb(MlKemKey* key, wc_MlKemParallelCb cb, void* ctx)
+{
+    int ret = 0;
+
+    if (key == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+#ifdef WOLFSSL_MLKEM_PARALLEL
+    else {
+        key->parallelCb = cb;
+        key->parallelCtx = ctx;
+    }
+#else
+    else {
+        ret = NOT_COMPILED_IN;
+    }
+
+    (void)cb;
+    (void)ctx;
+#endif
+
+    return ret;
+}
+
+/******************************************************************************/
+
+#ifdef WOLFSSL_MLKEM_CACHE_AT
+/* Allocate the cache of the transposed matrix A.
+ *
+ * @param  [in, out]  key  Kyber key object.
+ * @param  [in]       k    Number of dimensions.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+static int mlkemkey_alloc_at(MlKemKey* key, int k)
+{
+    int ret = 0;
+
+    if (key->at == NULL) {
+        key->at = (sword16*)XMALLOC(k * k * MLKEM_N * sizeof(sword16),
+            key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        if (key->at == NULL) {
+            ret = MEMORY_E;
+        }
+    }
+
+    return ret;
+}
+
+/* Expand the transposed matrix A from the public seed into the cache.
+ *
+ * FIPS 203, Algorithm 14: K-PKE.Encrypt(ek_PKE,m,r)
+ *   4-8: generate matrix A_hat
+ *
+ * @param  [in, out]  key  Kyber key object.
+ * @param  [in]       k    Number of dimensions.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+static int mlkemkey_cache_at(MlKemKey* key, int k)
+{
+    int ret;
+#ifdef WOLFSSL_MLKEM_PROFILE
+    word64 profT = 0;
+#endif
+
+    ret = mlkemkey_alloc_at(key, k);
+    if (ret == 0) {
+        MLKEM_PROF_START(profT);
+        ret = mlkemkey_gen_matrix(key, key->at, k, key->pubSeed, 1);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_MATRIX, profT);
+    }
+    if (ret == 0) {
+        key->flags |= MLKEM_FLAG_AT_SET;
+    }
+
+    return ret;
+}
+#endif
+
+/**
+ * Set whether the key keeps the transposed matrix A for encapsulation.
+ *
+ * Encapsulation, and re-encryption in decapsulation, generate the k x k matrix
+ * A from the public seed each call. With caching on, the matrix is expanded
+ * once and reused by every following operation with the key. Costs
+ * k x k x 512 bytes of dynamic memory: 2KB, 4.5KB or 8KB.
+ *
+ * Turn on before decoding the public key to have the matrix expanded in
+ * wc_MlKemKey_DecodePublicKey(). Otherwise it is expanded on first use.
+ * Turning caching off frees the matrix.
+ *
+ * @param  [in, out]  key     Kyber key object.
+ * @param  [in]       enable  1 to cache the matrix and 0 to not.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key is NULL.
+ * @return  NOT_COMPILED_IN when matrix caching is not compiled in.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_SetMatrixCache(MlKemKey* key, int enable)
+{
+    int ret = 0;
+
+    if (key == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+#ifdef WOLFSSL_MLKEM_CACHE_AT
+    else if (enable) {
+        key->cacheAt = 1;
+        /* Expand now when public key already available. */
+        if (((key->flags & MLKEM_FLAG_PUB_SET) != 0) &&
+                ((key->flags & MLKEM_FLAG_AT_SET) == 0)) {
+            ret = mlkemkey_cache_at(key, mlkemkey_get_k(key->type));
+        }
+    }
+    else {
+        key->cacheAt = 0;
+        XFREE(key->at, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        key->at = NULL;
+        key->flags &= ~MLKEM_FLAG_AT_SET;
+    }
+#else
+    else {
+        ret = NOT_COMPILED_IN;
+    }
+
+    (void)enable;
+#endif
+
+    return ret;
+}
+
+/******************************************************************************/
+
+/**
+ * Get the size in bytes of scratch memory for operations with key.
+ *
+ * Scratch memory of this size, passed to the _ex operations, is used instead of
+ * dynamic memory for the temporary vectors and matrices. Covers key
+ * generation, encapsulation and decapsulation so one buffer can be used for
+ * all operations with keys of this type. Memory must be aligned to
+ * WC_ML_KEM_SCRATCH_ALIGN bytes.
+ *
+ * @param  [in]   key  Kyber key object.
+ * @param  [out]  len  Length of scratch memory in bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key or len is NULL.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ */
+int wc_MlKemKey_ScratchSize(MlKemKey* key, word32* len)
+{
+    int ret = 0;
+    word32 k = 0;
+    word32 ctSz = 0;
+    word32 pubSz = 0;
+    word32 sz;
+    word32 opSz;
+
+    /* Validate parameters. */
+    if ((key == NULL) || (len == NULL)) {
+        ret = BAD_FUNC_ARG;
+    }
+    if (ret == 0) {
+        k = (word32)mlkemkey_get_k(key->type);
+        if (k == 0) {
+            /* No other values supported. */
+            ret = NOT_COMPILED_IN;
+        }
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_CipherTextSize(key, &ctSz);
+    }
+    if (ret == 0) {
+        ret = wc_KyberKey_PublicKeySize(key, &pubSz);
+    }
+    if (ret == 0) {
+        /* Key generation. */
+        sz = MLKEM_MAKEKEY_TMP_SZ(k);
+        /* Encapsulation - encoded public key when hash not cached. */
+        opSz = MLKEM_ENCAPSULATE_TMP_SZ(k);
+        if (pubSz > opSz) {
+            opSz = pubSz;
+        }
+        if (opSz > sz) {
+            sz = opSz;
+        }
+        /* Decapsulation - generated cipher text then decapsulation followed
+         * by encapsulation. */
+        opSz = MLKEM_DECAPSULATE_TMP_SZ(k);
+        if (MLKEM_ENCAPSULATE_TMP_SZ(k) > opSz) {
+            opSz = MLKEM_ENCAPSULATE_TMP_SZ(k);
+        }
+        opSz += MLKEM_SCRATCH_ROUND(ctSz);
+        if (opSz > sz) {
+            sz = opSz;
+        }
+        *len = MLKEM_SCRATCH_ROUND(sz);
+    }
+
+    return ret;
+}
+
+/* Get scratch memory from parameters of an _ex operation.
+ *
+ * @param  [in]   key        Kyber key object.
+ * @param  [in]   scratch    Scratch memory. May be NULL.
+ * @param  [in]   scratchSz  Size of scratch memory in bytes.
+ * @param  [out]  tmp        Scratch memory to use. NULL when dynamic memory is
+ *                           to be used.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when scratch is not aligned.
+ * @return  BUFFER_E when scratchSz is too small.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ */
+static int mlkemkey_get_scratch(MlKemKey* key, void* scratch, word32 scratchSz,
+    sword16** tmp)
+{
+    int ret = 0;
+    word32 sz = 0;
+
+    *tmp = NULL;
+    if (scratch != NULL) {
+        if (((wc_ptr_t)scratch & (WC_ML_KEM_SCRATCH_ALIGN - 1)) != 0) {
+            ret = BAD_FUNC_ARG;
+        }
+        if (ret == 0) {
+            ret = wc_MlKemKey_ScratchSize(key, &sz);
+        }
+        if ((ret == 0) && (scratchSz < sz)) {
+            ret = BUFFER_E;
+        }
+        if (ret == 0) {
+            *tmp = (sword16*)scratch;
+        }
+    }
+
+    return ret;
+}
+
+/******************************************************************************/
+
 #ifndef WOLFSSL_MLKEM_NO_MAKE_KEY
+/* Expand the random seed d into the public and noise seeds.
+ *
+ * FIPS 203, Algorithm 13: K-PKE.KeyGen(d)
+ *   1: (rho,sigma) <- G(d||k)A
+ *                         > expand 32+1 bytes to two pseudorandom 32-byte seeds
+ *
+ * @param  [in, out]  key  Kyber key object.
+ * @param  [in]       k    Number of dimensions.
+ * @param  [in]       d    Random seed of WC_ML_KEM_SYM_SZ bytes.
+ * @param  [out]      buf  Buffer to hold rho and sigma. Must be
+ *                         2 * WC_ML_KEM_SYM_SZ + 1 bytes.
+ * @return  0 on success.
+ */
+static int mlkemkey_expand_seed(MlKemKey* key, int k, const byte* d, byte* buf)
+{
+    int ret;
+
+#if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
+    if (key->type & MLKEM_KYBER)
+#endif
+#ifdef WOLFSSL_MLKEM_KYBER
+    {
+        /* Expand 32 bytes of random to 32. */
+        ret = MLKEM_HASH_G(&key->prf, d, WC_ML_KEM_SYM_SZ, NULL, 0, buf);
+    }
+#endif
+#if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
+    else
+#endif
+#ifndef WOLFSSL_NO_ML_KEM
+    {
+        buf[0] = (byte)k;
+        /* Expand 33 bytes of random to 32.
+         * Alg 13: Step 1: (rho,sigma) <- G(d||k)
+         */
+        ret = MLKEM_HASH_G(&key->prf, d, WC_ML_KEM_SYM_SZ, buf, 1, buf);
+    }
+#endif
+
+    (void)k;
+
+    return ret;
+}
+
+/* Make a Kyber key from the expanded seeds.
+ *
+ * FIPS 203 - Algorithm 13: K-PKE.KeyGen(d)
+ *   2: N <- 0
+ *   3-7: generate matrix A_hat
+ *   8-11: generate s
+ *   12-15: generate e
+ *   16-18: calculate t_hat from A_hat, s and e
+ *   ...
+ *
+ * @param  [in, out]  key   Kyber key object.
+ * @param  [in]       k     Number of dimensions.
+ * @param  [in]       buf   Public seed, rho, followed by noise seed, sigma.
+ * @param  [in]       z     Implicit rejection value.
+ * @param  [in]       aGen  Matrix A already generated from rho. NULL when the
+ *                          matrix is to be generated.
+ * @param  [in]       tmp   Scratch memory of MLKEM_MAKEKEY_TMP_SZ(k) bytes.
+ *                          NULL when dynamic memory is to be used.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+static int mlkemkey_make_key(MlKemKey* key, int k, byte* buf, const byte* z,
+    sword16* aGen, sword16* tmp)
+{
+    byte* rho = buf;
+    byte* sigma = buf + WC_ML_KEM_SYM_SZ;
+#ifndef WOLFSSL_NO_MALLOC
+    sword16* e = NULL;
+#else
+#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
+#ifndef WOLFSSL_MLKEM_CACHE_A
+    sword16 e[(WC_ML_KEM_MAX_K + 1) * WC_ML_KEM_MAX_K * MLKEM_N];
+#else
+    sword16 e[WC_ML_KEM_MAX_K * MLKEM_N];
+#endif
+#else
+    sword16 e[WC_ML_KEM_MAX_K * MLKEM_N];
+#endif
+#endif
+#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
+    sword16* a = NULL;
+#endif
+    sword16* s = NULL;
+    sword16* t = NULL;
+    int ret = 0;
+#ifdef WOLFSSL_MLKEM_PROFILE
+    word64 profT = 0;
+#endif
+
+#ifndef WOLFSSL_NO_MALLOC
+    if (tmp != NULL) {
+        /* Use scratch memory from caller for matrix and error vector. */
+        e = tmp;
+    }
+    else
+    /* Allocate dynamic memory for matrix and error vector. */
+#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
+#ifndef WOLFSSL_MLKEM_CACHE_A
+    if (aGen == NULL) {
+        /* e (v) | a (m) */
+        e = (sword16*)XMALLOC((k + 1) * k * MLKEM_N * sizeof(sword16),
+            key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+    else
+#endif
+#endif
+    {
+        /* e (v) */
+        e = (sword16*)XMALLOC(k * MLKEM_N * sizeof(sword16),
+            key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+    if (e == NULL) {
+        ret = MEMORY_E;
+    }
+#endif
+    if (ret == 0) {
+#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
+        if (aGen != NULL) {
+            a = aGen;
+        }
+        else {
+        #ifdef WOLFSSL_MLKEM_CACHE_A
+            a = key->a;
+        #else
+            /* Matrix A allocated at end of error vector. */
+            a = e + (k * MLKEM_N);
+        #endif
+        }
+#endif
+        s = key->priv;
+        t = key->pub;
+
+        /* Cache the public seed for use in encapsulation and encoding public
+         * key. */
+        XMEMCPY(key->pubSeed, rho, WC_ML_KEM_SYM_SZ);
+        /* Cache the z value for decapsulation and encoding private key. */
+        XMEMCPY(key->z, z, sizeof(key->z));
+
+        /* Initialize PRF for use in noise generation. */
+        mlkem_prf_init(&key->prf);
+#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
+        /* Generate noise using PRF.
+         * Alg 13: Steps 8-15: generate s and e
+         */
+        MLKEM_PROF_START(profT);
+        ret = mlkem_get_noise(&key->prf, k, s, e, NULL, sigma);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NOISE, profT);
+    }
+    if ((ret == 0) && (aGen == NULL)) {
+        /* Generate the matrix A.
+         * Alg 13: Steps 3-7
+         */
+        MLKEM_PROF_START(profT);
+        ret = mlkemkey_gen_matrix(key, a, k, rho, 0);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_MATRIX, profT);
+    }
+    if (ret == 0) {
+    #ifdef WOLFSSL_MLKEM_CACHE_A
+        if (a != key->a) {
+            XMEMCPY(key->a, a, k * k * MLKEM_N * sizeof(sword16));
+        }
+    #endif
+        /* Generate key pair from random data.
+         * Alg 13: Steps 16-18.
+         */
+        MLKEM_PROF_START(profT);
+        mlkem_keygen(s, t, e, a, k);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NTT, profT);
+#else
+        /* Generate noise using PRF.
+         * Alg 13: Steps 8-11: generate s
+         */
+        MLKEM_PROF_START(profT);
+        ret = mlkem_get_noise(&key->prf, k, s, NULL, NULL, sigma);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NOISE, profT);
+    }
+    if (ret == 0) {
+        /* Generate key pair from private vector and seeds.
+         * Alg 13: Steps 3-7: generate matrix A_hat
+         * Alg 13: 12-15: generate e
+         * Alg 13: 16-18: calculate t_hat from A_hat, s and e
+         * Matrix and noise generation are interleaved - all timed as NTT.
+         */
+        MLKEM_PROF_START(profT);
+        ret = mlkem_keygen_seeds(s, t, &key->prf, e, k, rho, sigma);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NTT, profT);
+    }
+    if (ret == 0) {
+#endif
+        /* Private and public key are set/available. */
+        key->flags |= MLKEM_FLAG_PRIV_SET | MLKEM_FLAG_PUB_SET;
+#ifdef WOLFSSL_MLKEM_CACHE_A
+        key->flags |= MLKEM_FLAG_A_SET;
+#endif
+    }
+
+#ifndef WOLFSSL_NO_MALLOC
+    /* Free dynamic memory allocated in function. */
+    if (e != tmp) {
+        XFREE(e, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+#endif
+
+    (void)aGen;
+    (void)tmp;
+
+    return ret;
+}
+
 /**
  * Make a Kyber key object using a random number generator.
  *
@@ -321,16 +1084,41 @@ int wc_MlKemKey_Free(MlKemKey* key)
  *                                       > run internal key generation algorithm
  *   &: return (ek,dk)
  *
- * @param  [in, out]  key   Kyber key object.
- * @param  [in]       rng   Random number generator.
+ * @param  [in, out]  key   Kyber key object.
+ * @param  [in]       rng   Random number generator.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key or rng is NULL.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ * @return  RNG_FAILURE_E when  generating random numbers failed.
+ * @return  DRBG_CONT_FAILURE when random number generator health check fails.
+ */
+int wc_MlKemKey_MakeKey(MlKemKey* key, WC_RNG* rng)
+{
+    return wc_MlKemKey_MakeKey_ex(key, rng, NULL, 0);
+}
+
+/**
+ * Make a Kyber key object using a random number generator and scratch memory.
+ *
+ * FIPS 203 - Algorithm 19: ML-KEM.KeyGen()
+ *
+ * No dynamic memory is allocated when scratch is not NULL.
+ *
+ * @param  [in, out]  key        Kyber key object.
+ * @param  [in]       rng        Random number generator.
+ * @param  [in]       scratch    Scratch memory of wc_MlKemKey_ScratchSize()
+ *                               bytes aligned to WC_ML_KEM_SCRATCH_ALIGN.
+ *                               NULL when dynamic memory is to be used.
+ * @param  [in]       scratchSz  Size of scratch memory in bytes.
  * @return  0 on success.
- * @return  BAD_FUNC_ARG when key or rng is NULL.
- * @return  MEMORY_E when dynamic memory allocation failed.
+ * @return  BAD_FUNC_ARG when key or rng is NULL, or scratch is not aligned.
+ * @return  BUFFER_E when scratchSz is too small.
  * @return  MEMORY_E when dynamic memory allocation failed.
  * @return  RNG_FAILURE_E when  generating random numbers failed.
  * @return  DRBG_CONT_FAILURE when random number generator health check fails.
  */
-int wc_MlKemKey_MakeKey(MlKemKey* key, WC_RNG* rng)
+int wc_MlKemKey_MakeKey_ex(MlKemKey* key, WC_RNG* rng, void* scratch,
+    word32 scratchSz)
 {
     int ret = 0;
     unsigned char rand[WC_ML_KEM_MAKEKEY_RAND_SZ];
@@ -353,7 +1141,8 @@ int wc_MlKemKey_MakeKey(MlKemKey* key, WC_RNG* rng)
          * Step 6. run internal key generation algorithm
          * Step 7. public and private key are stored in key
          */
-        ret = wc_KyberKey_MakeKeyWithRandom(key, rand, sizeof(rand));
+        ret = wc_MlKemKey_MakeKeyWithRandom_ex(key, rand, sizeof(rand),
+            scratch, scratchSz);
     }
 
     /* Ensure seeds are zeroized. */
@@ -395,30 +1184,38 @@ int wc_MlKemKey_MakeKey(MlKemKey* key, WC_RNG* rng)
  */
 int wc_MlKemKey_MakeKeyWithRandom(MlKemKey* key, const unsigned char* rand,
     int len)
+{
+    return wc_MlKemKey_MakeKeyWithRandom_ex(key, rand, len, NULL, 0);
+}
+
+/**
+ * Make a Kyber key object using random data and scratch memory.
+ *
+ * FIPS 203 - Algorithm 16: ML-KEM.KeyGen_internal(d,z)
+ *
+ * No dynamic memory is allocated when scratch is not NULL.
+ *
+ * @param  [in, out]  key        Kyber key ovject.
+ * @param  [in]       rand       Random data.
+ * @param  [in]       len        Length of random data in bytes.
+ * @param  [in]       scratch    Scratch memory of wc_MlKemKey_ScratchSize()
+ *                               bytes aligned to WC_ML_KEM_SCRATCH_ALIGN.
+ *                               NULL when dynamic memory is to be used.
+ * @param  [in]       scratchSz  Size of scratch memory in bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key or rand is NULL, or scratch is not aligned.
+ * @return  BUFFER_E when length is not WC_ML_KEM_MAKEKEY_RAND_SZ or scratchSz
+ *          is too small.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_MakeKeyWithRandom_ex(MlKemKey* key, const unsigned char* rand,
+    int len, void* scratch, word32 scratchSz)
 {
     byte buf[2 * WC_ML_KEM_SYM_SZ + 1];
-    byte* rho = buf;
-    byte* sigma = buf + WC_ML_KEM_SYM_SZ;
-#ifndef WOLFSSL_NO_MALLOC
-    sword16* e = NULL;
-#else
-#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
-#ifndef WOLFSSL_MLKEM_CACHE_A
-    sword16 e[(WC_ML_KEM_MAX_K + 1) * WC_ML_KEM_MAX_K * MLKEM_N];
-#else
-    sword16 e[WC_ML_KEM_MAX_K * MLKEM_N];
-#endif
-#else
-    sword16 e[WC_ML_KEM_MAX_K * MLKEM_N];
-#endif
-#endif
-#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
-    sword16* a = NULL;
-#endif
-    sword16* s = NULL;
-    sword16* t = NULL;
     int ret = 0;
     int k = 0;
+    sword16* tmp = NULL;
 
     /* Validate parameters. */
     if ((key == NULL) || (rand == NULL)) {
@@ -427,170 +1224,37 @@ int wc_MlKemKey_MakeKeyWithRandom(MlKemKey* key, const unsigned char* rand,
     if ((ret == 0) && (len != WC_ML_KEM_MAKEKEY_RAND_SZ)) {
         ret = BUFFER_E;
     }
+    if (ret == 0) {
+        ret = mlkemkey_get_scratch(key, scratch, scratchSz, &tmp);
+    }
 
     if (ret == 0) {
         key->flags = 0;
 
         /* Establish parameters based on key type. */
-        switch (key->type) {
-#ifndef WOLFSSL_NO_ML_KEM
-    #ifdef WOLFSSL_WC_ML_KEM_512
-        case WC_ML_KEM_512:
-            k = WC_ML_KEM_512_K;
-            break;
-    #endif
-    #ifdef WOLFSSL_WC_ML_KEM_768
-        case WC_ML_KEM_768:
-            k = WC_ML_KEM_768_K;
-            break;
-    #endif
-    #ifdef WOLFSSL_WC_ML_KEM_1024
-        case WC_ML_KEM_1024:
-            k = WC_ML_KEM_1024_K;
-            break;
-    #endif
-#endif
-#ifdef WOLFSSL_MLKEM_KYBER
-    #ifdef WOLFSSL_KYBER512
-        case KYBER512:
-            k = KYBER512_K;
-            break;
-    #endif
-    #ifdef WOLFSSL_KYBER768
-        case KYBER768:
-            k = KYBER768_K;
-            break;
-    #endif
-    #ifdef WOLFSSL_KYBER1024
-        case KYBER1024:
-            k = KYBER1024_K;
-            break;
-    #endif
-#endif
-        default:
+        k = mlkemkey_get_k(key->type);
+        if (k == 0) {
             /* No other values supported. */
             ret = NOT_COMPILED_IN;
-            break;
-        }
-    }
-
-#ifndef WOLFSSL_NO_MALLOC
-    if (ret == 0) {
-        /* Allocate dynamic memory for matrix and error vector. */
-#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
-#ifndef WOLFSSL_MLKEM_CACHE_A
-        /* e (v) | a (m) */
-        e = (sword16*)XMALLOC((k + 1) * k * MLKEM_N * sizeof(sword16),
-            key->heap, DYNAMIC_TYPE_TMP_BUFFER);
-#else
-        /* e (v) */
-        e = (sword16*)XMALLOC(k * MLKEM_N * sizeof(sword16),
-            key->heap, DYNAMIC_TYPE_TMP_BUFFER);
-#endif
-#else
-        /* e (v) */
-        e = (sword16*)XMALLOC(k * MLKEM_N * sizeof(sword16),
-            key->heap, DYNAMIC_TYPE_TMP_BUFFER);
-#endif
-        if (e == NULL) {
-            ret = MEMORY_E;
-        }
-    }
-#endif
-    if (ret == 0) {
-        const byte* d = rand;
-
-#ifdef WOLFSSL_MLKEM_CACHE_A
-        a = key->a;
-#elif !defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM)
-        /* Matrix A allocated at end of error vector. */
-        a = e + (k * MLKEM_N);
-#endif
-
-#if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
-        if (key->type & MLKEM_KYBER)
-#endif
-#ifdef WOLFSSL_MLKEM_KYBER
-        {
-            /* Expand 32 bytes of random to 32. */
-            ret = MLKEM_HASH_G(&key->prf, d, WC_ML_KEM_SYM_SZ, NULL, 0, buf);
-        }
-#endif
-#if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
-        else
-#endif
-#ifndef WOLFSSL_NO_ML_KEM
-        {
-            buf[0] = k;
-            /* Expand 33 bytes of random to 32.
-             * Alg 13: Step 1: (rho,sigma) <- G(d||k)
-             */
-            ret = MLKEM_HASH_G(&key->prf, d, WC_ML_KEM_SYM_SZ, buf, 1, buf);
         }
-#endif
     }
-    if (ret == 0) {
-        const byte* z = rand + WC_ML_KEM_SYM_SZ;
-        s = key->priv;
-        t = key->pub;
-
-        /* Cache the public seed for use in encapsulation and encoding public
-         * key. */
-        XMEMCPY(key->pubSeed, rho, WC_ML_KEM_SYM_SZ);
-        /* Cache the z value for decapsulation and encoding private key. */
-        XMEMCPY(key->z, z, sizeof(key->z));
 
-        /* Initialize PRF for use in noise generation. */
-        mlkem_prf_init(&key->prf);
-#ifndef WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM
-        /* Generate noise using PRF.
-         * Alg 13: Steps 8-15: generate s and e
-         */
-        ret = mlkem_get_noise(&key->prf, k, s, e, NULL, sigma);
-    }
-    if (ret == 0) {
-        /* Generate the matrix A.
-         * Alg 13: Steps 3-7
-         */
-        ret = mlkem_gen_matrix(&key->prf, a, k, rho, 0);
-    }
-    if (ret == 0) {
-        /* Generate key pair from random data.
-         * Alg 13: Steps 16-18.
-         */
-        mlkem_keygen(s, t, e, a, k);
-#else
-        /* Generate noise using PRF.
-         * Alg 13: Steps 8-11: generate s
-         */
-        ret = mlkem_get_noise(&key->prf, k, s, NULL, NULL, sigma);
-    }
     if (ret == 0) {
-        /* Generate key pair from private vector and seeds.
-         * Alg 13: Steps 3-7: generate matrix A_hat
-         * Alg 13: 12-15: generate e
-         * Alg 13: 16-18: calculate t_hat from A_hat, s and e
-         */
-        ret = mlkem_keygen_seeds(s, t, &key->prf, e, k, rho, sigma);
+        /* Alg 13: Step 1: (rho,sigma) <- G(d||k) */
+        ret = mlkemkey_expand_seed(key, k, rand, buf);
     }
     if (ret == 0) {
-#endif
-        /* Private and public key are set/available. */
-        key->flags |= MLKEM_FLAG_PRIV_SET | MLKEM_FLAG_PUB_SET;
-#ifdef WOLFSSL_MLKEM_CACHE_A
-        key->flags |= MLKEM_FLAG_A_SET;
-#endif
+        /* Alg 13: Steps 2-18. */
+        ret = mlkemkey_make_key(key, k, buf, rand + WC_ML_KEM_SYM_SZ, NULL,
+            tmp);
     }
 
-#ifndef WOLFSSL_NO_MALLOC
-    /* Free dynamic memory allocated in function. */
-    if (key != NULL) {
-        XFREE(e, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
-    }
-#endif
+    /* Ensure seeds are zeroized. */
+    ForceZero(buf, sizeof(buf));
 
     return ret;
 }
+
 #endif /* !WOLFSSL_MLKEM_NO_MAKE_KEY */
 
 /******************************************************************************/
@@ -677,6 +1341,7 @@ int wc_MlKemKey_SharedSecretSize(MlKemKey* key, word32* len)
     return 0;
 }
 
+
 #if !defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
     !defined(WOLFSSL_MLKEM_NO_DECAPSULATE)
 /* Encapsulate data and derive secret.
@@ -705,10 +1370,16 @@ int wc_MlKemKey_SharedSecretSize(MlKemKey* key, word32* len)
  * @param  [in]  m    Random bytes.
  * @param  [in]  r    Seed to feed to PRF when generating y, e1 and e2.
  * @param  [out] c    Calculated cipher text.
+ * @param  [in]  at   Transposed matrix A already generated from public seed.
+ *                    NULL when the matrix is to be generated.
+ * @param  [in]  tmp  Scratch memory of MLKEM_ENCAPSULATE_TMP_SZ(k) bytes.
+ *                    NULL when dynamic memory is to be used.
  * @return  0 on success.
  * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
  */
-static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
+static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c,
+    const sword16* at, sword16* tmp)
 {
     int ret = 0;
     sword16* a = NULL;
@@ -730,6 +1401,9 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
 #endif
     sword16* u = 0;
     sword16* v = 0;
+#ifdef WOLFSSL_MLKEM_PROFILE
+    word64 profT = 0;
+#endif
 
     /* Establish parameters based on key type. */
     switch (key->type) {
@@ -779,8 +1453,25 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
         break;
     }
 
+#ifdef WOLFSSL_MLKEM_CACHE_AT
+    if ((ret == 0) && (at == NULL) && key->cacheAt) {
+        /* Use transposed matrix cached against key - expand on first use. */
+        if ((key->flags & MLKEM_FLAG_AT_SET) == 0) {
+            ret = mlkemkey_cache_at(key, (int)k);
+        }
+        if (ret == 0) {
+            at = key->at;
+        }
+    }
+#endif
+
 #ifndef WOLFSSL_NO_MALLOC
-    if (ret == 0) {
+    if ((ret == 0) && (tmp != NULL)) {
+        /* Use scratch memory from caller for all matrices, vectors and
+         * polynomials. */
+        y = tmp;
+    }
+    else if (ret == 0) {
         /* Allocate dynamic memory for all matrices, vectors and polynomials. */
 #ifndef WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM
         y = (sword16*)XMALLOC(((k + 3) * k + 3) * MLKEM_N * sizeof(sword16),
@@ -806,17 +1497,23 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
 
         /* Convert msg to a polynomial.
          * Step 20: mu <- Decompress_1(ByteDecode_1(m)) */
+        MLKEM_PROF_START(profT);
         mlkem_from_msg(mu, m);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_COMPRESS, profT);
 
         /* Initialize the PRF for use in the noise generation. */
         mlkem_prf_init(&key->prf);
         /* Generate noise using PRF.
          * Steps 9-17: generate y, e_1, e_2
          */
+        MLKEM_PROF_START(profT);
         ret = mlkem_get_noise(&key->prf, k, y, e1, e2, r);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NOISE, profT);
     }
+    MLKEM_PROF_START(profT);
     #ifdef WOLFSSL_MLKEM_CACHE_A
-    if ((ret == 0) && ((key->flags & MLKEM_FLAG_A_SET) != 0)) {
+    if ((ret == 0) && (at == NULL) &&
+            ((key->flags & MLKEM_FLAG_A_SET) != 0)) {
         unsigned int i;
         /* Transpose matrix.
          *   Steps 4-8: generate matrix A_hat (from original) */
@@ -831,11 +1528,12 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
     }
     else
     #endif /* WOLFSSL_MLKEM_CACHE_A */
-    if (ret == 0) {
+    if ((ret == 0) && (at == NULL)) {
         /* Generate the transposed matrix.
          *   Step 4-8: generate matrix A_hat */
-        ret = mlkem_gen_matrix(&key->prf, a, k, key->pubSeed, 1);
+        ret = mlkemkey_gen_matrix(key, a, (int)k, key->pubSeed, 1);
     }
+    MLKEM_PROF_END(WC_MLKEM_PHASE_MATRIX, profT);
     if (ret == 0) {
         /* Assign remaining allocated dynamic memory to pointers.
          * y (v) | a (m) | mu (p) | e1 (p) | r2 (v) | u (v) | v (p)*/
@@ -844,7 +1542,10 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
 
         /* Perform encapsulation maths.
          *   Steps 18-19, 21: calculate u and v */
-        mlkem_encapsulate(key->pub, u, v, a, y, e1, e2, mu, k);
+        MLKEM_PROF_START(profT);
+        mlkem_encapsulate(key->pub, u, v, (at != NULL) ? at : a, y, e1, e2,
+            mu, k);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NTT, profT);
     }
 #else /* WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM */
     if (ret == 0) {
@@ -856,7 +1557,9 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
         mlkem_prf_init(&key->prf);
         /* Generate noise using PRF.
          * Steps 9-12: generate y */
+        MLKEM_PROF_START(profT);
         ret = mlkem_get_noise(&key->prf, k, y, NULL, NULL, r);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NOISE, profT);
     }
     if (ret == 0) {
         /* Assign remaining allocated dynamic memory to pointers.
@@ -866,16 +1569,23 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
 
         /* Perform encapsulation maths.
          *   Steps 13-17: generate e_1 and e_2
-         *   Steps 18-19, 21: calculate u and v */
+         *   Steps 18-19, 21: calculate u and v
+         * Matrix and noise generation are interleaved - all timed as NTT. */
+        MLKEM_PROF_START(profT);
         ret = mlkem_encapsulate_seeds(key->pub, &key->prf, u, a, y, k, m,
             key->pubSeed, r);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NTT, profT);
     }
+
+    (void)at;
 #endif /* WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM */
 
     if (ret == 0) {
         byte* c1 = c;
         byte* c2 = c + compVecSz;
 
+        MLKEM_PROF_START(profT);
+
     #if defined(WOLFSSL_KYBER512) || defined(WOLFSSL_WC_ML_KEM_512)
         if (k == WC_ML_KEM_512_K) {
             /* Step 22: c_1 <- ByteEncode_d_u(Compress_d_u(u)) */
@@ -903,13 +1613,18 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
             /* Step 24: return c <- (c_1||c_2) */
         }
     #endif
+        MLKEM_PROF_END(WC_MLKEM_PHASE_COMPRESS, profT);
     }
 
 #ifndef WOLFSSL_NO_MALLOC
     /* Dispose of dynamic memory allocated in function. */
-    XFREE(y, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (y != tmp) {
+        XFREE(y, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
 #endif
 
+    (void)tmp;
+
     return ret;
 }
 #endif
@@ -940,6 +1655,36 @@ static int mlkemkey_encapsulate(MlKemKey* key, const byte* m, byte* r, byte* c)
  */
 int wc_MlKemKey_Encapsulate(MlKemKey* key, unsigned char* c, unsigned char* k,
     WC_RNG* rng)
+{
+    return wc_MlKemKey_Encapsulate_ex(key, c, k, rng, NULL, 0);
+}
+
+/**
+ * Encapsulate with random number generator and scratch memory, and derive
+ * secret.
+ *
+ * FIPS 203, Algorithm 20: ML-KEM.Encaps(ek)
+ *
+ * No dynamic memory is allocated when scratch is not NULL, unless the
+ * transposed matrix is cached against the key and has not been expanded yet.
+ *
+ * @param  [in]   key        Kyber key object.
+ * @param  [out]  c          Cipher text.
+ * @param  [out]  k          Shared secret generated.
+ * @param  [in]   rng        Random number generator.
+ * @param  [in]   scratch    Scratch memory of wc_MlKemKey_ScratchSize() bytes
+ *                           aligned to WC_ML_KEM_SCRATCH_ALIGN.
+ *                           NULL when dynamic memory is to be used.
+ * @param  [in]   scratchSz  Size of scratch memory in bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key, ct, ss or RNG is NULL, or scratch is not
+ *          aligned.
+ * @return  BUFFER_E when scratchSz is too small.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_Encapsulate_ex(MlKemKey* key, unsigned char* c,
+    unsigned char* k, WC_RNG* rng, void* scratch, word32 scratchSz)
 {
     int ret = 0;
     unsigned char m[WC_ML_KEM_ENC_RAND_SZ];
@@ -960,7 +1705,8 @@ int wc_MlKemKey_Encapsulate(MlKemKey* key, unsigned char* c, unsigned char* k,
         /* Encapsulate with the random.
          * Step 5: run internal encapsulation algorithm
          */
-        ret = wc_KyberKey_EncapsulateWithRandom(key, c, k, m, sizeof(m));
+        ret = wc_MlKemKey_EncapsulateWithRandom_ex(key, c, k, m, sizeof(m),
+            scratch, scratchSz);
     }
 
     /* Step 3: return ret != 0 on falsum or internal key generation failure. */
@@ -979,18 +1725,24 @@ int wc_MlKemKey_Encapsulate(MlKemKey* key, unsigned char* c, unsigned char* k,
  *                                     > encrypt m using K-PKE with randomness r
  *   Step 3: return (K,c)
  *
+ * @param  [in]   key  Kyber key object.
  * @param  [out]  c    Cipher text.
  * @param  [out]  k    Shared secret generated.
  * @param  [in]   m    Random bytes.
  * @param  [in]   len  Length of random bytes.
+ * @param  [in]   at   Transposed matrix A already generated from public seed.
+ *                     NULL when the matrix is to be generated.
+ * @param  [in]   tmp  Scratch memory of wc_MlKemKey_ScratchSize() bytes.
+ *                     NULL when dynamic memory is to be used.
  * @return  0 on success.
  * @return  BAD_FUNC_ARG when key, c, k or RNG is NULL.
  * @return  BUFFER_E when len is not WC_ML_KEM_ENC_RAND_SZ.
  * @return  NOT_COMPILED_IN when key type is not supported.
  * @return  MEMORY_E when dynamic memory allocation failed.
  */
-int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
-    unsigned char* k, const unsigned char* m, int len)
+static int mlkemkey_encaps_internal(MlKemKey* key, unsigned char* c,
+    unsigned char* k, const unsigned char* m, int len, const sword16* at,
+    sword16* tmp)
 {
 #ifdef WOLFSSL_MLKEM_KYBER
     byte msg[KYBER_SYM_SZ];
@@ -1064,7 +1816,11 @@ int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
     #ifndef WOLFSSL_NO_MALLOC
         /* Determine how big an encoded public key will be. */
         ret = wc_KyberKey_PublicKeySize(key, &pubKeyLen);
-        if (ret == 0) {
+        if ((ret == 0) && (tmp != NULL)) {
+            /* Encode into scratch memory from caller. */
+            pubKey = (byte*)tmp;
+        }
+        else if (ret == 0) {
             /* Allocate dynamic memory for encoded public key. */
             pubKey = (byte*)XMALLOC(pubKeyLen, key->heap,
                 DYNAMIC_TYPE_TMP_BUFFER);
@@ -1079,7 +1835,9 @@ int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
     #ifndef WOLFSSL_NO_MALLOC
         }
         /* Dispose of encoded public key. */
-        XFREE(pubKey, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        if (pubKey != (byte*)tmp) {
+            XFREE(pubKey, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        }
      #endif
     }
     if ((ret == 0) && ((key->flags & MLKEM_FLAG_H_SET) == 0)) {
@@ -1128,7 +1886,8 @@ int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
 #endif
 #ifdef WOLFSSL_MLKEM_KYBER
         {
-            ret = mlkemkey_encapsulate(key, msg, kr + WC_ML_KEM_SYM_SZ, c);
+            ret = mlkemkey_encapsulate(key, msg, kr + WC_ML_KEM_SYM_SZ, c,
+                at, tmp);
         }
 #endif
 #if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
@@ -1137,7 +1896,8 @@ int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
 #ifndef WOLFSSL_NO_ML_KEM
         {
             /* Step 2: c <- K-PKE.Encrypt(ek,m,r) */
-            ret = mlkemkey_encapsulate(key, m, kr + WC_ML_KEM_SYM_SZ, c);
+            ret = mlkemkey_encapsulate(key, m, kr + WC_ML_KEM_SYM_SZ, c, at,
+                tmp);
         }
 #endif
     }
@@ -1156,18 +1916,85 @@ int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
             ret = MLKEM_KDF(kr, 2 * WC_ML_KEM_SYM_SZ, k, WC_ML_KEM_SS_SZ);
         }
     }
-#endif
-#if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
-    else
-#endif
-#ifndef WOLFSSL_NO_ML_KEM
-    {
-        if (ret == 0) {
-            /* return (K,c) */
-            XMEMCPY(k, kr, WC_ML_KEM_SS_SZ);
-        }
+#endif
+#if defined(WOLFSSL_MLKEM_KYBER) && !defined(WOLFSSL_NO_ML_KEM)
+    else
+#endif
+#ifndef WOLFSSL_NO_ML_KEM
+    {
+        if (ret == 0) {
+            /* return (K,c) */
+            XMEMCPY(k, kr, WC_ML_KEM_SS_SZ);
+        }
+    }
+#endif
+
+    return ret;
+}
+
+/**
+ * Encapsulate with random data and derive secret.
+ *
+ * FIPS 203, Algorithm 17: ML-KEM.Encaps_internal(ek, m)
+ *
+ * @param  [in]   key  Kyber key object.
+ * @param  [out]  c    Cipher text.
+ * @param  [out]  k    Shared secret generated.
+ * @param  [in]   m    Random bytes.
+ * @param  [in]   len  Length of random bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key, c, k or RNG is NULL.
+ * @return  BUFFER_E when len is not WC_ML_KEM_ENC_RAND_SZ.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
+    unsigned char* k, const unsigned char* m, int len)
+{
+    return mlkemkey_encaps_internal(key, c, k, m, len, NULL, NULL);
+}
+
+/**
+ * Encapsulate with random data and scratch memory, and derive secret.
+ *
+ * FIPS 203, Algorithm 17: ML-KEM.Encaps_internal(ek, m)
+ *
+ * No dynamic memory is allocated when scratch is not NULL, unless the
+ * transposed matrix is cached against the key and has not been expanded yet.
+ *
+ * @param  [in]   key        Kyber key object.
+ * @param  [out]  c          Cipher text.
+ * @param  [out]  k          Shared secret generated.
+ * @param  [in]   m          Random bytes.
+ * @param  [in]   len        Length of random bytes.
+ * @param  [in]   scratch    Scratch memory of wc_MlKemKey_ScratchSize() bytes
+ *                           aligned to WC_ML_KEM_SCRATCH_ALIGN.
+ *                           NULL when dynamic memory is to be used.
+ * @param  [in]   scratchSz  Size of scratch memory in bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key, c, k or RNG is NULL, or scratch is not
+ *          aligned.
+ * @return  BUFFER_E when len is not WC_ML_KEM_ENC_RAND_SZ or scratchSz is too
+ *          small.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_EncapsulateWithRandom_ex(MlKemKey* key, unsigned char* c,
+    unsigned char* k, const unsigned char* m, int len, void* scratch,
+    word32 scratchSz)
+{
+    int ret = 0;
+    sword16* tmp = NULL;
+
+    if (key == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+    if (ret == 0) {
+        ret = mlkemkey_get_scratch(key, scratch, scratchSz, &tmp);
+    }
+    if (ret == 0) {
+        ret = mlkemkey_encaps_internal(key, c, k, m, len, NULL, tmp);
     }
-#endif
 
     return ret;
 }
@@ -1192,12 +2019,14 @@ int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key, unsigned char* c,
  * @param  [in]   key  Kyber key object.
  * @param  [out]  m    Message than was encapsulated.
  * @param  [in]   c    Cipher text.
+ * @param  [in]   tmp  Scratch memory of MLKEM_DECAPSULATE_TMP_SZ(k) bytes.
+ *                     NULL when dynamic memory is to be used.
  * @return  0 on success.
  * @return  NOT_COMPILED_IN when key type is not supported.
  * @return  MEMORY_E when dynamic memory allocation failed.
  */
 static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
-    const byte* c)
+    const byte* c, sword16* tmp)
 {
     int ret = 0;
     sword16* v;
@@ -1210,6 +2039,9 @@ static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
 #else
     sword16 u[(WC_ML_KEM_MAX_K + 1) * MLKEM_N];
 #endif
+#ifdef WOLFSSL_MLKEM_PROFILE
+    word64 profT = 0;
+#endif
 
     /* Establish parameters based on key type. */
     switch (key->type) {
@@ -1261,7 +2093,11 @@ static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
 
 #if defined(WOLFSSL_SMALL_STACK) || \
     (!defined(USE_INTEL_SPEEDUP) && !defined(WOLFSSL_NO_MALLOC))
-    if (ret == 0) {
+    if ((ret == 0) && (tmp != NULL)) {
+        /* Use scratch memory from caller for a vector and a polynomial. */
+        u = tmp;
+    }
+    else if (ret == 0) {
         /* Allocate dynamic memory for a vector and a polynomial. */
         u = (sword16*)XMALLOC((k + 1) * MLKEM_N * sizeof(sword16), key->heap,
             DYNAMIC_TYPE_TMP_BUFFER);
@@ -1281,6 +2117,7 @@ static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
         v = u + k * MLKEM_N;
         w = u;
 
+        MLKEM_PROF_START(profT);
     #if defined(WOLFSSL_KYBER512) || defined(WOLFSSL_WC_ML_KEM_512)
         if (k == WC_ML_KEM_512_K) {
             /* Step 3: u' <= Decompress_d_u(ByteDecode_d_u(c1)) */
@@ -1305,23 +2142,32 @@ static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
             mlkem_decompress_5(v, c2);
         }
     #endif
+        MLKEM_PROF_END(WC_MLKEM_PHASE_COMPRESS, profT);
 
         /* Decapsulate the cipher text into polynomial.
          * Step 6: w <- v' - InvNTT(s_hat_trans o NTT(u')) */
+        MLKEM_PROF_START(profT);
         mlkem_decapsulate(key->priv, w, u, v, k);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_NTT, profT);
 
         /* Convert the polynomial into a array of bytes (message).
          * Step 7: m <- ByteEncode_1(Compress_1(w)) */
+        MLKEM_PROF_START(profT);
         mlkem_to_msg(m, w);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_COMPRESS, profT);
         /* Step 8: return m */
     }
 
 #if defined(WOLFSSL_SMALL_STACK) || \
     (!defined(USE_INTEL_SPEEDUP) && !defined(WOLFSSL_NO_MALLOC))
     /* Dispose of dynamically memory allocated in function. */
-    XFREE(u, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    if (u != tmp) {
+        XFREE(u, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
 #endif
 
+    (void)tmp;
+
     return ret;
 }
 
@@ -1362,14 +2208,18 @@ static MLKEM_NOINLINE int mlkemkey_decapsulate(MlKemKey* key, byte* m,
  * @param  [out]  ss   Shared secret.
  * @param  [in]   ct   Cipher text.
  * @param  [in]   len  Length of cipher text.
+ * @param  [in]   at   Transposed matrix A already generated from public seed.
+ *                     NULL when the matrix is to be generated.
+ * @param  [in]   tmp  Scratch memory of wc_MlKemKey_ScratchSize() bytes.
+ *                     NULL when dynamic memory is to be used.
  * @return  0 on success.
  * @return  BAD_FUNC_ARG when key, ss or cr are NULL.
  * @return  NOT_COMPILED_IN when key type is not supported.
  * @return  BUFFER_E when len is not the length of cipher text for the key type.
  * @return  MEMORY_E when dynamic memory allocation failed.
  */
-int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
-    const unsigned char* ct, word32 len)
+static int mlkemkey_decaps_internal(MlKemKey* key, unsigned char* ss,
+    const unsigned char* ct, word32 len, const sword16* at, sword16* tmp)
 {
     byte msg[WC_ML_KEM_SYM_SZ];
     byte kr[2 * WC_ML_KEM_SYM_SZ + 1];
@@ -1382,6 +2232,8 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
 #else
     byte cmp[WC_ML_KEM_MAX_CIPHER_TEXT_SIZE];
 #endif
+    /* Scratch memory for decapsulation and encapsulation operations. */
+    sword16* opTmp = tmp;
 
     /* Validate parameters. */
     if ((key == NULL) || (ss == NULL) || (ct == NULL)) {
@@ -1438,7 +2290,12 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
     }
 
 #if !defined(USE_INTEL_SPEEDUP) && !defined(WOLFSSL_NO_MALLOC)
-    if (ret == 0) {
+    if ((ret == 0) && (tmp != NULL)) {
+        /* Generate cipher text at start of scratch memory from caller. */
+        cmp = (byte*)tmp;
+        opTmp = tmp + MLKEM_SCRATCH_ROUND(ctSz) / sizeof(sword16);
+    }
+    else if (ret == 0) {
         /* Allocate memory for cipher text that is generated. */
         cmp = (byte*)XMALLOC(ctSz, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
         if (cmp == NULL) {
@@ -1449,7 +2306,7 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
 
     if (ret == 0) {
         /* Decapsulate the cipher text. */
-        ret = mlkemkey_decapsulate(key, msg, ct);
+        ret = mlkemkey_decapsulate(key, msg, ct, opTmp);
     }
     if (ret == 0) {
         /* Hash message into seed buffer. */
@@ -1458,7 +2315,8 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
     }
     if (ret == 0) {
         /* Encapsulate the message. */
-        ret = mlkemkey_encapsulate(key, msg, kr + WC_ML_KEM_SYM_SZ, cmp);
+        ret = mlkemkey_encapsulate(key, msg, kr + WC_ML_KEM_SYM_SZ, cmp,
+            at, opTmp);
     }
     if (ret == 0) {
         /* Compare generated cipher text with that passed in. */
@@ -1500,17 +2358,490 @@ int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
 
 #if !defined(USE_INTEL_SPEEDUP) && !defined(WOLFSSL_NO_MALLOC)
     /* Dispose of dynamic memory allocated in function. */
-    if (key != NULL) {
+    if ((key != NULL) && (cmp != (byte*)tmp)) {
         XFREE(cmp, key->heap, DYNAMIC_TYPE_TMP_BUFFER);
     }
 #endif
 
     return ret;
 }
+
+/**
+ * Decapsulate the cipher text to calculate the shared secret.
+ *
+ * FIPS 203, Algorithm 21: ML-KEM.Decaps(dk, c)
+ *
+ * @param  [in]   key  Kyber key object.
+ * @param  [out]  ss   Shared secret.
+ * @param  [in]   ct   Cipher text.
+ * @param  [in]   len  Length of cipher text.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key, ss or cr are NULL.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  BUFFER_E when len is not the length of cipher text for the key type.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
+    const unsigned char* ct, word32 len)
+{
+    return mlkemkey_decaps_internal(key, ss, ct, len, NULL, NULL);
+}
+
+/**
+ * Decapsulate the cipher text to calculate the shared secret using scratch
+ * memory.
+ *
+ * FIPS 203, Algorithm 21: ML-KEM.Decaps(dk, c)
+ *
+ * No dynamic memory is allocated when scratch is not NULL, unless the
+ * transposed matrix is cached against the key and has not been expanded yet.
+ *
+ * @param  [in]   key        Kyber key object.
+ * @param  [out]  ss         Shared secret.
+ * @param  [in]   ct         Cipher text.
+ * @param  [in]   len        Length of cipher text.
+ * @param  [in]   scratch    Scratch memory of wc_MlKemKey_ScratchSize() bytes
+ *                           aligned to WC_ML_KEM_SCRATCH_ALIGN.
+ *                           NULL when dynamic memory is to be used.
+ * @param  [in]   scratchSz  Size of scratch memory in bytes.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when key, ss or cr are NULL, or scratch is not
+ *          aligned.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  BUFFER_E when len is not the length of cipher text for the key type
+ *          or scratchSz is too small.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_Decapsulate_ex(MlKemKey* key, unsigned char* ss,
+    const unsigned char* ct, word32 len, void* scratch, word32 scratchSz)
+{
+    int ret = 0;
+    sword16* tmp = NULL;
+
+    if (key == NULL) {
+        ret = BAD_FUNC_ARG;
+    }
+    if (ret == 0) {
+        ret = mlkemkey_get_scratch(key, scratch, scratchSz, &tmp);
+    }
+    if (ret == 0) {
+        ret = mlkemkey_decaps_internal(key, ss, ct, len, NULL, tmp);
+    }
+
+    return ret;
+}
 #endif /* WOLFSSL_MLKEM_NO_DECAPSULATE */
 
 /******************************************************************************/
 
+/* Check the keys passed to a batch operation.
+ *
+ * All keys must be the same type so that their matrices can be generated
+ * together. Checked before any matrix is generated from the public seeds.
+ *
+ * @param  [in]   keys   Array of Kyber key objects.
+ * @param  [in]   cnt    Number of keys.
+ * @param  [in]   flags  Flags that must be set on every key.
+ * @param  [out]  k      Number of dimensions of the keys.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when keys or a key is NULL, cnt is less than 1, the
+ *          keys are not all the same type or a key doesn't have flags set.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ */
+static int mlkemkey_batch_check(MlKemKey** keys, int cnt, int flags, int* k)
+{
+    int ret = 0;
+    int i;
+
+    if ((keys == NULL) || (cnt < 1) || (keys[0] == NULL)) {
+        ret = BAD_FUNC_ARG;
+    }
+    for (i = 1; (ret == 0) && (i < cnt); i++) {
+        if ((keys[i] == NULL) || (keys[i]->type != keys[0]->type)) {
+            ret = BAD_FUNC_ARG;
+        }
+    }
+    for (i = 0; (ret == 0) && (i < cnt); i++) {
+        if ((keys[i]->flags & flags) != flags) {
+            ret = BAD_FUNC_ARG;
+        }
+    }
+    if (ret == 0) {
+        *k = mlkemkey_get_k(keys[0]->type);
+        if (*k == 0) {
+            ret = NOT_COMPILED_IN;
+        }
+    }
+
+    return ret;
+}
+
+#if defined(MLKEM_BATCH_MATRIX_AT) && \
+    (!defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
+     !defined(WOLFSSL_MLKEM_NO_DECAPSULATE))
+/* Generate the transposed matrices for a group of keys together.
+ *
+ * Keys that have matrix A cached are given NULL and transpose their cached
+ * matrix in encapsulation. Keys caching the transposed matrix have it expanded
+ * into their cache and are given NULL.
+ *
+ * @param  [in]   keys  Array of Kyber key objects.
+ * @param  [in]   cnt   Number of keys. At most WOLFSSL_MLKEM_BATCH_SZ.
+ * @param  [in]   k     Number of dimensions of the keys.
+ * @param  [in]   mat   Buffer to hold cnt matrices.
+ * @param  [out]  at    Array of cnt transposed matrices.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+static int mlkemkey_batch_gen_at(MlKemKey** keys, int cnt, int k,
+    sword16* mat, sword16** at)
+{
+    sword16* a[WOLFSSL_MLKEM_BATCH_SZ];
+    byte* seed[WOLFSSL_MLKEM_BATCH_SZ];
+    int ret = 0;
+    int n = 0;
+    int i;
+#ifdef WOLFSSL_MLKEM_PROFILE
+    word64 profT = 0;
+#endif
+
+    for (i = 0; (ret == 0) && (i < cnt); i++) {
+        at[i] = NULL;
+    #ifdef WOLFSSL_MLKEM_CACHE_AT
+        if (keys[i]->cacheAt) {
+            if ((keys[i]->flags & MLKEM_FLAG_AT_SET) == 0) {
+                /* Expand into the key's cache with the rest of the group. */
+                ret = mlkemkey_alloc_at(keys[i], k);
+                if (ret == 0) {
+                    a[n] = keys[i]->at;
+                    seed[n] = keys[i]->pubSeed;
+                    n++;
+                }
+            }
+        }
+        else
+    #endif
+    #ifdef WOLFSSL_MLKEM_CACHE_A
+        if ((keys[i]->flags & MLKEM_FLAG_A_SET) == 0)
+    #endif
+        {
+            at[i] = mat + n * k * k * MLKEM_N;
+            a[n] = at[i];
+            seed[n] = keys[i]->pubSeed;
+            n++;
+        }
+    }
+    if ((ret == 0) && (n > 0)) {
+        MLKEM_PROF_START(profT);
+        ret = mlkem_gen_matrix_batch(&keys[0]->prf, a, k, seed, 1, n);
+        MLKEM_PROF_END(WC_MLKEM_PHASE_MATRIX, profT);
+    }
+#ifdef WOLFSSL_MLKEM_CACHE_AT
+    for (i = 0; (ret == 0) && (i < cnt); i++) {
+        if (keys[i]->cacheAt) {
+            keys[i]->flags |= MLKEM_FLAG_AT_SET;
+        }
+    }
+#endif
+
+    return ret;
+}
+#endif
+
+#ifndef WOLFSSL_MLKEM_NO_MAKE_KEY
+/**
+ * Make a number of Kyber keys using a random number generator.
+ *
+ * Each key is generated as with wc_MlKemKey_MakeKey(). The random for a group
+ * of keys is generated with one call and the matrices of the group are
+ * generated together so that the multi-lane XOF is kept full.
+ *
+ * @param  [in, out]  keys  Array of Kyber key objects. All the same type.
+ * @param  [in]       cnt   Number of keys to make.
+ * @param  [in]       rng   Random number generator.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when keys, a key or rng is NULL, cnt is less than 1 or
+ *          the keys are not all the same type.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ * @return  RNG_FAILURE_E when generating random numbers failed.
+ */
+int wc_MlKemKey_MakeKeyBatch(MlKemKey** keys, int cnt, WC_RNG* rng)
+{
+    byte rand[WOLFSSL_MLKEM_BATCH_SZ * WC_ML_KEM_MAKEKEY_RAND_SZ];
+    byte buf[WOLFSSL_MLKEM_BATCH_SZ][2 * WC_ML_KEM_SYM_SZ + 1];
+#ifdef MLKEM_BATCH_MATRIX_A
+#ifndef WOLFSSL_MLKEM_CACHE_A
+    sword16* mat = NULL;
+#endif
+    sword16* a[WOLFSSL_MLKEM_BATCH_SZ];
+    byte* seed[WOLFSSL_MLKEM_BATCH_SZ];
+#endif
+    int ret;
+    int k = 0;
+    int n = 0;
+    int i;
+    int j;
+#if defined(WOLFSSL_MLKEM_PROFILE) && defined(MLKEM_BATCH_MATRIX_A)
+    word64 profT = 0;
+#endif
+
+    ret = mlkemkey_batch_check(keys, cnt, 0, &k);
+    if ((ret == 0) && (rng == NULL)) {
+        ret = BAD_FUNC_ARG;
+    }
+#if defined(MLKEM_BATCH_MATRIX_A) && !defined(WOLFSSL_MLKEM_CACHE_A)
+    if (ret == 0) {
+        n = (cnt < WOLFSSL_MLKEM_BATCH_SZ) ? cnt : WOLFSSL_MLKEM_BATCH_SZ;
+        /* Allocate dynamic memory for a group of matrices. */
+        mat = (sword16*)XMALLOC(n * k * k * MLKEM_N * sizeof(sword16),
+            keys[0]->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        if (mat == NULL) {
+            ret = MEMORY_E;
+        }
+    }
+#endif
+
+    for (i = 0; (ret == 0) && (i < cnt); i += n) {
+        n = ((cnt - i) < WOLFSSL_MLKEM_BATCH_SZ) ? (cnt - i) :
+            WOLFSSL_MLKEM_BATCH_SZ;
+
+        /* d and z for each key in the group. */
+        ret = wc_RNG_GenerateBlock(rng, rand,
+            (word32)(n * WC_ML_KEM_MAKEKEY_RAND_SZ));
+        for (j = 0; (ret == 0) && (j < n); j++) {
+            keys[i + j]->flags = 0;
+            ret = mlkemkey_expand_seed(keys[i + j], k,
+                rand + j * WC_ML_KEM_MAKEKEY_RAND_SZ, buf[j]);
+        #ifdef MLKEM_BATCH_MATRIX_A
+        #ifdef WOLFSSL_MLKEM_CACHE_A
+            a[j] = keys[i + j]->a;
+        #else
+            a[j] = mat + j * k * k * MLKEM_N;
+        #endif
+            /* rho */
+            seed[j] = buf[j];
+        #endif
+        }
+    #ifdef MLKEM_BATCH_MATRIX_A
+        if (ret == 0) {
+            MLKEM_PROF_START(profT);
+            ret = mlkem_gen_matrix_batch(&keys[i]->prf, a, k, seed, 0, n);
+            MLKEM_PROF_END(WC_MLKEM_PHASE_MATRIX, profT);
+        }
+    #endif
+        for (j = 0; (ret == 0) && (j < n); j++) {
+        #ifdef MLKEM_BATCH_MATRIX_A
+            sword16* aGen = a[j];
+        #else
+            sword16* aGen = NULL;
+        #endif
+
+            ret = mlkemkey_make_key(keys[i + j], k, buf[j],
+                rand + j * WC_ML_KEM_MAKEKEY_RAND_SZ + WC_ML_KEM_SYM_SZ, aGen,
+                NULL);
+        }
+    }
+
+    /* Ensure seeds are zeroized. */
+    ForceZero(rand, sizeof(rand));
+    ForceZero(buf, sizeof(buf));
+#if defined(MLKEM_BATCH_MATRIX_A) && !defined(WOLFSSL_MLKEM_CACHE_A)
+    if (mat != NULL) {
+        XFREE(mat, keys[0]->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+#endif
+
+    return ret;
+}
+#endif /* !WOLFSSL_MLKEM_NO_MAKE_KEY */
+
+#ifndef WOLFSSL_MLKEM_NO_ENCAPSULATE
+/**
+ * Encapsulate with a number of Kyber keys using a random number generator.
+ *
+ * Each encapsulation is performed as with wc_MlKemKey_Encapsulate(). The random
+ * for a group of encapsulations is generated with one call and the matrices of
+ * the group are generated together so that the multi-lane XOF is kept full.
+ *
+ * @param  [in]   keys  Array of Kyber key objects. All the same type.
+ * @param  [out]  ct    Array of cipher text buffers.
+ * @param  [out]  ss    Array of shared secret buffers.
+ * @param  [in]   cnt   Number of encapsulations.
+ * @param  [in]   rng   Random number generator.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when keys, ct, ss, rng or an element is NULL, cnt is
+ *          less than 1, the keys are not all the same type or a key has no
+ *          public key set.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_EncapsulateBatch(MlKemKey** keys, unsigned char** ct,
+    unsigned char** ss, int cnt, WC_RNG* rng)
+{
+    byte m[WOLFSSL_MLKEM_BATCH_SZ * WC_ML_KEM_ENC_RAND_SZ];
+#ifdef MLKEM_BATCH_MATRIX_AT
+    sword16* mat = NULL;
+    sword16* at[WOLFSSL_MLKEM_BATCH_SZ];
+#endif
+    int ret;
+    int k = 0;
+    int n = 0;
+    int i;
+    int j;
+
+    ret = mlkemkey_batch_check(keys, cnt, MLKEM_FLAG_PUB_SET, &k);
+    if ((ret == 0) && ((ct == NULL) || (ss == NULL) || (rng == NULL))) {
+        ret = BAD_FUNC_ARG;
+    }
+    for (i = 0; (ret == 0) && (i < cnt); i++) {
+        if ((ct[i] == NULL) || (ss[i] == NULL)) {
+            ret = BAD_FUNC_ARG;
+        }
+    }
+#ifdef MLKEM_BATCH_MATRIX_AT
+    if (ret == 0) {
+        n = (cnt < WOLFSSL_MLKEM_BATCH_SZ) ? cnt : WOLFSSL_MLKEM_BATCH_SZ;
+        /* Allocate dynamic memory for a group of matrices. */
+        mat = (sword16*)XMALLOC(n * k * k * MLKEM_N * sizeof(sword16),
+            keys[0]->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        if (mat == NULL) {
+            ret = MEMORY_E;
+        }
+    }
+#endif
+
+    for (i = 0; (ret == 0) && (i < cnt); i += n) {
+        n = ((cnt - i) < WOLFSSL_MLKEM_BATCH_SZ) ? (cnt - i) :
+            WOLFSSL_MLKEM_BATCH_SZ;
+
+        /* m for each encapsulation in the group. */
+        ret = wc_RNG_GenerateBlock(rng, m, (word32)(n * WC_ML_KEM_ENC_RAND_SZ));
+    #ifdef MLKEM_BATCH_MATRIX_AT
+        if (ret == 0) {
+            ret = mlkemkey_batch_gen_at(keys + i, n, k, mat, at);
+        }
+    #endif
+        for (j = 0; (ret == 0) && (j < n); j++) {
+        #ifdef MLKEM_BATCH_MATRIX_AT
+            const sword16* atGen = at[j];
+        #else
+            const sword16* atGen = NULL;
+        #endif
+
+            ret = mlkemkey_encaps_internal(keys[i + j], ct[i + j], ss[i + j],
+                m + j * WC_ML_KEM_ENC_RAND_SZ, WC_ML_KEM_ENC_RAND_SZ, atGen,
+                NULL);
+        }
+    }
+
+    /* Ensure random is zeroized. */
+    ForceZero(m, sizeof(m));
+#ifdef MLKEM_BATCH_MATRIX_AT
+    if (mat != NULL) {
+        XFREE(mat, keys[0]->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+#endif
+
+    return ret;
+}
+#endif /* !WOLFSSL_MLKEM_NO_ENCAPSULATE */
+
+#ifndef WOLFSSL_MLKEM_NO_DECAPSULATE
+/**
+ * Decapsulate a number of cipher texts to calculate the shared secrets.
+ *
+ * Each decapsulation is performed as with wc_MlKemKey_Decapsulate(). The
+ * matrices used to re-encrypt in a group are generated together so that the
+ * multi-lane XOF is kept full.
+ *
+ * @param  [in]   keys  Array of Kyber key objects. All the same type.
+ * @param  [out]  ss    Array of shared secret buffers.
+ * @param  [in]   ct    Array of cipher texts.
+ * @param  [in]   len   Length of each cipher text.
+ * @param  [in]   cnt   Number of decapsulations.
+ * @return  0 on success.
+ * @return  BAD_FUNC_ARG when keys, ss, ct or an element is NULL, cnt is less
+ *          than 1, the keys are not all the same type or a key has no
+ *          private key set.
+ * @return  NOT_COMPILED_IN when key type is not supported.
+ * @return  BUFFER_E when len is not the length of cipher text for the key type.
+ * @return  MEMORY_E when dynamic memory allocation failed.
+ */
+int wc_MlKemKey_DecapsulateBatch(MlKemKey** keys, unsigned char** ss,
+    const unsigned char* const* ct, word32 len, int cnt)
+{
+#ifdef MLKEM_BATCH_MATRIX_AT
+    sword16* mat = NULL;
+    sword16* at[WOLFSSL_MLKEM_BATCH_SZ];
+#endif
+    int ret;
+    int k = 0;
+    int n = 0;
+    int i;
+    int j;
+
+    ret = mlkemkey_batch_check(keys, cnt, MLKEM_FLAG_BOTH_SET, &k);
+    if ((ret == 0) && ((ss == NULL) || (ct == NULL))) {
+        ret = BAD_FUNC_ARG;
+    }
+    for (i = 0; (ret == 0) && (i < cnt); i++) {
+        if ((ss[i] == NULL) || (ct[i] == NULL)) {
+            ret = BAD_FUNC_ARG;
+        }
+    }
+    if (ret == 0) {
+        word32 ctSz;
+
+        /* Check length before generating any matrices. */
+        ret = wc_MlKemKey_CipherTextSize(keys[0], &ctSz);
+        if ((ret == 0) && (len != ctSz)) {
+            ret = BUFFER_E;
+        }
+    }
+#ifdef MLKEM_BATCH_MATRIX_AT
+    if (ret == 0) {
+        n = (cnt < WOLFSSL_MLKEM_BATCH_SZ) ? cnt : WOLFSSL_MLKEM_BATCH_SZ;
+        /* Allocate dynamic memory for a group of matrices. */
+        mat = (sword16*)XMALLOC(n * k * k * MLKEM_N * sizeof(sword16),
+            keys[0]->heap, DYNAMIC_TYPE_TMP_BUFFER);
+        if (mat == NULL) {
+            ret = MEMORY_E;
+        }
+    }
+#endif
+
+    for (i = 0; (ret == 0) && (i < cnt); i += n) {
+        n = ((cnt - i) < WOLFSSL_MLKEM_BATCH_SZ) ? (cnt - i) :
+            WOLFSSL_MLKEM_BATCH_SZ;
+
+    #ifdef MLKEM_BATCH_MATRIX_AT
+        ret = mlkemkey_batch_gen_at(keys + i, n, k, mat, at);
+    #endif
+        for (j = 0; (ret == 0) && (j < n); j++) {
+        #ifdef MLKEM_BATCH_MATRIX_AT
+            const sword16* atGen = at[j];
+        #else
+            const sword16* atGen = NULL;
+        #endif
+
+            ret = mlkemkey_decaps_internal(keys[i + j], ss[i + j], ct[i + j],
+                len, atGen, NULL);
+        }
+    }
+
+#ifdef MLKEM_BATCH_MATRIX_AT
+    if (mat != NULL) {
+        XFREE(mat, keys[0]->heap, DYNAMIC_TYPE_TMP_BUFFER);
+    }
+#endif
+
+    return ret;
+}
+#endif /* !WOLFSSL_MLKEM_NO_DECAPSULATE */
+
+/******************************************************************************/
+
 /**
  * Get the public key and public seed from bytes.
  *
@@ -1663,6 +2994,10 @@ int wc_MlKemKey_DecodePrivateKey(MlKemKey* key, const unsigned char* in,
 
         /* Set flags */
         key->flags |= MLKEM_FLAG_H_SET | MLKEM_FLAG_BOTH_SET;
+    #ifdef WOLFSSL_MLKEM_CACHE_AT
+        /* Public seed changed - cached transposed matrix expanded on use. */
+        key->flags &= ~MLKEM_FLAG_AT_SET;
+    #endif
     }
 
     return ret;
@@ -1756,6 +3091,13 @@ int wc_MlKemKey_DecodePublicKey(MlKemKey* key, const unsigned char* in,
     if (ret == 0) {
         /* Record public key and public hash set. */
         key->flags |= MLKEM_FLAG_PUB_SET | MLKEM_FLAG_H_SET;
+    #ifdef WOLFSSL_MLKEM_CACHE_AT
+        /* Public seed changed - expand transposed matrix when caching. */
+        key->flags &= ~MLKEM_FLAG_AT_SET;
+        if (key->cacheAt) {
+            ret = mlkemkey_cache_at(key, (int)k);
+        }
+    #endif
     }
 
     return ret;
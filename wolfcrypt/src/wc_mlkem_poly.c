@@ -147,6 +147,12 @@ static cpuid_flags_t cpuid_flags = WC_CPUID_INITIALIZER;
 /* Number of random bytes to generate for ETA2. */
 #define ETA2_RAND_SIZE     ((2 * MLKEM_N) / 4)
 
+#if defined(WOLFSSL_ASCON_X86_64_ASM) && !defined(WOLFSSL_MLKEM_SMALL) && \
+    !defined(WOLFSSL_ARMASM)
+    /* Generate matrix and noise polynomials with multi-lane Ascon-XOF128. */
+    #define MLKEM_XOF_LANES
+#endif
+
 
 /* Montgomery reduce a.
  *
@@ -2872,6 +2878,8 @@ static int mlkem_gen_matrix_k4_aarch64(sword16* a, byte* seed, int transposed)
 #endif /* USE_INTEL_SPEEDUP */
 
 #if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__))
+#if !defined(MLKEM_XOF_LANES) || defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
+    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
 /* Absorb the seed data for squeezing out pseudo-random data.
  *
  * FIPS 203, Section 4.1 (Modified for Ascon):
@@ -2894,6 +2902,7 @@ static int mlkem_xof_absorb(wc_AsconXof128* asconXof, byte* seed, int len)
 
     return ret;
 }
+#endif
 
 /* Squeeze the state to produce pseudo-random data.
  *
@@ -3040,7 +3049,9 @@ void mlkem_prf_free(wc_AsconXof128* prf) {
     wc_AsconXof128_Clear(prf);
 }
 
-#if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__))
+#if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__)) && \
+    (!defined(MLKEM_XOF_LANES) || defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
+     defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM))
 /* Create pseudo-random data from the key using SHAKE-256.
  *
  * FIPS 203, Section 4.1:
@@ -3333,7 +3344,8 @@ static unsigned int mlkem_rej_uniform_c(sword16* p, unsigned int len,
 #if !defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
     !defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
 
-#if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__))
+#if !(defined(WOLFSSL_ARMASM) && defined(__aarch64__)) && \
+    !defined(MLKEM_XOF_LANES)
 /* Deterministically generate a matrix (or transpose) of uniform integers mod q.
  *
  * Seed used with XOF to generate random bytes.
@@ -3462,6 +3474,132 @@ static int mlkem_gen_matrix_c(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
 }
 #endif
 
+#ifdef MLKEM_XOF_LANES
+/* Deterministically generate a matrix (or transpose) of uniform integers mod q.
+ *
+ * Polynomials are generated in groups with the multi-lane Ascon-XOF128 API so
+ * that 4 (AVX2) or 8 (AVX-512) permutations are calculated at once. Output is
+ * the same as mlkem_gen_matrix_c().
+ *
+ * Polynomials of more than one matrix are placed in the lanes together so that
+ * the lanes stay full when k x k is not a multiple of the lane count.
+ * Polynomials are numbered across the matrices - polynomial q is in matrix
+ * q / (k x k) - and only those from start up to end are generated.
+ *
+ * @param  [out]  a           Array of matrices of uniform integers.
+ * @param  [in]   k           Number of dimensions. k x k polynomials.
+ * @param  [in]   seed        Array of bytes to seed XOF generation.
+ * @param  [in]   transposed  Whether A or A^T is generated.
+ * @param  [in]   start       Index of first polynomial to generate.
+ * @param  [in]   end         Index after last polynomial to generate.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails. Only possible when
+ * WOLFSSL_SMALL_STACK is defined.
+ */
+static int mlkem_gen_matrix_lanes(sword16** a, int k, byte** seed,
+    int transposed, int start, int end)
+{
+#ifdef WOLFSSL_SMALL_STACK
+    byte* rand = NULL;
+    wc_AsconXof128* xof = NULL;
+#else
+    byte rand[ASCON_XOF128_MAX_LANES * (GEN_MATRIX_SIZE + 2)];
+    wc_AsconXof128 xof[ASCON_XOF128_MAX_LANES];
+#endif
+    byte extSeed[ASCON_XOF128_MAX_LANES][WC_ML_KEM_SYM_SZ + 2];
+    wc_AsconXof128* lane[ASCON_XOF128_MAX_LANES];
+    byte* out[ASCON_XOF128_MAX_LANES];
+    const byte* in[ASCON_XOF128_MAX_LANES];
+    int ret = 0;
+    int n = k * k;
+    int q;
+    int l;
+
+#ifdef WOLFSSL_SMALL_STACK
+    rand = (byte*)XMALLOC(ASCON_XOF128_MAX_LANES * (GEN_MATRIX_SIZE + 2), NULL,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    xof = (wc_AsconXof128*)XMALLOC(ASCON_XOF128_MAX_LANES *
+        sizeof(wc_AsconXof128), NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    if ((rand == NULL) || (xof == NULL)) {
+        ret = MEMORY_E;
+    }
+#endif
+
+    if (ret == 0) {
+        for (l = 0; l < ASCON_XOF128_MAX_LANES; l++) {
+            lane[l] = &xof[l];
+            out[l] = rand + l * (GEN_MATRIX_SIZE + 2);
+            in[l] = extSeed[l];
+            /* Loading 64 bits, only using 48 bits. Loading 2 bytes more than
+             * used. */
+            out[l][GEN_MATRIX_SIZE + 0] = 0xff;
+            out[l][GEN_MATRIX_SIZE + 1] = 0xff;
+        }
+    }
+
+    /* Generate polynomials in groups - polynomial q is in matrix q / n and,
+     * with p = q % n, at row p / k and column p % k. */
+    for (q = start; (ret == 0) && (q < end); q += ASCON_XOF128_MAX_LANES) {
+        int lanes = ((end - q) < ASCON_XOF128_MAX_LANES) ? (end - q) :
+            ASCON_XOF128_MAX_LANES;
+
+        for (l = 0; (ret == 0) && (l < lanes); l++) {
+            int p = (q + l) % n;
+            byte i = (byte)(p / k);
+            byte j = (byte)(p % k);
+
+            /* Copy seed into buffer than has space for i and j. */
+            XMEMCPY(extSeed[l], seed[(q + l) / n], WC_ML_KEM_SYM_SZ);
+            if (transposed) {
+                /* Alg 14, Step 6: .. rho||i||j ... */
+                extSeed[l][WC_ML_KEM_SYM_SZ + 0] = i;
+                extSeed[l][WC_ML_KEM_SYM_SZ + 1] = j;
+            }
+            else {
+                /* Alg 13, Step 5: .. rho||j||i ... */
+                extSeed[l][WC_ML_KEM_SYM_SZ + 0] = j;
+                extSeed[l][WC_ML_KEM_SYM_SZ + 1] = i;
+            }
+            ret = wc_AsconXof128_Init(lane[l]);
+        }
+        if (ret == 0) {
+            /* Absorb the index specific seeds.
+             * Alg 7, Step 1-2 */
+            ret = wc_AsconXof128_AbsorbX(lane, lanes, in, WC_ML_KEM_SYM_SZ + 2);
+        }
+        if (ret == 0) {
+            /* Create data based on the seeds.
+             * Alg 7, Step 5. */
+            ret = wc_AsconXof128_SqueezeX(lane, lanes, out, GEN_MATRIX_SIZE);
+        }
+        for (l = 0; (ret == 0) && (l < lanes); l++) {
+            sword16* poly = a[(q + l) / n] + ((q + l) % n) * MLKEM_N;
+            unsigned int ctr;
+
+            /* Alg 7, Step 3-16. */
+            ctr = mlkem_rej_uniform_c(poly, MLKEM_N, out[l], GEN_MATRIX_SIZE);
+            /* Create more blocks if too many rejected - rare so done one
+             * lane at a time.
+             * Alg 7, Step 4. */
+            while ((ret == 0) && (ctr < MLKEM_N)) {
+                /* Alg 7, Step 5. */
+                ret = mlkem_xof_squeezeblocks(lane[l], out[l], 1);
+                /* Alg 7, Step 4-16. */
+                ctr += mlkem_rej_uniform_c(poly + ctr, MLKEM_N - ctr, out[l],
+                    XOF_BLOCK_SIZE);
+            }
+        }
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    XFREE(xof, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(rand, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#endif
+
+    return ret;
+}
+#endif /* MLKEM_XOF_LANES */
+
 /* Deterministically generate a matrix (or transpose) of uniform integers mod q.
  *
  * Seed used with XOF to generate random bytes.
@@ -3496,7 +3634,12 @@ int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
         else
     #endif
         {
+        #ifdef MLKEM_XOF_LANES
+            ret = mlkem_gen_matrix_lanes(&a, WC_ML_KEM_512_K, &seed,
+                transposed, 0, WC_ML_KEM_512_K * WC_ML_KEM_512_K);
+        #else
             ret = mlkem_gen_matrix_c(prf, a, WC_ML_KEM_512_K, seed, transposed);
+        #endif
         }
 #endif
     }
@@ -3515,7 +3658,12 @@ int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
         else
     #endif
         {
+        #ifdef MLKEM_XOF_LANES
+            ret = mlkem_gen_matrix_lanes(&a, WC_ML_KEM_768_K, &seed,
+                transposed, 0, WC_ML_KEM_768_K * WC_ML_KEM_768_K);
+        #else
             ret = mlkem_gen_matrix_c(prf, a, WC_ML_KEM_768_K, seed, transposed);
+        #endif
         }
 #endif
     }
@@ -3534,8 +3682,13 @@ int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
         else
     #endif
         {
+        #ifdef MLKEM_XOF_LANES
+            ret = mlkem_gen_matrix_lanes(&a, WC_ML_KEM_1024_K, &seed,
+                transposed, 0, WC_ML_KEM_1024_K * WC_ML_KEM_1024_K);
+        #else
             ret = mlkem_gen_matrix_c(prf, a, WC_ML_KEM_1024_K, seed,
                 transposed);
+        #endif
         }
 #endif
     }
@@ -3550,10 +3703,48 @@ int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
     return ret;
 }
 
+/* Deterministically generate a number of matrices (or transposes) of uniform
+ * integers mod q.
+ *
+ * Each matrix is the same as generated by mlkem_gen_matrix() with its seed.
+ * When the multi-lane Ascon-XOF128 is available, the polynomials of all the
+ * matrices are generated together to keep the lanes full.
+ *
+ * @param  [in]   prf         XOF object.
+ * @param  [out]  a           Array of matrices of uniform integers.
+ * @param  [in]   k           Number of dimensions. k x k polynomials.
+ * @param  [in]   seed        Array of bytes to seed XOF generation.
+ * @param  [in]   transposed  Whether A or A^T is generated.
+ * @param  [in]   cnt         Number of matrices to generate.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails. Only possible when
+ * WOLFSSL_SMALL_STACK is defined.
+ */
+int mlkem_gen_matrix_batch(MLKEM_PRF_T* prf, sword16** a, int k, byte** seed,
+    int transposed, int cnt)
+{
+    int ret = 0;
+
+#ifdef MLKEM_XOF_LANES
+    ret = mlkem_gen_matrix_lanes(a, k, seed, transposed, 0, k * k * cnt);
+
+    (void)prf;
+#else
+    int i;
+
+    for (i = 0; (ret == 0) && (i < cnt); i++) {
+        ret = mlkem_gen_matrix(prf, a[i], k, seed[i], transposed);
+    }
+#endif
+
+    return ret;
+}
+
 #endif
 
 #if defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
-    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)
+    defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM) || \
+    (defined(WOLFSSL_MLKEM_PARALLEL) && !defined(MLKEM_XOF_LANES))
 
 /* Deterministically generate a matrix (or transpose) of uniform integers mod q.
  *
@@ -3664,6 +3855,43 @@ static int mlkem_gen_matrix_i(MLKEM_PRF_T* prf, sword16* a, int k, byte* seed,
 
 #endif
 
+#ifdef WOLFSSL_MLKEM_PARALLEL
+/* Deterministically generate one row of a matrix (or transpose) of uniform
+ * integers mod q.
+ *
+ * Only uses local state so rows can be generated on different threads at the
+ * same time. Output is the same as the row from mlkem_gen_matrix().
+ *
+ * FIPS 203, Algorithm 13: K-PKE.KeyGen(d), Steps 4-6
+ * FIPS 203, Algorithm 14: K-PKE.Encrypt(ek_PKE,m,r), Steps 5-7
+ *
+ * @param  [out]  a           Matrix of uniform integers.
+ * @param  [in]   k           Number of dimensions. k x k polynomials.
+ * @param  [in]   seed        Bytes to seed XOF generation.
+ * @param  [in]   i           Index of row to generate.
+ * @param  [in]   transposed  Whether A or A^T is generated.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails. Only possible when
+ * WOLFSSL_SMALL_STACK is defined.
+ */
+int mlkem_gen_matrix_row(sword16* a, int k, byte* seed, int i, int transposed)
+{
+    int ret;
+#ifdef MLKEM_XOF_LANES
+    /* Polynomials of the row are generated together in the lanes. */
+    ret = mlkem_gen_matrix_lanes(&a, k, &seed, transposed, i * k, (i + 1) * k);
+#else
+    wc_AsconXof128 xof;
+
+    ret = mlkem_gen_matrix_i(&xof, a + i * k * MLKEM_N, k, seed, i,
+        transposed);
+    wc_AsconXof128_Clear(&xof);
+#endif
+
+    return ret;
+}
+#endif
+
 
 /******************************************************************************/
 
@@ -3943,7 +4171,9 @@ static void mlkem_cbd_eta3(sword16* p, const byte* r)
 }
 #endif
 
-#if !(defined(__aarch64__) && defined(WOLFSSL_ARMASM))
+#if !(defined(__aarch64__) && defined(WOLFSSL_ARMASM)) && \
+    (!defined(MLKEM_XOF_LANES) || defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
+     defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM))
 
 /* Get noise/error by calculating random bytes and sampling to a binomial
  * distribution.
@@ -4499,7 +4729,152 @@ static int mlkem_get_noise_k4_aarch64(sword16* vec1, sword16* vec2,
 #endif
 #endif /* __aarch64__ && WOLFSSL_ARMASM */
 
-#if !(defined(__aarch64__) && defined(WOLFSSL_ARMASM))
+#ifdef MLKEM_XOF_LANES
+/* Get the noise/error by calculating random bytes and sampling to a binomial
+ * distribution.
+ *
+ * Consecutive polynomials with the same eta are generated together with the
+ * multi-lane Ascon-XOF128 API. Output is the same as mlkem_get_noise_c().
+ *
+ * @param  [in]       k     Number of polynomials in vector.
+ * @param  [out]      vec1  First Vector of polynomials.
+ * @param  [in]       eta1  Size of noise/error integers with first vector.
+ * @param  [out]      vec2  Second Vector of polynomials.
+ * @param  [in]       eta2  Size of noise/error integers with second vector.
+ * @param  [out]      poly  Polynomial.
+ * @param  [in]       seed  Seed to use when calculating random.
+ * @return  0 on success.
+ * @return  MEMORY_E when dynamic memory allocation fails. Only possible when
+ * WOLFSSL_SMALL_STACK is defined.
+ */
+static int mlkem_get_noise_lanes(int k, sword16* vec1, int eta1,
+    sword16* vec2, int eta2, sword16* poly, byte* seed)
+{
+#ifdef WOLFSSL_SMALL_STACK
+    byte* rand = NULL;
+    wc_AsconXof128* xof = NULL;
+#else
+    byte rand[ASCON_XOF128_MAX_LANES * ETA3_RAND_SIZE];
+    wc_AsconXof128 xof[ASCON_XOF128_MAX_LANES];
+#endif
+    byte extSeed[ASCON_XOF128_MAX_LANES][WC_ML_KEM_SYM_SZ + 1];
+    wc_AsconXof128* lane[ASCON_XOF128_MAX_LANES];
+    byte* out[ASCON_XOF128_MAX_LANES];
+    const byte* in[ASCON_XOF128_MAX_LANES];
+    /* Polynomials to generate and the eta of each - maximum is 2 * k + 1. */
+    sword16* p[2 * WC_ML_KEM_MAX_K + 1];
+    int eta[2 * WC_ML_KEM_MAX_K + 1];
+    int ret = 0;
+    int n = 0;
+    int i;
+    int l;
+
+    /* Seed index is the index of the polynomial in list. */
+    for (i = 0; i < k; i++) {
+        p[n] = vec1 + i * MLKEM_N;
+        eta[n++] = eta1;
+    }
+    if (vec2 != NULL) {
+        for (i = 0; i < k; i++) {
+            p[n] = vec2 + i * MLKEM_N;
+            eta[n++] = eta2;
+        }
+    }
+    else {
+        n = 2 * k;
+    }
+    if (poly != NULL) {
+        p[n] = poly;
+        eta[n++] = MLKEM_CBD_ETA2;
+    }
+
+#ifdef WOLFSSL_SMALL_STACK
+    rand = (byte*)XMALLOC(ASCON_XOF128_MAX_LANES * ETA3_RAND_SIZE, NULL,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    xof = (wc_AsconXof128*)XMALLOC(ASCON_XOF128_MAX_LANES *
+        sizeof(wc_AsconXof128), NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    if ((rand == NULL) || (xof == NULL)) {
+        ret = MEMORY_E;
+    }
+#endif
+
+    if (ret == 0) {
+        for (l = 0; l < ASCON_XOF128_MAX_LANES; l++) {
+            lane[l] = &xof[l];
+            out[l] = rand + l * ETA3_RAND_SIZE;
+            in[l] = extSeed[l];
+            XMEMCPY(extSeed[l], seed, WC_ML_KEM_SYM_SZ);
+        }
+    }
+
+    for (i = 0; (ret == 0) && (i < n); ) {
+        int lanes = 0;
+        word32 sz = ETA2_RAND_SIZE;
+
+        /* Skip vector that is not generated - its eta entries are not set. */
+        if ((vec2 == NULL) && (i == k)) {
+            i = 2 * k;
+            continue;
+        }
+    #if defined(WOLFSSL_KYBER512) || defined(WOLFSSL_WC_ML_KEM_512)
+        if (eta[i] == MLKEM_CBD_ETA3) {
+            sz = ETA3_RAND_SIZE;
+        }
+    #endif
+        /* Group consecutive polynomials with the same eta. */
+        while ((ret == 0) && (lanes < ASCON_XOF128_MAX_LANES) &&
+               (i + lanes < n) && (eta[i + lanes] == eta[i]) &&
+               ((vec2 != NULL) || (i + lanes != k))) {
+            extSeed[lanes][WC_ML_KEM_SYM_SZ] = (byte)(i + lanes);
+            ret = wc_AsconXof128_Init(lane[lanes]);
+            lanes++;
+        }
+        if (ret == 0) {
+            ret = wc_AsconXof128_AbsorbX(lane, lanes, in, WC_ML_KEM_SYM_SZ + 1);
+        }
+        if (ret == 0) {
+            ret = wc_AsconXof128_SqueezeX(lane, lanes, out, sz);
+        }
+        for (l = 0; (ret == 0) && (l < lanes); l++) {
+        #if defined(WOLFSSL_KYBER512) || defined(WOLFSSL_WC_ML_KEM_512)
+            if (eta[i] == MLKEM_CBD_ETA3) {
+                /* Sample for values in range -3..3 from 3 bits of random. */
+                mlkem_cbd_eta3(p[i + l], out[l]);
+            }
+            else
+        #endif
+            {
+                /* Sample for values in range -2..2 from 2 bits of random. */
+                mlkem_cbd_eta2(p[i + l], out[l]);
+            }
+        }
+        i += lanes;
+    }
+    /* Leave seed as the serial implementation does. */
+    seed[WC_ML_KEM_SYM_SZ] = (byte)(2 * k);
+
+#ifdef WOLFSSL_SMALL_STACK
+    for (l = 0; (xof != NULL) && (l < ASCON_XOF128_MAX_LANES); l++) {
+        wc_AsconXof128_Clear(&xof[l]);
+    }
+    XFREE(xof, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+    if (rand != NULL) {
+        ForceZero(rand, ASCON_XOF128_MAX_LANES * ETA3_RAND_SIZE);
+    }
+    XFREE(rand, NULL, DYNAMIC_TYPE_TMP_BUFFER);
+#else
+    for (l = 0; l < ASCON_XOF128_MAX_LANES; l++) {
+        wc_AsconXof128_Clear(&xof[l]);
+    }
+    ForceZero(rand, sizeof(rand));
+#endif
+
+    return ret;
+}
+#endif /* MLKEM_XOF_LANES */
+
+#if !(defined(__aarch64__) && defined(WOLFSSL_ARMASM)) && \
+    !defined(MLKEM_XOF_LANES)
 
 /* Get the noise/error by calculating random bytes and sampling to a binomial
  * distribution.
@@ -4579,6 +4954,16 @@ int mlkem_get_noise(MLKEM_PRF_T* prf, int k, sword16* vec1, sword16* vec2,
         }
         else
     #endif
+    #ifdef MLKEM_XOF_LANES
+        if (poly == NULL) {
+            ret = mlkem_get_noise_lanes(k, vec1, MLKEM_CBD_ETA3, vec2,
+                MLKEM_CBD_ETA3, NULL, seed);
+        }
+        else {
+            ret = mlkem_get_noise_lanes(k, vec1, MLKEM_CBD_ETA3, vec2,
+                MLKEM_CBD_ETA2, poly, seed);
+        }
+    #else
         if (poly == NULL) {
             ret = mlkem_get_noise_c(prf, k, vec1, MLKEM_CBD_ETA3, vec2,
                 MLKEM_CBD_ETA3, NULL, seed);
@@ -4587,6 +4972,7 @@ int mlkem_get_noise(MLKEM_PRF_T* prf, int k, sword16* vec1, sword16* vec2,
             ret = mlkem_get_noise_c(prf, k, vec1, MLKEM_CBD_ETA3, vec2,
                 MLKEM_CBD_ETA2, poly, seed);
         }
+    #endif
 #endif
     }
     else
@@ -4604,8 +4990,13 @@ int mlkem_get_noise(MLKEM_PRF_T* prf, int k, sword16* vec1, sword16* vec2,
         else
     #endif
         {
+        #ifdef MLKEM_XOF_LANES
+            ret = mlkem_get_noise_lanes(k, vec1, MLKEM_CBD_ETA2, vec2,
+                MLKEM_CBD_ETA2, poly, seed);
+        #else
             ret = mlkem_get_noise_c(prf, k, vec1, MLKEM_CBD_ETA2, vec2,
                 MLKEM_CBD_ETA2, poly, seed);
+        #endif
         }
 #endif
     }
@@ -4624,8 +5015,13 @@ int mlkem_get_noise(MLKEM_PRF_T* prf, int k, sword16* vec1, sword16* vec2,
         else
     #endif
         {
+        #ifdef MLKEM_XOF_LANES
+            ret = mlkem_get_noise_lanes(k, vec1, MLKEM_CBD_ETA2, vec2,
+                MLKEM_CBD_ETA2, poly, seed);
+        #else
             ret = mlkem_get_noise_c(prf, k, vec1, MLKEM_CBD_ETA2, vec2,
                 MLKEM_CBD_ETA2, poly, seed);
+        #endif
         }
 #endif
     }
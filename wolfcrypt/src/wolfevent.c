@@ -59,6 +59,15 @@ int wolfEvent_Poll(WOLF_EVENT* event, WOLF_EVENT_FLAG flags)
         ret = wolfAsync_EventPoll(event, flags);
     }
 #endif /* WOLFSSL_ASYNC_CRYPT */
+#ifdef WOLFSSL_CRYPT_POOL
+    /* State is set by the pool worker that ran it */
+    if (event->type == WOLF_EVENT_TYPE_CRYPT_POOL) {
+        ret = 0;
+    }
+#endif
+#ifndef WOLFSSL_ASYNC_CRYPT
+    (void)flags;
+#endif
 
     return ret;
 }
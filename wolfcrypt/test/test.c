@@ -15554,6 +15554,130 @@ WOLFSSL_TEST_SUBROUTINE wc_test_ret_t aesgcm_default_test(void)
     return 0;
 }
 
+#if (defined(WOLFSSL_AES_128) || defined(WOLFSSL_AES_256)) && \
+    !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST) && \
+    !defined(WOLFSSL_ASYNC_CRYPT) && !defined(WOLFSSL_NO_MALLOC)
+#define AESGCM_RECORDS_TEST
+/* Largest plaintext of a TLS record. */
+#define AESGCM_RECORDS_TEST_SZ 16384
+#define AESGCM_RECORDS_TEST_CNT 5
+/* Encrypt runs of records and compare with encrypting each on its own.
+ *
+ * Records 0 and 1 and records 2 and 3 are the same length and may be
+ * encrypted in pairs. Record 4 is always encrypted on its own.
+ */
+static wc_test_ret_t aesgcm_records_test(Aes* aes)
+{
+    WOLFSSL_SMALL_STACK_STATIC const byte key[] = {
+        0x29, 0x8e, 0xfa, 0x1c, 0xcf, 0x29, 0xcf, 0x62,
+        0xae, 0x68, 0x24, 0xbf, 0xc1, 0x95, 0x57, 0xfc,
+        0x6f, 0x0d, 0x74, 0x5b, 0x6d, 0x27, 0x60, 0x4a,
+        0x11, 0x83, 0x3e, 0x80, 0x16, 0x78, 0xa6, 0xb8
+    };
+    WOLFSSL_SMALL_STACK_STATIC const word32 keySizes[] = {
+    #ifdef WOLFSSL_AES_128
+        16,
+    #endif
+    #ifdef WOLFSSL_AES_256
+        32,
+    #endif
+    };
+    WOLFSSL_SMALL_STACK_STATIC const word32 sizes[] = {
+        0, 1, 15, 16, 17, 127, 128, 129, 255, 256, 272, 16383,
+        AESGCM_RECORDS_TEST_SZ
+    };
+    const int cnt = (int)(sizeof(sizes) / sizeof(sizes[0]));
+    byte* plain = NULL;
+    byte* cipher = NULL;
+    byte* expOut = NULL;
+    byte iv[AESGCM_RECORDS_TEST_CNT][GCM_NONCE_MID_SZ];
+    byte tag[AESGCM_RECORDS_TEST_CNT][WC_AES_BLOCK_SIZE];
+    byte expTag[WC_AES_BLOCK_SIZE];
+    byte aad[20];
+    wc_AesGcmRecord rec[AESGCM_RECORDS_TEST_CNT];
+    wc_test_ret_t ret = 0;
+    int i;
+    int j;
+    int k;
+
+    plain = (byte*)XMALLOC(AESGCM_RECORDS_TEST_CNT * AESGCM_RECORDS_TEST_SZ,
+        HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    cipher = (byte*)XMALLOC(AESGCM_RECORDS_TEST_CNT * AESGCM_RECORDS_TEST_SZ,
+        HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    expOut = (byte*)XMALLOC(AESGCM_RECORDS_TEST_SZ, HEAP_HINT,
+        DYNAMIC_TYPE_TMP_BUFFER);
+    if ((plain == NULL) || (cipher == NULL) || (expOut == NULL))
+        ERROR_OUT(WC_TEST_RET_ENC_ERRNO, out);
+
+    for (j = 0; j < AESGCM_RECORDS_TEST_CNT; j++) {
+        for (i = 0; i < AESGCM_RECORDS_TEST_SZ; i++)
+            plain[j * AESGCM_RECORDS_TEST_SZ + i] = (byte)(i * 7 + j);
+        for (i = 0; i < GCM_NONCE_MID_SZ; i++)
+            iv[j][i] = (byte)(i + j);
+    }
+    for (i = 0; i < (int)sizeof(aad); i++)
+        aad[i] = (byte)(0xa0 + i);
+
+    for (k = 0; k < (int)(sizeof(keySizes) / sizeof(keySizes[0])); k++) {
+        ret = wc_AesGcmSetKey(aes, key, keySizes[k]);
+        if (ret != 0)
+            ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+
+        for (i = 0; i < cnt; i++) {
+            XMEMSET(rec, 0, sizeof(rec));
+            for (j = 0; j < AESGCM_RECORDS_TEST_CNT; j++) {
+                rec[j].out = cipher + j * AESGCM_RECORDS_TEST_SZ;
+                rec[j].in = plain + j * AESGCM_RECORDS_TEST_SZ;
+                rec[j].iv = iv[j];
+                rec[j].ivSz = GCM_NONCE_MID_SZ;
+                rec[j].authTag = tag[j];
+                rec[j].authTagSz = WC_AES_BLOCK_SIZE - (word32)j;
+                rec[j].authIn = aad;
+            }
+            rec[0].sz = rec[1].sz = sizes[i];
+            rec[0].authInSz = rec[1].authInSz = sizes[i] % (sizeof(aad) + 1);
+            rec[2].sz = rec[3].sz = sizes[(i + 1) % cnt];
+            rec[2].authInSz = rec[3].authInSz = 13;
+            rec[4].sz = sizes[(i + 2) % cnt];
+            rec[4].authInSz = 5;
+
+            ret = wc_AesGcmEncryptRecords(aes, rec, AESGCM_RECORDS_TEST_CNT);
+            if (ret != 0)
+                ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+
+            for (j = 0; j < AESGCM_RECORDS_TEST_CNT; j++) {
+                ret = wc_AesGcmEncrypt(aes, expOut, rec[j].in, rec[j].sz,
+                    rec[j].iv, rec[j].ivSz, expTag, rec[j].authTagSz,
+                    rec[j].authIn, rec[j].authInSz);
+                if (ret != 0)
+                    ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+                if (XMEMCMP(rec[j].out, expOut, rec[j].sz) != 0)
+                    ERROR_OUT(WC_TEST_RET_ENC_I(i), out);
+                if (XMEMCMP(tag[j], expTag, rec[j].authTagSz) != 0)
+                    ERROR_OUT(WC_TEST_RET_ENC_I(i), out);
+            }
+        }
+    }
+
+    ret = wc_AesGcmEncryptRecords(NULL, rec, 1);
+    if (ret != WC_NO_ERR_TRACE(BAD_FUNC_ARG))
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    ret = wc_AesGcmEncryptRecords(aes, NULL, 1);
+    if (ret != WC_NO_ERR_TRACE(BAD_FUNC_ARG))
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+    ret = wc_AesGcmEncryptRecords(aes, NULL, 0);
+    if (ret != 0)
+        ERROR_OUT(WC_TEST_RET_ENC_EC(ret), out);
+
+out:
+    XFREE(plain, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(cipher, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+    XFREE(expOut, HEAP_HINT, DYNAMIC_TYPE_TMP_BUFFER);
+
+    return ret;
+}
+#endif
+
 WOLFSSL_TEST_SUBROUTINE wc_test_ret_t aesgcm_test(void)
 {
 #if defined(WOLFSSL_SMALL_STACK) && !defined(WOLFSSL_NO_MALLOC)
@@ -16359,6 +16483,11 @@ WOLFSSL_TEST_SUBROUTINE wc_test_ret_t aesgcm_test(void)
 #endif /* BENCH_AESGCM_LARGE */
 #endif /* WOLFSSL_AESGCM_STREAM */
 #endif /* WOLFSSL_AES_256 */
+#ifdef AESGCM_RECORDS_TEST
+    ret = aesgcm_records_test(enc);
+    if (ret != 0)
+        goto out;
+#endif
 #endif /* !WOLFSSL_AFALG_XILINX_AES && !WOLFSSL_XILINX_CRYPT */
 
     ret = 0;
@@ -64,6 +64,9 @@
 #ifdef WOLFSSL_SM4
     #include <wolfssl/wolfcrypt/sm4.h>
 #endif
+#ifdef HAVE_ASCON
+    #include <wolfssl/wolfcrypt/ascon.h>
+#endif
 #include <wolfssl/wolfcrypt/logging.h>
 #ifndef NO_HMAC
     #include <wolfssl/wolfcrypt/hmac.h>
@@ -845,6 +848,10 @@
             #define BUILD_TLS_SM4_CCM_SM3
         #endif
     #endif
+
+    #if defined(HAVE_ASCON) && !defined(NO_SHA256)
+        #define BUILD_TLS_ASCON_AEAD128_SHA256
+    #endif
 #endif
 
 #if !defined(WOLFCRYPT_ONLY) && defined(NO_PSK) && \
@@ -1172,6 +1179,11 @@ enum {
     TLS_SM4_GCM_SM3              = 0xC6,
     TLS_SM4_CCM_SM3              = 0xC7,
 
+    /* TLS v1.3 Ascon cipher suite - 0xFF (ASCON_BYTE) is first byte.
+     * Private use code point - only interoperates with peers configured the
+     * same way. */
+    TLS_ASCON_AEAD128_SHA256     = 0x01,
+
     /* TLS v1.2 SM cipher suites - 0xE0 (SM_BYTE) is first byte */
     TLS_ECDHE_ECDSA_WITH_SM4_CBC_SM3 = 0x11,
     TLS_ECDHE_ECDSA_WITH_SM4_GCM_SM3 = 0x51,
@@ -1450,6 +1462,8 @@ enum {
  * https://www.rfc-editor.org/rfc/rfc8998.html#name-aead_sm4_ccm
  */
 #define AEAD_SM4_CCM_LIMIT                       w64From32(0, (1 << 10) - 1)
+/* Limit is 2^54 octets per key (NIST SP 800-232) - 2^40 full records */
+#define AEAD_ASCON_LIMIT                         w64From32(1 << 8, 0)
 
 #if defined(WOLFSSL_TLS13) || !defined(NO_PSK)
 
@@ -1489,6 +1503,7 @@ enum Misc {
     TLS13_BYTE     = 0x13,         /* TLS v1.3 first byte of cipher suite */
     ECDHE_PSK_BYTE = 0xD0,         /* RFC 8442 */
     SM_BYTE        = 0xE0,         /* SM first byte - private range */
+    ASCON_BYTE     = 0xFF,         /* Ascon first byte - private use */
 
     SEND_CERT       = 1,
     SEND_BLANK_CERT = 2,
@@ -2028,6 +2043,26 @@ WOLFSSL_LOCAL int NamedGroupIsPqcHybrid(int group);
     #if WOLFSSL_TICKET_KEY_LIFETIME <= SESSION_TICKET_HINT_DEFAULT
         #error "Ticket Key lifetime must be longer than ticket life hint."
     #endif
+
+    #ifdef WOLFSSL_TICKET_KEY_RING
+        #ifndef HAVE_C___ATOMIC
+            #error "WOLFSSL_TICKET_KEY_RING requires __atomic support"
+        #endif
+        #ifndef WOLFSSL_TICKET_KEY_RING_SZ
+            /* Number of ticket keys kept for decryption. */
+            #define WOLFSSL_TICKET_KEY_RING_SZ  4
+        #endif
+        #if WOLFSSL_TICKET_KEY_RING_SZ < 2 || WOLFSSL_TICKET_KEY_RING_SZ > 128 || \
+            (WOLFSSL_TICKET_KEY_RING_SZ & (WOLFSSL_TICKET_KEY_RING_SZ - 1)) != 0
+            #error "Ticket key ring size must be a power of 2 from 2 to 128."
+        #endif
+        #ifndef WOLFSSL_TICKET_KEY_ROTATE
+            /* Seconds a key encrypts tickets for before a new key is made.
+             * The oldest key has then expired when its slot is reused. */
+            #define WOLFSSL_TICKET_KEY_ROTATE \
+                (WOLFSSL_TICKET_KEY_LIFETIME / (WOLFSSL_TICKET_KEY_RING_SZ - 1))
+        #endif
+    #endif
 #endif
 
 #define MAX_ENCRYPT_SZ ENCRYPT_LEN
@@ -2182,6 +2217,10 @@ WOLFSSL_LOCAL int wolfssl_priv_der_blind(WC_RNG* rng, DerBuffer* key,
 WOLFSSL_LOCAL void wolfssl_priv_der_unblind(DerBuffer* key, DerBuffer* mask);
 #endif
 WOLFSSL_LOCAL int  DecodePrivateKey(WOLFSSL *ssl, word32* length);
+#ifdef WOLFSSL_CTX_DECODED_KEY
+WOLFSSL_LOCAL int  DecodeCtxPrivateKey(WOLFSSL_CTX* ctx);
+WOLFSSL_LOCAL void FreeCtxDecodedKey(WOLFSSL_CTX* ctx);
+#endif
 #ifdef WOLFSSL_DUAL_ALG_CERTS
 WOLFSSL_LOCAL int  DecodeAltPrivateKey(WOLFSSL *ssl, word32* length);
 #endif
@@ -2336,16 +2375,110 @@ enum {
     #define STATIC_BUFFER_LEN RECORD_HEADER_SZ
 #endif
 
+#ifndef WOLFSSL_READ_AHEAD_SZ
+    /* input buffer size when reading ahead: room for several full records */
+    #define WOLFSSL_READ_AHEAD_SZ 65536
+#endif
+#ifndef WOLFSSL_READ_AHEAD_MAX_SZ
+    #define WOLFSSL_READ_AHEAD_MAX_SZ (1 << 24)
+#endif
+
+#if !defined(NO_TLS) && !defined(WOLFSSL_ASYNC_CRYPT) && \
+    !defined(WOLFSSL_THREADED_CRYPT)
+    #if !defined(_WIN32) && !defined(USE_WINDOWS_API) && \
+        !defined(NO_WRITEV) && !defined(WOLFSSL_NO_NATIVE_WRITEV)
+        /* wolfSSL_writev() gathers straight into the records */
+        #define WOLFSSL_NATIVE_WRITEV
+    #endif
+    #ifdef WOLFSSL_SEND_BATCH_SZ
+        /* records of every large write are built back to back and sent
+         * together - output buffer grows to hold WOLFSSL_SEND_BATCH_SZ bytes
+         * of plaintext in records */
+        #define WOLFSSL_SEND_BATCH_ALL
+    #endif
+    #if defined(WOLFSSL_TLS13) && defined(BUILD_AESGCM) && \
+        !defined(HAVE_FIPS) && !defined(HAVE_SELFTEST) && \
+        !defined(WOLFSSL_CIPHER_TEXT_CHECK) && \
+        !defined(WOLFSSL_RENESAS_TSIP_TLS) && \
+        !defined(WOLFSSL_NO_SEND_GCM_RECORDS)
+        /* full TLS 1.3 AES-GCM records are encrypted in pairs */
+        #define WOLFSSL_SEND_GCM_RECORDS
+    #endif
+    #if defined(WOLFSSL_NATIVE_WRITEV) || defined(WOLFSSL_SEND_BATCH_ALL) || \
+        defined(WOLFSSL_SEND_GCM_RECORDS)
+        #define WOLFSSL_SEND_BATCH
+    #endif
+#endif
+#ifndef WOLFSSL_WRITEV_BATCH_SZ
+    /* plaintext of records packed into the output buffer before sending */
+    #define WOLFSSL_WRITEV_BATCH_SZ (4 * MAX_RECORD_SIZE)
+#endif
+#if !defined(NO_TLS) && !defined(WOLFSSL_STATIC_MEMORY) && \
+    !defined(WOLFSSL_NO_IO_POOL)
+    /* I/O buffers of connections can be borrowed from a pool in the CTX */
+    #define WOLFSSL_IO_POOL
+    /* number of buffer sizes kept in the pool */
+    #define WOLFSSL_IO_POOL_CLASSES 5
+#endif
+
+#ifdef WOLFSSL_IO_POOL
+/* Free I/O buffers kept by a CTX for its connections, by size class. */
+typedef struct IOPool {
+    byte*         free[WOLFSSL_IO_POOL_CLASSES];   /* linked through start */
+    word32        freeCnt[WOLFSSL_IO_POOL_CLASSES];
+    word32        inUse[WOLFSSL_IO_POOL_CLASSES];  /* held by connections */
+    word32        gets;         /* buffers borrowed */
+    word32        hits;         /* buffers borrowed from the free lists */
+    word32        maxFree;      /* free buffers kept per class, 0 when off */
+    wolfSSL_Mutex lock;
+    byte          init;         /* lock initialized */
+} IOPool;
+#endif
+
 typedef struct {
     ALIGN16 byte staticBuffer[STATIC_BUFFER_LEN];
     byte*  buffer;       /* place holder for static or dynamic buffer */
     word32 length;       /* total buffer length used */
     word32 idx;          /* idx to part of length already consumed */
     word32 bufferSize;   /* current buffer size */
+#ifdef WOLFSSL_IO_POOL
+    IOPool* pool;        /* pool buffer is borrowed from, NULL when not */
+#endif
     byte   dynamicFlag;  /* dynamic memory currently in use */
     byte   offset;       /* alignment offset attempt */
+    byte   poolClass;    /* size class + 1 when borrowed from CTX pool */
 } bufferStatic;
 
+#if defined(WOLFSSL_EARLY_DATA) && defined(WOLFSSL_EARLY_DATA_ANTI_REPLAY)
+/* ClientHellos with early data seen by a server CTX, defined in tls13.c. */
+typedef struct AntiReplayStore AntiReplayStore;
+#endif
+
+/* Dynamic record sizing: application data goes out in small records, which
+ * the peer can decrypt as soon as the first TCP segment arrives, until enough
+ * has been sent for the congestion window to have opened up. */
+#ifndef WOLFSSL_DYN_REC_SMALL_SZ
+    /* plaintext that fits in one TCP segment of a 1500 byte MTU path with
+     * TLS record overhead */
+    #define WOLFSSL_DYN_REC_SMALL_SZ 1369
+#endif
+#ifndef WOLFSSL_DYN_REC_RAMP_SZ
+    /* bytes sent in small records before using full sized records */
+    #define WOLFSSL_DYN_REC_RAMP_SZ 65536
+#endif
+#ifndef WOLFSSL_DYN_REC_IDLE_SEC
+    /* seconds without writes after which records start small again */
+    #define WOLFSSL_DYN_REC_IDLE_SEC 1
+#endif
+
+typedef struct DynRecord {
+    word32 rampSz;      /* bytes to send in small records */
+    word32 idleSec;     /* idle seconds before starting small again, 0 never */
+    word32 sent;        /* bytes sent since start or last idle period */
+    word32 last;        /* time of last write in seconds */
+    word16 smallSz;     /* size of small records, 0 when off */
+} DynRecord;
+
 /* Cipher Suites holder */
 struct Suites {
     word16 suiteSz;                 /* suite length in bytes        */
@@ -3487,14 +3620,43 @@ typedef struct SessionTicket {
 
 #if !defined(WOLFSSL_NO_DEF_TICKET_ENC_CB) && !defined(NO_WOLFSSL_SERVER)
 
+#ifdef WOLFSSL_TICKET_KEY_RING
+/* Session ticket key in the ring of the default callback. */
+typedef struct TicketKey {
+    /* Name of key - sent in ticket. */
+    byte name[WOLFSSL_TICKET_NAME_SZ];
+    /* Key to encrypt/decrypt with. */
+    byte key[WOLFSSL_TICKET_KEY_SZ];
+    /* Expirary date of key for decryption. */
+    word32 expirary;
+    /* Date after which key no longer used for encryption. */
+    word32 encEnd;
+    /* Set when key given through API - not replaced after encEnd. */
+    byte added;
+    /* Odd while key is being replaced. */
+    word32 seq;
+} TicketKey;
+#endif
+
 /* Data passed to default SessionTicket enc/dec callback. */
 typedef struct TicketEncCbCtx {
+#ifndef WOLFSSL_TICKET_KEY_RING
     /* Name for this context. */
     byte name[WOLFSSL_TICKET_NAME_SZ];
     /* Current keys - current and next. */
     byte key[2][WOLFSSL_TICKET_KEY_SZ];
     /* Expirary date of keys. */
     word32 expirary[2];
+#else
+    /* Keys that tickets may be encrypted with. */
+    TicketKey ring[WOLFSSL_TICKET_KEY_RING_SZ];
+    /* Index of key to encrypt with. */
+    int cur;
+    /* Set while a key is being made to replace an expiring one. */
+    int rotating;
+    /* Set once RNG and first key made. */
+    int setup;
+#endif
     /* Random number generator to use for generating name, keys and IV. */
     WC_RNG rng;
 #ifndef SINGLE_THREADED
@@ -3505,6 +3667,11 @@ typedef struct TicketEncCbCtx {
     WOLFSSL_CTX* ctx;
 } TicketEncCbCtx;
 
+#ifdef WOLFSSL_TICKET_KEY_RING
+WOLFSSL_LOCAL int TicketKeyRing_Export(WOLFSSL_CTX* ctx, byte* keys);
+WOLFSSL_LOCAL int TicketKeyRing_Import(WOLFSSL_CTX* ctx, const byte* keys);
+#endif
+
 #endif /* !WOLFSSL_NO_DEF_TICKET_ENC_CB && !NO_WOLFSSL_SERVER */
 
 WOLFSSL_LOCAL int  TLSX_UseSessionTicket(TLSX** extensions,
@@ -3737,6 +3904,10 @@ struct WOLFSSL_CTX {
     WOLFSSL_METHOD* method;
 #ifdef SINGLE_THREADED
     WC_RNG*         rng;          /* to be shared with WOLFSSL w/o locking */
+#endif
+#ifdef WOLFSSL_CTX_PARENT_RNG
+    WC_RNG*         parentRng;    /* seeds each WOLFSSL's rng */
+    wolfSSL_Mutex   parentRngMutex;
 #endif
     wolfSSL_RefWithMutex ref;
     int         err;              /* error code in case of mutex not created */
@@ -3770,6 +3941,10 @@ struct WOLFSSL_CTX {
     byte        privateKeyLabel:1;
     int         privateKeySz;
     int         privateKeyDevId;
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    void*       decodedKey;       /* privateKey decoded for all SSLs to use */
+    word32      decodedKeyType;   /* DYNAMIC_TYPE_* of decodedKey */
+#endif
 
 #ifdef WOLFSSL_DUAL_ALG_CERTS
     DerBuffer*  altPrivateKey;
@@ -3970,6 +4145,11 @@ struct WOLFSSL_CTX {
 #endif
 #ifdef WOLFSSL_EARLY_DATA
     word32          maxEarlyDataSz;
+#ifdef WOLFSSL_EARLY_DATA_ANTI_REPLAY
+    AntiReplayStore*   antiReplay;    /* seen ClientHellos, NULL when off */
+    CallbackAntiReplay antiReplayCb;  /* store shared with other processes */
+    void*              antiReplayCtx;
+#endif
 #endif
 #ifdef HAVE_ANON
     byte        useAnon;               /* User wants to allow Anon suites */
@@ -4159,6 +4339,14 @@ struct WOLFSSL_CTX {
         const WOLFSSL_QUIC_METHOD *method;
     } quic;
 #endif
+#ifdef WOLFSSL_KTLS
+    byte ktls;                  /* WOLFSSL_KTLS_* directions to offload */
+#endif
+    word32 readAheadSz;         /* input buffer size to fill, 0 when off */
+    DynRecord dynRec;           /* record sizing for new connections */
+#ifdef WOLFSSL_IO_POOL
+    IOPool ioPool;              /* I/O buffers for connections to borrow */
+#endif
 #if defined(WOLFSSL_TLS13) && defined(HAVE_ECH)
     WOLFSSL_EchConfig* echConfigs;
 #endif
@@ -4391,6 +4579,9 @@ typedef struct Ciphers {
 #ifdef WOLFSSL_SM4
     wc_Sm4*   sm4;
 #endif
+#ifdef HAVE_ASCON
+    byte*     ascon; /* Ascon-AEAD128 key and full IV */
+#endif
 #if defined(WOLFSSL_TLS13) && defined(HAVE_NULL_CIPHER) && !defined(NO_HMAC)
     Hmac* hmac;
 #endif
@@ -4413,9 +4604,24 @@ typedef struct RecordNumberCiphers {
 #ifdef HAVE_CHACHA
         ChaCha *chacha;
 #endif
+#ifdef HAVE_ASCON
+        byte *ascon;
+#endif
 } RecordNumberCiphers;
 #endif /* WOLFSSL_DTLS13 */
 
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+/* TLS 1.3 AES-GCM records built into the output buffer but not yet encrypted.
+ * Positions are offsets into the output buffer so that it may grow. */
+typedef struct SendGcmRecords {
+    word32 off[2];                          /* record header of each record */
+    word16 sz[2];                           /* plaintext size of each record */
+    byte   nonce[2][AESGCM_NONCE_SZ];
+    byte   cnt;                             /* records waiting */
+    byte   defer;                           /* queue the next record */
+} SendGcmRecords;
+#endif
+
 #ifdef HAVE_ONE_TIME_AUTH
 /* Ciphers for one time authentication such as poly1305 */
 typedef struct OneTimeAuth {
@@ -4523,6 +4729,24 @@ WOLFSSL_LOCAL int wolfSSL_quic_add_transport_extensions(WOLFSSL *ssl, int msg_ty
 
 #endif /* WOLFSSL_QUIC */
 
+#ifdef WOLFSSL_KTLS
+#if !defined(__linux__) || defined(WOLFSSL_NO_SOCK) || \
+    !defined(USE_WOLFSSL_IO)
+    #error WOLFSSL_KTLS requires Linux sockets and the default I/O callbacks
+#endif
+/* Linux kernel TLS offload state */
+typedef struct KtlsState {
+    word32 txSent;          /* plaintext sent before SendData would block */
+    byte   want;            /* WOLFSSL_KTLS_* directions still to offload */
+    byte   rxType;          /* content type of last record received */
+    byte   tx:1;            /* kernel encrypts the records we send */
+    byte   rx:1;            /* kernel decrypts the records we receive */
+    byte   ulp:1;           /* "tls" ULP attached to the socket */
+    byte   txRekey:1;       /* install new send keys once output is flushed */
+    byte   txPending:1;     /* txSent holds progress of an interrupted write */
+} KtlsState;
+#endif /* WOLFSSL_KTLS */
+
 /** Session Ticket - RFC 5077 (session 3.2) */
 #if defined(WOLFSSL_TLS13) && defined(HAVE_SESSION_TICKET) || !defined(NO_PSK)
 /* Ticket nonce - for deriving PSK.
@@ -4961,6 +5185,9 @@ struct Options {
                                            or psk */
     word16            weOwnRng:1;         /* will be true unless CTX owns */
     word16            dontFreeDigest:1;   /* when true, we used SetDigest */
+#ifdef WOLFSSL_CTX_DECODED_KEY
+    word16            hsKeyShared:1;      /* hsKey is the CTX's decodedKey */
+#endif
     word16            haveEMS:1;          /* using extended master secret */
 #ifdef HAVE_POLY1305
     word16            oldPoly:1;        /* set when to use old rfc way of poly*/
@@ -5764,6 +5991,39 @@ typedef struct CIDInfo {
         (ssl)->suites : \
         (ssl)->ctx->suites))
 
+#if defined(WOLFSSL_CTX_PARENT_RNG) && (defined(SINGLE_THREADED) || \
+    !defined(HAVE_HASHDRBG) || defined(HAVE_FIPS) || defined(WC_NO_RNG))
+    #error WOLFSSL_CTX_PARENT_RNG requires threads and a non-FIPS Hash DRBG
+#endif
+
+#if defined(WOLFSSL_CTX_DECODED_KEY) && defined(WOLFSSL_BLIND_PRIVATE_KEY)
+    #error WOLFSSL_CTX_DECODED_KEY keeps the private key unblinded in memory
+#endif
+
+#ifdef WOLFSSL_CRYPT_POOL
+#if defined(SINGLE_THREADED) || !defined(WOLFSSL_COND) || defined(NO_TLS)
+    #error WOLFSSL_CRYPT_POOL requires TLS and threads with condition signaling
+#endif
+#ifndef WOLFSSL_CRYPT_POOL_MAX_THREADS
+    #define WOLFSSL_CRYPT_POOL_MAX_THREADS 256
+#endif
+/* Worker threads that run handshake steps, and their private key operations,
+ * off the caller's thread. */
+struct WOLFSSL_CRYPTPOOL {
+    void*                     heap;
+    THREAD_TYPE*              threads;
+    int                       threadCnt;
+    WOLF_EVENT_QUEUE          events;    /* submitted, polled when done */
+    wolfSSL_Mutex             lock;      /* jobs and stop */
+    COND_TYPE                 cond;      /* signaled on new job or stop */
+    WOLFSSL*                  jobHead;   /* waiting for a worker */
+    WOLFSSL*                  jobTail;
+    WOLFSSL_CRYPT_POOL_SIGNAL signal;    /* called when a job is done */
+    void*                     signalCtx;
+    byte                      stop;
+};
+#endif
+
 /* wolfSSL ssl type */
 struct WOLFSSL {
     WOLFSSL_CTX*    ctx;
@@ -5834,6 +6094,10 @@ struct WOLFSSL {
     /* Message building context should be stored here for functions that expect
      * to encounter encryption blocking or fragment the message. */
     struct WOLFSSL_ASYNC* async;
+#endif
+#ifdef WOLFSSL_CRYPT_POOL
+    WOLF_EVENT      poolEvent;          /* completion of pool submission */
+    WOLFSSL*        poolNext;           /* next job waiting in the pool */
 #endif
     void*           hsKey;              /* Handshake key (RsaKey or ecc_key)
                                          * allocated from heap */
@@ -5849,6 +6113,9 @@ struct WOLFSSL {
 #endif
     Ciphers         encrypt;
     Ciphers         decrypt;
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+    SendGcmRecords  sendGcm;
+#endif
     Buffers         buffers;
     WOLFSSL_SESSION* session;
 #ifndef NO_CLIENT_CACHE
@@ -6272,6 +6539,13 @@ struct WOLFSSL {
                                           * content have not been handled yet by quic */
     } quic;
 #endif /* WOLFSSL_QUIC */
+#ifdef WOLFSSL_KTLS
+    KtlsState ktls;
+#endif
+    DynRecord dynRec;           /* record sizing of application data */
+    word32 readAheadSz;         /* input buffer size to fill, 0 when off */
+    int    readAheadErr;        /* error decrypting read ahead records,
+                                 * reported by the next read */
 #if defined(WOLFSSL_TLS13) && defined(HAVE_ECH)
     WOLFSSL_EchConfig* echConfigs;
 #endif
@@ -6495,6 +6769,10 @@ WOLFSSL_LOCAL int DoClientTicket_ex(const WOLFSSL* ssl, PreSharedKey* psk,
 WOLFSSL_LOCAL int DoClientTicket(WOLFSSL* ssl, const byte* input, word32 len);
 #endif /* HAVE_SESSION_TICKET */
 WOLFSSL_LOCAL int SendData(WOLFSSL* ssl, const void* data, size_t sz);
+#ifdef WOLFSSL_NATIVE_WRITEV
+WOLFSSL_LOCAL int SendDataV(WOLFSSL* ssl, const struct iovec* iov, int iovcnt,
+                            size_t sz);
+#endif
 #ifdef WOLFSSL_THREADED_CRYPT
 WOLFSSL_LOCAL int SendAsyncData(WOLFSSL* ssl);
 #endif
@@ -6516,6 +6794,8 @@ WOLFSSL_LOCAL int SendCertificateStatus(WOLFSSL* ssl);
 WOLFSSL_LOCAL int SendServerKeyExchange(WOLFSSL* ssl);
 WOLFSSL_LOCAL int SendBuffered(WOLFSSL* ssl);
 WOLFSSL_LOCAL int ReceiveData(WOLFSSL* ssl, byte* output, size_t sz, int peek);
+WOLFSSL_LOCAL int ReceiveDataZc(WOLFSSL* ssl, const byte** data, size_t sz);
+WOLFSSL_LOCAL int ReceiveDataRelease(WOLFSSL* ssl, size_t sz);
 WOLFSSL_LOCAL int SendFinished(WOLFSSL* ssl);
 WOLFSSL_LOCAL int RetrySendAlert(WOLFSSL* ssl);
 WOLFSSL_LOCAL int SendAlert(WOLFSSL* ssl, int severity, int type);
@@ -6543,6 +6823,16 @@ WOLFSSL_LOCAL int TLSv1_3_Capable(WOLFSSL* ssl);
 WOLFSSL_LOCAL void FreeHandshakeResources(WOLFSSL* ssl);
 WOLFSSL_LOCAL void ShrinkInputBuffer(WOLFSSL* ssl, int forcedFree);
 WOLFSSL_LOCAL void ShrinkOutputBuffer(WOLFSSL* ssl);
+#ifdef WOLFSSL_IO_POOL
+WOLFSSL_LOCAL word32 IOPoolSize(int c);
+WOLFSSL_LOCAL void IOPoolFree(WOLFSSL_CTX* ctx);
+WOLFSSL_LOCAL void IOPoolDisown(WOLFSSL* ssl);
+#endif
+#if defined(WOLFSSL_EARLY_DATA) && defined(WOLFSSL_EARLY_DATA_ANTI_REPLAY)
+WOLFSSL_LOCAL int  AntiReplayCheck(WOLFSSL* ssl, const byte* key,
+                                   word32 keySz);
+WOLFSSL_LOCAL void AntiReplayFree(WOLFSSL_CTX* ctx);
+#endif
 WOLFSSL_LOCAL byte* GetOutputBuffer(WOLFSSL* ssl);
 
 WOLFSSL_LOCAL int CipherRequires(byte first, byte second, int requirement);
@@ -6916,6 +7206,9 @@ WOLFSSL_TEST_VIS int BuildTls13Message(WOLFSSL* ssl, byte* output, int outSz, co
                int inSz, int type, int hashOutput, int sizeOnly, int asyncOkay);
 WOLFSSL_LOCAL int Tls13UpdateKeys(WOLFSSL* ssl);
 #endif
+#ifdef WOLFSSL_SEND_GCM_RECORDS
+WOLFSSL_LOCAL int Tls13GcmRecordsFlush(WOLFSSL* ssl);
+#endif
 
 WOLFSSL_LOCAL int AllocKey(WOLFSSL* ssl, int type, void** pKey);
 WOLFSSL_LOCAL void FreeKey(WOLFSSL* ssl, int type, void** pKey);
@@ -7121,6 +7414,19 @@ WOLFSSL_LOCAL int wolfSSL_quic_keys_active(WOLFSSL* ssl, enum encrypt_side side)
 #define WOLFSSL_IS_QUIC(s) 0
 #endif /* WOLFSSL_QUIC (else) */
 
+#ifdef WOLFSSL_KTLS
+#define IsKtlsTx(s) ((s)->ktls.tx)
+#define IsKtlsRx(s) ((s)->ktls.rx)
+WOLFSSL_LOCAL void KtlsEnable(WOLFSSL* ssl);
+WOLFSSL_LOCAL int KtlsRekey(WOLFSSL* ssl, int side);
+WOLFSSL_LOCAL int KtlsBuildRecord(WOLFSSL* ssl, byte* output, int outSz,
+                                  const byte* input, int inSz, int type,
+                                  int hashOutput, int sizeOnly);
+#else
+#define IsKtlsTx(s) 0
+#define IsKtlsRx(s) 0
+#endif /* WOLFSSL_KTLS (else) */
+
 #if defined(SHOW_SECRETS) && defined(WOLFSSL_SSLKEYLOGFILE)
 WOLFSSL_LOCAL int tls13ShowSecrets(WOLFSSL* ssl, int id, const unsigned char* secret,
     int secretSz, void* ctx);
@@ -1382,6 +1382,8 @@ WOLFSSL_API int wolfSSL_write_ex(WOLFSSL* ssl, const void* data, size_t sz,
 WOLFSSL_ABI WOLFSSL_API int  wolfSSL_read(WOLFSSL* ssl, void* data, int sz);
 WOLFSSL_API int wolfSSL_read_ex(WOLFSSL* ssl, void* data, size_t sz, size_t* rd);
 WOLFSSL_API int  wolfSSL_peek(WOLFSSL* ssl, void* data, int sz);
+WOLFSSL_API int  wolfSSL_read_zc(WOLFSSL* ssl, const unsigned char** data);
+WOLFSSL_API int  wolfSSL_read_release(WOLFSSL* ssl, int sz);
 WOLFSSL_ABI WOLFSSL_API int  wolfSSL_accept(WOLFSSL* ssl);
 WOLFSSL_API int wolfSSL_inject(WOLFSSL* ssl, const void* data, int sz);
 WOLFSSL_API int  wolfSSL_CTX_mutual_auth(WOLFSSL_CTX* ctx, int req);
@@ -1438,6 +1440,17 @@ WOLFSSL_API int  wolfSSL_write_early_data(WOLFSSL* ssl, const void* data,
 WOLFSSL_API int  wolfSSL_read_early_data(WOLFSSL* ssl, void* data, int sz,
                                          int* outSz);
 WOLFSSL_API int  wolfSSL_get_early_data_status(const WOLFSSL* ssl);
+#ifdef WOLFSSL_EARLY_DATA_ANTI_REPLAY
+/* Returns 0 when key not seen within window seconds, 1 when seen and < 0 on
+ * error. Recording key when not seen is up to the callback. */
+typedef int (*CallbackAntiReplay)(WOLFSSL* ssl, const unsigned char* key,
+                                  unsigned int keySz, unsigned int window,
+                                  void* ctx);
+WOLFSSL_API int  wolfSSL_CTX_set_early_data_antireplay(WOLFSSL_CTX* ctx,
+                                  unsigned int window, unsigned int maxEntries);
+WOLFSSL_API int  wolfSSL_CTX_set_early_data_antireplay_cb(WOLFSSL_CTX* ctx,
+                                  CallbackAntiReplay cb, void* cbCtx);
+#endif
 #ifdef OPENSSL_EXTRA
 WOLFSSL_API unsigned int wolfSSL_SESSION_get_max_early_data(const WOLFSSL_SESSION *s);
 #endif /* OPENSSL_EXTRA */
@@ -3606,6 +3619,44 @@ WOLFSSL_API int wolfSSL_make_eap_keys(WOLFSSL* ssl, void* key, unsigned int len,
     #endif /* !NO_WRITEV */
 #endif /* !_WIN32 */
 
+#ifdef WOLFSSL_KTLS
+    #include <sys/types.h>
+
+    /* directions to hand over to Linux kernel TLS after the handshake */
+    #define WOLFSSL_KTLS_TX 0x1
+    #define WOLFSSL_KTLS_RX 0x2
+
+    WOLFSSL_API int wolfSSL_CTX_UseKTLS(WOLFSSL_CTX* ctx, int dirs);
+    WOLFSSL_API int wolfSSL_UseKTLS(WOLFSSL* ssl, int dirs);
+    WOLFSSL_API int wolfSSL_GetKTLS(WOLFSSL* ssl);
+    WOLFSSL_API int wolfSSL_sendfile(WOLFSSL* ssl, int fd, off_t offset,
+                                     size_t count);
+#endif /* WOLFSSL_KTLS */
+
+/* read as many records as are available with each read from the socket */
+WOLFSSL_API int wolfSSL_CTX_SetReadAheadSz(WOLFSSL_CTX* ctx, unsigned int sz);
+WOLFSSL_API int wolfSSL_SetReadAheadSz(WOLFSSL* ssl, unsigned int sz);
+
+/* send application data in small records until the connection has ramped up */
+WOLFSSL_API int wolfSSL_CTX_SetDynamicRecordSize(WOLFSSL_CTX* ctx,
+    unsigned short smallSz, unsigned int rampSz, unsigned int idleSec);
+WOLFSSL_API int wolfSSL_SetDynamicRecordSize(WOLFSSL* ssl,
+    unsigned short smallSz, unsigned int rampSz, unsigned int idleSec);
+
+/* pool of I/O buffers kept by a context for its connections */
+typedef struct WOLFSSL_IO_POOL_STATS {
+    unsigned long gets;       /* buffers borrowed by connections */
+    unsigned long hits;       /* borrowed buffers that came from the pool */
+    unsigned long inUse;      /* buffers held by connections */
+    size_t        inUseBytes;
+    unsigned long free;       /* buffers kept in the pool */
+    size_t        freeBytes;
+} WOLFSSL_IO_POOL_STATS;
+
+WOLFSSL_API int wolfSSL_CTX_UseIOPool(WOLFSSL_CTX* ctx, unsigned int maxFree);
+WOLFSSL_API int wolfSSL_CTX_GetIOPoolStats(WOLFSSL_CTX* ctx,
+    WOLFSSL_IO_POOL_STATS* stats);
+
 
 #ifndef NO_CERTS
     /* SSL_CTX versions */
@@ -3887,7 +3938,8 @@ enum BulkCipherAlgorithm {
     wolfssl_sm4_cbc     = 11,
     wolfssl_sm4_gcm     = 12,
     wolfssl_sm4_ccm     = 13,
-    wolfssl_aria_gcm    = 14
+    wolfssl_aria_gcm    = 14,
+    wolfssl_ascon_aead  = 15
 };
 
 
@@ -4803,6 +4855,13 @@ WOLFSSL_API int wolfSSL_CTX_set_TicketEncCtx(WOLFSSL_CTX* ctx, void* userCtx);
 WOLFSSL_API void* wolfSSL_CTX_get_TicketEncCtx(WOLFSSL_CTX* ctx);
 WOLFSSL_API size_t wolfSSL_CTX_get_num_tickets(WOLFSSL_CTX* ctx);
 WOLFSSL_API int wolfSSL_CTX_set_num_tickets(WOLFSSL_CTX* ctx, size_t mxTickets);
+#if !defined(WOLFSSL_NO_DEF_TICKET_ENC_CB) && defined(WOLFSSL_TICKET_KEY_RING)
+WOLFSSL_API int wolfSSL_CTX_add_ticket_key(WOLFSSL_CTX* ctx,
+                                           const unsigned char* name,
+                                           const unsigned char* key,
+                                           unsigned int keySz);
+WOLFSSL_API int wolfSSL_CTX_rotate_ticket_key(WOLFSSL_CTX* ctx);
+#endif
 
 #endif /* NO_WOLFSSL_SERVER */
 
@@ -5589,6 +5648,20 @@ WOLFSSL_API int wolfSSL_CTX_AsyncPoll(WOLFSSL_CTX* ctx, WOLF_EVENT** events, int
         }                                                       \
     } while (err == WC_NO_ERR_TRACE(WC_PENDING_E))
 
+#ifdef WOLFSSL_CRYPT_POOL
+typedef struct WOLFSSL_CRYPTPOOL WOLFSSL_CRYPTPOOL;
+typedef void (*WOLFSSL_CRYPT_POOL_SIGNAL)(void* ctx);
+
+WOLFSSL_API WOLFSSL_CRYPTPOOL* wolfSSL_CryptPool_new(void* heap, int threads);
+WOLFSSL_API void wolfSSL_CryptPool_free(WOLFSSL_CRYPTPOOL* pool);
+WOLFSSL_API int wolfSSL_CryptPool_SetSignal(WOLFSSL_CRYPTPOOL* pool,
+    WOLFSSL_CRYPT_POOL_SIGNAL signal, void* ctx);
+WOLFSSL_API int wolfSSL_CryptPool_Submit(WOLFSSL_CRYPTPOOL* pool,
+    WOLFSSL* ssl);
+WOLFSSL_API int wolfSSL_CryptPool_Poll(WOLFSSL_CRYPTPOOL* pool,
+    WOLF_EVENT** events, int maxEvents, int* eventCount);
+#endif /* WOLFSSL_CRYPT_POOL */
+
 typedef void (*Rem_Sess_Cb)(WOLFSSL_CTX*, WOLFSSL_SESSION*);
 
 #ifdef OPENSSL_EXTRA
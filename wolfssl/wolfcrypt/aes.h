@@ -608,6 +608,23 @@ WOLFSSL_API int wc_AesEcbDecrypt(Aes* aes, byte* out,
                                    const byte* iv, word32 ivSz,
                                    const byte* authTag, word32 authTagSz,
                                    const byte* authIn, word32 authInSz);
+
+/* One record to encrypt with wc_AesGcmEncryptRecords(). */
+typedef struct wc_AesGcmRecord {
+    byte*       out;
+    const byte* in;
+    word32      sz;
+    const byte* iv;
+    word32      ivSz;
+    byte*       authTag;
+    word32      authTagSz;
+    const byte* authIn;
+    word32      authInSz;
+} wc_AesGcmRecord;
+
+WOLFSSL_API int wc_AesGcmEncryptRecords(Aes* aes,
+                                        const wc_AesGcmRecord* recs,
+                                        word32 cnt);
 #ifdef WOLFSSL_AESGCM_STREAM
 WOLFSSL_API int wc_AesGcmInit(Aes* aes, const byte* key, word32 len,
         const byte* iv, word32 ivSz);
@@ -37,6 +37,10 @@ extern "C" {
 #define ASCON_AEAD128_NONCE_SZ                         16
 #define ASCON_AEAD128_TAG_SZ                           16
 
+/* Maximum number of Ascon-XOF128 objects processed together by the multi-lane
+ * API. */
+#define ASCON_XOF128_MAX_LANES                          8
+
 
 typedef union AsconState {
 #ifdef WORD64_AVAILABLE
@@ -76,8 +80,21 @@ typedef struct wc_AsconAEAD128 {
     byte nonceSet:1; /* has the nonce been processed */
     byte adSet:1;    /* has the associated data been processed */
     byte op:2;       /* 0 for not set, 1 for encrypt, 2 for decrypt */
+    byte keyKeep:1;  /* key kept after final - see wc_AsconAEAD128_InitKey */
 } wc_AsconAEAD128;
 
+/* One message of a batch operation. */
+typedef struct wc_AsconAEAD128_Msg {
+    const byte* nonce; /* ASCON_AEAD128_NONCE_SZ bytes */
+    const byte* ad;
+    word32 adSz;
+    const byte* in;
+    word32 inSz;
+    byte* out;         /* inSz bytes - may be the same as in */
+    byte* tag;         /* output on encrypt, input on decrypt */
+    int ret;           /* result of operation on this message */
+} wc_AsconAEAD128_Msg;
+
 /* AsconHash API */
 
 WOLFSSL_API wc_AsconHash256* wc_AsconHash256_New(void);
@@ -100,6 +117,35 @@ WOLFSSL_API int wc_AsconXof128_Absorb(wc_AsconXof128* a, const byte* data,
 WOLFSSL_API int wc_AsconXof128_Squeeze(wc_AsconXof128* a, byte* out,
                                         word32 outSz);
 
+/* Multi-lane AsconXof API - independent objects processed together */
+
+WOLFSSL_API int wc_AsconXof128_AbsorbX(wc_AsconXof128** a, int lanes,
+                                       const byte* const* data, word32 dataSz);
+WOLFSSL_API int wc_AsconXof128_SqueezeX(wc_AsconXof128** a, int lanes,
+                                        byte* const* out, word32 outSz);
+WOLFSSL_API int wc_AsconXof128_SqueezeX4(wc_AsconXof128** a,
+                                         byte* const* out, word32 outSz);
+WOLFSSL_API int wc_AsconXof128_SqueezeX8(wc_AsconXof128** a,
+                                         byte* const* out, word32 outSz);
+
+#ifdef WOLFSSL_ASCON_PERM_COUNT
+/* Number of permutations computed by the calling thread - for profiling. */
+WOLFSSL_API word64 wc_Ascon_PermutationCount(void);
+#endif
+
+#if defined(USE_INTEL_SPEEDUP) && defined(WOLFSSL_X86_64_BUILD) && \
+    !defined(WOLFSSL_NO_ASM) && !defined(WOLFSSL_ASCON_NO_ASM)
+    #define WOLFSSL_ASCON_X86_64_ASM
+
+    /* Scalar permutation using BMI1 andn and BMI2 rorx. start is the index
+     * of the first round constant: 0 for p12 and 4 for p8. */
+    WOLFSSL_LOCAL void ascon_permute_bmi2(word64* s, word32 start);
+    /* State is five words per lane, interleaved: word i of lane j is at
+     * s[i * lanes + j]. start is the index of the first round constant. */
+    WOLFSSL_LOCAL void ascon_permute_x4_avx2(word64* s, word32 start);
+    WOLFSSL_LOCAL void ascon_permute_x8_avx512(word64* s, word32 start);
+#endif
+
 
 /* AsconAEAD API */
 WOLFSSL_API wc_AsconAEAD128* wc_AsconAEAD128_New(void);
@@ -121,6 +167,26 @@ WOLFSSL_API int wc_AsconAEAD128_DecryptUpdate(wc_AsconAEAD128* a, byte* out,
 WOLFSSL_API int wc_AsconAEAD128_DecryptFinal(wc_AsconAEAD128* a,
                                              const byte* tag);
 
+/* One-shot AsconAEAD API - out may be the same buffer as in */
+WOLFSSL_API int wc_AsconAEAD128_Encrypt(const byte* key, const byte* nonce,
+                                        const byte* ad, word32 adSz,
+                                        const byte* in, word32 inSz,
+                                        byte* out, byte* tag);
+WOLFSSL_API int wc_AsconAEAD128_Decrypt(const byte* key, const byte* nonce,
+                                        const byte* ad, word32 adSz,
+                                        const byte* in, word32 inSz,
+                                        byte* out, const byte* tag);
+
+/* Keyed AsconAEAD API - key loaded once, reset with a nonce per message */
+WOLFSSL_API int wc_AsconAEAD128_InitKey(wc_AsconAEAD128* a, const byte* key);
+WOLFSSL_API int wc_AsconAEAD128_Reset(wc_AsconAEAD128* a, const byte* nonce);
+WOLFSSL_API int wc_AsconAEAD128_EncryptBatch(wc_AsconAEAD128* a,
+                                             wc_AsconAEAD128_Msg* msgs,
+                                             word32 cnt);
+WOLFSSL_API int wc_AsconAEAD128_DecryptBatch(wc_AsconAEAD128* a,
+                                             wc_AsconAEAD128_Msg* msgs,
+                                             word32 cnt);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
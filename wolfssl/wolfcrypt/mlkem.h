@@ -302,12 +302,23 @@ enum {
 
     /* Encoded polynomial size. */
     WC_ML_KEM_POLY_SIZE         = 384,
+
+    /* Alignment in bytes of scratch memory passed to _ex operations. */
+    WC_ML_KEM_SCRATCH_ALIGN     = 16,
 };
 
 
 /* Different structures for different implementations. */
 typedef struct MlKemKey MlKemKey;
 
+/* Task run by a worker: generates the part of the work indexed by idx. */
+typedef void (*wc_MlKemTask)(void* arg, int idx);
+/* Application parallel-for: call task(arg, idx) for each idx in 0..cnt-1, on
+ * any threads, and return once all calls have completed. Return 0 on success.
+ */
+typedef int (*wc_MlKemParallelCb)(void* ctx, wc_MlKemTask task, void* arg,
+    int cnt);
+
 
 #ifdef __cplusplus
     extern "C" {
@@ -326,6 +337,7 @@ WOLFSSL_API int wc_MlKemKey_MakeKeyWithRandom(MlKemKey* key,
 
 WOLFSSL_API int wc_MlKemKey_CipherTextSize(MlKemKey* key, word32* len);
 WOLFSSL_API int wc_MlKemKey_SharedSecretSize(MlKemKey* key, word32* len);
+WOLFSSL_API int wc_MlKemKey_ScratchSize(MlKemKey* key, word32* len);
 
 WOLFSSL_API int wc_MlKemKey_Encapsulate(MlKemKey* key, unsigned char* ct,
     unsigned char* ss, WC_RNG* rng);
@@ -334,6 +346,29 @@ WOLFSSL_API int wc_MlKemKey_EncapsulateWithRandom(MlKemKey* key,
 WOLFSSL_API int wc_MlKemKey_Decapsulate(MlKemKey* key, unsigned char* ss,
     const unsigned char* ct, word32 len);
 
+WOLFSSL_API int wc_MlKemKey_MakeKey_ex(MlKemKey* key, WC_RNG* rng,
+    void* scratch, word32 scratchSz);
+WOLFSSL_API int wc_MlKemKey_MakeKeyWithRandom_ex(MlKemKey* key,
+    const unsigned char* rand, int len, void* scratch, word32 scratchSz);
+WOLFSSL_API int wc_MlKemKey_Encapsulate_ex(MlKemKey* key, unsigned char* ct,
+    unsigned char* ss, WC_RNG* rng, void* scratch, word32 scratchSz);
+WOLFSSL_API int wc_MlKemKey_EncapsulateWithRandom_ex(MlKemKey* key,
+    unsigned char* ct, unsigned char* ss, const unsigned char* rand, int len,
+    void* scratch, word32 scratchSz);
+WOLFSSL_API int wc_MlKemKey_Decapsulate_ex(MlKemKey* key, unsigned char* ss,
+    const unsigned char* ct, word32 len, void* scratch, word32 scratchSz);
+
+WOLFSSL_API int wc_MlKemKey_SetMatrixCache(MlKemKey* key, int enable);
+WOLFSSL_API int wc_MlKemKey_SetParallelCb(MlKemKey* key, wc_MlKemParallelCb cb,
+    void* ctx);
+
+WOLFSSL_API int wc_MlKemKey_MakeKeyBatch(MlKemKey** keys, int cnt,
+    WC_RNG* rng);
+WOLFSSL_API int wc_MlKemKey_EncapsulateBatch(MlKemKey** keys,
+    unsigned char** ct, unsigned char** ss, int cnt, WC_RNG* rng);
+WOLFSSL_API int wc_MlKemKey_DecapsulateBatch(MlKemKey** keys,
+    unsigned char** ss, const unsigned char* const* ct, word32 len, int cnt);
+
 WOLFSSL_API int wc_MlKemKey_DecodePrivateKey(MlKemKey* key,
     const unsigned char* in, word32 len);
 WOLFSSL_API int wc_MlKemKey_DecodePublicKey(MlKemKey* key,
@@ -192,6 +192,9 @@ struct WC_RNG {
     struct DRBG_internal drbg_data;
 #endif
     byte status;
+#ifdef WC_RNG_CTR_DRBG
+    byte drbgType; /* Hash_DRBG or CTR_DRBG mechanism */
+#endif
 #endif
 #if defined(HAVE_GETPID) && !defined(WOLFSSL_NO_GETPID)
     pid_t pid;
@@ -235,6 +238,13 @@ WOLFSSL_API int  wc_InitRng_ex(WC_RNG* rng, void* heap, int devId);
 WOLFSSL_API int  wc_InitRngNonce(WC_RNG* rng, byte* nonce, word32 nonceSz);
 WOLFSSL_API int  wc_InitRngNonce_ex(WC_RNG* rng, byte* nonce, word32 nonceSz,
                                     void* heap, int devId);
+#ifdef HAVE_HASHDRBG
+WOLFSSL_API int  wc_InitRngChild_ex(WC_RNG* rng, WC_RNG* parent, void* heap,
+                                    int devId);
+#endif
+#ifdef WC_RNG_CTR_DRBG
+WOLFSSL_API int  wc_InitRngCtrDrbg_ex(WC_RNG* rng, void* heap, int devId);
+#endif
 WOLFSSL_ABI WOLFSSL_API int wc_RNG_GenerateBlock(WC_RNG* rng, byte* output, word32 sz);
 WOLFSSL_API int  wc_RNG_GenerateByte(WC_RNG* rng, byte* b);
 WOLFSSL_API int  wc_FreeRng(WC_RNG* rng);
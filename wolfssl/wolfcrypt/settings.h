@@ -3403,6 +3403,12 @@ extern void uITRON4_free(void *p) ;
     #endif /* HAVE_ECC && HAVE_ECC_SIGN */
 
 #endif /* WOLFSSL_ASYNC_CRYPT */
+#ifdef WOLFSSL_CRYPT_POOL
+    /* Crypto worker pool completions are reported through a wolf event
+     * queue */
+    #undef HAVE_WOLF_EVENT
+    #define HAVE_WOLF_EVENT
+#endif
 #ifndef WC_ASYNC_DEV_SIZE
     #define WC_ASYNC_DEV_SIZE 0
 #endif
@@ -4294,6 +4300,11 @@ extern void uITRON4_free(void *p) ;
 #endif
 #endif
 
+/* Profiling ML-KEM reports the Ascon permutations of each operation. */
+#if defined(WOLFSSL_MLKEM_PROFILE) && !defined(WOLFSSL_ASCON_PERM_COUNT)
+    #define WOLFSSL_ASCON_PERM_COUNT
+#endif
+
 #if (defined(HAVE_LIBOQS) ||                                            \
      defined(HAVE_LIBXMSS) ||                                           \
      defined(HAVE_LIBLMS) ||                                            \
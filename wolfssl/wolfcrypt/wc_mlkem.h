@@ -45,6 +45,22 @@
     #define WOLFSSL_MLKEM_NO_DECAPSULATE
 #endif
 
+#if !defined(WOLFSSL_NO_MALLOC) && \
+    !defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM) && \
+    !defined(WOLFSSL_MLKEM_NO_CACHE_AT) && \
+    (!defined(WOLFSSL_MLKEM_NO_ENCAPSULATE) || \
+     !defined(WOLFSSL_MLKEM_NO_DECAPSULATE))
+    /* Keys can keep the transposed matrix A for repeated encapsulation. */
+    #define WOLFSSL_MLKEM_CACHE_AT
+#endif
+
+#if (!defined(WOLFSSL_MLKEM_MAKEKEY_SMALL_MEM) || \
+     !defined(WOLFSSL_MLKEM_ENCAPSULATE_SMALL_MEM)) && \
+    !defined(WOLFSSL_MLKEM_NO_PARALLEL)
+    /* Rows of matrix A can be generated on application worker threads. */
+    #define WOLFSSL_MLKEM_PARALLEL
+#endif
+
 #ifdef noinline
     #define MLKEM_NOINLINE noinline
 #elif defined(_MSC_VER)
@@ -62,6 +78,7 @@ enum {
     MLKEM_FLAG_BOTH_SET = 0x0003,
     MLKEM_FLAG_H_SET    = 0x0004,
     MLKEM_FLAG_A_SET    = 0x0008,
+    MLKEM_FLAG_AT_SET   = 0x0010,
 
     /* 2 bits of random used to create noise value. */
     MLKEM_CBD_ETA2      = 2,
@@ -142,12 +159,59 @@ struct MlKemKey {
     /* A matrix from key generation. */
     sword16 a[WC_ML_KEM_MAX_K * WC_ML_KEM_MAX_K * MLKEM_N];
 #endif
+#ifdef WOLFSSL_MLKEM_CACHE_AT
+    /* Transposed A matrix expanded from public seed - dynamically allocated
+     * when caching is on. */
+    sword16* at;
+    /* Keep transposed A matrix for encapsulations. */
+    byte cacheAt:1;
+#endif
+#ifdef WOLFSSL_MLKEM_PARALLEL
+    /* Application callback that runs matrix generation tasks in parallel. */
+    wc_MlKemParallelCb parallelCb;
+    /* Context passed to parallel callback. */
+    void* parallelCtx;
+#endif
 };
 
+#ifdef WOLFSSL_MLKEM_PROFILE
+/* Phases of ML-KEM operations that are timed when profiling. */
+enum {
+    /* Expanding matrix A from the public seed. */
+    WC_MLKEM_PHASE_MATRIX   = 0,
+    /* Sampling noise polynomials with the PRF. */
+    WC_MLKEM_PHASE_NOISE    = 1,
+    /* NTT, inverse NTT and polynomial arithmetic. */
+    WC_MLKEM_PHASE_NTT      = 2,
+    /* Compression, decompression and message encoding. */
+    WC_MLKEM_PHASE_COMPRESS = 3,
+
+    /* Number of phases timed. */
+    WC_MLKEM_PHASE_CNT      = 4
+};
+
+/* Clock used to time phases - e.g. a CPU cycle counter. */
+typedef word64 (*wc_MlKemProfileClock)(void);
+
+/* Totals accumulated by the calling thread since the last reset. */
+typedef struct wc_MlKemProfile {
+    /* Clock ticks spent in each phase. */
+    word64 ticks[WC_MLKEM_PHASE_CNT];
+    /* Number of Ascon permutations computed. */
+    word64 perms;
+} wc_MlKemProfile;
+#endif
+
 #ifdef __cplusplus
     extern "C" {
 #endif
 
+#ifdef WOLFSSL_MLKEM_PROFILE
+WOLFSSL_API void wc_MlKemProfile_SetClock(wc_MlKemProfileClock clk);
+WOLFSSL_API void wc_MlKemProfile_Reset(void);
+WOLFSSL_API int wc_MlKemProfile_Get(wc_MlKemProfile* prof);
+#endif
+
 WOLFSSL_LOCAL
 void mlkem_init(void);
 
@@ -178,6 +242,14 @@ void mlkem_decapsulate(const sword16* priv, sword16* mp, sword16* bp,
 WOLFSSL_LOCAL
 int mlkem_gen_matrix(MLKEM_PRF_T* prf, sword16* a, int kp, byte* seed,
     int transposed);
+#ifdef WOLFSSL_MLKEM_PARALLEL
+WOLFSSL_LOCAL
+int mlkem_gen_matrix_row(sword16* a, int kp, byte* seed, int i,
+    int transposed);
+#endif
+WOLFSSL_LOCAL
+int mlkem_gen_matrix_batch(MLKEM_PRF_T* prf, sword16** a, int kp, byte** seed,
+    int transposed, int cnt);
 WOLFSSL_LOCAL
 int mlkem_get_noise(MLKEM_PRF_T* prf, int kp, sword16* vec1, sword16* vec2,
     sword16* poly, byte* seed);
@@ -210,9 +282,6 @@ int mlkem_prf_new(MLKEM_PRF_T* prf, void* heap, int devId);
 WOLFSSL_LOCAL
 void mlkem_prf_free(MLKEM_PRF_T* prf);
 
-WOLFSSL_LOCAL
-int mlkem_kdf(const byte* seed, int seedLen, byte* out, int outLen);
-
 WOLFSSL_LOCAL
 int mlkem_cmp(const byte* a, const byte* b, int sz);
 
@@ -41,6 +41,9 @@ typedef enum WOLF_EVENT_TYPE {
     WOLF_EVENT_TYPE_ASYNC_FIRST = WOLF_EVENT_TYPE_ASYNC_WOLFSSL,
     WOLF_EVENT_TYPE_ASYNC_LAST = WOLF_EVENT_TYPE_ASYNC_WOLFCRYPT,
 #endif /* WOLFSSL_ASYNC_CRYPT */
+#ifdef WOLFSSL_CRYPT_POOL
+    WOLF_EVENT_TYPE_CRYPT_POOL,       /* context is WOLFSSL* */
+#endif
 } WOLF_EVENT_TYPE;
 
 typedef enum WOLF_EVENT_STATE {
@@ -629,6 +629,39 @@ WOLFSSL_LOCAL int SslBioReceive(WOLFSSL* ssl, char* buf, int sz, void* ctx);
     WOLFSSL_API int EmbedReceive(WOLFSSL* ssl, char* buf, int sz, void* ctx);
     WOLFSSL_API int EmbedSend(WOLFSSL* ssl, char* buf, int sz, void* ctx);
 
+    #ifdef WOLFSSL_KTLS
+        WOLFSSL_LOCAL int wolfIO_KtlsAttach(SOCKET_T sd);
+        WOLFSSL_LOCAL int wolfIO_KtlsRekeySupported(void);
+        WOLFSSL_LOCAL int wolfIO_KtlsSetKey(SOCKET_T sd, int rx, int tls13,
+            byte bulkAlg, const byte* key, word16 keySz, const byte* iv,
+            const byte* seq);
+        WOLFSSL_LOCAL int wolfIO_KtlsSend(SOCKET_T sd, byte type,
+            const byte* buf, int sz, int wrFlags, int more);
+        WOLFSSL_LOCAL int wolfIO_KtlsRecv(SOCKET_T sd, byte* type, byte* buf,
+            int sz, int rdFlags);
+        WOLFSSL_LOCAL int wolfIO_KtlsSendfile(SOCKET_T sd, int fd,
+            off_t* offset, size_t count);
+    #endif /* WOLFSSL_KTLS */
+
+    #ifdef WOLFSSL_IO_URING
+        /* Linux io_uring serving the I/O of many connections */
+        typedef struct WOLFSSL_URING WOLFSSL_URING;
+
+        WOLFSSL_API WOLFSSL_URING* wolfSSL_IoUring_new(void* heap,
+            unsigned int maxConns, unsigned int bufSz);
+        WOLFSSL_API void wolfSSL_IoUring_free(WOLFSSL_URING* ring);
+        WOLFSSL_API int wolfSSL_IoUring_Attach(WOLFSSL_URING* ring,
+            WOLFSSL* ssl, SOCKET_T sd);
+        WOLFSSL_API int wolfSSL_IoUring_Detach(WOLFSSL_URING* ring,
+            WOLFSSL* ssl);
+        WOLFSSL_API int wolfSSL_IoUring_Pending(WOLFSSL_URING* ring,
+            WOLFSSL* ssl);
+        WOLFSSL_API int wolfSSL_IoUring_Submit(WOLFSSL_URING* ring);
+        WOLFSSL_API int wolfSSL_IoUring_Wait(WOLFSSL_URING* ring,
+            WOLFSSL** ready, int maxReady, int timeoutMs);
+        WOLFSSL_LOCAL void wolfIO_IoUringFree(WOLFSSL* ssl);
+    #endif /* WOLFSSL_IO_URING */
+
     #ifdef WOLFSSL_DTLS
         #ifdef NUCLEUS_PLUS_2_3
             #define SELECT_FUNCTION nucyassl_select